@@ -723,18 +723,18 @@ private:
 };
 
 
-#if GKO_HAVE_METIS
-
-
 class ReorderNestedDissectionOperation : public BenchmarkOperation {
     using factory_type =
         gko::experimental::reorder::NestedDissection<etype, itype>;
     using reorder_type = gko::matrix::Permutation<itype>;
 
 public:
-    explicit ReorderNestedDissectionOperation(const Mtx* mtx)
+    explicit ReorderNestedDissectionOperation(
+        const Mtx* mtx, gko::experimental::reorder::nd_algorithm algorithm)
         : mtx_{mtx->clone()},
-          factory_{factory_type::build().on(mtx->get_executor())}
+          factory_{factory_type::build()
+                       .with_algorithm(algorithm)
+                       .on(mtx->get_executor())}
     {}
 
     std::pair<bool, double> validate() const override
@@ -758,17 +758,17 @@ private:
 };
 
 
-#endif
-
-
 class ReorderApproxMinDegOperation : public BenchmarkOperation {
     using factory_type = gko::experimental::reorder::Amd<itype>;
     using reorder_type = gko::matrix::Permutation<itype>;
 
 public:
-    explicit ReorderApproxMinDegOperation(const Mtx* mtx)
+    explicit ReorderApproxMinDegOperation(
+        const Mtx* mtx, gko::experimental::reorder::amd_algorithm algorithm)
         : mtx_{mtx->clone()},
-          factory_{factory_type::build().on(mtx->get_executor())}
+          factory_{factory_type::build()
+                       .with_algorithm(algorithm)
+                       .on(mtx->get_executor())}
     {}
 
     std::pair<bool, double> validate() const override
@@ -837,15 +837,23 @@ const std::map<std::string,
          }},
         {"reorder_amd",
          [](const Mtx* mtx) {
-             return std::make_unique<ReorderApproxMinDegOperation>(mtx);
+             return std::make_unique<ReorderApproxMinDegOperation>(
+                 mtx, gko::experimental::reorder::amd_algorithm::suitesparse);
+         }},
+        {"reorder_amd_parallel",
+         [](const Mtx* mtx) {
+             return std::make_unique<ReorderApproxMinDegOperation>(
+                 mtx, gko::experimental::reorder::amd_algorithm::parallel);
          }},
         {"reorder_nd",
-         [](const Mtx* mtx) -> std::unique_ptr<BenchmarkOperation> {
-#if GKO_HAVE_METIS
-             return std::make_unique<ReorderNestedDissectionOperation>(mtx);
-#else
-             GKO_NOT_COMPILED(METIS);
-#endif
+         [](const Mtx* mtx) {
+             return std::make_unique<ReorderNestedDissectionOperation>(
+                 mtx, gko::experimental::reorder::nd_algorithm::metis);
+         }},
+        {"reorder_nd_native",
+         [](const Mtx* mtx) {
+             return std::make_unique<ReorderNestedDissectionOperation>(
+                 mtx, gko::experimental::reorder::nd_algorithm::native);
          }}};
 
 
@@ -35,10 +35,7 @@ const char* operations_string =
     "spgemm, spgeam, transpose, sort, is_sorted, generate_lookup, "
     "lookup, symbolic_lu, symbolic_lu_near_symm, symbolic_cholesky, "
     "symbolic_cholesky_symmetric, reorder_rcm, "
-#if GKO_HAVE_METIS
-    "reorder_nd, "
-#endif
-    "reorder_amd";
+    "reorder_nd, reorder_nd_native, reorder_amd, reorder_amd_parallel";
 
 DEFINE_string(operations, "spgemm,spgeam,transpose", operations_string);
 
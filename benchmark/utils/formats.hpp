@@ -28,7 +28,7 @@ std::string available_format =
     "coo, csr, ell, ell_mixed, sellp, hybrid, hybrid0, hybrid25, hybrid33, "
     "hybrid40, "
     "hybrid60, hybrid80, hybridlimit0, hybridlimit25, hybridlimit33, "
-    "hybridminstorage"
+    "hybridminstorage, symmetric_csr"
 #ifdef HAS_CUDA
     ", cusparse_csr, cusparse_csrex, cusparse_coo"
     ", cusparse_csrmp, cusparse_csrmm, cusparse_ell, cusparse_hybrid"
@@ -66,7 +66,9 @@ std::string format_description =
     "hybridlimit0, hybridlimit25, hybrid33: Similar to hybrid0\n"
     "    but with an additional absolute limit on the number of entries\n"
     "    per row stored in ELL.\n"
-    "hybridminstorage: Use the minimal storage to store the matrix."
+    "hybridminstorage: Use the minimal storage to store the matrix.\n"
+    "symmetric_csr: CSR storage of only the upper triangle and diagonal of a\n"
+    "     symmetric matrix, the lower triangle of the input is ignored."
 #ifdef HAS_CUDA
     "\n"
     "cusparse_coo: cuSPARSE COO SpMV, using cusparseXhybmv with \n"
@@ -135,29 +137,6 @@ using ell = gko::matrix::Ell<etype, itype>;
 using ell_mixed = gko::matrix::Ell<gko::next_precision<etype>, itype>;
 
 
-/**
- * Creates a CSR strategy of the given type for the given executor if possible,
- * falls back to csr::classical for executors without support for this strategy.
- *
- * @tparam Strategy  one of csr::automatical or csr::load_balance
- */
-template <typename Strategy>
-std::shared_ptr<csr::strategy_type> create_gpu_strategy(
-    std::shared_ptr<const gko::Executor> exec)
-{
-    if (auto cuda = dynamic_cast<const gko::CudaExecutor*>(exec.get())) {
-        return std::make_shared<Strategy>(cuda->shared_from_this());
-    } else if (auto hip = dynamic_cast<const gko::HipExecutor*>(exec.get())) {
-        return std::make_shared<Strategy>(hip->shared_from_this());
-    } else if (auto dpcpp =
-                   dynamic_cast<const gko::DpcppExecutor*>(exec.get())) {
-        return std::make_shared<Strategy>(dpcpp->shared_from_this());
-    } else {
-        return std::make_shared<csr::classical>();
-    }
-}
-
-
 /**
  * Checks whether the given matrix data exceeds the ELL imbalance limit set by
  * the --ell_imbalance_limit flag
@@ -192,27 +171,31 @@ auto create_matrix_type(Args&&... args)
 }
 
 
-template <typename MatrixType, typename Strategy>
-auto create_matrix_type_with_gpu_strategy()
+using matrix_type_factory_map =
+    std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
+                              std::shared_ptr<const gko::Executor>)>>;
+
+
+/**
+ * Adds the Ginkgo formats known to gko::matrix::SpmvAutotuner to the given
+ * formats, so both use a single table of format names.
+ */
+matrix_type_factory_map add_ginkgo_formats(matrix_type_factory_map factory)
 {
-    return [&](std::shared_ptr<const gko::Executor> exec)
-               -> std::unique_ptr<MatrixType> {
-        return MatrixType::create(exec, create_gpu_strategy<Strategy>(exec));
-    };
+    using autotuner = gko::matrix::SpmvAutotuner<etype, itype>;
+    for (const auto& format : autotuner::get_formats()) {
+        factory.emplace(format,
+                        [format](std::shared_ptr<const gko::Executor> exec) {
+                            return autotuner::create_format(std::move(exec),
+                                                            format);
+                        });
+    }
+    return factory;
 }
 
 
 // clang-format off
-const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
-                                std::shared_ptr<const gko::Executor>)>>
-    matrix_type_factory{
-        {"csr", create_matrix_type_with_gpu_strategy<csr, csr::automatical>()},
-        {"csri", create_matrix_type_with_gpu_strategy<csr, csr::load_balance>()},
-        {"csrm", create_matrix_type<csr>(std::make_shared<csr::merge_path>())},
-        {"csrc", create_matrix_type<csr>(std::make_shared<csr::classical>())},
-        {"csrs", create_matrix_type<csr>(std::make_shared<csr::sparselib>())},
-        {"coo", create_matrix_type<coo>()},
-        {"ell", create_matrix_type<ell>()},
+const matrix_type_factory_map matrix_type_factory = add_ginkgo_formats({
         {"ell_mixed", create_matrix_type<ell_mixed>()},
 #ifdef HAS_CUDA
         {"cusparse_csr", create_sparselib_linop<cusparse_csr>},
@@ -239,32 +222,9 @@ const std::map<std::string, std::function<std::unique_ptr<gko::LinOp>(
         {"onemkl_csr", create_sparselib_linop<onemkl_csr>},
         {"onemkl_optimized_csr", create_sparselib_linop<onemkl_optimized_csr>},
 #endif  // HAS_DPCPP
-        {"hybrid", create_matrix_type<hybrid>()},
-        {"hybrid0",create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_limit>(0))},
-        {"hybrid25",create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_limit>(0.25))},
-        {"hybrid33",
-         create_matrix_type<hybrid>(
-                     std::make_shared<hybrid::imbalance_limit>(1.0 / 3.0))},
-        {"hybrid40",
-         create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_limit>(0.4))},
-        {"hybrid60",
-         create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_limit>(0.6))},
-        {"hybrid80",
-         create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_limit>(0.8))},
-        {"hybridlimit0",
-         create_matrix_type<hybrid>(
-                     std::make_shared<hybrid::imbalance_bounded_limit>(0))},
-        {"hybridlimit25",
-         create_matrix_type<hybrid>(
-                     std::make_shared<hybrid::imbalance_bounded_limit>(0.25))},
-        {"hybridlimit33",
-         create_matrix_type<hybrid>( std::make_shared<hybrid::imbalance_bounded_limit>(
-                                 1.0 / 3.0))},
-        {"hybridminstorage",
-         create_matrix_type<hybrid>(
-                     std::make_shared<hybrid::minimal_storage_limit>())},
-        {"sellp", create_matrix_type<gko::matrix::Sellp<etype, itype>>()}
-};
+        {"symmetric_csr",
+         create_matrix_type<gko::matrix::SymmetricCsr<etype, itype>>()}
+});
 // clang-format on
 
 
@@ -6,6 +6,7 @@
 
 
 #include "common/unified/base/kernel_launch.hpp"
+#include "core/base/extended_float.hpp"
 
 
 namespace gko {
@@ -25,6 +26,8 @@ void convert_precision(std::shared_ptr<const DefaultExecutor> exec,
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_CONVERSION(GKO_DECLARE_CONVERT_PRECISION_KERNEL);
+GKO_INSTANTIATE_FOR_EACH_REDUCED_STORAGE_CONVERSION(
+    GKO_DECLARE_CONVERT_PRECISION_KERNEL);
 
 
 }  // namespace components
@@ -28,6 +28,27 @@ void initialize(std::shared_ptr<const DefaultExecutor> exec,
 }
 
 
+template <typename CorrectionType, typename ValueType>
+void add_correction(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Dense<ValueType>* alpha,
+                    const matrix::Dense<CorrectionType>* correction,
+                    matrix::Dense<ValueType>* x)
+{
+    run_kernel(
+        exec,
+        [] GKO_KERNEL(auto row, auto col, auto alpha, auto correction,
+                      auto x) {
+            using value_type = device_type<ValueType>;
+            x(row, col) +=
+                alpha[0] * static_cast<value_type>(correction(row, col));
+        },
+        x->get_size(), alpha->get_const_values(), correction, x);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_CONVERSION_OR_COPY(
+    GKO_DECLARE_IR_ADD_CORRECTION_KERNEL);
+
+
 }  // namespace ir
 }  // namespace GKO_DEVICE_NAMESPACE
 }  // namespace kernels
@@ -23,6 +23,7 @@ GKO_REGISTER_OPERATION(soa_to_aos, components::soa_to_aos);
 GKO_REGISTER_OPERATION(remove_zeros, components::remove_zeros);
 GKO_REGISTER_OPERATION(sum_duplicates, components::sum_duplicates);
 GKO_REGISTER_OPERATION(sort_row_major, components::sort_row_major);
+GKO_REGISTER_OPERATION(sort_sum_duplicates, components::sort_sum_duplicates);
 
 
 }  // anonymous namespace
@@ -113,9 +114,16 @@ void device_matrix_data<ValueType, IndexType>::remove_zeros()
 template <typename ValueType, typename IndexType>
 void device_matrix_data<ValueType, IndexType>::sum_duplicates()
 {
-    this->sort_row_major();
-    this->values_.get_executor()->run(components::make_sum_duplicates(
-        this->size_[0], this->values_, this->row_idxs_, this->col_idxs_));
+    this->values_.get_executor()->run(components::make_sort_sum_duplicates(
+        this->size_, this->values_, this->row_idxs_, this->col_idxs_, false));
+}
+
+
+template <typename ValueType, typename IndexType>
+void device_matrix_data<ValueType, IndexType>::sum_duplicates_and_remove_zeros()
+{
+    this->values_.get_executor()->run(components::make_sort_sum_duplicates(
+        this->size_, this->values_, this->row_idxs_, this->col_idxs_, true));
 }
 
 
@@ -51,6 +51,13 @@ namespace kernels {
     void sort_row_major(std::shared_ptr<const DefaultExecutor> exec,    \
                         device_matrix_data<ValueType, IndexType>& data)
 
+#define GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_SUM_DUPLICATES_KERNEL(ValueType, \
+                                                                  IndexType) \
+    void sort_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,    \
+                             const dim<2>& size, array<ValueType>& values,   \
+                             array<IndexType>& row_idxs,                     \
+                             array<IndexType>& col_idxs, bool filter_zeros)
+
 
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                          \
     template <typename ValueType, typename IndexType>                         \
@@ -63,7 +70,11 @@ namespace kernels {
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL(ValueType,           \
                                                          IndexType);          \
     template <typename ValueType, typename IndexType>                         \
-    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL(ValueType, IndexType)
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL(ValueType,           \
+                                                         IndexType);          \
+    template <typename ValueType, typename IndexType>                         \
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_SUM_DUPLICATES_KERNEL(ValueType,      \
+                                                              IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(components,
@@ -73,6 +73,15 @@ struct basic_float_traits<float16> {
     static constexpr bool rounds_to_nearest = true;
 };
 
+template <>
+struct basic_float_traits<bfloat16> {
+    using type = bfloat16;
+    static constexpr int sign_bits = 1;
+    static constexpr int significand_bits = 7;
+    static constexpr int exponent_bits = 8;
+    static constexpr bool rounds_to_nearest = true;
+};
+
 template <>
 struct basic_float_traits<float32> {
     using type = float32;
@@ -367,6 +376,76 @@ private:
 };
 
 
+/**
+ * A class providing basic support for the bfloat16 floating point format.
+ *
+ * bfloat16 keeps the exponent range of single precision, but only stores the
+ * upper 7 bits of its significand. Like half, it only provides reduced storage
+ * and conversions from and to single precision floating point type, which round
+ * to the nearest representable value (ties to even).
+ */
+class bfloat16 {
+public:
+    bfloat16() noexcept = default;
+
+    GKO_ATTRIBUTES bfloat16(float32 val) noexcept
+        : data_{float2bfloat16(reinterpret_cast<const uint32&>(val))}
+    {}
+
+    GKO_ATTRIBUTES bfloat16(float64 val) noexcept
+        : bfloat16(static_cast<float32>(val))
+    {}
+
+    GKO_ATTRIBUTES operator float32() const noexcept
+    {
+        const auto bits = bfloat162float(data_);
+        return reinterpret_cast<const float32&>(bits);
+    }
+
+    GKO_ATTRIBUTES operator float64() const noexcept
+    {
+        return static_cast<float64>(static_cast<float32>(*this));
+    }
+
+    GKO_ATTRIBUTES bfloat16 operator-() const noexcept
+    {
+        auto res = *this;
+        // flip sign bit
+        res.data_ ^= bf16_traits::sign_mask;
+        return res;
+    }
+
+private:
+    using bf16_traits = detail::float_traits<bfloat16>;
+    using f32_traits = detail::float_traits<float32>;
+
+    GKO_ATTRIBUTES static uint16 float2bfloat16(uint32 data_) noexcept
+    {
+        constexpr auto shift =
+            f32_traits::significand_bits - bf16_traits::significand_bits;
+        if (f32_traits::is_nan(data_)) {
+            // truncating the significand could turn a NaN into an infinity
+            return static_cast<uint16>(data_ >> shift) |
+                   static_cast<uint16>(bf16_traits::significand_mask);
+        }
+        // round to nearest, ties to even. Overflow of the significand carries
+        // into the exponent, which correctly rounds large values to infinity.
+        const uint32 rounding_bias =
+            ((uint32{1} << (shift - 1)) - 1) + ((data_ >> shift) & 1u);
+        return static_cast<uint16>((data_ + rounding_bias) >> shift);
+    }
+
+    GKO_ATTRIBUTES static uint32 bfloat162float(uint16 data_) noexcept
+    {
+        constexpr auto shift =
+            f32_traits::significand_bits - bf16_traits::significand_bits;
+        return static_cast<uint32>(data_) << shift;
+    }
+
+    uint16 data_;
+};
+
+
 /**
  * This template implements the truncated (or split) storage of a floating point
  * type.
@@ -527,6 +606,10 @@ template <>
 struct is_scalar<gko::half> : std::true_type {};
 
 
+template <>
+struct is_scalar<gko::bfloat16> : std::true_type {};
+
+
 template <>
 struct numeric_limits<gko::half> {
     static constexpr bool is_specialized{true};
@@ -548,6 +631,26 @@ struct numeric_limits<gko::half> {
     }
 };
 
+
+template <>
+struct numeric_limits<gko::bfloat16> {
+    static constexpr bool is_specialized{true};
+    static constexpr bool is_signed{true};
+    static constexpr bool is_integer{false};
+    static constexpr bool is_exact{false};
+    static constexpr bool is_bounded{true};
+    static constexpr bool is_modulo{false};
+    static constexpr int digits{
+        gko::detail::float_traits<gko::bfloat16>::significand_bits + 1};
+    // 3/10 is approx. log_10(2)
+    static constexpr int digits10{digits * 3 / 10};
+
+    static constexpr float epsilon()
+    {
+        return gko::detail::float_traits<gko::bfloat16>::eps;
+    }
+};
+
 }  // namespace std
 
 
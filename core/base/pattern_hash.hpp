@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_BASE_PATTERN_HASH_HPP_
+#define GKO_CORE_BASE_PATTERN_HASH_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace detail {
+
+
+/**
+ * Accumulates 64-bit values into a 64-bit FNV-1a hash.
+ */
+class fnv1a_hash {
+public:
+    /**
+     * Adds a single value to the hash.
+     *
+     * @param value  the value to add
+     */
+    void combine(uint64 value)
+    {
+        constexpr uint64 fnv_prime = 1099511628211ull;
+        for (int byte = 0; byte < 8; byte++) {
+            hash_ ^= (value >> (8 * byte)) & 0xffu;
+            hash_ *= fnv_prime;
+        }
+    }
+
+    /**
+     * Adds all entries of an index array to the hash. The array is copied to
+     * the host if necessary.
+     *
+     * @param exec  the executor on which the array is stored
+     * @param size  the number of entries
+     * @param data  the index array
+     */
+    template <typename IndexType>
+    void combine(std::shared_ptr<const Executor> exec, size_type size,
+                 const IndexType* data)
+    {
+        const auto host_exec = exec->get_master();
+        array<IndexType> host_data{host_exec, size};
+        host_exec->copy_from(exec, size, data, host_data.get_data());
+        for (size_type i = 0; i < size; i++) {
+            combine(static_cast<uint64>(host_data.get_const_data()[i]));
+        }
+    }
+
+    /** Returns the current hash value. */
+    uint64 get() const { return hash_; }
+
+private:
+    uint64 hash_ = 14695981039346656037ull;
+};
+
+
+/**
+ * Computes a 64-bit FNV-1a hash of a CSR sparsity pattern.
+ *
+ * The hash covers the matrix dimensions and the row pointer and column index
+ * arrays. The index arrays are copied to the host if necessary, so the cost is
+ * a single pass over the pattern.
+ *
+ * @param exec  the executor on which the arrays are stored
+ * @param size  the dimensions of the matrix
+ * @param num_nonzeros  the number of stored elements
+ * @param row_ptrs  the row pointers
+ * @param col_idxs  the column indices
+ *
+ * @return the hash of the sparsity pattern
+ */
+template <typename IndexType>
+uint64 hash_sparsity_pattern(std::shared_ptr<const Executor> exec,
+                             dim<2> size, size_type num_nonzeros,
+                             const IndexType* row_ptrs,
+                             const IndexType* col_idxs)
+{
+    fnv1a_hash hash;
+    hash.combine(size[0]);
+    hash.combine(size[1]);
+    hash.combine(num_nonzeros);
+    hash.combine(exec, size[0] + 1, row_ptrs);
+    hash.combine(exec, num_nonzeros, col_idxs);
+    return hash.get();
+}
+
+
+/**
+ * @copydoc hash_sparsity_pattern
+ *
+ * @param mtx  the matrix whose sparsity pattern is hashed
+ */
+template <typename ValueType, typename IndexType>
+uint64 hash_sparsity_pattern(const matrix::Csr<ValueType, IndexType>* mtx)
+{
+    return hash_sparsity_pattern(
+        mtx->get_executor(), mtx->get_size(), mtx->get_num_stored_elements(),
+        mtx->get_const_row_ptrs(), mtx->get_const_col_idxs());
+}
+
+
+/**
+ * @copydoc hash_sparsity_pattern
+ *
+ * Since all items of a batch matrix share their sparsity pattern, the hash
+ * additionally covers only the number of batch items.
+ *
+ * @param mtx  the batch matrix whose sparsity pattern is hashed
+ */
+template <typename ValueType, typename IndexType>
+uint64 hash_sparsity_pattern(
+    const batch::matrix::Csr<ValueType, IndexType>* mtx)
+{
+    return hash_sparsity_pattern(
+               mtx->get_executor(), mtx->get_common_size(),
+               mtx->get_num_elements_per_item(), mtx->get_const_row_ptrs(),
+               mtx->get_const_col_idxs()) ^
+           static_cast<uint64>(mtx->get_num_batch_items());
+}
+
+
+/**
+ * Computes a 64-bit FNV-1a hash of the common sparsity pattern of a batch
+ * ELL matrix, including the padding entries.
+ *
+ * @param mtx  the batch matrix whose sparsity pattern is hashed
+ *
+ * @return the hash of the sparsity pattern
+ */
+template <typename ValueType, typename IndexType>
+uint64 hash_sparsity_pattern(
+    const batch::matrix::Ell<ValueType, IndexType>* mtx)
+{
+    const auto size = mtx->get_common_size();
+    const auto num_stored_per_row = mtx->get_num_stored_elements_per_row();
+    fnv1a_hash hash;
+    hash.combine(size[0]);
+    hash.combine(size[1]);
+    hash.combine(mtx->get_num_batch_items());
+    hash.combine(static_cast<uint64>(num_stored_per_row));
+    hash.combine(mtx->get_executor(), size[0] * num_stored_per_row,
+                 mtx->get_const_col_idxs());
+    return hash.get();
+}
+
+
+/**
+ * Throws an InvalidStateError if the sparsity pattern hash of a matrix passed
+ * to `update_values` does not match the hash recorded at generation.
+ *
+ * @param expected_hash  the hash of the pattern the operator was generated
+ *                       from
+ * @param new_hash  the hash of the pattern of the new matrix
+ */
+inline void ensure_same_sparsity_pattern(uint64 expected_hash, uint64 new_hash)
+{
+    if (expected_hash != new_hash) {
+        GKO_INVALID_STATE(
+            "The sparsity pattern of the new matrix differs from the one the "
+            "operator was generated from");
+    }
+}
+
+
+/**
+ * Throws an InvalidStateError if the sparsity pattern of a matrix passed to
+ * `update_values` differs from the one of the matrix the operator was
+ * generated from.
+ *
+ * Instead of hashing its pattern during the generation, the operator keeps the
+ * generating matrix, which is only hashed by the first call to
+ * `update_values` and released afterwards. This way, operators that are never
+ * updated do not pay for hashing.
+ *
+ * @param source  the matrix the operator was generated from, reset after its
+ *                pattern was hashed
+ * @param source_hash  the hash of the pattern of source, set when source is
+ *                     reset
+ * @param new_matrix  the new matrix
+ * @param new_hash  the hash of the pattern of the new matrix
+ * @param hash_pattern  the function hashing the pattern of source
+ */
+template <typename MatrixType, typename HashFunction>
+void ensure_same_sparsity_pattern(std::shared_ptr<const MatrixType>& source,
+                                  uint64& source_hash,
+                                  const MatrixType* new_matrix,
+                                  uint64 new_hash, HashFunction hash_pattern)
+{
+    if (source) {
+        source_hash = source.get() == new_matrix ? new_hash
+                                                 : hash_pattern(source.get());
+        source.reset();
+    }
+    ensure_same_sparsity_pattern(source_hash, new_hash);
+}
+
+
+}  // namespace detail
+}  // namespace gko
+
+
+#endif  // GKO_CORE_BASE_PATTERN_HASH_HPP_
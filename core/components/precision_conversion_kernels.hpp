@@ -27,6 +27,42 @@ namespace kernels {
                            TargetType* out)
 
 
+#if GINKGO_DPCPP_SINGLE_MODE
+#define GKO_INSTANTIATE_FOR_EACH_REDUCED_STORAGE_CONVERSION(_macro) \
+    template _macro(float, half);                                   \
+    template _macro(half, float);                                   \
+    template _macro(float, bfloat16);                               \
+    template _macro(bfloat16, float);                               \
+    template <>                                                     \
+    _macro(double, half) GKO_NOT_IMPLEMENTED;                       \
+    template <>                                                     \
+    _macro(half, double) GKO_NOT_IMPLEMENTED;                       \
+    template <>                                                     \
+    _macro(double, bfloat16) GKO_NOT_IMPLEMENTED;                   \
+    template <>                                                     \
+    _macro(bfloat16, double) GKO_NOT_IMPLEMENTED
+#else
+/**
+ * Instantiates a template for each conversion between a real value type and
+ * the 16-bit floating point storage types half and bfloat16.
+ *
+ * @param _macro  A macro which expands the template instantiation
+ *                (not including the leading `template` specifier).
+ *                Should take two arguments `src` and `dst`, which
+ *                are replaced by the source and destination type.
+ */
+#define GKO_INSTANTIATE_FOR_EACH_REDUCED_STORAGE_CONVERSION(_macro) \
+    template _macro(float, half);                                   \
+    template _macro(half, float);                                   \
+    template _macro(double, half);                                  \
+    template _macro(half, double);                                  \
+    template _macro(float, bfloat16);                               \
+    template _macro(bfloat16, float);                               \
+    template _macro(double, bfloat16);                              \
+    template _macro(bfloat16, double)
+#endif
+
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                    \
     template <typename SourceType, typename TargetType> \
     GKO_DECLARE_CONVERT_PRECISION_KERNEL(SourceType, TargetType)
@@ -22,6 +22,7 @@
 #include "core/distributed/partition_kernels.hpp"
 #include "core/distributed/vector_kernels.hpp"
 #include "core/factorization/cholesky_kernels.hpp"
+#include "core/factorization/elimination_forest_kernels.hpp"
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/ic_kernels.hpp"
 #include "core/factorization/ilu_kernels.hpp"
@@ -33,7 +34,9 @@
 #include "core/matrix/batch_csr_kernels.hpp"
 #include "core/matrix/batch_dense_kernels.hpp"
 #include "core/matrix/batch_ell_kernels.hpp"
+#include "core/matrix/batch_variable_csr_kernels.hpp"
 #include "core/matrix/coo_kernels.hpp"
+#include "core/matrix/csr_assembly_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
 #include "core/matrix/dense_kernels.hpp"
 #include "core/matrix/diagonal_kernels.hpp"
@@ -44,14 +47,23 @@
 #include "core/matrix/permutation_kernels.hpp"
 #include "core/matrix/scaled_permutation_kernels.hpp"
 #include "core/matrix/sellp_kernels.hpp"
+#include "core/matrix/reduced_csr_kernels.hpp"
 #include "core/matrix/sparsity_csr_kernels.hpp"
+#include "core/matrix/stencil_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
 #include "core/multigrid/pgm_kernels.hpp"
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+#include "core/preconditioner/batch_isai_kernels.hpp"
 #include "core/preconditioner/batch_jacobi_kernels.hpp"
 #include "core/preconditioner/isai_kernels.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
+#include "core/reorder/amd_kernels.hpp"
+#include "core/reorder/gray_code_kernels.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 #include "core/reorder/rcm_kernels.hpp"
 #include "core/solver/batch_bicgstab_kernels.hpp"
 #include "core/solver/batch_cg_kernels.hpp"
+#include "core/solver/batch_gmres_kernels.hpp"
 #include "core/solver/bicg_kernels.hpp"
 #include "core/solver/bicgstab_kernels.hpp"
 #include "core/solver/cb_gmres_kernels.hpp"
@@ -175,6 +187,8 @@ namespace components {
 
 
 GKO_STUB_VALUE_CONVERSION(GKO_DECLARE_CONVERT_PRECISION_KERNEL);
+GKO_INSTANTIATE_FOR_EACH_REDUCED_STORAGE_CONVERSION(
+    GKO_DECLARE_CONVERT_PRECISION_KERNEL);
 GKO_STUB_INDEX_TYPE(GKO_DECLARE_PREFIX_SUM_NONNEGATIVE_KERNEL);
 // explicitly instantiate for size_type, as this is
 // used in the SellP format
@@ -193,6 +207,8 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_SUM_DUPLICATES_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DEVICE_MATRIX_DATA_AOS_TO_SOA_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_DEVICE_MATRIX_DATA_SOA_TO_AOS_KERNEL);
 
@@ -332,6 +348,18 @@ GKO_STUB_VALUE_AND_INT32_TYPE(GKO_DECLARE_BATCH_ELL_ADD_SCALED_IDENTITY_KERNEL);
 }  // namespace batch_ell
 
 
+namespace batch_variable_csr {
+
+
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_VARIABLE_CSR_SIMPLE_APPLY_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_VARIABLE_CSR_ADVANCED_APPLY_KERNEL);
+
+
+}  // namespace batch_variable_csr
+
+
 namespace dense {
 
 
@@ -436,6 +464,15 @@ GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_CG_APPLY_KERNEL);
 }  // namespace batch_cg
 
 
+namespace batch_gmres {
+
+
+GKO_STUB_VALUE_TYPE(GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL);
+
+
+}  // namespace batch_gmres
+
+
 namespace cg {
 
 
@@ -575,6 +612,7 @@ namespace ir {
 
 
 GKO_STUB(GKO_DECLARE_IR_INITIALIZE_KERNEL);
+GKO_STUB_VALUE_CONVERSION_OR_COPY(GKO_DECLARE_IR_ADD_CORRECTION_KERNEL);
 
 
 }  // namespace ir
@@ -591,6 +629,17 @@ GKO_STUB_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_MULTIGRID_KCYCLE_CHECK_STOP_KERNEL);
 }  // namespace multigrid
 
 
+namespace reduced_csr {
+
+
+GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL);
+GKO_STUB_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace reduced_csr
+
+
 namespace sparsity_csr {
 
 
@@ -611,6 +660,48 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(
 }  // namespace sparsity_csr
 
 
+namespace stencil {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_COMPUTE_ROW_PTRS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+
+
+namespace symmetric_csr {
+
+
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_UPPER_ROW_PTRS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_FULL_ROW_PTRS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+
+
+namespace csr_assembly {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL);
+
+
+}  // namespace csr_assembly
+
+
 namespace csr {
 
 
@@ -678,6 +769,10 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_CONJ_TRANSPOSE_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_IS_SORTED_BY_COLUMN_INDEX);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_SORT_BY_COLUMN_INDEX);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL);
 
 
 }  // namespace fbcsr
@@ -784,6 +879,30 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SELLP_EXTRACT_DIAGONAL_KERNEL);
 }  // namespace sellp
 
 
+namespace batch_ilu {
+
+
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_FIND_DIAGONAL_LOCATIONS_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_COMPUTE_ILU0_FACTORIZATION_KERNEL);
+
+
+}  // namespace batch_ilu
+
+
+namespace batch_isai {
+
+
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_DENSE_LINEAR_SYSTEM_PATTERN_KERNEL);
+GKO_STUB_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_FILL_VALUES_DENSE_MATRIX_AND_SOLVE_KERNEL);
+
+
+}  // namespace batch_isai
+
+
 namespace batch_jacobi {
 
 
@@ -827,6 +946,9 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_GENERATE_GENERAL_INVERSE_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_GENERATE_EXCESS_SYSTEM_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_SCALE_EXCESS_SOLUTION_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_SELECT_PATTERN_EXTENSION_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ISAI_EXTEND_PATTERN_KERNEL);
 
 
 }  // namespace isai
@@ -845,6 +967,15 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CHOLESKY_FACTORIZE);
 }  // namespace cholesky
 
 
+namespace elimination_forest {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL);
+
+
+}  // namespace elimination_forest
+
+
 namespace factorization {
 
 
@@ -874,6 +1005,9 @@ namespace ilu_factorization {
 
 
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL);
 
 
 }  // namespace ilu_factorization
@@ -929,11 +1063,39 @@ GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILUT_THRESHOLD_SELECT_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL);
 GKO_STUB_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_APPROX_KERNEL);
+GKO_STUB_VALUE_AND_INDEX_TYPE(GKO_DECLARE_PAR_ILUT_ROW_WISE_FACTORIZE_KERNEL);
 
 
 }  // namespace par_ilut_factorization
 
 
+namespace amd {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+
+
+namespace gray_code {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace gray_code
+
+
+namespace nested_dissection {
+
+
+GKO_STUB_INDEX_TYPE(GKO_DECLARE_ND_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+
+
 namespace rcm {
 
 
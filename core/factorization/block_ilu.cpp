@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/factorization/block_ilu.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/base/array_access.hpp"
+#include "core/factorization/ilu_kernels.hpp"
+
+
+namespace gko {
+namespace factorization {
+namespace block_ilu_factorization {
+namespace {
+
+
+GKO_REGISTER_OPERATION(initialize_block_row_ptrs_l_u,
+                       ilu_factorization::initialize_block_row_ptrs_l_u);
+GKO_REGISTER_OPERATION(compute_block_lu, ilu_factorization::compute_block_lu);
+
+
+}  // anonymous namespace
+}  // namespace block_ilu_factorization
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Composition<ValueType>>
+BlockIlu<ValueType, IndexType>::generate_l_u(
+    const std::shared_ptr<const LinOp>& system_matrix) const
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+
+    const auto exec = this->get_executor();
+
+    // Converts the system matrix to Fbcsr, an Fbcsr input keeps its own block
+    // size. Throws an exception if it is not convertible.
+    auto local_system_matrix =
+        matrix_type::create(exec, parameters_.block_size);
+    as<ConvertibleTo<matrix_type>>(system_matrix.get())
+        ->convert_to(local_system_matrix);
+
+    // Fbcsr only sorts block sizes with compiled kernels, so sorted inputs
+    // skip it
+    if (!parameters_.skip_sorting &&
+        !local_system_matrix->is_sorted_by_column_index()) {
+        local_system_matrix->sort_by_column_index();
+    }
+
+    // Block row pointers of the factors, each of which stores the diagonal
+    // block of every block row
+    const auto matrix_size = local_system_matrix->get_size();
+    const auto block_size = local_system_matrix->get_block_size();
+    const auto num_block_rows =
+        static_cast<size_type>(local_system_matrix->get_num_block_rows());
+    array<IndexType> l_row_ptrs{exec, num_block_rows + 1};
+    array<IndexType> u_row_ptrs{exec, num_block_rows + 1};
+    exec->run(block_ilu_factorization::make_initialize_block_row_ptrs_l_u(
+        local_system_matrix.get(), l_row_ptrs.get_data(),
+        u_row_ptrs.get_data()));
+
+    // Get number of blocks from device memory
+    const auto l_nbnz =
+        static_cast<size_type>(get_element(l_row_ptrs, num_block_rows));
+    const auto u_nbnz =
+        static_cast<size_type>(get_element(u_row_ptrs, num_block_rows));
+    const auto block_entries =
+        static_cast<size_type>(block_size) * static_cast<size_type>(block_size);
+
+    std::shared_ptr<matrix_type> l_factor = matrix_type::create(
+        exec, matrix_size, block_size,
+        array<ValueType>{exec, l_nbnz * block_entries},
+        array<IndexType>{exec, l_nbnz}, std::move(l_row_ptrs));
+    std::shared_ptr<matrix_type> u_factor = matrix_type::create(
+        exec, matrix_size, block_size,
+        array<ValueType>{exec, u_nbnz * block_entries},
+        array<IndexType>{exec, u_nbnz}, std::move(u_row_ptrs));
+
+    // Compute the block LU factorization into the factors
+    exec->run(block_ilu_factorization::make_compute_block_lu(
+        local_system_matrix.get(), l_factor.get(), u_factor.get()));
+
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(u_factor));
+}
+
+
+#define GKO_DECLARE_BLOCK_ILU(ValueType, IndexType) \
+    class BlockIlu<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BLOCK_ILU);
+
+
+}  // namespace factorization
+}  // namespace gko
@@ -8,46 +8,15 @@
 #include <ginkgo/core/base/types.hpp>
 
 
+#include "core/factorization/elimination_forest_kernels.hpp"
+
+
 namespace gko {
 namespace factorization {
 namespace {
 
 
-template <typename IndexType>
-void compute_elim_forest_parent_impl(std::shared_ptr<const Executor> host_exec,
-                                     const IndexType* row_ptrs,
-                                     const IndexType* cols, IndexType num_rows,
-                                     IndexType* parent)
-{
-    disjoint_sets<IndexType> subtrees{host_exec, num_rows};
-    array<IndexType> subtree_root_array{host_exec,
-                                        static_cast<size_type>(num_rows)};
-    // pseudo-root one past the last row to deal with disconnected matrices
-    const auto unattached = num_rows;
-    auto subtree_root = subtree_root_array.get_data();
-    for (IndexType row = 0; row < num_rows; row++) {
-        // so far the row is an unattached singleton subtree
-        subtree_root[row] = row;
-        parent[row] = unattached;
-        auto row_rep = row;
-        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
-            const auto col = cols[nz];
-            // for each lower triangular entry
-            if (col < row) {
-                // find the subtree it is contained in
-                const auto col_rep = subtrees.find(col);
-                const auto col_root = subtree_root[col_rep];
-                // if it is not yet attached, put it below row
-                // and make row its new root
-                if (parent[col_root] == unattached && col_root != row) {
-                    parent[col_root] = row;
-                    row_rep = subtrees.join(row_rep, col_rep);
-                    subtree_root[row_rep] = row;
-                }
-            }
-        }
-    }
-}
+GKO_REGISTER_OPERATION(compute_parents, elimination_forest::compute_parents);
 
 
 template <typename IndexType>
@@ -149,9 +118,10 @@ void compute_elim_forest(const matrix::Csr<ValueType, IndexType>* mtx,
     const auto num_rows = static_cast<IndexType>(host_mtx->get_size()[0]);
     forest =
         std::make_unique<elimination_forest<IndexType>>(host_exec, num_rows);
-    compute_elim_forest_parent_impl(host_exec, host_mtx->get_const_row_ptrs(),
-                                    host_mtx->get_const_col_idxs(), num_rows,
-                                    forest->parents.get_data());
+    // device executors compute the forest on their host executor
+    host_exec->run(make_compute_parents(
+        host_mtx->get_const_row_ptrs(), host_mtx->get_const_col_idxs(),
+        num_rows, forest->parents.get_data()));
     compute_elim_forest_children_impl(forest->parents.get_const_data(),
                                       num_rows, forest->child_ptrs.get_data(),
                                       forest->children.get_data());
@@ -11,9 +11,6 @@
 #include <ginkgo/core/matrix/csr.hpp>
 
 
-#include "core/components/disjoint_sets.hpp"
-
-
 namespace gko {
 namespace factorization {
 
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_FACTORIZATION_ELIMINATION_FOREST_KERNELS_HPP_
+#define GKO_CORE_FACTORIZATION_ELIMINATION_FOREST_KERNELS_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+/**
+ * Computes the parents in the elimination forest of the lower triangle of the
+ * sparsity pattern given by row_ptrs and cols. The roots of the forest get
+ * the pseudo-root `size` as their parent.
+ */
+#define GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL(IndexType)    \
+    void compute_parents(std::shared_ptr<const DefaultExecutor> exec,       \
+                         const IndexType* row_ptrs, const IndexType* cols, \
+                         IndexType size, IndexType* parents)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES \
+    template <typename IndexType>    \
+    GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL(IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(elimination_forest,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_FACTORIZATION_ELIMINATION_FOREST_KERNELS_HPP_
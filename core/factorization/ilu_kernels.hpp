@@ -15,6 +15,7 @@
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/types.hpp>
 #include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
 
 
 #include "core/base/kernel_declaration.hpp"
@@ -28,10 +29,29 @@ namespace kernels {
     void compute_lu(std::shared_ptr<const DefaultExecutor> exec, \
                     matrix::Csr<ValueType, IndexType>* system_matrix)
 
-
-#define GKO_DECLARE_ALL_AS_TEMPLATES                  \
-    template <typename ValueType, typename IndexType> \
-    GKO_DECLARE_ILU_COMPUTE_LU_KERNEL(ValueType, IndexType)
+#define GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL(ValueType, \
+                                                             IndexType) \
+    void initialize_block_row_ptrs_l_u(                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                    \
+        const matrix::Fbcsr<ValueType, IndexType>* system_matrix,       \
+        IndexType* l_row_ptrs, IndexType* u_row_ptrs)
+
+#define GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL(ValueType, IndexType) \
+    void compute_block_lu(                                            \
+        std::shared_ptr<const DefaultExecutor> exec,                  \
+        const matrix::Fbcsr<ValueType, IndexType>* system_matrix,     \
+        matrix::Fbcsr<ValueType, IndexType>* l_factor,                \
+        matrix::Fbcsr<ValueType, IndexType>* u_factor)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                 \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_ILU_COMPUTE_LU_KERNEL(ValueType, IndexType);         \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL(ValueType,  \
+                                                         IndexType); \
+    template <typename ValueType, typename IndexType>                \
+    GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(ilu_factorization,
@@ -17,6 +17,8 @@
 
 
 #include "core/base/array_access.hpp"
+#include "core/base/pattern_hash.hpp"
+#include "core/base/utils.hpp"
 #include "core/factorization/factorization_kernels.hpp"
 #include "core/factorization/par_ilu_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
@@ -42,12 +44,67 @@ GKO_REGISTER_OPERATION(csr_transpose, csr::transpose);
 }  // namespace par_ilu_factorization
 
 
+namespace {
+
+
+/**
+ * Computes the values of the factors for the sparsity patterns already stored
+ * in l_factor and u_factor.
+ *
+ * If coo_system_matrix is nullptr, csr_system_matrix is moved into a Coo
+ * matrix to be used by the fixed-point iteration.
+ */
+template <typename ValueType, typename IndexType>
+void compute_factor_values(
+    std::shared_ptr<const Executor> exec, size_type iterations,
+    std::unique_ptr<matrix::Csr<ValueType, IndexType>> csr_system_matrix,
+    const matrix::Coo<ValueType, IndexType>* coo_system_matrix,
+    matrix::Csr<ValueType, IndexType>* l_factor,
+    matrix::Csr<ValueType, IndexType>* u_factor)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    exec->run(par_ilu_factorization::make_initialize_l_u(
+        csr_system_matrix.get(), l_factor, u_factor));
+
+    // We use `transpose()` here to convert the Csr format to Csc.
+    auto u_factor_transpose_lin_op = u_factor->transpose();
+    // Since `transpose()` returns an `std::unique_ptr<LinOp>`, we need to
+    // convert it to `CsrMatrix *` in order to use it.
+    auto u_factor_transpose =
+        static_cast<CsrMatrix*>(u_factor_transpose_lin_op.get());
+
+    // If we already own a CSR `system_matrix`, we can move the Csr matrix to
+    // Coo, which has very little overhead.
+    std::unique_ptr<CooMatrix> coo_system_matrix_unique_ptr{nullptr};
+    if (coo_system_matrix == nullptr) {
+        coo_system_matrix_unique_ptr = CooMatrix::create(exec);
+        csr_system_matrix->move_to(coo_system_matrix_unique_ptr);
+        coo_system_matrix = coo_system_matrix_unique_ptr.get();
+    }
+
+    exec->run(par_ilu_factorization::make_compute_l_u_factors(
+        iterations, coo_system_matrix, l_factor, u_factor_transpose));
+
+    // Transpose it again, which is basically a conversion from CSC back to CSR
+    // Since the transposed version has the exact same non-zero positions
+    // as `u_factor`, we can both skip the allocation and the `make_srow()`
+    // call from CSR, leaving just the `transpose()` kernel call
+    exec->run(par_ilu_factorization::make_csr_transpose(u_factor_transpose,
+                                                        u_factor));
+}
+
+
+}  // anonymous namespace
+
+
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Composition<ValueType>>
 ParIlu<ValueType, IndexType>::generate_l_u(
     const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
     std::shared_ptr<typename l_matrix_type::strategy_type> l_strategy,
-    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy) const
+    std::shared_ptr<typename u_matrix_type::strategy_type> u_strategy)
 {
     using CsrMatrix = matrix::Csr<ValueType, IndexType>;
     using CooMatrix = matrix::Coo<ValueType, IndexType>;
@@ -65,6 +122,7 @@ ParIlu<ValueType, IndexType>::generate_l_u(
     if (!skip_sorting) {
         csr_system_matrix->sort_by_column_index();
     }
+    pattern_source_ = system_matrix;
 
     // Add explicit diagonal zero elements if they are missing
     exec->run(par_ilu_factorization::make_add_diagonal_elements(
@@ -94,44 +152,60 @@ ParIlu<ValueType, IndexType>::generate_l_u(
         exec, matrix_size, std::move(u_vals), std::move(u_col_idxs),
         std::move(u_row_ptrs), u_strategy);
 
-    exec->run(par_ilu_factorization::make_initialize_l_u(
-        csr_system_matrix.get(), l_factor.get(), u_factor.get()));
+    // At first, test if the given system_matrix was already a sorted Coo
+    // matrix, so no conversion would be necessary.
+    auto coo_system_matrix_ptr =
+        skip_sorting ? dynamic_cast<const CooMatrix*>(system_matrix.get())
+                     : nullptr;
 
-    // We use `transpose()` here to convert the Csr format to Csc.
-    auto u_factor_transpose_lin_op = u_factor->transpose();
-    // Since `transpose()` returns an `std::unique_ptr<LinOp>`, we need to
-    // convert it to `u_matrix_type *` in order to use it.
-    auto u_factor_transpose =
-        static_cast<u_matrix_type*>(u_factor_transpose_lin_op.get());
+    compute_factor_values<ValueType, IndexType>(
+        exec, parameters_.iterations, std::move(csr_system_matrix),
+        coo_system_matrix_ptr, l_factor.get(), u_factor.get());
 
-    // At first, test if the given system_matrix was already a Coo matrix,
-    // so no conversion would be necessary.
-    std::unique_ptr<CooMatrix> coo_system_matrix_unique_ptr{nullptr};
-    auto coo_system_matrix_ptr =
-        dynamic_cast<const CooMatrix*>(system_matrix.get());
+    return Composition<ValueType>::create(std::move(l_factor),
+                                          std::move(u_factor));
+}
 
-    // If it was not, and we already own a CSR `system_matrix`,
-    // we can move the Csr matrix to Coo, which has very little overhead.
-    // We also have to move from the CSR matrix if it was not already sorted.
-    if (!skip_sorting || coo_system_matrix_ptr == nullptr) {
-        coo_system_matrix_unique_ptr = CooMatrix::create(exec);
-        csr_system_matrix->move_to(coo_system_matrix_unique_ptr);
-        coo_system_matrix_ptr = coo_system_matrix_unique_ptr.get();
+
+template <typename ValueType, typename IndexType>
+void ParIlu<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = CsrMatrix::create(exec);
+    as<ConvertibleTo<CsrMatrix>>(new_matrix.get())
+        ->convert_to(csr_system_matrix);
+    if (!parameters_.skip_sorting) {
+        csr_system_matrix->sort_by_column_index();
     }
+    detail::ensure_same_sparsity_pattern(
+        pattern_source_, pattern_hash_, new_matrix.get(),
+        detail::hash_sparsity_pattern(csr_system_matrix.get()),
+        [&](const LinOp* mtx) {
+            return detail::hash_sparsity_pattern(
+                convert_to_with_sorting<CsrMatrix>(exec, mtx,
+                                                   parameters_.skip_sorting)
+                    .get());
+        });
 
-    exec->run(par_ilu_factorization::make_compute_l_u_factors(
-        parameters_.iterations, coo_system_matrix_ptr, l_factor.get(),
-        u_factor_transpose));
+    exec->run(par_ilu_factorization::make_add_diagonal_elements(
+        csr_system_matrix.get(), true));
 
-    // Transpose it again, which is basically a conversion from CSC back to CSR
-    // Since the transposed version has the exact same non-zero positions
-    // as `u_factor`, we can both skip the allocation and the `make_srow()`
-    // call from CSR, leaving just the `transpose()` kernel call
-    exec->run(par_ilu_factorization::make_csr_transpose(u_factor_transpose,
-                                                        u_factor.get()));
+    // the factors may be shared with other objects (e.g. triangular solvers),
+    // so the new values are computed in copies reusing the existing patterns
+    std::shared_ptr<CsrMatrix> l_factor = gko::clone(this->get_l_factor());
+    std::shared_ptr<CsrMatrix> u_factor = gko::clone(this->get_u_factor());
+    compute_factor_values<ValueType, IndexType>(
+        exec, parameters_.iterations, std::move(csr_system_matrix), nullptr,
+        l_factor.get(), u_factor.get());
 
-    return Composition<ValueType>::create(std::move(l_factor),
-                                          std::move(u_factor));
+    Composition<ValueType>::create(std::move(l_factor), std::move(u_factor))
+        ->move_to(this);
 }
 
 
@@ -17,6 +17,7 @@
 
 
 #include "core/base/array_access.hpp"
+#include "core/base/pattern_hash.hpp"
 #include "core/base/utils.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/factorization/factorization_kernels.hpp"
@@ -42,6 +43,8 @@ GKO_REGISTER_OPERATION(threshold_filter_approx,
 GKO_REGISTER_OPERATION(add_candidates, par_ilut_factorization::add_candidates);
 GKO_REGISTER_OPERATION(compute_l_u_factors,
                        par_ilut_factorization::compute_l_u_factors);
+GKO_REGISTER_OPERATION(row_wise_factorize,
+                       par_ilut_factorization::row_wise_factorize);
 
 GKO_REGISTER_OPERATION(initialize_row_ptrs_l_u,
                        factorization::initialize_row_ptrs_l_u);
@@ -62,6 +65,7 @@ using par_ilut_factorization::make_convert_ptrs_to_idxs;
 using par_ilut_factorization::make_csr_transpose;
 using par_ilut_factorization::make_initialize_l_u;
 using par_ilut_factorization::make_initialize_row_ptrs_l_u;
+using par_ilut_factorization::make_row_wise_factorize;
 using par_ilut_factorization::make_spgemm;
 using par_ilut_factorization::make_threshold_filter;
 using par_ilut_factorization::make_threshold_filter_approx;
@@ -163,7 +167,7 @@ struct ParIlutState {
 template <typename ValueType, typename IndexType>
 std::unique_ptr<Composition<ValueType>>
 ParIlut<ValueType, IndexType>::generate_l_u(
-    const std::shared_ptr<const LinOp>& system_matrix) const
+    const std::shared_ptr<const LinOp>& system_matrix)
 {
     using CsrMatrix = matrix::Csr<ValueType, IndexType>;
 
@@ -176,6 +180,20 @@ ParIlut<ValueType, IndexType>::generate_l_u(
     // convert and/or sort the matrix if necessary
     auto csr_system_matrix = convert_to_with_sorting<CsrMatrix>(
         exec, system_matrix, parameters_.skip_sorting);
+    pattern_source_ = system_matrix;
+
+    if (parameters_.algorithm == ilut_algorithm::row_wise) {
+        const auto mtx_size = csr_system_matrix->get_size();
+        auto l = CsrMatrix::create(exec, mtx_size);
+        auto u = CsrMatrix::create(exec, mtx_size);
+        exec->run(make_row_wise_factorize(
+            csr_system_matrix.get(),
+            static_cast<remove_complex<ValueType>>(parameters_.drop_tolerance),
+            parameters_.fill_in_limit, l.get(), u.get()));
+        l->set_strategy(parameters_.l_strategy);
+        u->set_strategy(parameters_.u_strategy);
+        return Composition<ValueType>::create(std::move(l), std::move(u));
+    }
 
     // initialize the L and U matrix data structures
     const auto num_rows = csr_system_matrix->get_size()[0];
@@ -226,6 +244,65 @@ ParIlut<ValueType, IndexType>::generate_l_u(
 }
 
 
+template <typename ValueType, typename IndexType>
+void ParIlut<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    using CsrMatrix = matrix::Csr<ValueType, IndexType>;
+    using CooMatrix = matrix::Coo<ValueType, IndexType>;
+
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+
+    const auto exec = this->get_executor();
+
+    auto csr_system_matrix = convert_to_with_sorting<CsrMatrix>(
+        exec, new_matrix, parameters_.skip_sorting);
+    detail::ensure_same_sparsity_pattern(
+        pattern_source_, pattern_hash_, new_matrix.get(),
+        detail::hash_sparsity_pattern(csr_system_matrix.get()),
+        [&](const LinOp* mtx) {
+            return detail::hash_sparsity_pattern(
+                convert_to_with_sorting<CsrMatrix>(exec, mtx,
+                                                   parameters_.skip_sorting)
+                    .get());
+        });
+
+    // the factors may be shared with other objects (e.g. triangular solvers),
+    // so the new values are computed in copies, using the previous values as
+    // initial guess for the fixed-point iteration
+    auto l = gko::clone(exec, this->get_l_factor());
+    auto u = gko::clone(exec, this->get_u_factor());
+    const auto mtx_size = l->get_size();
+    const auto l_nnz = l->get_num_stored_elements();
+    const auto u_nnz = u->get_num_stored_elements();
+    auto u_csc = CsrMatrix::create(exec, mtx_size, u_nnz);
+    exec->run(make_csr_transpose(u.get(), u_csc.get()));
+    // the COO versions share the column indices and values with L and U
+    auto l_coo = CooMatrix::create(
+        exec, mtx_size, make_array_view(exec, l_nnz, l->get_values()),
+        make_array_view(exec, l_nnz, l->get_col_idxs()),
+        array<IndexType>{exec, l_nnz});
+    auto u_coo = CooMatrix::create(
+        exec, mtx_size, make_array_view(exec, u_nnz, u->get_values()),
+        make_array_view(exec, u_nnz, u->get_col_idxs()),
+        array<IndexType>{exec, u_nnz});
+    exec->run(make_convert_ptrs_to_idxs(l->get_const_row_ptrs(), mtx_size[0],
+                                        l_coo->get_row_idxs()));
+    exec->run(make_convert_ptrs_to_idxs(u->get_const_row_ptrs(), mtx_size[0],
+                                        u_coo->get_row_idxs()));
+
+    // the sparsity patterns stay fixed, so only the fixed-point sweeps of the
+    // generation are repeated
+    for (size_type it = 0; it < parameters_.iterations; ++it) {
+        exec->run(make_compute_l_u_factors(csr_system_matrix.get(), l.get(),
+                                           l_coo.get(), u.get(), u_coo.get(),
+                                           u_csc.get()));
+    }
+
+    Composition<ValueType>::create(std::move(l), std::move(u))->move_to(this);
+}
+
+
 template <typename ValueType, typename IndexType>
 void ParIlutState<ValueType, IndexType>::iterate()
 {
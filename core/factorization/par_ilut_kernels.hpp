@@ -67,6 +67,14 @@ namespace kernels {
                                  matrix::Csr<ValueType, IndexType>* m_out,    \
                                  matrix::Coo<ValueType, IndexType>* m_out_coo)
 
+#define GKO_DECLARE_PAR_ILUT_ROW_WISE_FACTORIZE_KERNEL(ValueType, IndexType) \
+    void row_wise_factorize(std::shared_ptr<const DefaultExecutor> exec,      \
+                            const matrix::Csr<ValueType, IndexType>* a,       \
+                            remove_complex<ValueType> drop_tolerance,         \
+                            double fill_in_limit,                             \
+                            matrix::Csr<ValueType, IndexType>* l,             \
+                            matrix::Csr<ValueType, IndexType>* u)
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                      \
     constexpr auto sampleselect_searchtree_height = 8;                    \
     constexpr auto sampleselect_oversampling = 4;                         \
@@ -79,7 +87,10 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                     \
     GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_KERNEL(ValueType, IndexType);   \
     template <typename ValueType, typename IndexType>                     \
-    GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_APPROX_KERNEL(ValueType, IndexType)
+    GKO_DECLARE_PAR_ILUT_THRESHOLD_FILTER_APPROX_KERNEL(ValueType,        \
+                                                        IndexType);       \
+    template <typename ValueType, typename IndexType>                     \
+    GKO_DECLARE_PAR_ILUT_ROW_WISE_FACTORIZE_KERNEL(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(par_ilut_factorization,
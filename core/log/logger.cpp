@@ -17,6 +17,7 @@ constexpr Logger::mask_type Logger::linop_events_mask;
 constexpr Logger::mask_type Logger::linop_factory_events_mask;
 constexpr Logger::mask_type Logger::batch_linop_factory_events_mask;
 constexpr Logger::mask_type Logger::criterion_events_mask;
+constexpr Logger::mask_type Logger::communication_events_mask;
 
 constexpr Logger::mask_type Logger::allocation_started_mask;
 constexpr Logger::mask_type Logger::allocation_completed_mask;
@@ -51,6 +52,9 @@ constexpr Logger::mask_type Logger::batch_solver_completed_mask;
 
 constexpr Logger::mask_type Logger::iteration_complete_mask;
 
+constexpr Logger::mask_type Logger::communication_started_mask;
+constexpr Logger::mask_type Logger::communication_completed_mask;
+
 
 }  // namespace log
 }  // namespace gko
@@ -280,6 +280,28 @@ void Papi<ValueType>::on_iteration_complete(
 }
 
 
+template <typename ValueType>
+void Papi<ValueType>::on_communication_started(const Executor* exec,
+                                               const char* name, int peer,
+                                               size_type send_bytes,
+                                               size_type recv_bytes) const
+{
+    communication_started_send.get_counter(exec) += send_bytes;
+    communication_started_recv.get_counter(exec) += recv_bytes;
+}
+
+
+template <typename ValueType>
+void Papi<ValueType>::on_communication_completed(const Executor* exec,
+                                                 const char* name, int peer,
+                                                 size_type send_bytes,
+                                                 size_type recv_bytes) const
+{
+    communication_completed_send.get_counter(exec) += send_bytes;
+    communication_completed_recv.get_counter(exec) += recv_bytes;
+}
+
+
 #define GKO_DECLARE_PAPI(_type) class Papi<_type>
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_PAPI);
 
@@ -158,6 +158,9 @@ void ProfilerHook::on_linop_apply_completed(const LinOp* A, const LinOp* b,
     if (dynamic_cast<const solver::IterativeBase*>(A)) {
         this->end_hook_("iteration", profile_event_category::solver);
     }
+    if (this->work_hook_) {
+        this->work_hook_(estimate_apply_work(A, b, x, false));
+    }
     this->end_hook_(ss.str().c_str(), profile_event_category::linop);
 }
 
@@ -188,6 +191,9 @@ void ProfilerHook::on_linop_advanced_apply_completed(const LinOp* A,
     if (dynamic_cast<const solver::IterativeBase*>(A)) {
         this->end_hook_("iteration", profile_event_category::solver);
     }
+    if (this->work_hook_) {
+        this->work_hook_(estimate_apply_work(A, b, x, true));
+    }
     this->end_hook_(ss.str().c_str(), profile_event_category::linop);
 }
 
@@ -247,6 +253,35 @@ void ProfilerHook::on_criterion_check_completed(
 }
 
 
+void ProfilerHook::on_communication_started(const Executor* exec,
+                                            const char* name, int peer,
+                                            size_type send_bytes,
+                                            size_type recv_bytes) const
+{
+    this->maybe_synchronize(exec);
+    std::stringstream ss;
+    ss << "communicate(" << name << ")";
+    this->begin_hook_(ss.str().c_str(), profile_event_category::communication);
+}
+
+
+void ProfilerHook::on_communication_completed(const Executor* exec,
+                                              const char* name, int peer,
+                                              size_type send_bytes,
+                                              size_type recv_bytes) const
+{
+    this->maybe_synchronize(exec);
+    std::stringstream ss;
+    ss << "communicate(" << name << ")";
+    if (this->work_hook_) {
+        work_estimate work;
+        work.bytes = static_cast<int64>(send_bytes + recv_bytes);
+        this->work_hook_(work);
+    }
+    this->end_hook_(ss.str().c_str(), profile_event_category::communication);
+}
+
+
 void ProfilerHook::on_iteration_complete(
     const LinOp* solver, const LinOp* right_hand_side, const LinOp* solution,
     const size_type& num_iterations, const LinOp* residual,
@@ -330,8 +365,12 @@ std::string ProfilerHook::stringify_object(const PolymorphicObject* obj) const
 }
 
 
-ProfilerHook::ProfilerHook(hook_function begin, hook_function end)
-    : synchronize_{false}, begin_hook_{begin}, end_hook_{end}
+ProfilerHook::ProfilerHook(hook_function begin, hook_function end,
+                           work_hook_function work)
+    : synchronize_{false},
+      begin_hook_{begin},
+      end_hook_{end},
+      work_hook_{work}
 {}
 
 
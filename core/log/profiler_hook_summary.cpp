@@ -198,6 +198,17 @@ struct summary : summary_base {
         overhead += (cpu_now4 - cpu_now3) + (cpu_now2 - cpu_now);
     }
 
+    void add_work(const ProfilerHook::work_estimate& work)
+    {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (broken || stack.empty()) {
+            return;
+        }
+        auto& entry = entries[stack.back().first];
+        entry.flops += work.flops;
+        entry.bytes += work.bytes;
+    }
+
     const std::string& get_top_name() const
     {
         return entries[stack.back().first].name;
@@ -212,6 +223,8 @@ struct nested_summary : summary_base {
         int64 parent_id;
         std::chrono::nanoseconds elapsed{};
         int64 count{};
+        int64 flops{};
+        int64 bytes{};
 
         entry(int64 name_id, int64 node_id, int64 parent_id)
             : name_id{name_id}, node_id{node_id}, parent_id{parent_id}
@@ -318,6 +331,17 @@ struct nested_summary : summary_base {
         overhead += (cpu_now4 - cpu_now3) + (cpu_now2 - cpu_now);
     }
 
+    void add_work(const ProfilerHook::work_estimate& work)
+    {
+        std::lock_guard<std::mutex> guard{mutex};
+        if (broken || stack.empty()) {
+            return;
+        }
+        auto& node = nodes[stack.back().node_id];
+        node.flops += work.flops;
+        node.bytes += work.bytes;
+    }
+
     const std::string& get_top_name() const
     {
         return names[stack.back().name_id];
@@ -357,6 +381,8 @@ ProfilerHook::nested_summary_entry build_tree(const nested_summary& summary)
         entry.name = summary.names[summary_node.name_id];
         entry.elapsed = summary_node.elapsed;
         entry.count = summary_node.count;
+        entry.flops = summary_node.flops;
+        entry.bytes = summary_node.bytes;
         const auto child_range = child_ranges[summary_node.node_id];
         for (auto i = child_range.first; i < child_range.second; i++) {
             entry.children.emplace_back();
@@ -388,7 +414,8 @@ std::shared_ptr<ProfilerHook> ProfilerHook::create_summary(
     data->check_nesting = debug_check_nesting;
     return std::shared_ptr<ProfilerHook>{new ProfilerHook{
         [data](const char* name, profile_event_category) { data->push(name); },
-        [data](const char* name, profile_event_category) { data->pop(name); }}};
+        [data](const char* name, profile_event_category) { data->pop(name); },
+        [data](const work_estimate& work) { data->add_work(work); }}};
 }
 
 
@@ -410,7 +437,8 @@ std::shared_ptr<ProfilerHook> ProfilerHook::create_nested_summary(
     data->check_nesting = debug_check_nesting;
     return std::shared_ptr<ProfilerHook>{new ProfilerHook{
         [data](const char* name, profile_event_category) { data->push(name); },
-        [data](const char* name, profile_event_category) { data->pop(name); }}};
+        [data](const char* name, profile_event_category) { data->pop(name); },
+        [data](const work_estimate& work) { data->add_work(work); }}};
 }
 
 
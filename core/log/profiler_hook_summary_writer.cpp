@@ -53,6 +53,23 @@ std::string format_fraction(std::chrono::nanoseconds part,
 }
 
 
+/**
+ * Formats the rate of the given amount of work (flops or bytes) in the given
+ * time in giga-units per second, or "-" if no work estimate is available.
+ */
+std::string format_rate(int64 work, std::chrono::nanoseconds time)
+{
+    if (work <= 0 || time.count() <= 0) {
+        return "-";
+    }
+    std::stringstream ss;
+    ss << std::setprecision(2) << std::fixed;
+    // one unit per nanosecond is 1e9 units per second
+    ss << double(work) / double(time.count());
+    return ss.str();
+}
+
+
 template <std::size_t size>
 void print_table(const std::array<std::string, size>& headers,
                  const std::vector<std::array<std::string, size>>& table,
@@ -184,5 +201,74 @@ void ProfilerHook::TableSummaryWriter::write_nested(
 }
 
 
+ProfilerHook::ThroughputSummaryWriter::ThroughputSummaryWriter(
+    std::ostream& output, std::string header)
+    : output_{&output}, header_{std::move(header)}
+{}
+
+
+void ProfilerHook::ThroughputSummaryWriter::write(
+    const std::vector<summary_entry>& entries,
+    std::chrono::nanoseconds overhead)
+{
+    (*output_) << header_ << '\n'
+               << "Overhead estimate " << format_duration(overhead) << '\n';
+    auto sorted_entries = entries;
+    std::sort(sorted_entries.begin(), sorted_entries.end(),
+              [](const summary_entry& lhs, const summary_entry& rhs) {
+                  // reverse-sort by inclusive total time
+                  return lhs.inclusive > rhs.inclusive;
+              });
+    std::vector<std::array<std::string, 6>> table;
+    std::array<std::string, 6> headers({" name ", " total ", " count ",
+                                        " avg ", " GFLOP/s ", " GB/s "});
+    for (const auto& entry : sorted_entries) {
+        table.emplace_back(std::array<std::string, 6>{
+            " " + entry.name + " ",
+            " " + format_duration(entry.inclusive) + " ",
+            " " + std::to_string(entry.count) + " ",
+            " " + format_avg_duration(entry.inclusive, entry.count) + " ",
+            " " + format_rate(entry.flops, entry.inclusive) + " ",
+            " " + format_rate(entry.bytes, entry.inclusive) + " "});
+    }
+    print_table(headers, table, *output_);
+}
+
+
+void ProfilerHook::ThroughputSummaryWriter::write_nested(
+    const nested_summary_entry& root, std::chrono::nanoseconds overhead)
+{
+    (*output_) << header_ << '\n'
+               << "Overhead estimate " << format_duration(overhead) << '\n';
+    std::vector<std::array<std::string, 6>> table;
+    std::array<std::string, 6> headers({" name ", " total ", " fraction ",
+                                        " count ", " GFLOP/s ", " GB/s "});
+    auto visitor = [&table](auto visitor, const nested_summary_entry& node,
+                            std::chrono::nanoseconds parent_elapsed,
+                            std::size_t depth) -> void {
+        std::vector<int64> child_permutation(node.children.size());
+        std::iota(child_permutation.begin(), child_permutation.end(), 0);
+        std::sort(child_permutation.begin(), child_permutation.end(),
+                  [&node](int64 lhs, int64 rhs) {
+                      // sort by elapsed time in descending order
+                      return node.children[lhs].elapsed >
+                             node.children[rhs].elapsed;
+                  });
+        table.emplace_back(std::array<std::string, 6>{
+            std::string(2 * depth + 1, ' ') + node.name + " ",
+            " " + format_duration(node.elapsed) + " ",
+            format_fraction(node.elapsed, parent_elapsed) + " ",
+            " " + std::to_string(node.count) + " ",
+            " " + format_rate(node.flops, node.elapsed) + " ",
+            " " + format_rate(node.bytes, node.elapsed) + " "});
+        for (const auto child_id : child_permutation) {
+            visitor(visitor, node.children[child_id], node.elapsed, depth + 1);
+        }
+    };
+    visitor(visitor, root, root.elapsed, 0);
+    print_table(headers, table, *output_);
+}
+
+
 }  // namespace log
 }  // namespace gko
@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+#include "core/log/profiler_hook.hpp"
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+using trace_clock = std::chrono::steady_clock;
+
+
+const char* get_category_name(profile_event_category category)
+{
+    switch (category) {
+    case profile_event_category::memory:
+        return "memory";
+    case profile_event_category::operation:
+        return "operation";
+    case profile_event_category::object:
+        return "object";
+    case profile_event_category::linop:
+        return "linop";
+    case profile_event_category::factory:
+        return "factory";
+    case profile_event_category::solver:
+        return "solver";
+    case profile_event_category::criterion:
+        return "criterion";
+    case profile_event_category::user:
+        return "user";
+    case profile_event_category::communication:
+        return "communication";
+    case profile_event_category::internal:
+    default:
+        return "internal";
+    }
+}
+
+
+void write_json_string(std::ostream& stream, const std::string& str)
+{
+    stream << '"';
+    for (const auto c : str) {
+        switch (c) {
+        case '"':
+            stream << "\\\"";
+            break;
+        case '\\':
+            stream << "\\\\";
+            break;
+        case '\n':
+            stream << "\\n";
+            break;
+        case '\t':
+            stream << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                stream << "\\u" << std::hex << std::setw(4)
+                       << std::setfill('0') << static_cast<int>(c)
+                       << std::dec << std::setfill(' ');
+            } else {
+                stream << c;
+            }
+        }
+    }
+    stream << '"';
+}
+
+
+/** A completed range, with timestamps relative to the start of the trace. */
+struct trace_event {
+    int64 name_id;
+    profile_event_category category;
+    std::chrono::nanoseconds begin;
+    std::chrono::nanoseconds end;
+};
+
+
+/**
+ * The ranges recorded on a single thread. Only the owning thread accesses it
+ * while the trace is running, so no synchronization is necessary.
+ */
+struct thread_trace {
+    thread_trace(int64 thread_id, size_type capacity)
+        : thread_id{thread_id},
+          owner{std::this_thread::get_id()},
+          capacity{capacity}
+    {}
+
+    int64 get_name_id(const char* name)
+    {
+        // most names are string literals or reuse the same temporary buffer,
+        // so looking up the pointer first avoids building a string for every
+        // range. The name stored behind a pointer may change, so it needs to
+        // be compared as well.
+        constexpr size_type max_pointer_map_size = 1024;
+        const auto ptr_it = pointer_map.find(name);
+        if (ptr_it != pointer_map.end() && names[ptr_it->second] == name) {
+            return ptr_it->second;
+        }
+        std::string name_str{name};
+        auto it = name_map.find(name_str);
+        if (it == name_map.end()) {
+            it = name_map.emplace(name_str, static_cast<int64>(names.size()))
+                     .first;
+            names.push_back(std::move(name_str));
+        }
+        if (pointer_map.size() >= max_pointer_map_size) {
+            pointer_map.clear();
+        }
+        pointer_map[name] = it->second;
+        return it->second;
+    }
+
+    void record(const trace_event& event)
+    {
+        if (events.size() < capacity) {
+            events.push_back(event);
+        } else {
+            // ring buffer: overwrite the oldest range
+            events[num_recorded % capacity] = event;
+        }
+        num_recorded++;
+    }
+
+    int64 thread_id;
+    std::thread::id owner;
+    size_type capacity;
+    // the depth of the current range nesting, including unsampled ranges
+    int64 depth{};
+    // the number of outermost ranges started so far
+    int64 num_outermost{};
+    // is the current outermost range (and everything inside it) sampled?
+    bool sampled{};
+    std::vector<trace_event> stack;
+    std::vector<trace_event> events;
+    size_type num_recorded{};
+    std::unordered_map<const char*, int64> pointer_map;
+    std::unordered_map<std::string, int64> name_map;
+    std::vector<std::string> names;
+};
+
+
+struct trace {
+    trace(std::string path, int64 sample_interval, size_type buffer_size)
+        : id{next_id++},
+          sample_interval{std::max<int64>(sample_interval, 1)},
+          buffer_size{std::max<size_type>(buffer_size, 1)},
+          start{trace_clock::now()},
+          output{path}
+    {
+        if (!output) {
+            throw GKO_STREAM_ERROR("could not open trace file " + path);
+        }
+    }
+
+    std::chrono::nanoseconds now() const
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            trace_clock::now() - start);
+    }
+
+    thread_trace& get_thread_trace()
+    {
+        // cache of the trace buffers of this thread, there is usually only a
+        // single trace logger, so a linear search suffices. The entries of
+        // traces that were destroyed are never hit again, so the oldest entry
+        // is evicted once the cache is full.
+        constexpr size_type max_cache_size = 4;
+        thread_local std::vector<std::pair<uint64, thread_trace*>> cache;
+        for (const auto& entry : cache) {
+            if (entry.first == id) {
+                return *entry.second;
+            }
+        }
+        std::lock_guard<std::mutex> guard{mutex};
+        const auto owner = std::this_thread::get_id();
+        auto it = std::find_if(
+            threads.begin(), threads.end(),
+            [&](const std::unique_ptr<thread_trace>& thread) {
+                return thread->owner == owner;
+            });
+        if (it == threads.end()) {
+            threads.push_back(std::make_unique<thread_trace>(
+                static_cast<int64>(threads.size()), buffer_size));
+            it = threads.end() - 1;
+        }
+        if (cache.size() >= max_cache_size) {
+            cache.erase(cache.begin());
+        }
+        cache.emplace_back(id, it->get());
+        return **it;
+    }
+
+    void push(const char* name, profile_event_category category)
+    {
+        auto& thread = get_thread_trace();
+        if (thread.depth++ == 0) {
+            thread.sampled = thread.num_outermost++ % sample_interval == 0;
+        }
+        if (thread.sampled) {
+            thread.stack.push_back(trace_event{thread.get_name_id(name),
+                                               category, now(), {}});
+        }
+    }
+
+    void pop()
+    {
+        const auto end = now();
+        auto& thread = get_thread_trace();
+        if (thread.depth == 0) {
+            // the range was started before the logger was attached
+            return;
+        }
+        thread.depth--;
+        if (thread.sampled) {
+            auto event = thread.stack.back();
+            thread.stack.pop_back();
+            event.end = end;
+            thread.record(event);
+        }
+    }
+
+    /**
+     * Writes all recorded ranges in the Chrome trace event format. Ranges that
+     * are still open are closed at the current time.
+     */
+    void write()
+    {
+        const auto end = now();
+        std::lock_guard<std::mutex> guard{mutex};
+        size_type num_dropped{};
+        output << std::fixed << std::setprecision(3);
+        output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+        bool first = true;
+        for (auto& thread : threads) {
+            if (!first) {
+                output << ',';
+            }
+            first = false;
+            output << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,"
+                   << "\"tid\":" << thread->thread_id
+                   << ",\"args\":{\"name\":\"thread " << thread->thread_id
+                   << "\"}}";
+            while (!thread->stack.empty()) {
+                auto event = thread->stack.back();
+                thread->stack.pop_back();
+                event.end = end;
+                thread->record(event);
+            }
+            const auto num_events = thread->events.size();
+            num_dropped += thread->num_recorded - num_events;
+            for (size_type i = 0; i < num_events; i++) {
+                // start with the oldest range in the ring buffer
+                const auto& event =
+                    thread->events[(thread->num_recorded + i) % num_events];
+                output << ",\n{\"name\":";
+                write_json_string(output, thread->names[event.name_id]);
+                output << ",\"cat\":\"" << get_category_name(event.category)
+                       << "\",\"ph\":\"X\",\"pid\":0,\"tid\":"
+                       << thread->thread_id
+                       << ",\"ts\":" << event.begin.count() / 1000.0
+                       << ",\"dur\":"
+                       << (event.end - event.begin).count() / 1000.0 << '}';
+            }
+        }
+        output << "\n]}\n";
+        output.flush();
+#if GKO_VERBOSE_LEVEL >= 1
+        if (num_dropped > 0) {
+            std::cerr << "WARNING: The trace gko::log::ProfilerHook dropped "
+                      << num_dropped
+                      << " ranges because its buffers were full.\nTo record "
+                         "all ranges, increase the buffer size or the "
+                         "sampling interval.\n";
+        }
+#endif
+    }
+
+    static std::atomic<uint64> next_id;
+
+    uint64 id;
+    int64 sample_interval;
+    size_type buffer_size;
+    trace_clock::time_point start;
+    std::ofstream output;
+    std::mutex mutex;
+    std::vector<std::unique_ptr<thread_trace>> threads;
+};
+
+
+std::atomic<uint64> trace::next_id{1};
+
+
+}  // namespace
+
+
+std::shared_ptr<ProfilerHook> ProfilerHook::create_trace_file(
+    std::string path, int64 sample_interval, size_type buffer_size)
+{
+    std::shared_ptr<trace> data{
+        new trace{std::move(path), sample_interval, buffer_size},
+        [](trace* ptr) {
+            ptr->write();
+            delete ptr;
+        }};
+    return std::shared_ptr<ProfilerHook>{new ProfilerHook{
+        [data](const char* name, profile_event_category category) {
+            data->push(name, category);
+        },
+        [data](const char*, profile_event_category) { data->pop(); }}};
+}
+
+
+}  // namespace log
+}  // namespace gko
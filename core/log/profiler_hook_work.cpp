@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/log/profiler_hook.hpp>
+
+
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+
+namespace gko {
+namespace log {
+namespace {
+
+
+/**
+ * The work of applying an operator to a single right-hand side, derived from
+ * its metadata: the bytes of the operator itself, the floating point
+ * operations and the size of its values.
+ */
+struct operator_work {
+    int64 operator_bytes{};
+    int64 flops_per_rhs{};
+    int64 value_size{};
+};
+
+
+template <typename ValueType, typename IndexType>
+bool estimate_sparse_work(const LinOp* op, operator_work& work)
+{
+    constexpr auto value_size = static_cast<int64>(sizeof(ValueType));
+    constexpr auto index_size = static_cast<int64>(sizeof(IndexType));
+    const auto num_rows = static_cast<int64>(op->get_size()[0]);
+    if (auto csr = dynamic_cast<const matrix::Csr<ValueType, IndexType>*>(op)) {
+        const auto nnz = static_cast<int64>(csr->get_num_stored_elements());
+        work = {nnz * (value_size + index_size) + (num_rows + 1) * index_size,
+                2 * nnz, value_size};
+        return true;
+    }
+    if (auto coo = dynamic_cast<const matrix::Coo<ValueType, IndexType>*>(op)) {
+        const auto nnz = static_cast<int64>(coo->get_num_stored_elements());
+        work = {nnz * (value_size + 2 * index_size), 2 * nnz, value_size};
+        return true;
+    }
+    if (auto ell = dynamic_cast<const matrix::Ell<ValueType, IndexType>*>(op)) {
+        // padding entries are loaded and multiplied as well
+        const auto stored = static_cast<int64>(ell->get_num_stored_elements());
+        work = {stored * (value_size + index_size), 2 * stored, value_size};
+        return true;
+    }
+    if (auto sellp =
+            dynamic_cast<const matrix::Sellp<ValueType, IndexType>*>(op)) {
+        const auto stored =
+            static_cast<int64>(sellp->get_num_stored_elements());
+        const auto num_slices = static_cast<int64>(
+            ceildiv(num_rows, static_cast<int64>(sellp->get_slice_size())));
+        work = {stored * (value_size + index_size) +
+                    (2 * num_slices + 1) * index_size,
+                2 * stored, value_size};
+        return true;
+    }
+    if (auto hybrid =
+            dynamic_cast<const matrix::Hybrid<ValueType, IndexType>*>(op)) {
+        operator_work ell_work;
+        operator_work coo_work;
+        estimate_sparse_work<ValueType, IndexType>(hybrid->get_ell(),
+                                                   ell_work);
+        estimate_sparse_work<ValueType, IndexType>(hybrid->get_coo(),
+                                                   coo_work);
+        work = {ell_work.operator_bytes + coo_work.operator_bytes,
+                ell_work.flops_per_rhs + coo_work.flops_per_rhs,
+                value_size};
+        return true;
+    }
+    if (auto fbcsr =
+            dynamic_cast<const matrix::Fbcsr<ValueType, IndexType>*>(op)) {
+        const auto stored =
+            static_cast<int64>(fbcsr->get_num_stored_elements());
+        const auto num_blocks =
+            static_cast<int64>(fbcsr->get_num_stored_blocks());
+        const auto num_block_rows = num_rows / fbcsr->get_block_size();
+        work = {stored * value_size + num_blocks * index_size +
+                    (num_block_rows + 1) * index_size,
+                2 * stored, value_size};
+        return true;
+    }
+    return false;
+}
+
+
+template <typename ValueType>
+bool estimate_value_work(const LinOp* op, operator_work& work)
+{
+    constexpr auto value_size = static_cast<int64>(sizeof(ValueType));
+    if (dynamic_cast<const matrix::Dense<ValueType>*>(op)) {
+        const auto entries =
+            static_cast<int64>(op->get_size()[0] * op->get_size()[1]);
+        work = {entries * value_size, 2 * entries, value_size};
+        return true;
+    }
+    if (dynamic_cast<const matrix::Diagonal<ValueType>*>(op)) {
+        const auto entries = static_cast<int64>(op->get_size()[0]);
+        work = {entries * value_size, entries, value_size};
+        return true;
+    }
+    return estimate_sparse_work<ValueType, int32>(op, work) ||
+           estimate_sparse_work<ValueType, int64>(op, work);
+}
+
+
+bool estimate_operator_work(const LinOp* op, operator_work& work)
+{
+    return estimate_value_work<float>(op, work) ||
+           estimate_value_work<double>(op, work) ||
+           estimate_value_work<std::complex<float>>(op, work) ||
+           estimate_value_work<std::complex<double>>(op, work);
+}
+
+
+/**
+ * Returns the size of the values of a dense vector, or the given fallback if
+ * the vector is not Dense.
+ */
+int64 dense_value_size(const LinOp* vec, int64 fallback)
+{
+    if (dynamic_cast<const matrix::Dense<float>*>(vec)) {
+        return sizeof(float);
+    }
+    if (dynamic_cast<const matrix::Dense<double>*>(vec)) {
+        return sizeof(double);
+    }
+    if (dynamic_cast<const matrix::Dense<std::complex<float>>*>(vec)) {
+        return sizeof(std::complex<float>);
+    }
+    if (dynamic_cast<const matrix::Dense<std::complex<double>>*>(vec)) {
+        return sizeof(std::complex<double>);
+    }
+    return fallback;
+}
+
+
+}  // namespace
+
+
+ProfilerHook::work_estimate ProfilerHook::estimate_apply_work(const LinOp* A,
+                                                              const LinOp* b,
+                                                              const LinOp* x,
+                                                              bool advanced)
+{
+    operator_work work;
+    if (!A || !b || !x || !estimate_operator_work(A, work)) {
+        return {};
+    }
+    const auto num_rhs = static_cast<int64>(b->get_size()[1]);
+    const auto b_entries = static_cast<int64>(b->get_size()[0]) * num_rhs;
+    const auto x_entries = static_cast<int64>(x->get_size()[0]) * num_rhs;
+    const auto b_value_size = dense_value_size(b, work.value_size);
+    const auto x_value_size = dense_value_size(x, work.value_size);
+    work_estimate result;
+    result.flops = work.flops_per_rhs * num_rhs;
+    // every operator entry and vector entry is transferred once, x is only
+    // read for the advanced apply
+    result.bytes = work.operator_bytes + b_entries * b_value_size +
+                   x_entries * x_value_size * (advanced ? 2 : 1);
+    if (advanced) {
+        // scaling by alpha and beta and the final addition
+        result.flops += 3 * x_entries;
+    }
+    return result;
+}
+
+
+}  // namespace log
+}  // namespace gko
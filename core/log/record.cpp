@@ -298,5 +298,26 @@ void Record::on_iteration_complete(
 }
 
 
+void Record::on_communication_started(const Executor* exec, const char* name,
+                                      int peer, size_type send_bytes,
+                                      size_type recv_bytes) const
+{
+    append_deque(data_.communication_started,
+                 (std::unique_ptr<communication_data>(new communication_data{
+                     exec, name, peer, send_bytes, recv_bytes})));
+}
+
+
+void Record::on_communication_completed(const Executor* exec,
+                                        const char* name, int peer,
+                                        size_type send_bytes,
+                                        size_type recv_bytes) const
+{
+    append_deque(data_.communication_completed,
+                 (std::unique_ptr<communication_data>(new communication_data{
+                     exec, name, peer, send_bytes, recv_bytes})));
+}
+
+
 }  // namespace log
 }  // namespace gko
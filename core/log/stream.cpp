@@ -483,6 +483,32 @@ void Stream<ValueType>::on_iteration_complete(
 }
 
 
+template <typename ValueType>
+void Stream<ValueType>::on_communication_started(const Executor* exec,
+                                                 const char* name, int peer,
+                                                 size_type send_bytes,
+                                                 size_type recv_bytes) const
+{
+    *os_ << prefix_ << "communication " << name << " started on "
+         << demangle_name(exec) << " with peer " << peer << " sending "
+         << bytes_name(send_bytes) << " receiving " << bytes_name(recv_bytes)
+         << std::endl;
+}
+
+
+template <typename ValueType>
+void Stream<ValueType>::on_communication_completed(const Executor* exec,
+                                                   const char* name, int peer,
+                                                   size_type send_bytes,
+                                                   size_type recv_bytes) const
+{
+    *os_ << prefix_ << "communication " << name << " completed on "
+         << demangle_name(exec) << " with peer " << peer << " sending "
+         << bytes_name(send_bytes) << " receiving " << bytes_name(recv_bytes)
+         << std::endl;
+}
+
+
 #define GKO_DECLARE_STREAM(_type) class Stream<_type>
 GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_STREAM);
 
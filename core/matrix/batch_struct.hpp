@@ -11,6 +11,7 @@
 #include <ginkgo/core/matrix/batch_csr.hpp>
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
 
 
 namespace gko {
@@ -165,6 +166,41 @@ struct uniform_batch {
 }  // namespace ell
 
 
+namespace variable_csr {
+
+
+/**
+ * A 'simple' structure to store a global batch of csr matrices whose items
+ * have individual sizes and sparsity patterns. A single item of the batch is
+ * a regular csr::batch_item.
+ */
+template <typename ValueType, typename IndexType>
+struct variable_batch {
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using entry_type = csr::batch_item<value_type, index_type>;
+
+    ValueType* values;
+    const index_type* col_idxs;
+    const index_type* row_ptrs;
+    const index_type* item_row_offsets;
+    const index_type* item_nnz_offsets;
+    size_type num_batch_items;
+    // the largest number of rows and columns of any item
+    index_type num_rows;
+    index_type num_cols;
+    index_type max_num_nnz_per_item;
+
+    inline size_type get_single_item_num_nnz() const
+    {
+        return static_cast<size_type>(max_num_nnz_per_item);
+    }
+};
+
+
+}  // namespace variable_csr
+
+
 template <typename ValueType, typename IndexType>
 GKO_ATTRIBUTES GKO_INLINE csr::batch_item<const ValueType, const IndexType>
 to_const(const csr::batch_item<ValueType, IndexType>& b)
@@ -213,6 +249,35 @@ extract_batch_item(ValueType* const batch_values,
 }
 
 
+template <typename ValueType, typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE
+    variable_csr::variable_batch<const ValueType, const IndexType>
+    to_const(const variable_csr::variable_batch<ValueType, IndexType>& vb)
+{
+    return {vb.values,           vb.col_idxs,         vb.row_ptrs,
+            vb.item_row_offsets, vb.item_nnz_offsets, vb.num_batch_items,
+            vb.num_rows,         vb.num_cols,         vb.max_num_nnz_per_item};
+}
+
+
+template <typename ValueType, typename IndexType>
+GKO_ATTRIBUTES GKO_INLINE csr::batch_item<ValueType, IndexType>
+extract_batch_item(
+    const variable_csr::variable_batch<ValueType, IndexType>& batch,
+    const size_type batch_idx)
+{
+    const auto row_begin = batch.item_row_offsets[batch_idx];
+    const auto nnz_begin = batch.item_nnz_offsets[batch_idx];
+    const auto num_rows = batch.item_row_offsets[batch_idx + 1] - row_begin;
+    return {batch.values + nnz_begin,
+            batch.col_idxs + nnz_begin,
+            batch.row_ptrs + row_begin + batch_idx,
+            num_rows,
+            num_rows,
+            batch.item_nnz_offsets[batch_idx + 1] - nnz_begin};
+}
+
+
 template <typename ValueType>
 GKO_ATTRIBUTES GKO_INLINE dense::batch_item<const ValueType> to_const(
     const dense::batch_item<ValueType>& b)
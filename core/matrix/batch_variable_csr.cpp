@@ -0,0 +1,377 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
+
+
+#include <algorithm>
+#include <type_traits>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/matrix/batch_variable_csr_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace matrix {
+namespace variable_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(simple_apply, batch_variable_csr::simple_apply);
+GKO_REGISTER_OPERATION(advanced_apply, batch_variable_csr::advanced_apply);
+
+
+}  // namespace
+}  // namespace variable_csr
+
+
+template <typename ValueType, typename IndexType>
+dim<2> VariableCsr<ValueType, IndexType>::get_item_size(
+    size_type item_id) const
+{
+    GKO_ASSERT(item_id < this->get_num_batch_items());
+    auto exec = this->get_executor();
+    const auto begin = exec->copy_val_to_host(
+        item_row_offsets_.get_const_data() + item_id);
+    const auto end = exec->copy_val_to_host(
+        item_row_offsets_.get_const_data() + item_id + 1);
+    const auto num_rows = static_cast<size_type>(end - begin);
+    return dim<2>{num_rows, num_rows};
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type VariableCsr<ValueType, IndexType>::get_num_elements_for_item(
+    size_type item_id) const
+{
+    GKO_ASSERT(item_id < this->get_num_batch_items());
+    auto exec = this->get_executor();
+    const auto begin = exec->copy_val_to_host(
+        item_nnz_offsets_.get_const_data() + item_id);
+    const auto end = exec->copy_val_to_host(
+        item_nnz_offsets_.get_const_data() + item_id + 1);
+    return static_cast<size_type>(end - begin);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<gko::matrix::Csr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create_view_for_item(size_type item_id)
+{
+    auto exec = this->get_executor();
+    const auto size = this->get_item_size(item_id);
+    const auto num_nnz = this->get_num_elements_for_item(item_id);
+    const auto row_begin = exec->copy_val_to_host(
+        item_row_offsets_.get_const_data() + item_id);
+    const auto nnz_begin = exec->copy_val_to_host(
+        item_nnz_offsets_.get_const_data() + item_id);
+    auto mat = unbatch_type::create(
+        exec, size,
+        make_array_view(exec, num_nnz, this->get_values() + nnz_begin),
+        make_array_view(exec, num_nnz, this->get_col_idxs() + nnz_begin),
+        make_array_view(exec, size[0] + 1,
+                        this->get_row_ptrs() + row_begin + item_id));
+    return mat;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<const gko::matrix::Csr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create_const_view_for_item(
+    size_type item_id) const
+{
+    auto exec = this->get_executor();
+    const auto size = this->get_item_size(item_id);
+    const auto num_nnz = this->get_num_elements_for_item(item_id);
+    const auto row_begin = exec->copy_val_to_host(
+        item_row_offsets_.get_const_data() + item_id);
+    const auto nnz_begin = exec->copy_val_to_host(
+        item_nnz_offsets_.get_const_data() + item_id);
+    auto mat = unbatch_type::create_const(
+        exec, size,
+        make_const_array_view(exec, num_nnz,
+                              this->get_const_values() + nnz_begin),
+        make_const_array_view(exec, num_nnz,
+                              this->get_const_col_idxs() + nnz_begin),
+        make_const_array_view(exec, size[0] + 1,
+                              this->get_const_row_ptrs() + row_begin +
+                                  item_id));
+    return mat;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<VariableCsr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec)
+{
+    return std::unique_ptr<VariableCsr>{new VariableCsr{exec}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<VariableCsr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, size_type num_batch_items,
+    array<value_type> values, array<index_type> col_idxs,
+    array<index_type> row_ptrs, array<index_type> item_row_offsets,
+    array<index_type> item_nnz_offsets)
+{
+    return std::unique_ptr<VariableCsr>{new VariableCsr{
+        exec, num_batch_items, std::move(values), std::move(col_idxs),
+        std::move(row_ptrs), std::move(item_row_offsets),
+        std::move(item_nnz_offsets)}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<VariableCsr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create_from_items(
+    std::shared_ptr<const Executor> exec,
+    const std::vector<const unbatch_type*>& items)
+{
+    const auto num_batch_items = items.size();
+    const auto host_exec = exec->get_master();
+    array<index_type> item_row_offsets(host_exec, num_batch_items + 1);
+    array<index_type> item_nnz_offsets(host_exec, num_batch_items + 1);
+    auto row_offsets = item_row_offsets.get_data();
+    auto nnz_offsets = item_nnz_offsets.get_data();
+    row_offsets[0] = 0;
+    nnz_offsets[0] = 0;
+    for (size_type item = 0; item < num_batch_items; ++item) {
+        GKO_ASSERT_IS_SQUARE_MATRIX(items[item]);
+        row_offsets[item + 1] =
+            row_offsets[item] +
+            static_cast<index_type>(items[item]->get_size()[0]);
+        nnz_offsets[item + 1] =
+            nnz_offsets[item] +
+            static_cast<index_type>(items[item]->get_num_stored_elements());
+    }
+    array<value_type> values(exec, nnz_offsets[num_batch_items]);
+    array<index_type> col_idxs(exec, nnz_offsets[num_batch_items]);
+    array<index_type> row_ptrs(exec,
+                               row_offsets[num_batch_items] + num_batch_items);
+    for (size_type item = 0; item < num_batch_items; ++item) {
+        const auto num_rows = items[item]->get_size()[0];
+        const auto num_nnz = items[item]->get_num_stored_elements();
+        const auto item_exec = items[item]->get_executor();
+        exec->copy_from(item_exec, num_nnz, items[item]->get_const_values(),
+                        values.get_data() + nnz_offsets[item]);
+        exec->copy_from(item_exec, num_nnz, items[item]->get_const_col_idxs(),
+                        col_idxs.get_data() + nnz_offsets[item]);
+        exec->copy_from(item_exec, num_rows + 1,
+                        items[item]->get_const_row_ptrs(),
+                        row_ptrs.get_data() + row_offsets[item] + item);
+    }
+    return create(exec, num_batch_items, std::move(values), std::move(col_idxs),
+                  std::move(row_ptrs), std::move(item_row_offsets),
+                  std::move(item_nnz_offsets));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<const VariableCsr<ValueType, IndexType>>
+VariableCsr<ValueType, IndexType>::create_const(
+    std::shared_ptr<const Executor> exec, size_type num_batch_items,
+    gko::detail::const_array_view<ValueType>&& values,
+    gko::detail::const_array_view<IndexType>&& col_idxs,
+    gko::detail::const_array_view<IndexType>&& row_ptrs,
+    gko::detail::const_array_view<IndexType>&& item_row_offsets,
+    gko::detail::const_array_view<IndexType>&& item_nnz_offsets)
+{
+    // cast const-ness away, but return a const object afterwards,
+    // so we can ensure that no modifications take place.
+    return std::unique_ptr<const VariableCsr>(new VariableCsr{
+        exec, num_batch_items,
+        gko::detail::array_const_cast(std::move(values)),
+        gko::detail::array_const_cast(std::move(col_idxs)),
+        gko::detail::array_const_cast(std::move(row_ptrs)),
+        gko::detail::array_const_cast(std::move(item_row_offsets)),
+        gko::detail::array_const_cast(std::move(item_nnz_offsets))});
+}
+
+
+template <typename ValueType, typename IndexType>
+VariableCsr<ValueType, IndexType>::VariableCsr(
+    std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<VariableCsr<ValueType, IndexType>>(exec),
+      values_(exec),
+      col_idxs_(exec),
+      row_ptrs_(exec),
+      item_row_offsets_(exec, 1),
+      item_nnz_offsets_(exec, 1),
+      max_num_elements_per_item_{}
+{
+    item_row_offsets_.fill(0);
+    item_nnz_offsets_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+VariableCsr<ValueType, IndexType>::VariableCsr(
+    std::shared_ptr<const Executor> exec, size_type num_batch_items,
+    array<value_type> values, array<index_type> col_idxs,
+    array<index_type> row_ptrs, array<index_type> item_row_offsets,
+    array<index_type> item_nnz_offsets)
+    : EnableBatchLinOp<VariableCsr<ValueType, IndexType>>(exec),
+      values_{exec, std::move(values)},
+      col_idxs_{exec, std::move(col_idxs)},
+      row_ptrs_{exec, std::move(row_ptrs)},
+      item_row_offsets_{exec, std::move(item_row_offsets)},
+      item_nnz_offsets_{exec, std::move(item_nnz_offsets)},
+      max_num_elements_per_item_{}
+{
+    GKO_ASSERT_EQ(item_row_offsets_.get_size(), num_batch_items + 1);
+    GKO_ASSERT_EQ(item_nnz_offsets_.get_size(), num_batch_items + 1);
+    GKO_ASSERT_EQ(values_.get_size(), col_idxs_.get_size());
+    // the item sizes are needed on the host to determine the common size and
+    // the workspace requirements, so we compute them once here.
+    const array<index_type> host_row_offsets{exec->get_master(),
+                                             item_row_offsets_};
+    const array<index_type> host_nnz_offsets{exec->get_master(),
+                                             item_nnz_offsets_};
+    const auto row_offsets = host_row_offsets.get_const_data();
+    const auto nnz_offsets = host_nnz_offsets.get_const_data();
+    GKO_ASSERT_EQ(row_ptrs_.get_size(),
+                  static_cast<size_type>(row_offsets[num_batch_items]) +
+                      num_batch_items);
+    GKO_ASSERT_EQ(values_.get_size(),
+                  static_cast<size_type>(nnz_offsets[num_batch_items]));
+    size_type max_num_rows{};
+    for (size_type item = 0; item < num_batch_items; ++item) {
+        max_num_rows = std::max(
+            max_num_rows,
+            static_cast<size_type>(row_offsets[item + 1] - row_offsets[item]));
+        max_num_elements_per_item_ = std::max(
+            max_num_elements_per_item_,
+            static_cast<size_type>(nnz_offsets[item + 1] - nnz_offsets[item]));
+    }
+    if (num_batch_items > 0) {
+        this->set_size(
+            batch_dim<2>(num_batch_items, dim<2>{max_num_rows, max_num_rows}));
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+VariableCsr<ValueType, IndexType>* VariableCsr<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<MultiVector<ValueType>> x)
+{
+    this->validate_application_parameters(b.get(), x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+const VariableCsr<ValueType, IndexType>*
+VariableCsr<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<MultiVector<ValueType>> x) const
+{
+    this->validate_application_parameters(b.get(), x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+VariableCsr<ValueType, IndexType>* VariableCsr<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> alpha,
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<const MultiVector<ValueType>> beta,
+    ptr_param<MultiVector<ValueType>> x)
+{
+    this->validate_application_parameters(alpha.get(), b.get(), beta.get(),
+                                          x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, alpha).get(),
+                     make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, beta).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+const VariableCsr<ValueType, IndexType>*
+VariableCsr<ValueType, IndexType>::apply(
+    ptr_param<const MultiVector<ValueType>> alpha,
+    ptr_param<const MultiVector<ValueType>> b,
+    ptr_param<const MultiVector<ValueType>> beta,
+    ptr_param<MultiVector<ValueType>> x) const
+{
+    this->validate_application_parameters(alpha.get(), b.get(), beta.get(),
+                                          x.get());
+    auto exec = this->get_executor();
+    this->apply_impl(make_temporary_clone(exec, alpha).get(),
+                     make_temporary_clone(exec, b).get(),
+                     make_temporary_clone(exec, beta).get(),
+                     make_temporary_clone(exec, x).get());
+    return this;
+}
+
+
+template <typename ValueType, typename IndexType>
+void VariableCsr<ValueType, IndexType>::apply_impl(
+    const MultiVector<ValueType>* b, MultiVector<ValueType>* x) const
+{
+    this->get_executor()->run(variable_csr::make_simple_apply(this, b, x));
+}
+
+
+template <typename ValueType, typename IndexType>
+void VariableCsr<ValueType, IndexType>::apply_impl(
+    const MultiVector<ValueType>* alpha, const MultiVector<ValueType>* b,
+    const MultiVector<ValueType>* beta, MultiVector<ValueType>* x) const
+{
+    this->get_executor()->run(
+        variable_csr::make_advanced_apply(alpha, this, b, beta, x));
+}
+
+
+template <typename ValueType, typename IndexType>
+void VariableCsr<ValueType, IndexType>::convert_to(
+    VariableCsr<next_precision<ValueType>, IndexType>* result) const
+{
+    result->values_ = this->values_;
+    result->col_idxs_ = this->col_idxs_;
+    result->row_ptrs_ = this->row_ptrs_;
+    result->item_row_offsets_ = this->item_row_offsets_;
+    result->item_nnz_offsets_ = this->item_nnz_offsets_;
+    result->max_num_elements_per_item_ = this->max_num_elements_per_item_;
+    result->set_size(this->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void VariableCsr<ValueType, IndexType>::move_to(
+    VariableCsr<next_precision<ValueType>, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+#define GKO_DECLARE_BATCH_VARIABLE_CSR_MATRIX(ValueType) \
+    class VariableCsr<ValueType, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_VARIABLE_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace batch
+}  // namespace gko
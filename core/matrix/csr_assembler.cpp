@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/array_access.hpp"
+#include "core/components/fill_array_kernels.hpp"
+#include "core/matrix/csr_assembly_kernels.hpp"
+#include "core/matrix/csr_kernels.hpp"
+#include "core/matrix/csr_lookup.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace csr_assembly {
+namespace {
+
+
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+GKO_REGISTER_OPERATION(build_lookup_offsets, csr::build_lookup_offsets);
+GKO_REGISTER_OPERATION(build_lookup, csr::build_lookup);
+GKO_REGISTER_OPERATION(build_pattern, csr_assembly::build_pattern);
+GKO_REGISTER_OPERATION(add_elements, csr_assembly::add_elements);
+GKO_REGISTER_OPERATION(add_values, csr_assembly::add_values);
+
+
+/**
+ * Throws an OutOfBoundsError if the largest index found by a kernel is not
+ * smaller than the bound. Negative indices mark ignored entries, so a negative
+ * maximum means that all entries were ignored.
+ */
+template <typename IndexType>
+void ensure_in_bounds(IndexType max_idx, size_type bound)
+{
+    if (max_idx >= 0) {
+        GKO_ENSURE_IN_BOUNDS(static_cast<size_type>(max_idx), bound);
+    }
+}
+
+
+}  // anonymous namespace
+}  // namespace csr_assembly
+
+
+template <typename ValueType, typename IndexType>
+CsrAssembler<ValueType, IndexType>::CsrAssembler(
+    std::shared_ptr<matrix_type> mtx)
+    : mtx_{std::move(mtx)}
+{
+    const auto exec = mtx_->get_executor();
+    const auto num_rows = mtx_->get_size()[0];
+    storage_offsets_ = array<index_type>{exec, num_rows + 1};
+    row_descs_ = array<int64>{exec, num_rows};
+    const auto allowed = csr::sparsity_type::bitmap |
+                         csr::sparsity_type::full | csr::sparsity_type::hash;
+    exec->run(csr_assembly::make_build_lookup_offsets(
+        mtx_->get_const_row_ptrs(), mtx_->get_const_col_idxs(), num_rows,
+        allowed, storage_offsets_.get_data()));
+    const auto storage_size =
+        static_cast<size_type>(get_element(storage_offsets_, num_rows));
+    storage_ = array<int32>{exec, storage_size};
+    exec->run(csr_assembly::make_build_lookup(
+        mtx_->get_const_row_ptrs(), mtx_->get_const_col_idxs(), num_rows,
+        allowed, storage_offsets_.get_const_data(), row_descs_.get_data(),
+        storage_.get_data()));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<CsrAssembler<ValueType, IndexType>>
+CsrAssembler<ValueType, IndexType>::create(std::shared_ptr<matrix_type> mtx)
+{
+    return std::unique_ptr<CsrAssembler>{new CsrAssembler{std::move(mtx)}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<CsrAssembler<ValueType, IndexType>>
+CsrAssembler<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, dim<2> size,
+    const array<index_type>& element_dofs, size_type dofs_per_element)
+{
+    if (dofs_per_element == 0) {
+        GKO_INVALID_STATE("elements need at least one degree of freedom");
+    }
+    GKO_ASSERT_EQ(element_dofs.get_size() % dofs_per_element, 0);
+    const auto num_elements = element_dofs.get_size() / dofs_per_element;
+    // the dofs are used both as row and column indices
+    const auto num_dofs = std::min(size[0], size[1]);
+    const auto local_dofs = make_temporary_clone(exec, &element_dofs);
+    array<index_type> row_ptrs{exec, size[0] + 1};
+    array<index_type> col_idxs{exec};
+    index_type max_dof{};
+    exec->run(csr_assembly::make_build_pattern(
+        local_dofs->get_const_data(), num_elements, dofs_per_element, size[0],
+        num_dofs, row_ptrs.get_data(), col_idxs, max_dof));
+    csr_assembly::ensure_in_bounds(max_dof, num_dofs);
+    array<value_type> values{exec, col_idxs.get_size()};
+    values.fill(zero<value_type>());
+    return create(std::shared_ptr<matrix_type>{
+        matrix_type::create(exec, size, std::move(values), std::move(col_idxs),
+                            std::move(row_ptrs))});
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::zero_values()
+{
+    const auto exec = mtx_->get_executor();
+    exec->run(csr_assembly::make_fill_array(mtx_->get_values(),
+                                            mtx_->get_num_stored_elements(),
+                                            zero<value_type>()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::add_elements(
+    const array<index_type>& element_dofs,
+    const array<value_type>& element_values, size_type dofs_per_element)
+{
+    if (dofs_per_element == 0) {
+        GKO_INVALID_STATE("elements need at least one degree of freedom");
+    }
+    GKO_ASSERT_EQ(element_dofs.get_size() % dofs_per_element, 0);
+    const auto num_elements = element_dofs.get_size() / dofs_per_element;
+    GKO_ASSERT_EQ(element_values.get_size(),
+                  num_elements * dofs_per_element * dofs_per_element);
+    const auto num_dofs = std::min(mtx_->get_size()[0], mtx_->get_size()[1]);
+    const auto exec = mtx_->get_executor();
+    const auto local_dofs = make_temporary_clone(exec, &element_dofs);
+    const auto local_values = make_temporary_clone(exec, &element_values);
+    index_type max_dof{};
+    exec->run(csr_assembly::make_add_elements(
+        local_dofs->get_const_data(), local_values->get_const_data(),
+        num_elements, dofs_per_element, num_dofs, mtx_->get_const_row_ptrs(),
+        mtx_->get_const_col_idxs(), storage_offsets_.get_const_data(),
+        row_descs_.get_const_data(), storage_.get_const_data(),
+        mtx_->get_values(), max_dof));
+    csr_assembly::ensure_in_bounds(max_dof, num_dofs);
+}
+
+
+template <typename ValueType, typename IndexType>
+void CsrAssembler<ValueType, IndexType>::add_values(
+    const array<index_type>& row_idxs, const array<index_type>& col_idxs,
+    const array<value_type>& values)
+{
+    GKO_ASSERT_EQ(row_idxs.get_size(), values.get_size());
+    GKO_ASSERT_EQ(col_idxs.get_size(), values.get_size());
+    const auto size = mtx_->get_size();
+    const auto exec = mtx_->get_executor();
+    const auto local_rows = make_temporary_clone(exec, &row_idxs);
+    const auto local_cols = make_temporary_clone(exec, &col_idxs);
+    const auto local_values = make_temporary_clone(exec, &values);
+    index_type max_row{};
+    index_type max_col{};
+    exec->run(csr_assembly::make_add_values(
+        local_rows->get_const_data(), local_cols->get_const_data(),
+        local_values->get_const_data(), values.get_size(), size[0], size[1],
+        mtx_->get_const_row_ptrs(), mtx_->get_const_col_idxs(),
+        storage_offsets_.get_const_data(), row_descs_.get_const_data(),
+        storage_.get_const_data(), mtx_->get_values(), max_row, max_col));
+    csr_assembly::ensure_in_bounds(max_row, size[0]);
+    csr_assembly::ensure_in_bounds(max_col, size[1]);
+}
+
+
+#define GKO_DECLARE_CSR_ASSEMBLER(ValueType, IndexType) \
+    class CsrAssembler<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_CSR_ASSEMBLER);
+
+
+}  // namespace matrix
+}  // namespace gko
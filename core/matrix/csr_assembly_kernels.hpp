@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_CSR_ASSEMBLY_KERNELS_HPP_
+#define GKO_CORE_MATRIX_CSR_ASSEMBLY_KERNELS_HPP_
+
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL(IndexType)            \
+    void build_pattern(std::shared_ptr<const DefaultExecutor> exec,         \
+                       const IndexType* element_dofs,                       \
+                       size_type num_elements, size_type dofs_per_element, \
+                       size_type num_rows, size_type num_dofs,              \
+                       IndexType* row_ptrs, array<IndexType>& col_idxs,     \
+                       IndexType& max_dof)
+
+#define GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL(ValueType, IndexType)   \
+    void add_elements(std::shared_ptr<const DefaultExecutor> exec,           \
+                      const IndexType* element_dofs,                         \
+                      const ValueType* element_values,                       \
+                      size_type num_elements, size_type dofs_per_element,    \
+                      size_type num_dofs, const IndexType* row_ptrs,         \
+                      const IndexType* col_idxs,                             \
+                      const IndexType* storage_offsets, const int64* row_desc, \
+                      const int32* storage, ValueType* values,               \
+                      IndexType& max_dof)
+
+#define GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL(ValueType, IndexType)     \
+    void add_values(std::shared_ptr<const DefaultExecutor> exec,             \
+                    const IndexType* row_idxs, const IndexType* entry_cols,  \
+                    const ValueType* entry_values, size_type num_entries,    \
+                    size_type num_rows, size_type num_cols,                  \
+                    const IndexType* row_ptrs, const IndexType* col_idxs,    \
+                    const IndexType* storage_offsets, const int64* row_desc, \
+                    const int32* storage, ValueType* values,                 \
+                    IndexType& max_row, IndexType& max_col)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                   \
+    template <typename IndexType>                                      \
+    GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL(IndexType);          \
+    template <typename ValueType, typename IndexType>                  \
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                  \
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL(ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(csr_assembly,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_CSR_ASSEMBLY_KERNELS_HPP_
@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_FBCSR_BLOCK_INVERSE_HPP_
+#define GKO_CORE_MATRIX_FBCSR_BLOCK_INVERSE_HPP_
+
+
+#include <utility>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace fbcsr {
+
+
+/**
+ * @internal
+ *
+ * Computes the inverse of a dense block stored in column-major order, like the
+ * blocks of an Fbcsr matrix, using Gauss-Jordan elimination with partial
+ * pivoting. A singular block results in non-finite values in the inverse.
+ *
+ * @param block_size  the number of rows and columns of the block
+ * @param block  the block to invert, it is overwritten during the inversion
+ * @param inverse  the output block for the inverse
+ */
+template <typename ValueType>
+void invert_block(int block_size, ValueType* block, ValueType* inverse)
+{
+    using std::swap;
+    const auto idx = [block_size](int row, int col) {
+        return row + col * block_size;
+    };
+    for (int col = 0; col < block_size; col++) {
+        for (int row = 0; row < block_size; row++) {
+            inverse[idx(row, col)] =
+                row == col ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+    for (int k = 0; k < block_size; k++) {
+        auto pivot = k;
+        for (int row = k + 1; row < block_size; row++) {
+            if (abs(block[idx(row, k)]) > abs(block[idx(pivot, k)])) {
+                pivot = row;
+            }
+        }
+        if (pivot != k) {
+            for (int col = 0; col < block_size; col++) {
+                swap(block[idx(k, col)], block[idx(pivot, col)]);
+                swap(inverse[idx(k, col)], inverse[idx(pivot, col)]);
+            }
+        }
+        const auto scale = one<ValueType>() / block[idx(k, k)];
+        for (int col = 0; col < block_size; col++) {
+            block[idx(k, col)] *= scale;
+            inverse[idx(k, col)] *= scale;
+        }
+        for (int row = 0; row < block_size; row++) {
+            const auto factor = block[idx(row, k)];
+            if (row == k || is_zero(factor)) {
+                continue;
+            }
+            for (int col = 0; col < block_size; col++) {
+                block[idx(row, col)] -= factor * block[idx(k, col)];
+                inverse[idx(row, col)] -= factor * inverse[idx(k, col)];
+            }
+        }
+    }
+}
+
+
+}  // namespace fbcsr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_FBCSR_BLOCK_INVERSE_HPP_
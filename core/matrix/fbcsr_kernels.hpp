@@ -78,27 +78,53 @@ namespace kernels {
                           const matrix::Fbcsr<ValueType, IndexType>* orig, \
                           matrix::Diagonal<ValueType>* diag)
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES                                    \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_SPMV_KERNEL(ValueType, IndexType);                \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);       \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_FILL_IN_MATRIX_DATA_KERNEL(ValueType, IndexType); \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_FILL_IN_DENSE_KERNEL(ValueType, IndexType);       \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType);      \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_TRANSPOSE_KERNEL(ValueType, IndexType);           \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_CONJ_TRANSPOSE_KERNEL(ValueType, IndexType);      \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_IS_SORTED_BY_COLUMN_INDEX(ValueType, IndexType);  \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_SORT_BY_COLUMN_INDEX(ValueType, IndexType);       \
-    template <typename ValueType, typename IndexType>                   \
-    GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL(ValueType, IndexType)
+#define GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL(ValueType, IndexType) \
+    void invert_diagonal_blocks(                                              \
+        std::shared_ptr<const DefaultExecutor> exec,                          \
+        const matrix::Fbcsr<ValueType, IndexType>* mtx,                       \
+        ValueType* inv_diag_blocks)
+
+#define GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL(ValueType, IndexType)   \
+    void lower_trs(std::shared_ptr<const DefaultExecutor> exec,    \
+                   const matrix::Fbcsr<ValueType, IndexType>* mtx, \
+                   const ValueType* inv_diag_blocks,               \
+                   const matrix::Dense<ValueType>* b,              \
+                   matrix::Dense<ValueType>* x)
+
+#define GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL(ValueType, IndexType)   \
+    void upper_trs(std::shared_ptr<const DefaultExecutor> exec,    \
+                   const matrix::Fbcsr<ValueType, IndexType>* mtx, \
+                   const ValueType* inv_diag_blocks,               \
+                   const matrix::Dense<ValueType>* b,              \
+                   matrix::Dense<ValueType>* x)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                       \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_SPMV_KERNEL(ValueType, IndexType);                   \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_ADVANCED_SPMV_KERNEL(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_FILL_IN_MATRIX_DATA_KERNEL(ValueType, IndexType);    \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_FILL_IN_DENSE_KERNEL(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_CONVERT_TO_CSR_KERNEL(ValueType, IndexType);         \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_TRANSPOSE_KERNEL(ValueType, IndexType);              \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_CONJ_TRANSPOSE_KERNEL(ValueType, IndexType);         \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_IS_SORTED_BY_COLUMN_INDEX(ValueType, IndexType);     \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_SORT_BY_COLUMN_INDEX(ValueType, IndexType);          \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL(ValueType, IndexType);              \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL(ValueType, IndexType);              \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(fbcsr, GKO_DECLARE_ALL_AS_TEMPLATES);
@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/components/precision_conversion_kernels.hpp"
+#include "core/matrix/reduced_csr_kernels.hpp"
+#include "core/matrix/reduced_csr_storage.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace reduced_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, reduced_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, reduced_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(convert_precision, components::convert_precision);
+
+
+}  // anonymous namespace
+}  // namespace reduced_csr
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                  LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                reduced_csr::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                  const LinOp* b,
+                                                  const LinOp* beta,
+                                                  LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(reduced_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>& ReducedCsr<ValueType, IndexType>::operator=(
+    const ReducedCsr<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<ReducedCsr>::operator=(other);
+        storage_ = other.storage_;
+        values_ = other.values_;
+        col_idxs_ = other.col_idxs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>& ReducedCsr<ValueType, IndexType>::operator=(
+    ReducedCsr<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<ReducedCsr>::operator=(std::move(other));
+        storage_ = other.storage_;
+        values_ = std::move(other.values_);
+        col_idxs_ = std::move(other.col_idxs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(
+    const ReducedCsr<ValueType, IndexType>& other)
+    : ReducedCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(
+    ReducedCsr<ValueType, IndexType>&& other)
+    : ReducedCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+ReducedCsr<ValueType, IndexType>::ReducedCsr(
+    std::shared_ptr<const Executor> exec, reduced_storage storage)
+    : EnableLinOp<ReducedCsr>(exec),
+      storage_{storage},
+      values_(exec),
+      col_idxs_(exec),
+      row_ptrs_(exec, 1)
+{
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ReducedCsr<ValueType, IndexType>>
+ReducedCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                         reduced_storage storage)
+{
+    return std::unique_ptr<ReducedCsr>{new ReducedCsr{exec, storage}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<ReducedCsr<ValueType, IndexType>>
+ReducedCsr<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                         const LinOp* matrix,
+                                         reduced_storage storage)
+{
+    auto result = create(exec, storage);
+    result->compress(
+        copy_and_convert_to<Csr<ValueType, IndexType>>(exec, matrix).get());
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::compress(
+    const Csr<ValueType, IndexType>* source)
+{
+    auto exec = this->get_executor();
+    const auto nnz = source->get_num_stored_elements();
+    this->set_size(source->get_size());
+    row_ptrs_ = make_const_array_view(exec, source->get_size()[0] + 1,
+                                      source->get_const_row_ptrs());
+    col_idxs_ =
+        make_const_array_view(exec, nnz, source->get_const_col_idxs());
+    values_.resize_and_reset(nnz);
+    reduced_csr::run_with_storage_type(storage_, [&](auto tag) {
+        using storage_type = decltype(tag);
+        exec->run(reduced_csr::make_convert_precision(
+            nnz, source->get_const_values(),
+            reinterpret_cast<storage_type*>(values_.get_data())));
+    });
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto nnz = this->get_num_stored_elements();
+    auto tmp = Csr<ValueType, IndexType>::create(
+        exec, this->get_size(), array<ValueType>{exec, nnz},
+        array<IndexType>{exec, col_idxs_}, array<IndexType>{exec, row_ptrs_},
+        result->get_strategy());
+    reduced_csr::run_with_storage_type(storage_, [&](auto tag) {
+        using storage_type = decltype(tag);
+        exec->run(reduced_csr::make_convert_precision(
+            nnz,
+            reinterpret_cast<const storage_type*>(values_.get_const_data()),
+            tmp->get_values()));
+    });
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(std::move(data));
+    this->compress(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void ReducedCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+#define GKO_DECLARE_REDUCED_CSR_MATRIX(ValueType, IndexType) \
+    class ReducedCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
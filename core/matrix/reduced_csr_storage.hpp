@@ -0,0 +1,47 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
+#define GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
+
+
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+
+#include "core/base/extended_float.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace reduced_csr {
+
+
+/**
+ * Calls the functor with a default-constructed object of the 16-bit type
+ * corresponding to the given storage format, so the packed values can be
+ * reinterpreted as `const decltype(tag)*` inside the functor.
+ *
+ * @param storage  the storage format
+ * @param fn  the functor to call with the storage type tag
+ */
+template <typename Functor>
+void run_with_storage_type(reduced_storage storage, Functor&& fn)
+{
+    static_assert(sizeof(half) == sizeof(uint16) &&
+                      sizeof(bfloat16) == sizeof(uint16),
+                  "the storage types need to be 16 bits wide");
+    if (storage == reduced_storage::float16) {
+        fn(half{});
+    } else {
+        fn(bfloat16{});
+    }
+}
+
+
+}  // namespace reduced_csr
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_REDUCED_CSR_STORAGE_HPP_
@@ -0,0 +1,436 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/spmv_autotuner.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <sstream>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/name_demangling.hpp>
+#include <ginkgo/core/base/timer.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace {
+
+
+/**
+ * Creates a Csr strategy of the given type for the given executor if possible,
+ * falls back to classical for executors without support for this strategy.
+ *
+ * @tparam Strategy  one of Csr::automatical or Csr::load_balance
+ */
+template <typename Strategy, typename CsrType>
+std::shared_ptr<typename CsrType::strategy_type> create_gpu_strategy(
+    std::shared_ptr<const Executor> exec)
+{
+    if (auto cuda = std::dynamic_pointer_cast<const CudaExecutor>(exec)) {
+        return std::make_shared<Strategy>(cuda);
+    } else if (auto hip = std::dynamic_pointer_cast<const HipExecutor>(exec)) {
+        return std::make_shared<Strategy>(hip);
+    } else if (auto dpcpp =
+                   std::dynamic_pointer_cast<const DpcppExecutor>(exec)) {
+        return std::make_shared<Strategy>(dpcpp);
+    } else {
+        return std::make_shared<typename CsrType::classical>();
+    }
+}
+
+
+using format_factory =
+    std::function<std::unique_ptr<LinOp>(std::shared_ptr<const Executor>)>;
+
+
+template <typename MatrixType, typename... Args>
+format_factory create_matrix_type(Args... args)
+{
+    return [=](std::shared_ptr<const Executor> exec) {
+        return std::unique_ptr<LinOp>{MatrixType::create(exec, args...)};
+    };
+}
+
+
+template <typename CsrType, typename Strategy>
+format_factory create_csr_with_gpu_strategy()
+{
+    return [](std::shared_ptr<const Executor> exec) {
+        auto strategy = create_gpu_strategy<Strategy, CsrType>(exec);
+        return std::unique_ptr<LinOp>{
+            CsrType::create(std::move(exec), std::move(strategy))};
+    };
+}
+
+
+// the single table of Ginkgo formats, also used by the SpMV benchmarks
+template <typename ValueType, typename IndexType>
+const std::map<std::string, format_factory>& get_format_factories()
+{
+    using csr = Csr<ValueType, IndexType>;
+    using hybrid = Hybrid<ValueType, IndexType>;
+    static const std::map<std::string, format_factory> factories{
+        {"csr", create_csr_with_gpu_strategy<csr, typename csr::automatical>()},
+        {"csri",
+         create_csr_with_gpu_strategy<csr, typename csr::load_balance>()},
+        {"csrm",
+         create_matrix_type<csr>(std::make_shared<typename csr::merge_path>())},
+        {"csrc",
+         create_matrix_type<csr>(std::make_shared<typename csr::classical>())},
+        {"csrs",
+         create_matrix_type<csr>(std::make_shared<typename csr::sparselib>())},
+        {"coo", create_matrix_type<Coo<ValueType, IndexType>>()},
+        {"ell", create_matrix_type<Ell<ValueType, IndexType>>()},
+        {"sellp", create_matrix_type<Sellp<ValueType, IndexType>>()},
+        {"hybrid", create_matrix_type<hybrid>()},
+        {"hybrid0",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(0.0))},
+        {"hybrid25",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(0.25))},
+        {"hybrid33",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(1.0 / 3.0))},
+        {"hybrid40",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(0.4))},
+        {"hybrid60",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(0.6))},
+        {"hybrid80",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_limit>(0.8))},
+        {"hybridlimit0",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_bounded_limit>(0.0))},
+        {"hybridlimit25",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_bounded_limit>(0.25))},
+        {"hybridlimit33",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::imbalance_bounded_limit>(1.0 /
+                                                                        3.0))},
+        {"hybridminstorage",
+         create_matrix_type<hybrid>(
+             std::make_shared<typename hybrid::minimal_storage_limit>())}};
+    return factories;
+}
+
+
+/** Returns the row lengths of the matrix on the host. */
+template <typename ValueType, typename IndexType>
+std::vector<int64> compute_row_lengths(const Csr<ValueType, IndexType>* mtx)
+{
+    const auto num_rows = mtx->get_size()[0];
+    const auto exec = mtx->get_executor();
+    array<IndexType> row_ptrs{exec->get_master(), num_rows + 1};
+    exec->get_master()->copy_from(exec, num_rows + 1,
+                                  mtx->get_const_row_ptrs(),
+                                  row_ptrs.get_data());
+    std::vector<int64> row_lengths(num_rows);
+    for (size_type row = 0; row < num_rows; row++) {
+        row_lengths[row] = row_ptrs.get_const_data()[row + 1] -
+                           row_ptrs.get_const_data()[row];
+    }
+    return row_lengths;
+}
+
+
+bool exceeds_ell_imbalance_limit(const std::vector<int64>& row_lengths,
+                                 double limit)
+{
+    if (row_lengths.empty() || limit < 0) {
+        return false;
+    }
+    const auto max_len =
+        *std::max_element(row_lengths.begin(), row_lengths.end());
+    const auto nnz =
+        std::accumulate(row_lengths.begin(), row_lengths.end(), int64{});
+    const auto avg_len = nnz / static_cast<double>(row_lengths.size());
+    return max_len > limit * avg_len;
+}
+
+
+/**
+ * Describes the hardware the executor runs on, i.e. its type together with
+ * the device id for GPU executors and the number of threads for OpenMP, so
+ * tuning results are not shared between different devices or thread counts.
+ */
+std::string describe_executor(const Executor* exec)
+{
+    std::stringstream description;
+    description << name_demangling::get_dynamic_type(*exec);
+    // the ReferenceExecutor is derived from the OmpExecutor, but sequential
+    if (dynamic_cast<const ReferenceExecutor*>(exec)) {
+        return description.str();
+    }
+    if (dynamic_cast<const OmpExecutor*>(exec)) {
+        description << '(' << OmpExecutor::get_num_omp_threads() << ')';
+    } else if (auto cuda = dynamic_cast<const CudaExecutor*>(exec)) {
+        description << '(' << cuda->get_device_id() << ')';
+    } else if (auto hip = dynamic_cast<const HipExecutor*>(exec)) {
+        description << '(' << hip->get_device_id() << ')';
+    } else if (auto dpcpp = dynamic_cast<const DpcppExecutor*>(exec)) {
+        description << '(' << dpcpp->get_device_id() << ')';
+    }
+    return description.str();
+}
+
+
+/**
+ * Computes the cache key of a matrix from its precomputed row lengths, see
+ * SpmvAutotuner::get_key.
+ */
+template <typename ValueType, typename IndexType>
+std::string compute_key(const Csr<ValueType, IndexType>* mtx,
+                        const std::vector<int64>& row_lengths)
+{
+    // bucket 0 counts empty rows, bucket i > 0 rows with length in
+    // [2^(i-1), 2^i)
+    std::vector<int64> histogram;
+    for (const auto length : row_lengths) {
+        size_type bucket = 0;
+        while ((int64{1} << bucket) <= length) {
+            bucket++;
+        }
+        if (histogram.size() <= bucket) {
+            histogram.resize(bucket + 1);
+        }
+        histogram[bucket]++;
+    }
+    std::stringstream key;
+    key << describe_executor(mtx->get_executor().get()) << ';'
+        << name_demangling::get_type_name(typeid(ValueType)) << ';'
+        << name_demangling::get_type_name(typeid(IndexType)) << ';'
+        << mtx->get_size()[0] << 'x' << mtx->get_size()[1] << ';'
+        << mtx->get_num_stored_elements() << ';';
+    for (size_type i = 0; i < histogram.size(); i++) {
+        key << (i > 0 ? "," : "") << histogram[i];
+    }
+    return key.str();
+}
+
+
+/**
+ * Reads the cache entries from the given file into the map. Every line of the
+ * file holds a key and a format name separated by a tab.
+ */
+void read_cache_file(const std::string& path,
+                     std::map<std::string, std::string>& cache)
+{
+    // a missing cache file is not an error, it is created on the first store
+    std::ifstream input{path};
+    std::string line;
+    while (std::getline(input, line)) {
+        const auto separator = line.rfind('\t');
+        if (separator != std::string::npos) {
+            cache[line.substr(0, separator)] = line.substr(separator + 1);
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+std::vector<std::string>
+SpmvAutotuner<ValueType, IndexType>::get_default_candidates()
+{
+    return {"csr",    "csri",    "csrm",     "csrc",
+            "csrs",   "coo",     "ell",      "sellp",
+            "hybrid", "hybrid0", "hybrid80", "hybridminstorage"};
+}
+
+
+template <typename ValueType, typename IndexType>
+SpmvAutotuner<ValueType, IndexType>::SpmvAutotuner(
+    std::string cache_path, std::vector<std::string> candidates,
+    int num_repetitions, double ell_imbalance_limit)
+    : cache_path_{std::move(cache_path)},
+      candidates_{std::move(candidates)},
+      num_repetitions_{std::max(num_repetitions, 1)},
+      ell_imbalance_limit_{ell_imbalance_limit}
+{
+    const auto& factories = get_format_factories<ValueType, IndexType>();
+    for (const auto& candidate : candidates_) {
+        if (factories.find(candidate) == factories.end()) {
+            GKO_INVALID_STATE("unknown SpMV format " + candidate);
+        }
+    }
+    if (candidates_.empty()) {
+        GKO_INVALID_STATE("the autotuner needs at least one candidate");
+    }
+    this->load_cache();
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string SpmvAutotuner<ValueType, IndexType>::get_key(
+    ptr_param<const csr> mtx)
+{
+    return compute_key(mtx.get(), compute_row_lengths(mtx.get()));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::vector<std::string> SpmvAutotuner<ValueType, IndexType>::get_formats()
+{
+    std::vector<std::string> formats;
+    for (const auto& entry : get_format_factories<ValueType, IndexType>()) {
+        formats.push_back(entry.first);
+    }
+    return formats;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> SpmvAutotuner<ValueType, IndexType>::create_format(
+    std::shared_ptr<const Executor> exec, const std::string& format)
+{
+    const auto& factories = get_format_factories<ValueType, IndexType>();
+    const auto it = factories.find(format);
+    if (it == factories.end()) {
+        GKO_INVALID_STATE("unknown SpMV format " + format);
+    }
+    return it->second(std::move(exec));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> SpmvAutotuner<ValueType, IndexType>::convert(
+    ptr_param<const csr> mtx, const std::string& format)
+{
+    auto result = create_format(mtx->get_executor(), format);
+    if (auto csr_result = dynamic_cast<csr*>(result.get())) {
+        // copying a Csr matrix also copies its strategy
+        auto strategy = csr_result->get_strategy();
+        csr_result->copy_from(mtx.get());
+        csr_result->set_strategy(std::move(strategy));
+    } else {
+        result->copy_from(mtx.get());
+    }
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::string SpmvAutotuner<ValueType, IndexType>::select(
+    ptr_param<const csr> mtx)
+{
+    // the row lengths are copied to the host only once for the key and the
+    // ELL imbalance check
+    const auto row_lengths = compute_row_lengths(mtx.get());
+    const auto key = compute_key(mtx.get(), row_lengths);
+    {
+        std::lock_guard<std::mutex> guard{mutex_};
+        const auto it = cache_.find(key);
+        if (it != cache_.end()) {
+            return it->second;
+        }
+    }
+    const auto exec = mtx->get_executor();
+    const auto skip_ell =
+        exceeds_ell_imbalance_limit(row_lengths, ell_imbalance_limit_);
+    auto b = Dense<ValueType>::create(exec, dim<2>{mtx->get_size()[1], 1});
+    auto x = Dense<ValueType>::create(exec, dim<2>{mtx->get_size()[0], 1});
+    b->fill(one<ValueType>());
+    auto timer = Timer::create_for_executor(exec);
+    auto start = timer->create_time_point();
+    auto stop = timer->create_time_point();
+    auto best_format = candidates_.front();
+    auto best_time = std::chrono::nanoseconds::max();
+    for (const auto& candidate : candidates_) {
+        if (candidate == "ell" && skip_ell) {
+            continue;
+        }
+        auto op = convert(mtx, candidate);
+        // warmup to exclude one-time setup costs
+        op->apply(b, x);
+        timer->record(start);
+        for (int i = 0; i < num_repetitions_; i++) {
+            op->apply(b, x);
+        }
+        timer->record(stop);
+        const auto time = timer->difference(start, stop);
+        if (time < best_time) {
+            best_time = time;
+            best_format = candidate;
+        }
+    }
+    std::lock_guard<std::mutex> guard{mutex_};
+    cache_[key] = best_format;
+    this->store_cache();
+    return best_format;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> SpmvAutotuner<ValueType, IndexType>::generate(
+    ptr_param<const csr> mtx)
+{
+    return convert(mtx, this->select(mtx));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::map<std::string, std::string>
+SpmvAutotuner<ValueType, IndexType>::get_cache() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return cache_;
+}
+
+
+template <typename ValueType, typename IndexType>
+void SpmvAutotuner<ValueType, IndexType>::load_cache()
+{
+    if (!cache_path_.empty()) {
+        read_cache_file(cache_path_, cache_);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void SpmvAutotuner<ValueType, IndexType>::store_cache() const
+{
+    if (cache_path_.empty()) {
+        return;
+    }
+    // merge with decisions stored by other autotuners in the meantime
+    std::map<std::string, std::string> merged;
+    read_cache_file(cache_path_, merged);
+    for (const auto& entry : cache_) {
+        merged[entry.first] = entry.second;
+    }
+    std::ofstream output{cache_path_};
+    if (!output) {
+        throw GKO_STREAM_ERROR("could not write autotuning cache " +
+                               cache_path_);
+    }
+    for (const auto& entry : merged) {
+        output << entry.first << '\t' << entry.second << '\n';
+    }
+}
+
+
+#define GKO_DECLARE_SPMV_AUTOTUNER(ValueType, IndexType) \
+    class SpmvAutotuner<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SPMV_AUTOTUNER);
+
+
+}  // namespace matrix
+}  // namespace gko
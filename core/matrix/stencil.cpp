@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/matrix/stencil_kernels.hpp"
+#include "core/matrix/stencil_points.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace stencil {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, stencil::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, stencil::advanced_spmv);
+GKO_REGISTER_OPERATION(compute_row_ptrs, stencil::compute_row_ptrs);
+GKO_REGISTER_OPERATION(fill_in_csr, stencil::fill_in_csr);
+GKO_REGISTER_OPERATION(extract_diagonal, stencil::extract_diagonal);
+
+
+}  // anonymous namespace
+}  // namespace stencil
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                stencil::make_spmv(this, dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                               const LinOp* b,
+                                               const LinOp* beta,
+                                               LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(stencil::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+size_type Stencil<ValueType, IndexType>::get_num_points() const noexcept
+{
+    return stencil::get_stencil_points(type_).num_points;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>& Stencil<ValueType, IndexType>::operator=(
+    const Stencil<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<Stencil>::operator=(other);
+        grid_size_ = other.grid_size_;
+        type_ = other.type_;
+        coefficients_ = other.coefficients_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>& Stencil<ValueType, IndexType>::operator=(
+    Stencil<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<Stencil>::operator=(std::move(other));
+        grid_size_ = std::exchange(other.grid_size_, dim<3>{});
+        type_ = other.type_;
+        coefficients_ = std::move(other.coefficients_);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(
+    const Stencil<ValueType, IndexType>& other)
+    : Stencil{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(Stencil<ValueType, IndexType>&& other)
+    : Stencil{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+Stencil<ValueType, IndexType>::Stencil(std::shared_ptr<const Executor> exec,
+                                       dim<3> grid_size, stencil_type type,
+                                       array<value_type> coefficients)
+    : EnableLinOp<Stencil>(exec, dim<2>{grid_size[0] * grid_size[1] *
+                                        grid_size[2]}),
+      grid_size_{grid_size},
+      type_{type},
+      coefficients_{exec, std::move(coefficients)}
+{
+    const auto is_3d = type == stencil_type::seven_point ||
+                       type == stencil_type::twenty_seven_point;
+    if (!is_3d && grid_size[2] > 1) {
+        GKO_INVALID_STATE("2D stencils require a grid size of 1 in z");
+    }
+    const auto num_points = this->get_num_points();
+    const auto num_coefficients = coefficients_.get_size();
+    if (num_coefficients != num_points &&
+        num_coefficients != num_points * this->get_size()[0]) {
+        throw ValueMismatch(__FILE__, __LINE__, __func__, num_coefficients,
+                            num_points,
+                            "expected one coefficient per stencil point, "
+                            "or per stencil point and grid point");
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Stencil<ValueType, IndexType>>
+Stencil<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec)
+{
+    return std::unique_ptr<Stencil>{new Stencil{exec}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Stencil<ValueType, IndexType>>
+Stencil<ValueType, IndexType>::create(std::shared_ptr<const Executor> exec,
+                                      dim<3> grid_size, stencil_type type,
+                                      array<value_type> coefficients)
+{
+    return std::unique_ptr<Stencil>{
+        new Stencil{exec, grid_size, type, std::move(coefficients)}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Stencil<ValueType, IndexType>>
+Stencil<ValueType, IndexType>::create_laplacian(
+    std::shared_ptr<const Executor> exec, dim<3> grid_size, stencil_type type)
+{
+    const auto points = stencil::get_stencil_points(type);
+    array<value_type> coefficients{exec->get_master(),
+                                   static_cast<size_type>(points.num_points)};
+    coefficients.fill(-one<value_type>());
+    coefficients.get_data()[points.center] =
+        static_cast<value_type>(points.num_points - 1);
+    return create(exec, grid_size, type, std::move(coefficients));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    array<IndexType> row_ptrs{exec, num_rows + 1};
+    exec->run(stencil::make_compute_row_ptrs(this, row_ptrs.get_data()));
+    const auto nnz = static_cast<size_type>(
+        exec->copy_val_to_host(row_ptrs.get_const_data() + num_rows));
+    auto tmp = Csr<ValueType, IndexType>::create(
+        exec, this->get_size(), array<ValueType>{exec, nnz},
+        array<IndexType>{exec, nnz}, std::move(row_ptrs),
+        result->get_strategy());
+    exec->run(stencil::make_fill_in_csr(this, tmp.get()));
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::move_to(Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Stencil<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Diagonal<ValueType>>
+Stencil<ValueType, IndexType>::extract_diagonal() const
+{
+    auto exec = this->get_executor();
+    auto diag = Diagonal<ValueType>::create(exec, this->get_size()[0]);
+    exec->run(stencil::make_extract_diagonal(this, diag.get()));
+    return diag;
+}
+
+
+#define GKO_DECLARE_STENCIL_MATRIX(ValueType, IndexType) \
+    class Stencil<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_MATRIX_STENCIL_POINTS_HPP_
+#define GKO_CORE_MATRIX_STENCIL_POINTS_HPP_
+
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+namespace gko {
+namespace matrix {
+namespace stencil {
+
+
+/**
+ * The neighbor offsets of all points of a stencil, in the order of the
+ * stencil coefficients, i.e. lexicographically by their (z, y, x) offset.
+ */
+struct stencil_points {
+    int num_points;
+    /** The index of the point with offset (0, 0, 0). */
+    int center;
+    int dx[27];
+    int dy[27];
+    int dz[27];
+};
+
+
+/**
+ * Returns the neighbor offsets of the given stencil.
+ *
+ * @param type  the stencil type
+ *
+ * @return the offsets of all stencil points
+ */
+inline stencil_points get_stencil_points(stencil_type type)
+{
+    const bool is_3d = type == stencil_type::seven_point ||
+                       type == stencil_type::twenty_seven_point;
+    const bool is_full_box = type == stencil_type::nine_point ||
+                             type == stencil_type::twenty_seven_point;
+    stencil_points points{};
+    const int z_range = is_3d ? 1 : 0;
+    for (int dz = -z_range; dz <= z_range; ++dz) {
+        for (int dy = -1; dy <= 1; ++dy) {
+            for (int dx = -1; dx <= 1; ++dx) {
+                // restricted stencils only couple along the axes
+                const auto num_zero_offsets = (dz == 0) + (dy == 0) + (dx == 0);
+                if (is_full_box || num_zero_offsets >= 2) {
+                    if (num_zero_offsets == 3) {
+                        points.center = points.num_points;
+                    }
+                    points.dx[points.num_points] = dx;
+                    points.dy[points.num_points] = dy;
+                    points.dz[points.num_points] = dz;
+                    points.num_points++;
+                }
+            }
+        }
+    }
+    return points;
+}
+
+
+}  // namespace stencil
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_CORE_MATRIX_STENCIL_POINTS_HPP_
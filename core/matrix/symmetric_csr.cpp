@@ -0,0 +1,262 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/components/fill_array_kernels.hpp"
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+namespace gko {
+namespace matrix {
+namespace symmetric_csr {
+namespace {
+
+
+GKO_REGISTER_OPERATION(spmv, symmetric_csr::spmv);
+GKO_REGISTER_OPERATION(advanced_spmv, symmetric_csr::advanced_spmv);
+GKO_REGISTER_OPERATION(compute_upper_row_ptrs,
+                       symmetric_csr::compute_upper_row_ptrs);
+GKO_REGISTER_OPERATION(fill_upper, symmetric_csr::fill_upper);
+GKO_REGISTER_OPERATION(compute_full_row_ptrs,
+                       symmetric_csr::compute_full_row_ptrs);
+GKO_REGISTER_OPERATION(fill_in_csr, symmetric_csr::fill_in_csr);
+GKO_REGISTER_OPERATION(extract_diagonal, symmetric_csr::extract_diagonal);
+GKO_REGISTER_OPERATION(fill_array, components::fill_array);
+
+
+}  // anonymous namespace
+}  // namespace symmetric_csr
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(
+                symmetric_csr::make_spmv(this, dense_b, dense_x, buffer_));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                    const LinOp* b,
+                                                    const LinOp* beta,
+                                                    LinOp* x) const
+{
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            this->get_executor()->run(symmetric_csr::make_advanced_spmv(
+                dense_alpha, this, dense_b, dense_beta, dense_x, buffer_));
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(
+    const SymmetricCsr<ValueType, IndexType>& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(other);
+        values_ = other.values_;
+        col_idxs_ = other.col_idxs_;
+        row_ptrs_ = other.row_ptrs_;
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>&
+SymmetricCsr<ValueType, IndexType>::operator=(
+    SymmetricCsr<ValueType, IndexType>&& other)
+{
+    if (&other != this) {
+        EnableLinOp<SymmetricCsr>::operator=(std::move(other));
+        values_ = std::move(other.values_);
+        col_idxs_ = std::move(other.col_idxs_);
+        row_ptrs_ = std::move(other.row_ptrs_);
+        // restore other invariant
+        other.row_ptrs_.resize_and_reset(1);
+        other.row_ptrs_.fill(0);
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    const SymmetricCsr<ValueType, IndexType>& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    SymmetricCsr<ValueType, IndexType>&& other)
+    : SymmetricCsr{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+SymmetricCsr<ValueType, IndexType>::SymmetricCsr(
+    std::shared_ptr<const Executor> exec)
+    : EnableLinOp<SymmetricCsr>(exec),
+      values_(exec),
+      col_idxs_(exec),
+      row_ptrs_(exec, 1),
+      buffer_(exec)
+{
+    row_ptrs_.fill(0);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<SymmetricCsr<ValueType, IndexType>>
+SymmetricCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec)
+{
+    return std::unique_ptr<SymmetricCsr>{new SymmetricCsr{exec}};
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<SymmetricCsr<ValueType, IndexType>>
+SymmetricCsr<ValueType, IndexType>::create(
+    std::shared_ptr<const Executor> exec, const LinOp* matrix)
+{
+    auto result = create(exec);
+    result->extract_upper(
+        copy_and_convert_to<Csr<ValueType, IndexType>>(exec, matrix).get());
+    return result;
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::extract_upper(
+    const Csr<ValueType, IndexType>* source)
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(source);
+    auto exec = this->get_executor();
+    const auto num_rows = source->get_size()[0];
+    row_ptrs_.resize_and_reset(num_rows + 1);
+    exec->run(
+        symmetric_csr::make_compute_upper_row_ptrs(source, get_row_ptrs()));
+    const auto nnz = static_cast<size_type>(
+        exec->copy_val_to_host(get_const_row_ptrs() + num_rows));
+    col_idxs_.resize_and_reset(nnz);
+    values_.resize_and_reset(nnz);
+    exec->run(symmetric_csr::make_fill_upper(
+        source, get_const_row_ptrs(), get_col_idxs(), get_values()));
+    this->set_size(source->get_size());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::convert_to(
+    Csr<ValueType, IndexType>* result) const
+{
+    auto exec = this->get_executor();
+    const auto num_rows = this->get_size()[0];
+    array<IndexType> row_ptrs{exec, num_rows + 1};
+    exec->run(symmetric_csr::make_compute_full_row_ptrs(this,
+                                                        row_ptrs.get_data()));
+    const auto nnz = static_cast<size_type>(
+        exec->copy_val_to_host(row_ptrs.get_const_data() + num_rows));
+    auto tmp = Csr<ValueType, IndexType>::create(
+        exec, this->get_size(), array<ValueType>{exec, nnz},
+        array<IndexType>{exec, nnz}, std::move(row_ptrs),
+        result->get_strategy());
+    exec->run(symmetric_csr::make_fill_in_csr(this, tmp.get()));
+    tmp->move_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::move_to(
+    Csr<ValueType, IndexType>* result)
+{
+    this->convert_to(result);
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    this->extract_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(const device_mat_data& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(data);
+    this->extract_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::read(device_mat_data&& data)
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    tmp->read(std::move(data));
+    this->extract_upper(tmp.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void SymmetricCsr<ValueType, IndexType>::write(mat_data& data) const
+{
+    auto tmp = Csr<ValueType, IndexType>::create(this->get_executor());
+    this->convert_to(tmp.get());
+    tmp->write(data);
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<Diagonal<ValueType>>
+SymmetricCsr<ValueType, IndexType>::extract_diagonal() const
+{
+    auto exec = this->get_executor();
+
+    const auto diag_size = this->get_size()[0];
+    auto diag = Diagonal<ValueType>::create(exec, diag_size);
+    exec->run(symmetric_csr::make_fill_array(
+        diag->get_values(), diag->get_size()[0], zero<ValueType>()));
+    exec->run(symmetric_csr::make_extract_diagonal(this, diag.get()));
+    return diag;
+}
+
+
+#define GKO_DECLARE_SYMMETRIC_CSR_MATRIX(ValueType, IndexType) \
+    class SymmetricCsr<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_SYMMETRIC_CSR_MATRIX);
+
+
+}  // namespace matrix
+}  // namespace gko
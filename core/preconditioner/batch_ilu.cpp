@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+
+#include <algorithm>
+
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+namespace ilu {
+
+
+GKO_REGISTER_OPERATION(find_diagonal_locations,
+                       batch_ilu::find_diagonal_locations);
+GKO_REGISTER_OPERATION(compute_ilu0_factorization,
+                       batch_ilu::compute_ilu0_factorization);
+
+
+}  // namespace ilu
+
+
+template <typename ValueType, typename IndexType>
+Ilu<ValueType, IndexType>::Ilu(std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<Ilu>(exec),
+      factorized_mat_{matrix_type::create(exec)},
+      diag_locations_(exec)
+{}
+
+
+template <typename ValueType, typename IndexType>
+Ilu<ValueType, IndexType>::Ilu(const Factory* factory,
+                               std::shared_ptr<const BatchLinOp> system_matrix)
+    : EnableBatchLinOp<Ilu>(factory->get_executor(),
+                            gko::transpose(system_matrix->get_size())),
+      parameters_{factory->get_parameters()},
+      factorized_mat_{matrix_type::create(factory->get_executor())},
+      diag_locations_(factory->get_executor(),
+                      system_matrix->get_common_size()[0])
+{
+    GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
+    this->generate_precond(system_matrix.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Ilu<ValueType, IndexType>::generate_precond(
+    const BatchLinOp* const system_matrix)
+{
+    auto exec = this->get_executor();
+    // the factorization is computed in-place on a copy of the system matrix
+    as<ConvertibleTo<matrix_type>>(system_matrix)
+        ->convert_to(factorized_mat_.get());
+
+    // all items share the sparsity pattern, so the diagonal locations only
+    // need to be computed once for the whole batch
+    exec->run(ilu::make_find_diagonal_locations(factorized_mat_.get(),
+                                                diag_locations_.get_data()));
+    const array<index_type> host_diag_locs(exec->get_master(),
+                                           diag_locations_);
+    const auto host_diag_locs_end =
+        host_diag_locs.get_const_data() + host_diag_locs.get_size();
+    if (std::find(host_diag_locs.get_const_data(), host_diag_locs_end,
+                  index_type{-1}) != host_diag_locs_end) {
+        GKO_INVALID_STATE(
+            "The system matrix needs to store all diagonal entries");
+    }
+
+    exec->run(ilu::make_compute_ilu0_factorization(
+        diag_locations_.get_const_data(), factorized_mat_.get()));
+}
+
+
+#define GKO_DECLARE_BATCH_ILU(_type) class Ilu<_type, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ILU);
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
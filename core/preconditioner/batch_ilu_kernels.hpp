@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
+
+
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+#define GKO_DECLARE_BATCH_ILU_FIND_DIAGONAL_LOCATIONS_KERNEL(ValueType,     \
+                                                             IndexType)     \
+    void find_diagonal_locations(                                           \
+        std::shared_ptr<const DefaultExecutor> exec,                        \
+        const batch::matrix::Csr<ValueType, IndexType>* mat,                \
+        IndexType* diag_locs)
+
+#define GKO_DECLARE_BATCH_ILU_COMPUTE_ILU0_FACTORIZATION_KERNEL(ValueType, \
+                                                                IndexType) \
+    void compute_ilu0_factorization(                                       \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const IndexType* diag_locs,                                        \
+        batch::matrix::Csr<ValueType, IndexType>* mat_factorized)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                       \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_BATCH_ILU_FIND_DIAGONAL_LOCATIONS_KERNEL(ValueType,        \
+                                                         IndexType);       \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_BATCH_ILU_COMPUTE_ILU0_FACTORIZATION_KERNEL(ValueType,     \
+                                                            IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_ilu,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_BATCH_ILU_KERNELS_HPP_
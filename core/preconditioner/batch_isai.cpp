@@ -0,0 +1,141 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/matrix_data.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+namespace isai {
+
+
+GKO_REGISTER_OPERATION(extract_dense_linear_sys_pattern,
+                       batch_isai::extract_dense_linear_sys_pattern);
+GKO_REGISTER_OPERATION(fill_values_dense_mat_and_solve,
+                       batch_isai::fill_values_dense_mat_and_solve);
+
+
+}  // namespace isai
+
+
+template <typename ValueType, typename IndexType>
+Isai<ValueType, IndexType>::Isai(std::shared_ptr<const Executor> exec)
+    : EnableBatchLinOp<Isai>(exec), approx_inv_{matrix_type::create(exec)}
+{}
+
+
+template <typename ValueType, typename IndexType>
+Isai<ValueType, IndexType>::Isai(
+    const Factory* factory, std::shared_ptr<const BatchLinOp> system_matrix)
+    : EnableBatchLinOp<Isai>(factory->get_executor(),
+                             gko::transpose(system_matrix->get_size())),
+      parameters_{factory->get_parameters()},
+      approx_inv_{matrix_type::create(factory->get_executor())}
+{
+    GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
+    if (parameters_.sparsity_power < 1) {
+        GKO_INVALID_STATE("The sparsity power needs to be positive");
+    }
+    this->generate_precond(system_matrix.get());
+}
+
+
+template <typename ValueType, typename IndexType>
+void Isai<ValueType, IndexType>::generate_precond(
+    const BatchLinOp* const system_matrix)
+{
+    using unbatch_type = gko::matrix::Csr<ValueType, IndexType>;
+    auto exec = this->get_executor();
+    const auto sys_csr = as<matrix_type>(system_matrix);
+    const auto num_rows = sys_csr->get_common_size()[0];
+    const auto first_sys_csr = sys_csr->create_const_view_for_item(0);
+
+    // the sparsity pattern of the approximate inverse is shared by all items,
+    // so it is computed from the first item only
+    matrix_data<ValueType, IndexType> pattern_data;
+    first_sys_csr->write(pattern_data);
+    const auto type = parameters_.isai_input_matrix_type;
+    pattern_data.nonzeros.erase(
+        std::remove_if(pattern_data.nonzeros.begin(),
+                       pattern_data.nonzeros.end(),
+                       [type](const auto& entry) {
+                           using input_type = batch_isai_input_matrix_type;
+                           return (type == input_type::lower &&
+                                   entry.column > entry.row) ||
+                                  (type == input_type::upper &&
+                                   entry.column < entry.row);
+                       }),
+        pattern_data.nonzeros.end());
+    // use positive values to avoid cancellation in the matrix powers
+    for (auto& entry : pattern_data.nonzeros) {
+        entry.value = one<ValueType>();
+    }
+    auto pattern = share(unbatch_type::create(exec));
+    pattern->read(pattern_data);
+    auto inv_pattern = pattern;
+    for (int power = 1; power < parameters_.sparsity_power; power++) {
+        auto next_pattern =
+            share(unbatch_type::create(exec, pattern->get_size()));
+        inv_pattern->apply(pattern, next_pattern);
+        inv_pattern = next_pattern;
+    }
+
+    {
+        auto host_inv_pattern =
+            make_temporary_clone(exec->get_master(), inv_pattern.get());
+        const auto row_ptrs = host_inv_pattern->get_const_row_ptrs();
+        for (size_type row = 0; row < num_rows; row++) {
+            if (row_ptrs[row + 1] - row_ptrs[row] >
+                kernels::batch_isai::row_size_limit) {
+                GKO_INVALID_STATE(
+                    "The approximate inverse has too many nonzeros per row");
+            }
+        }
+    }
+
+    const auto inv_nnz = inv_pattern->get_num_stored_elements();
+    approx_inv_ =
+        share(matrix_type::create(exec, sys_csr->get_size(), inv_nnz));
+    exec->copy(num_rows + 1, inv_pattern->get_const_row_ptrs(),
+               approx_inv_->get_row_ptrs());
+    exec->copy(inv_nnz, inv_pattern->get_const_col_idxs(),
+               approx_inv_->get_col_idxs());
+
+    // the positions of the system matrix entries in the dense systems of all
+    // rows only depend on the sparsity patterns, so they are extracted once
+    // for the whole batch
+    array<IndexType> dense_mat_pattern(
+        exec, num_rows * kernels::batch_isai::row_size_limit *
+                  kernels::batch_isai::row_size_limit);
+    array<IndexType> rhs_one_idxs(exec, num_rows);
+    array<IndexType> sizes(exec, num_rows);
+    exec->run(isai::make_extract_dense_linear_sys_pattern(
+        first_sys_csr.get(), inv_pattern.get(), dense_mat_pattern.get_data(),
+        rhs_one_idxs.get_data(), sizes.get_data()));
+
+    exec->run(isai::make_fill_values_dense_mat_and_solve(
+        sys_csr, approx_inv_.get(), dense_mat_pattern.get_const_data(),
+        rhs_one_idxs.get_const_data(), sizes.get_const_data()));
+}
+
+
+#define GKO_DECLARE_BATCH_ISAI(_type) class Isai<_type, int32>
+GKO_INSTANTIATE_FOR_EACH_VALUE_TYPE(GKO_DECLARE_BATCH_ISAI);
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
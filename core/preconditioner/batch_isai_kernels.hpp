@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+#define GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
+
+
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace batch_isai {
+
+
+/**
+ * The maximal number of nonzeros in a row of the approximate inverse, which is
+ * also the maximal size of the dense linear systems solved for each row.
+ */
+constexpr int row_size_limit = 32;
+
+
+}  // namespace batch_isai
+
+
+#define GKO_DECLARE_BATCH_ISAI_EXTRACT_DENSE_LINEAR_SYSTEM_PATTERN_KERNEL(  \
+    ValueType, IndexType)                                                  \
+    void extract_dense_linear_sys_pattern(                                 \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const matrix::Csr<ValueType, IndexType>* first_sys_csr,            \
+        const matrix::Csr<ValueType, IndexType>* first_approx_inv,         \
+        IndexType* dense_mat_pattern, IndexType* rhs_one_idxs,             \
+        IndexType* sizes)
+
+#define GKO_DECLARE_BATCH_ISAI_FILL_VALUES_DENSE_MATRIX_AND_SOLVE_KERNEL(   \
+    ValueType, IndexType)                                                  \
+    void fill_values_dense_mat_and_solve(                                  \
+        std::shared_ptr<const DefaultExecutor> exec,                       \
+        const batch::matrix::Csr<ValueType, IndexType>* sys_csr,           \
+        batch::matrix::Csr<ValueType, IndexType>* approx_inv,              \
+        const IndexType* dense_mat_pattern, const IndexType* rhs_one_idxs, \
+        const IndexType* sizes)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                                       \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_DENSE_LINEAR_SYSTEM_PATTERN_KERNEL(     \
+        ValueType, IndexType);                                             \
+    template <typename ValueType, typename IndexType>                      \
+    GKO_DECLARE_BATCH_ISAI_FILL_VALUES_DENSE_MATRIX_AND_SOLVE_KERNEL(      \
+        ValueType, IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_isai,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_BATCH_ISAI_KERNELS_HPP_
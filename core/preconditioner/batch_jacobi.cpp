@@ -5,6 +5,11 @@
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 
 
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+
+
+#include "core/base/pattern_hash.hpp"
 #include "core/matrix/batch_csr_kernels.hpp"
 #include "core/matrix/csr_kernels.hpp"
 #include "core/preconditioner/batch_jacobi_kernels.hpp"
@@ -27,6 +32,30 @@ GKO_REGISTER_OPERATION(compute_cumulative_block_storage,
                        batch_jacobi::compute_cumulative_block_storage);
 
 
+/**
+ * Hashes the sparsity pattern of a batch matrix of any format supported by
+ * the scalar Jacobi preconditioner. Dense matrices store all entries, so only
+ * their dimensions are hashed.
+ */
+template <typename ValueType, typename IndexType>
+uint64 hash_batch_pattern(const BatchLinOp* mtx)
+{
+    if (auto csr =
+            dynamic_cast<const matrix::Csr<ValueType, IndexType>*>(mtx)) {
+        return ::gko::detail::hash_sparsity_pattern(csr);
+    }
+    if (auto ell =
+            dynamic_cast<const matrix::Ell<ValueType, IndexType>*>(mtx)) {
+        return ::gko::detail::hash_sparsity_pattern(ell);
+    }
+    ::gko::detail::fnv1a_hash hash;
+    hash.combine(mtx->get_common_size()[0]);
+    hash.combine(mtx->get_common_size()[1]);
+    hash.combine(mtx->get_num_batch_items());
+    return hash.get();
+}
+
+
 }  // namespace jacobi
 
 
@@ -49,7 +78,9 @@ Jacobi<ValueType, IndexType>::Jacobi(std::shared_ptr<const Executor> exec)
       block_pointers_(exec),
       blocks_(exec),
       map_block_to_row_(exec),
-      blocks_cumulative_offsets_(exec)
+      blocks_cumulative_offsets_(exec),
+      block_nnz_idxs_(exec),
+      pattern_hash_{}
 {}
 
 
@@ -65,7 +96,10 @@ Jacobi<ValueType, IndexType>::Jacobi(
       blocks_(factory->get_executor()),
       map_block_to_row_(factory->get_executor(),
                         system_matrix->get_common_size()[0]),
-      blocks_cumulative_offsets_(factory->get_executor(), num_blocks_ + 1)
+      blocks_cumulative_offsets_(factory->get_executor(), num_blocks_ + 1),
+      block_nnz_idxs_(factory->get_executor()),
+      pattern_hash_{},
+      pattern_source_{system_matrix}
 {
     GKO_ASSERT_BATCH_HAS_SQUARE_DIMENSIONS(system_matrix);
     this->generate_precond(system_matrix.get());
@@ -152,8 +186,8 @@ void Jacobi<ValueType, IndexType>::generate_precond(
     // also stored in a similar way.
 
     // array for storing the common pattern of the diagonal blocks
-    gko::array<IndexType> block_nnz_idxs(exec, this->compute_storage_space(1));
-    block_nnz_idxs.fill(static_cast<IndexType>(-1));
+    block_nnz_idxs_.resize_and_reset(this->compute_storage_space(1));
+    block_nnz_idxs_.fill(static_cast<IndexType>(-1));
 
     // Since all the matrices in the batch have the same sparsity pattern, it is
     // advantageous to extract the blocks only once instead of repeating
@@ -165,12 +199,59 @@ void Jacobi<ValueType, IndexType>::generate_precond(
         first_sys_csr.get(), num_blocks_,
         blocks_cumulative_offsets_.get_const_data(),
         block_pointers_.get_const_data(), map_block_to_row_.get_const_data(),
-        block_nnz_idxs.get_data()));
+        block_nnz_idxs_.get_data()));
+
+    exec->run(jacobi::make_compute_block_jacobi(
+        sys_csr, parameters_.max_block_size, num_blocks_,
+        blocks_cumulative_offsets_.get_const_data(),
+        block_pointers_.get_const_data(), block_nnz_idxs_.get_const_data(),
+        blocks_.get_data()));
+}
 
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::update_values(
+    std::shared_ptr<const BatchLinOp> new_matrix)
+{
+    GKO_ASSERT_BATCH_EQUAL_DIMENSIONS(this, new_matrix);
+    if (parameters_.max_block_size == 1u) {
+        // the scalar version is generated inside the solver kernels, so only
+        // the pattern needs to be validated
+        ::gko::detail::ensure_same_sparsity_pattern(
+            pattern_source_, pattern_hash_, new_matrix.get(),
+            jacobi::hash_batch_pattern<ValueType, IndexType>(new_matrix.get()),
+            jacobi::hash_batch_pattern<ValueType, IndexType>);
+        return;
+    }
+    auto exec = this->get_executor();
+    auto* sys_csr = dynamic_cast<const matrix_type*>(new_matrix.get());
+    std::shared_ptr<const matrix_type> sys_csr_shared_ptr{};
+
+    if (!sys_csr) {
+        sys_csr_shared_ptr = gko::share(matrix_type::create(exec));
+        as<ConvertibleTo<const matrix_type>>(new_matrix.get())
+            ->convert_to(sys_csr_shared_ptr.get());
+        sys_csr = sys_csr_shared_ptr.get();
+    }
+    ::gko::detail::ensure_same_sparsity_pattern(
+        pattern_source_, pattern_hash_, new_matrix.get(),
+        ::gko::detail::hash_sparsity_pattern(sys_csr),
+        [&](const BatchLinOp* mtx) {
+            if (auto csr_mtx = dynamic_cast<const matrix_type*>(mtx)) {
+                return ::gko::detail::hash_sparsity_pattern(csr_mtx);
+            }
+            auto csr_mtx = matrix_type::create(exec);
+            as<ConvertibleTo<const matrix_type>>(mtx)->convert_to(
+                csr_mtx.get());
+            return ::gko::detail::hash_sparsity_pattern(csr_mtx.get());
+        });
+
+    // the block structure and the positions of the block entries within the
+    // values of a batch item are unchanged, so only the inversion is repeated
     exec->run(jacobi::make_compute_block_jacobi(
         sys_csr, parameters_.max_block_size, num_blocks_,
         blocks_cumulative_offsets_.get_const_data(),
-        block_pointers_.get_const_data(), block_nnz_idxs.get_const_data(),
+        block_pointers_.get_const_data(), block_nnz_idxs_.get_const_data(),
         blocks_.get_data()));
 }
 
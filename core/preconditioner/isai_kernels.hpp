@@ -57,6 +57,20 @@ namespace kernels {
         matrix::Csr<ValueType, IndexType>* inverse, size_type e_start,        \
         size_type e_end)
 
+#define GKO_DECLARE_ISAI_SELECT_PATTERN_EXTENSION_KERNEL(ValueType, IndexType) \
+    void select_pattern_extension(                                             \
+        std::shared_ptr<const DefaultExecutor> exec,                           \
+        const matrix::Csr<ValueType, IndexType>* input,                        \
+        const matrix::Csr<ValueType, IndexType>* inverse, IndexType fill,      \
+        remove_complex<ValueType> tolerance, bool lower, bool upper,           \
+        IndexType* extension, IndexType* extended_row_ptrs)
+
+#define GKO_DECLARE_ISAI_EXTEND_PATTERN_KERNEL(ValueType, IndexType)       \
+    void extend_pattern(std::shared_ptr<const DefaultExecutor> exec,       \
+                        const matrix::Csr<ValueType, IndexType>* inverse,  \
+                        const IndexType* extension, IndexType fill,        \
+                        matrix::Csr<ValueType, IndexType>* extended)
+
 #define GKO_DECLARE_ALL_AS_TEMPLATES                                        \
     constexpr int row_size_limit = 32;                                      \
     template <typename ValueType, typename IndexType>                       \
@@ -68,7 +82,11 @@ namespace kernels {
     template <typename ValueType, typename IndexType>                       \
     GKO_DECLARE_ISAI_SCALE_EXCESS_SOLUTION_KERNEL(ValueType, IndexType);    \
     template <typename ValueType, typename IndexType>                       \
-    GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL(ValueType, IndexType)
+    GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL(ValueType, IndexType);  \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_ISAI_SELECT_PATTERN_EXTENSION_KERNEL(ValueType, IndexType); \
+    template <typename ValueType, typename IndexType>                       \
+    GKO_DECLARE_ISAI_EXTEND_PATTERN_KERNEL(ValueType, IndexType)
 
 
 GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(isai, GKO_DECLARE_ALL_AS_TEMPLATES);
@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_PRECONDITIONER_ISAI_ROW_EXTENSION_HPP_
+#define GKO_CORE_PRECONDITIONER_ISAI_ROW_EXTENSION_HPP_
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace preconditioner {
+namespace isai {
+
+
+/**
+ * Selects the columns by which a row of the approximate inverse aiM is
+ * extended in an adaptive refinement step.
+ *
+ * The candidates are the columns outside the pattern of the row (restricted
+ * to the strictly lower or upper triangle for triangular ISAI) with a nonzero
+ * entry in the row of aiM * M. The row is only extended if the norm of these
+ * entries exceeds tolerance * |(aiM * M)_ii|, in which case the fill
+ * candidates of largest magnitude are selected.
+ *
+ * @param residual  dense workspace of size num_cols
+ * @param touched_marker  workspace of size num_cols, must not contain row
+ * @param pattern_marker  workspace of size num_cols, must not contain row
+ * @param candidates  workspace for the candidate columns
+ * @param extension  the output array for at least fill column indices
+ *
+ * @return the number of selected columns, which are stored sorted in
+ *         extension
+ */
+template <typename ValueType, typename IndexType>
+IndexType select_row_extension(
+    IndexType row, const matrix::Csr<ValueType, IndexType>* input,
+    const matrix::Csr<ValueType, IndexType>* inverse, IndexType fill,
+    remove_complex<ValueType> tolerance, bool lower, bool upper,
+    ValueType* residual, IndexType* touched_marker, IndexType* pattern_marker,
+    vector<IndexType>& candidates, IndexType* extension)
+{
+    const auto m_row_ptrs = input->get_const_row_ptrs();
+    const auto m_cols = input->get_const_col_idxs();
+    const auto m_vals = input->get_const_values();
+    const auto i_row_ptrs = inverse->get_const_row_ptrs();
+    const auto i_cols = inverse->get_const_col_idxs();
+    const auto i_vals = inverse->get_const_values();
+    const auto i_begin = i_row_ptrs[row];
+    const auto i_end = i_row_ptrs[row + 1];
+    candidates.clear();
+    for (auto i_nz = i_begin; i_nz < i_end; ++i_nz) {
+        pattern_marker[i_cols[i_nz]] = row;
+    }
+    // accumulate the residual row aiM[row, :] * M, the markers avoid clearing
+    // the dense workspace between rows
+    for (auto i_nz = i_begin; i_nz < i_end; ++i_nz) {
+        const auto col = i_cols[i_nz];
+        const auto i_val = i_vals[i_nz];
+        for (auto m_nz = m_row_ptrs[col]; m_nz < m_row_ptrs[col + 1]; ++m_nz) {
+            const auto m_col = m_cols[m_nz];
+            if (touched_marker[m_col] != row) {
+                touched_marker[m_col] = row;
+                residual[m_col] = zero<ValueType>();
+                if (pattern_marker[m_col] != row && (!lower || m_col < row) &&
+                    (!upper || m_col > row)) {
+                    candidates.push_back(m_col);
+                }
+            }
+            residual[m_col] += i_val * m_vals[m_nz];
+        }
+    }
+    candidates.erase(std::remove_if(candidates.begin(), candidates.end(),
+                                    [&](IndexType col) {
+                                        return is_zero(residual[col]);
+                                    }),
+                     candidates.end());
+    remove_complex<ValueType> residual_norm{};
+    for (const auto col : candidates) {
+        residual_norm += squared_norm(residual[col]);
+    }
+    const auto diag = touched_marker[row] == row
+                          ? abs(residual[row])
+                          : zero<remove_complex<ValueType>>();
+    if (candidates.empty() || sqrt(residual_norm) <= tolerance * diag) {
+        return 0;
+    }
+    const auto count =
+        std::min(fill, static_cast<IndexType>(candidates.size()));
+    // pick the largest residual entries, break ties by column index
+    std::partial_sort(candidates.begin(), candidates.begin() + count,
+                      candidates.end(), [&](IndexType a, IndexType b) {
+                          const auto abs_a = abs(residual[a]);
+                          const auto abs_b = abs(residual[b]);
+                          return abs_a > abs_b || (abs_a == abs_b && a < b);
+                      });
+    std::sort(candidates.begin(), candidates.begin() + count);
+    std::copy_n(candidates.begin(), count, extension);
+    return count;
+}
+
+
+}  // namespace isai
+}  // namespace preconditioner
+}  // namespace gko
+
+
+#endif  // GKO_CORE_PRECONDITIONER_ISAI_ROW_EXTENSION_HPP_
@@ -19,6 +19,7 @@
 
 
 #include "core/base/extended_float.hpp"
+#include "core/base/pattern_hash.hpp"
 #include "core/base/utils.hpp"
 #include "core/preconditioner/jacobi_kernels.hpp"
 #include "core/preconditioner/jacobi_utils.hpp"
@@ -46,6 +47,28 @@ GKO_REGISTER_OPERATION(scalar_convert_to_dense,
 GKO_REGISTER_OPERATION(initialize_precisions, jacobi::initialize_precisions);
 
 
+/**
+ * Hashes the sparsity pattern of a matrix passed to the scalar Jacobi
+ * preconditioner. The pattern is hashed as stored, to avoid sorting a copy of
+ * the matrix. Matrices that are not convertible to Csr only provide a
+ * diagonal, so only their size is hashed.
+ */
+template <typename ValueType, typename IndexType>
+uint64 hash_scalar_pattern(std::shared_ptr<const Executor> exec,
+                           const LinOp* mtx)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    if (dynamic_cast<const ConvertibleTo<csr_type>*>(mtx)) {
+        auto csr_mtx = convert_to_with_sorting<csr_type>(exec, mtx, true);
+        return ::gko::detail::hash_sparsity_pattern(csr_mtx.get());
+    }
+    ::gko::detail::fnv1a_hash hash;
+    hash.combine(mtx->get_size()[0]);
+    hash.combine(mtx->get_size()[1]);
+    return hash.get();
+}
+
+
 }  // anonymous namespace
 }  // namespace jacobi
 
@@ -60,6 +83,9 @@ Jacobi<ValueType, IndexType>& Jacobi<ValueType, IndexType>::operator=(
         num_blocks_ = other.num_blocks_;
         blocks_ = other.blocks_;
         conditioning_ = other.conditioning_;
+        requested_precisions_ = other.requested_precisions_;
+        pattern_hash_ = other.pattern_hash_;
+        pattern_source_ = other.pattern_source_;
         parameters_ = other.parameters_;
     }
     return *this;
@@ -79,6 +105,9 @@ Jacobi<ValueType, IndexType>& Jacobi<ValueType, IndexType>::operator=(
         num_blocks_ = std::exchange(other.num_blocks_, 0);
         blocks_ = std::move(other.blocks_);
         conditioning_ = std::move(other.conditioning_);
+        requested_precisions_ = std::move(other.requested_precisions_);
+        pattern_hash_ = std::exchange(other.pattern_hash_, 0);
+        pattern_source_ = std::move(other.pattern_source_);
         parameters_ = std::exchange(other.parameters_, parameters_type{});
     }
     return *this;
@@ -324,12 +353,61 @@ void Jacobi<ValueType, IndexType>::generate(const LinOp* system_matrix,
             exec->run(jacobi::make_initialize_precisions(precisions, tmp));
             precisions = std::move(tmp);
             conditioning_.resize_and_reset(num_blocks_);
+            // keep the requested precisions, as the generation replaces
+            // autodetect() entries by the selected precisions
+            requested_precisions_ = precisions;
         }
-        exec->run(jacobi::make_generate(
-            csr_mtx.get(), num_blocks_, parameters_.max_block_size,
-            parameters_.accuracy, storage_scheme_, conditioning_, precisions,
-            parameters_.block_pointers, blocks_));
+        this->compute_blocks(csr_mtx.get());
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::compute_blocks(
+    const matrix::Csr<ValueType, IndexType>* system_matrix)
+{
+    this->get_executor()->run(jacobi::make_generate(
+        system_matrix, num_blocks_, parameters_.max_block_size,
+        parameters_.accuracy, storage_scheme_, conditioning_,
+        parameters_.storage_optimization.block_wise,
+        parameters_.block_pointers, blocks_));
+}
+
+
+template <typename ValueType, typename IndexType>
+void Jacobi<ValueType, IndexType>::update_values(
+    std::shared_ptr<const LinOp> new_matrix)
+{
+    using csr_type = matrix::Csr<ValueType, IndexType>;
+    GKO_ASSERT_EQUAL_DIMENSIONS(this, new_matrix);
+    const auto exec = this->get_executor();
+    if (parameters_.max_block_size == 1) {
+        // the scalar version has no symbolic part to reuse
+        const auto hash_pattern = [&](const LinOp* mtx) {
+            return jacobi::hash_scalar_pattern<ValueType, IndexType>(exec,
+                                                                     mtx);
+        };
+        ::gko::detail::ensure_same_sparsity_pattern(
+            pattern_source_, pattern_hash_, new_matrix.get(),
+            hash_pattern(new_matrix.get()), hash_pattern);
+        this->generate(new_matrix.get(), parameters_.skip_sorting);
+        return;
+    }
+    const auto hash_pattern = [&](const LinOp* mtx) {
+        return ::gko::detail::hash_sparsity_pattern(
+            convert_to_with_sorting<csr_type>(exec, mtx,
+                                              parameters_.skip_sorting)
+                .get());
+    };
+    auto csr_mtx = convert_to_with_sorting<csr_type>(exec, new_matrix.get(),
+                                                     parameters_.skip_sorting);
+    ::gko::detail::ensure_same_sparsity_pattern(
+        pattern_source_, pattern_hash_, new_matrix.get(),
+        ::gko::detail::hash_sparsity_pattern(csr_mtx.get()), hash_pattern);
+    if (requested_precisions_.get_size() > 0) {
+        parameters_.storage_optimization.block_wise = requested_precisions_;
     }
+    this->compute_blocks(csr_mtx.get());
 }
 
 
@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/gray_code.hpp>
+
+
+#include <complex>
+#include <memory>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/temporary_clone.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/reorder/gray_code_kernels.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace gray_code {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_permutation, gray_code::compute_permutation);
+
+
+}  // anonymous namespace
+}  // namespace gray_code
+
+
+template <typename IndexType>
+GrayCode<IndexType>::GrayCode(std::shared_ptr<const Executor> exec,
+                              const parameters_type& params)
+    : EnablePolymorphicObject<GrayCode, LinOpFactory>(std::move(exec)),
+      parameters_{params}
+{
+    if (parameters_.num_column_blocks < 1 ||
+        parameters_.num_column_blocks > 64) {
+        GKO_INVALID_STATE("num_column_blocks needs to be between 1 and 64");
+    }
+}
+
+
+template <typename IndexType>
+std::unique_ptr<matrix::Permutation<IndexType>> GrayCode<IndexType>::generate(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    auto product =
+        std::unique_ptr<permutation_type>(static_cast<permutation_type*>(
+            this->LinOpFactory::generate(std::move(system_matrix)).release()));
+    return product;
+}
+
+
+template <typename IndexType>
+std::unique_ptr<LinOp> GrayCode<IndexType>::generate_impl(
+    std::shared_ptr<const LinOp> system_matrix) const
+{
+    const auto exec = this->get_executor();
+    const auto host_exec = exec->get_master();
+    const auto num_rows = system_matrix->get_size()[0];
+    const auto num_cols = system_matrix->get_size()[1];
+    array<IndexType> permutation(host_exec, num_rows);
+    // only the sparsity pattern is used, so we convert to the cheapest Csr
+    // type the matrix supports
+    auto compute = [&](auto value_type) {
+        using ValueType = std::decay_t<decltype(value_type)>;
+        using Mtx = matrix::Csr<ValueType, IndexType>;
+        const auto csr_mtx = copy_and_convert_to<Mtx>(exec, system_matrix);
+        const auto host_mtx = make_temporary_clone(host_exec, csr_mtx);
+        // device executors run the ordering on their host executor
+        host_exec->run(gray_code::make_compute_permutation(
+            static_cast<IndexType>(num_rows), static_cast<IndexType>(num_cols),
+            host_mtx->get_const_row_ptrs(), host_mtx->get_const_col_idxs(),
+            static_cast<int>(parameters_.num_column_blocks),
+            permutation.get_data()));
+    };
+    if (dynamic_cast<const ConvertibleTo<matrix::Csr<float, IndexType>>*>(
+            system_matrix.get())) {
+        compute(float{});
+    } else {
+        compute(std::complex<float>{});
+    }
+    permutation.set_executor(exec);
+    return permutation_type::create(exec, std::move(permutation));
+}
+
+
+#define GKO_DECLARE_GRAY_CODE(IndexType) class GrayCode<IndexType>
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_GRAY_CODE);
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
@@ -0,0 +1,54 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_GRAY_CODE_KERNELS_HPP_
+#define GKO_CORE_REORDER_GRAY_CODE_KERNELS_HPP_
+
+
+#include <ginkgo/core/reorder/gray_code.hpp>
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+
+
+/**
+ * Computes the Gray code row ordering of the sparsity pattern given by
+ * row_ptrs and col_idxs, using num_column_blocks bits per row signature.
+ * permutation[i] is the row placed at position i.
+ */
+#define GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL(IndexType)       \
+    void compute_permutation(std::shared_ptr<const DefaultExecutor> exec, \
+                             IndexType num_rows, IndexType num_cols,      \
+                             const IndexType* row_ptrs,                   \
+                             const IndexType* col_idxs,                   \
+                             int num_column_blocks, IndexType* permutation)
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES \
+    template <typename IndexType>    \
+    GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL(IndexType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(gray_code,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAY_CODE_KERNELS_HPP_
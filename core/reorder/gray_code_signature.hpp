@@ -0,0 +1,55 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_GRAY_CODE_SIGNATURE_HPP_
+#define GKO_CORE_REORDER_GRAY_CODE_SIGNATURE_HPP_
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+namespace gray_code {
+
+
+/**
+ * Returns the signature of a row, which has bit b set if the row has a
+ * nonzero in the b-th of num_column_blocks contiguous column blocks.
+ */
+template <typename IndexType>
+uint64 row_signature(const IndexType* row_ptrs, const IndexType* col_idxs,
+                     IndexType row, IndexType num_cols, int num_column_blocks)
+{
+    uint64 signature{};
+    for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; ++nz) {
+        const auto block = static_cast<int64>(col_idxs[nz]) *
+                           num_column_blocks / static_cast<int64>(num_cols);
+        signature |= uint64{1} << block;
+    }
+    return signature;
+}
+
+
+/**
+ * Returns the position of the given code word in the binary reflected Gray
+ * code sequence, i.e. converts it from Gray code to binary.
+ */
+inline uint64 gray_code_rank(uint64 code)
+{
+    for (int shift = 1; shift < 64; shift *= 2) {
+        code ^= code >> shift;
+    }
+    return code;
+}
+
+
+}  // namespace gray_code
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_GRAY_CODE_SIGNATURE_HPP_
@@ -19,11 +19,27 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
 
 
 namespace gko {
 namespace experimental {
 namespace reorder {
+namespace nested_dissection {
+namespace {
+
+
+GKO_REGISTER_OPERATION(compute_permutation,
+                       nested_dissection::compute_permutation);
+
+
+}  // anonymous namespace
+}  // namespace nested_dissection
+
+
+#if GKO_HAVE_METIS
+
+
 namespace {
 
 
@@ -110,6 +126,9 @@ GKO_REGISTER_HOST_OPERATION(metis_nd, metis_nd);
 }  // namespace
 
 
+#endif  // GKO_HAVE_METIS
+
+
 template <typename ValueType, typename IndexType>
 NestedDissection<ValueType, IndexType>::NestedDissection(
     std::shared_ptr<const Executor> exec, const parameters_type& params)
@@ -147,6 +166,15 @@ std::unique_ptr<LinOp> NestedDissection<ValueType, IndexType>::generate_impl(
     const auto host_mtx = make_temporary_clone(host_exec, sparsity_mtx);
     const auto num_rows = host_mtx->get_size()[0];
     array<IndexType> permutation(host_exec, num_rows);
+    if (parameters_.algorithm == nd_algorithm::native) {
+        // device executors run the ordering on their host executor
+        host_exec->run(nested_dissection::make_compute_permutation(
+            static_cast<IndexType>(num_rows), host_mtx->get_const_row_ptrs(),
+            host_mtx->get_const_col_idxs(), permutation.get_data()));
+        permutation.set_executor(exec);
+        return permutation_type::create(exec, std::move(permutation));
+    }
+#if GKO_HAVE_METIS
     array<IndexType> inv_permutation(host_exec, num_rows);
     exec->run(make_metis_nd(host_exec, num_rows, host_mtx->get_const_row_ptrs(),
                             host_mtx->get_const_col_idxs(),
@@ -156,6 +184,9 @@ std::unique_ptr<LinOp> NestedDissection<ValueType, IndexType>::generate_impl(
     permutation.set_executor(exec);
     // we discard the inverse permutation
     return permutation_type::create(exec, std::move(permutation));
+#else
+    GKO_NOT_COMPILED(metis);
+#endif
 }
 
 
@@ -0,0 +1,814 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_REORDER_NESTED_DISSECTION_HPP_
+#define GKO_CORE_REORDER_NESTED_DISSECTION_HPP_
+
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <tuple>
+#include <utility>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/addressable_pq.hpp"
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+/**
+ * @brief The building blocks of the native multilevel nested dissection,
+ *        shared between the host kernels.
+ */
+namespace nd {
+
+
+/** Graphs with at most this many vertices are ordered by minimum degree. */
+constexpr int leaf_size = 128;
+
+/** Coarsening stops once the graph has at most this many vertices. */
+constexpr int coarsest_size = 100;
+
+/** The number of initial bisections computed on the coarsest graph. */
+constexpr int num_initial_trials = 4;
+
+/** The maximum number of refinement passes on each level. */
+constexpr int num_refinement_passes = 4;
+
+/** The number of consecutive moves without improvement ending a pass. */
+constexpr int max_bad_moves = 64;
+
+/** The allowed relative weight of each side of a bisection. */
+constexpr double max_side_weight_ratio = 0.55;
+
+
+/** Labels of vertices in a bisection or vertex separator. */
+constexpr uint8 separator = 2;
+
+
+/**
+ * Scrambles an integer, used to visit vertices in a deterministic but
+ * irregular order.
+ */
+inline uint32 scramble(uint32 value)
+{
+    value ^= value >> 16;
+    value *= 0x7feb352dU;
+    value ^= value >> 15;
+    value *= 0x846ca68bU;
+    value ^= value >> 16;
+    return value;
+}
+
+
+/**
+ * An undirected graph without self-loops in CSR format, with vertex and edge
+ * weights.
+ */
+template <typename IndexType>
+struct graph {
+    explicit graph(std::shared_ptr<const Executor> exec)
+        : row_ptrs{exec},
+          col_idxs{exec},
+          edge_weights{exec},
+          vertex_weights{exec}
+    {}
+
+    IndexType num_vertices() const
+    {
+        return static_cast<IndexType>(vertex_weights.size());
+    }
+
+    IndexType total_weight() const
+    {
+        return std::accumulate(vertex_weights.begin(), vertex_weights.end(),
+                               IndexType{});
+    }
+
+    vector<IndexType> row_ptrs;
+    vector<IndexType> col_idxs;
+    vector<IndexType> edge_weights;
+    vector<IndexType> vertex_weights;
+};
+
+
+/**
+ * A subgraph to be ordered, together with the original indices of its
+ * vertices.
+ */
+template <typename IndexType>
+struct problem {
+    explicit problem(std::shared_ptr<const Executor> exec)
+        : adjacency{exec}, vertices{exec}
+    {}
+
+    IndexType size() const { return adjacency.num_vertices(); }
+
+    graph<IndexType> adjacency;
+    vector<IndexType> vertices;
+};
+
+
+/**
+ * Computes a heavy-edge matching of the graph and contracts the matched
+ * vertices, returning the coarse graph. coarse_map maps every vertex to its
+ * coarse vertex.
+ */
+template <typename IndexType>
+graph<IndexType> coarsen(std::shared_ptr<const Executor> exec,
+                         const graph<IndexType>& fine,
+                         vector<IndexType>& coarse_map)
+{
+    const auto invalid = invalid_index<IndexType>();
+    const auto n = fine.num_vertices();
+    // avoid creating heavy coarse vertices that make balancing hard
+    const auto max_vertex_weight =
+        std::max<IndexType>(fine.total_weight() / coarsest_size * 3 / 2, 1);
+    vector<IndexType> order(n, exec);
+    std::iota(order.begin(), order.end(), IndexType{});
+    std::sort(order.begin(), order.end(), [&](IndexType a, IndexType b) {
+        return std::make_tuple(fine.row_ptrs[a + 1] - fine.row_ptrs[a],
+                               scramble(a), a) <
+               std::make_tuple(fine.row_ptrs[b + 1] - fine.row_ptrs[b],
+                               scramble(b), b);
+    });
+    vector<IndexType> match(n, invalid, exec);
+    vector<IndexType> coarse_vertices(exec);
+    coarse_map.assign(n, invalid);
+    for (auto vertex : order) {
+        if (match[vertex] != invalid) {
+            continue;
+        }
+        auto partner = vertex;
+        IndexType partner_weight{};
+        for (auto nz = fine.row_ptrs[vertex]; nz < fine.row_ptrs[vertex + 1];
+             nz++) {
+            const auto neighbor = fine.col_idxs[nz];
+            if (match[neighbor] == invalid &&
+                fine.edge_weights[nz] > partner_weight &&
+                fine.vertex_weights[vertex] +
+                        fine.vertex_weights[neighbor] <=
+                    max_vertex_weight) {
+                partner = neighbor;
+                partner_weight = fine.edge_weights[nz];
+            }
+        }
+        match[vertex] = partner;
+        match[partner] = vertex;
+        coarse_map[vertex] = static_cast<IndexType>(coarse_vertices.size());
+        coarse_map[partner] = coarse_map[vertex];
+        coarse_vertices.push_back(vertex);
+    }
+    const auto coarse_n = static_cast<IndexType>(coarse_vertices.size());
+    graph<IndexType> coarse{exec};
+    coarse.row_ptrs.reserve(coarse_n + 1);
+    coarse.row_ptrs.push_back(0);
+    coarse.vertex_weights.resize(coarse_n);
+    vector<IndexType> position(coarse_n, invalid, exec);
+    for (IndexType coarse_vertex = 0; coarse_vertex < coarse_n;
+         coarse_vertex++) {
+        const auto begin = static_cast<IndexType>(coarse.col_idxs.size());
+        const auto vertex = coarse_vertices[coarse_vertex];
+        const auto partner = match[vertex];
+        coarse.vertex_weights[coarse_vertex] =
+            fine.vertex_weights[vertex] +
+            (partner != vertex ? fine.vertex_weights[partner] : 0);
+        for (auto fine_vertex : {vertex, partner}) {
+            for (auto nz = fine.row_ptrs[fine_vertex];
+                 nz < fine.row_ptrs[fine_vertex + 1]; nz++) {
+                const auto neighbor = coarse_map[fine.col_idxs[nz]];
+                if (neighbor == coarse_vertex) {
+                    continue;
+                }
+                if (position[neighbor] == invalid) {
+                    position[neighbor] =
+                        static_cast<IndexType>(coarse.col_idxs.size());
+                    coarse.col_idxs.push_back(neighbor);
+                    coarse.edge_weights.push_back(fine.edge_weights[nz]);
+                } else {
+                    coarse.edge_weights[position[neighbor]] +=
+                        fine.edge_weights[nz];
+                }
+            }
+            if (partner == vertex) {
+                break;
+            }
+        }
+        const auto end = static_cast<IndexType>(coarse.col_idxs.size());
+        for (auto nz = begin; nz < end; nz++) {
+            position[coarse.col_idxs[nz]] = invalid;
+        }
+        coarse.row_ptrs.push_back(
+            static_cast<IndexType>(coarse.col_idxs.size()));
+    }
+    return coarse;
+}
+
+
+/**
+ * Computes the weight of the edges between both sides of a bisection.
+ */
+template <typename IndexType>
+IndexType edge_cut(const graph<IndexType>& g, const vector<uint8>& side)
+{
+    IndexType cut{};
+    for (IndexType vertex = 0; vertex < g.num_vertices(); vertex++) {
+        for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1]; nz++) {
+            if (side[vertex] != side[g.col_idxs[nz]]) {
+                cut += g.edge_weights[nz];
+            }
+        }
+    }
+    return cut / 2;
+}
+
+
+/**
+ * Improves an edge bisection using Fiduccia-Mattheyses refinement, moving
+ * boundary vertices between the sides as long as this reduces the edge cut
+ * or the imbalance.
+ */
+template <typename IndexType>
+void refine_bisection(std::shared_ptr<const Executor> exec,
+                      const graph<IndexType>& g, vector<uint8>& side,
+                      IndexType max_side_weight)
+{
+    using key_type = std::pair<IndexType, IndexType>;
+    const auto n = g.num_vertices();
+    vector<IndexType> gain(n, exec);
+    vector<uint8> locked(n, exec);
+    vector<uint8> queued(n, exec);
+    vector<IndexType> moves(exec);
+    std::array<addressable_priority_queue<key_type, IndexType>, 2> queues{
+        {{exec, static_cast<size_type>(n)}, {exec, static_cast<size_type>(n)}}};
+    IndexType weights[2]{};
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        weights[side[vertex]] += g.vertex_weights[vertex];
+    }
+    auto cut = edge_cut(g, side);
+    const auto cost = [&](IndexType cur_cut) {
+        return std::make_pair(
+            std::max({weights[0] - max_side_weight,
+                      weights[1] - max_side_weight, IndexType{}}),
+            cur_cut);
+    };
+    for (int pass = 0; pass < num_refinement_passes; pass++) {
+        std::fill(locked.begin(), locked.end(), uint8{});
+        std::fill(queued.begin(), queued.end(), uint8{});
+        queues[0].reset();
+        queues[1].reset();
+        for (IndexType vertex = 0; vertex < n; vertex++) {
+            IndexType external{};
+            IndexType internal{};
+            for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1];
+                 nz++) {
+                (side[g.col_idxs[nz]] == side[vertex] ? internal : external) +=
+                    g.edge_weights[nz];
+            }
+            gain[vertex] = external - internal;
+            if (external > 0) {
+                queues[side[vertex]].insert({-gain[vertex], vertex}, vertex);
+                queued[vertex] = 1;
+            }
+        }
+        moves.clear();
+        const auto initial_cost = cost(cut);
+        auto best_cost = initial_cost;
+        size_type best_num_moves{};
+        int bad_moves{};
+        while (!queues[0].empty() || !queues[1].empty()) {
+            // move from the side whose best move has the higher gain, unless
+            // that makes the other side too heavy
+            int from = -1;
+            for (int s = 0; s < 2; s++) {
+                if (queues[s].empty()) {
+                    continue;
+                }
+                const auto vertex = queues[s].min_node();
+                if (weights[1 - s] + g.vertex_weights[vertex] >
+                        max_side_weight &&
+                    weights[s] <= max_side_weight) {
+                    continue;
+                }
+                if (from < 0 ||
+                    std::make_pair(queues[s].min_key().first, -weights[s]) <
+                        std::make_pair(queues[from].min_key().first,
+                                       -weights[from])) {
+                    from = s;
+                }
+            }
+            if (from < 0) {
+                break;
+            }
+            const auto vertex = queues[from].min_node();
+            queues[from].pop_min();
+            queued[vertex] = 0;
+            locked[vertex] = 1;
+            side[vertex] = static_cast<uint8>(1 - from);
+            weights[from] -= g.vertex_weights[vertex];
+            weights[1 - from] += g.vertex_weights[vertex];
+            cut -= gain[vertex];
+            moves.push_back(vertex);
+            for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1];
+                 nz++) {
+                const auto neighbor = g.col_idxs[nz];
+                if (locked[neighbor]) {
+                    continue;
+                }
+                gain[neighbor] += side[neighbor] == from
+                                      ? 2 * g.edge_weights[nz]
+                                      : -2 * g.edge_weights[nz];
+                if (queued[neighbor]) {
+                    queues[side[neighbor]].update_key(
+                        {-gain[neighbor], neighbor}, neighbor);
+                } else {
+                    queues[side[neighbor]].insert({-gain[neighbor], neighbor},
+                                                  neighbor);
+                    queued[neighbor] = 1;
+                }
+            }
+            if (cost(cut) < best_cost) {
+                best_cost = cost(cut);
+                best_num_moves = moves.size();
+                bad_moves = 0;
+            } else if (++bad_moves > max_bad_moves) {
+                break;
+            }
+        }
+        // roll back the moves after the best bisection
+        while (moves.size() > best_num_moves) {
+            const auto vertex = moves.back();
+            moves.pop_back();
+            const auto to = side[vertex];
+            side[vertex] = static_cast<uint8>(1 - to);
+            weights[to] -= g.vertex_weights[vertex];
+            weights[1 - to] += g.vertex_weights[vertex];
+        }
+        cut = best_cost.second;
+        if (!(best_cost < initial_cost)) {
+            break;
+        }
+    }
+}
+
+
+/**
+ * Computes an edge bisection of a (small) graph by greedy graph growing: Side
+ * 0 is grown from a seed vertex, always adding the vertex that decreases the
+ * edge cut most, until it contains half of the vertex weight.
+ */
+template <typename IndexType>
+void grow_bisection(std::shared_ptr<const Executor> exec,
+                    const graph<IndexType>& g, IndexType seed,
+                    vector<uint8>& side)
+{
+    using key_type = std::pair<IndexType, IndexType>;
+    const auto n = g.num_vertices();
+    const auto target_weight = g.total_weight() / 2;
+    side.assign(n, 1);
+    vector<IndexType> gain(n, exec);
+    vector<uint8> queued(n, exec);
+    addressable_priority_queue<key_type, IndexType> queue{
+        exec, static_cast<size_type>(n)};
+    IndexType weight{};
+    IndexType next_unvisited{};
+    while (weight < target_weight) {
+        if (queue.empty()) {
+            // the graph may be disconnected, start from a new seed
+            if (side[seed] == 0) {
+                while (side[next_unvisited] == 0) {
+                    next_unvisited++;
+                }
+                seed = next_unvisited;
+            }
+            gain[seed] = 0;
+            queue.insert({0, seed}, seed);
+            queued[seed] = 1;
+        }
+        const auto vertex = queue.min_node();
+        queue.pop_min();
+        side[vertex] = 0;
+        weight += g.vertex_weights[vertex];
+        for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1]; nz++) {
+            const auto neighbor = g.col_idxs[nz];
+            if (side[neighbor] == 0) {
+                continue;
+            }
+            if (queued[neighbor]) {
+                gain[neighbor] += 2 * g.edge_weights[nz];
+                queue.update_key({-gain[neighbor], neighbor}, neighbor);
+            } else {
+                gain[neighbor] = 0;
+                for (auto nz2 = g.row_ptrs[neighbor];
+                     nz2 < g.row_ptrs[neighbor + 1]; nz2++) {
+                    gain[neighbor] += side[g.col_idxs[nz2]] == 0
+                                          ? g.edge_weights[nz2]
+                                          : -g.edge_weights[nz2];
+                }
+                queue.insert({-gain[neighbor], neighbor}, neighbor);
+                queued[neighbor] = 1;
+            }
+        }
+    }
+}
+
+
+/**
+ * Turns an edge bisection into a vertex separator by moving the boundary
+ * vertices of the side with the smaller boundary into the separator.
+ */
+template <typename IndexType>
+void edge_to_vertex_separator(const graph<IndexType>& g, vector<uint8>& side)
+{
+    const auto n = g.num_vertices();
+    const auto is_boundary = [&](IndexType vertex) {
+        for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1]; nz++) {
+            if (side[g.col_idxs[nz]] != side[vertex]) {
+                return true;
+            }
+        }
+        return false;
+    };
+    IndexType boundary_weights[2]{};
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        if (is_boundary(vertex)) {
+            boundary_weights[side[vertex]] += g.vertex_weights[vertex];
+        }
+    }
+    const auto separator_side =
+        boundary_weights[0] <= boundary_weights[1] ? 0 : 1;
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        // new separator vertices are not boundary vertices of the other side
+        if (side[vertex] == separator_side && is_boundary(vertex)) {
+            side[vertex] = separator;
+        }
+    }
+}
+
+
+/**
+ * Improves a vertex separator using Fiduccia-Mattheyses refinement: Moving a
+ * separator vertex to one side pulls its neighbors on the other side into the
+ * separator. The moves are applied greedily as long as they reduce the
+ * separator weight or the imbalance.
+ */
+template <typename IndexType>
+void refine_separator(std::shared_ptr<const Executor> exec,
+                      const graph<IndexType>& g, vector<uint8>& side,
+                      IndexType max_side_weight)
+{
+    using key_type = std::pair<IndexType, IndexType>;
+    const auto n = g.num_vertices();
+    vector<uint8> locked(n, exec);
+    vector<uint8> queued(n, exec);
+    // stores the vertex and its previous side for every change
+    vector<std::pair<IndexType, uint8>> changes(exec);
+    vector<IndexType> affected(exec);
+    std::array<addressable_priority_queue<key_type, IndexType>, 2> queues{
+        {{exec, static_cast<size_type>(n)}, {exec, static_cast<size_type>(n)}}};
+    IndexType weights[3]{};
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        weights[side[vertex]] += g.vertex_weights[vertex];
+    }
+    const auto cost = [&] {
+        return std::make_tuple(
+            std::max({weights[0] - max_side_weight,
+                      weights[1] - max_side_weight, IndexType{}}),
+            weights[separator], std::abs(weights[0] - weights[1]));
+    };
+    // the gain of moving a separator vertex to side s
+    const auto compute_gain = [&](IndexType vertex, int s) {
+        auto gain = g.vertex_weights[vertex];
+        for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1]; nz++) {
+            const auto neighbor = g.col_idxs[nz];
+            if (side[neighbor] == 1 - s) {
+                gain -= g.vertex_weights[neighbor];
+            }
+        }
+        return gain;
+    };
+    const auto update_queues = [&](IndexType vertex) {
+        for (int s = 0; s < 2; s++) {
+            const key_type key{-compute_gain(vertex, s), vertex};
+            if (queued[vertex] & (1 << s)) {
+                queues[s].update_key(key, vertex);
+            } else {
+                queues[s].insert(key, vertex);
+                queued[vertex] |= 1 << s;
+            }
+        }
+    };
+    const auto is_stale = [&](IndexType vertex) {
+        return side[vertex] != separator || locked[vertex];
+    };
+    const auto change_side = [&](IndexType vertex, uint8 new_side) {
+        changes.emplace_back(vertex, side[vertex]);
+        weights[side[vertex]] -= g.vertex_weights[vertex];
+        weights[new_side] += g.vertex_weights[vertex];
+        side[vertex] = new_side;
+    };
+    for (int pass = 0; pass < num_refinement_passes; pass++) {
+        std::fill(locked.begin(), locked.end(), uint8{});
+        std::fill(queued.begin(), queued.end(), uint8{});
+        queues[0].reset();
+        queues[1].reset();
+        for (IndexType vertex = 0; vertex < n; vertex++) {
+            if (side[vertex] == separator) {
+                update_queues(vertex);
+            }
+        }
+        changes.clear();
+        const auto initial_cost = cost();
+        auto best_cost = initial_cost;
+        size_type best_num_changes{};
+        int bad_moves{};
+        while (true) {
+            int to = -1;
+            for (int s = 0; s < 2; s++) {
+                while (!queues[s].empty() && is_stale(queues[s].min_node())) {
+                    queued[queues[s].min_node()] &= ~(1 << s);
+                    queues[s].pop_min();
+                }
+                if (queues[s].empty() ||
+                    weights[s] + g.vertex_weights[queues[s].min_node()] >
+                        max_side_weight) {
+                    continue;
+                }
+                if (to < 0 ||
+                    std::make_pair(queues[s].min_key().first, weights[s]) <
+                        std::make_pair(queues[to].min_key().first,
+                                       weights[to])) {
+                    to = s;
+                }
+            }
+            if (to < 0) {
+                break;
+            }
+            const auto vertex = queues[to].min_node();
+            queues[to].pop_min();
+            queued[vertex] &= ~(1 << to);
+            locked[vertex] = 1;
+            change_side(vertex, static_cast<uint8>(to));
+            affected.clear();
+            for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1];
+                 nz++) {
+                const auto neighbor = g.col_idxs[nz];
+                if (side[neighbor] == 1 - to) {
+                    change_side(neighbor, separator);
+                    for (auto nz2 = g.row_ptrs[neighbor];
+                         nz2 < g.row_ptrs[neighbor + 1]; nz2++) {
+                        affected.push_back(g.col_idxs[nz2]);
+                    }
+                }
+                affected.push_back(neighbor);
+            }
+            for (auto affected_vertex : affected) {
+                if (!is_stale(affected_vertex)) {
+                    update_queues(affected_vertex);
+                }
+            }
+            if (cost() < best_cost) {
+                best_cost = cost();
+                best_num_changes = changes.size();
+                bad_moves = 0;
+            } else if (++bad_moves > max_bad_moves) {
+                break;
+            }
+        }
+        // roll back the changes after the best separator
+        while (changes.size() > best_num_changes) {
+            const auto change = changes.back();
+            changes.pop_back();
+            weights[side[change.first]] -= g.vertex_weights[change.first];
+            weights[change.second] += g.vertex_weights[change.first];
+            side[change.first] = change.second;
+        }
+        if (!(best_cost < initial_cost)) {
+            break;
+        }
+    }
+}
+
+
+/**
+ * Computes a vertex separator of the graph using multilevel bisection: The
+ * graph is coarsened by heavy-edge matching, bisected by greedy graph growing
+ * and the bisection is refined on every level while projecting it back to the
+ * input graph. Finally, it is converted into a vertex separator and refined.
+ *
+ * @return the side (0 or 1) of every vertex, or `separator`.
+ */
+template <typename IndexType>
+vector<uint8> compute_separator(std::shared_ptr<const Executor> exec,
+                                const graph<IndexType>& input)
+{
+    const auto max_side_weight = static_cast<IndexType>(
+        input.total_weight() * max_side_weight_ratio);
+    vector<graph<IndexType>> levels(exec);
+    vector<vector<IndexType>> coarse_maps(exec);
+    const auto* current = &input;
+    while (current->num_vertices() > coarsest_size) {
+        vector<IndexType> coarse_map(exec);
+        auto coarse = coarsen(exec, *current, coarse_map);
+        if (coarse.num_vertices() > current->num_vertices() * 9 / 10) {
+            break;
+        }
+        levels.push_back(std::move(coarse));
+        coarse_maps.push_back(std::move(coarse_map));
+        current = &levels.back();
+    }
+    // bisect the coarsest graph, choosing the best of multiple seeds
+    vector<uint8> side(exec);
+    vector<uint8> trial_side(exec);
+    IndexType best_cut{};
+    for (int trial = 0; trial < num_initial_trials; trial++) {
+        const auto seed = static_cast<IndexType>(
+            scramble(static_cast<uint32>(trial)) % current->num_vertices());
+        grow_bisection(exec, *current, seed, trial_side);
+        refine_bisection(exec, *current, trial_side, max_side_weight);
+        const auto cut = edge_cut(*current, trial_side);
+        if (trial == 0 || cut < best_cut) {
+            best_cut = cut;
+            side = trial_side;
+        }
+    }
+    // project the bisection back to the input graph
+    for (auto level = static_cast<int>(levels.size()) - 1; level >= 0;
+         level--) {
+        const auto& fine = level > 0 ? levels[level - 1] : input;
+        const auto& coarse_map = coarse_maps[level];
+        vector<uint8> fine_side(fine.num_vertices(), exec);
+        for (IndexType vertex = 0; vertex < fine.num_vertices(); vertex++) {
+            fine_side[vertex] = side[coarse_map[vertex]];
+        }
+        side = std::move(fine_side);
+        refine_bisection(exec, fine, side, max_side_weight);
+    }
+    edge_to_vertex_separator(input, side);
+    refine_separator(exec, input, side, max_side_weight);
+    return side;
+}
+
+
+/**
+ * Orders a small graph using the minimum degree algorithm on the explicit
+ * elimination graph, writing the original vertex indices to permutation.
+ */
+template <typename IndexType>
+void order_leaf(std::shared_ptr<const Executor> exec,
+                const problem<IndexType>& p, IndexType* permutation)
+{
+    const auto n = p.size();
+    const auto& g = p.adjacency;
+    vector<vector<IndexType>> adj(n, vector<IndexType>(exec), exec);
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        adj[vertex].assign(g.col_idxs.begin() + g.row_ptrs[vertex],
+                           g.col_idxs.begin() + g.row_ptrs[vertex + 1]);
+        std::sort(adj[vertex].begin(), adj[vertex].end());
+    }
+    vector<uint8> eliminated(n, exec);
+    vector<IndexType> merged(exec);
+    for (IndexType step = 0; step < n; step++) {
+        IndexType pivot = -1;
+        for (IndexType vertex = 0; vertex < n; vertex++) {
+            if (!eliminated[vertex] &&
+                (pivot < 0 || adj[vertex].size() < adj[pivot].size())) {
+                pivot = vertex;
+            }
+        }
+        eliminated[pivot] = 1;
+        permutation[step] = p.vertices[pivot];
+        // the neighbors of the pivot form a clique
+        const auto& clique = adj[pivot];
+        for (auto vertex : clique) {
+            merged.clear();
+            std::set_union(adj[vertex].begin(), adj[vertex].end(),
+                           clique.begin(), clique.end(),
+                           std::back_inserter(merged));
+            merged.erase(std::remove_if(merged.begin(), merged.end(),
+                                        [&](IndexType u) {
+                                            return u == vertex || u == pivot;
+                                        }),
+                         merged.end());
+            adj[vertex].swap(merged);
+        }
+    }
+}
+
+
+/**
+ * Extracts the subgraph induced by all vertices on the given side.
+ */
+template <typename IndexType>
+problem<IndexType> extract_side(std::shared_ptr<const Executor> exec,
+                                const problem<IndexType>& p,
+                                const vector<uint8>& side, uint8 which,
+                                vector<IndexType>& local_index)
+{
+    const auto& g = p.adjacency;
+    problem<IndexType> result{exec};
+    for (IndexType vertex = 0; vertex < p.size(); vertex++) {
+        if (side[vertex] == which) {
+            local_index[vertex] =
+                static_cast<IndexType>(result.vertices.size());
+            result.vertices.push_back(p.vertices[vertex]);
+        }
+    }
+    auto& sub = result.adjacency;
+    sub.row_ptrs.push_back(0);
+    for (IndexType vertex = 0; vertex < p.size(); vertex++) {
+        if (side[vertex] != which) {
+            continue;
+        }
+        for (auto nz = g.row_ptrs[vertex]; nz < g.row_ptrs[vertex + 1]; nz++) {
+            const auto neighbor = g.col_idxs[nz];
+            if (side[neighbor] == which) {
+                sub.col_idxs.push_back(local_index[neighbor]);
+                sub.edge_weights.push_back(1);
+            }
+        }
+        sub.row_ptrs.push_back(static_cast<IndexType>(sub.col_idxs.size()));
+    }
+    sub.vertex_weights.assign(result.vertices.size(), 1);
+    return result;
+}
+
+
+/**
+ * Creates the problem for the whole graph given by an adjacency matrix
+ * without diagonal entries.
+ */
+template <typename IndexType>
+problem<IndexType> make_problem(std::shared_ptr<const Executor> exec,
+                                IndexType num_vertices,
+                                const IndexType* row_ptrs,
+                                const IndexType* col_idxs)
+{
+    problem<IndexType> result{exec};
+    auto& g = result.adjacency;
+    g.row_ptrs.assign(row_ptrs, row_ptrs + num_vertices + 1);
+    g.col_idxs.assign(col_idxs, col_idxs + row_ptrs[num_vertices]);
+    g.edge_weights.assign(g.col_idxs.size(), 1);
+    g.vertex_weights.assign(num_vertices, 1);
+    result.vertices.resize(num_vertices);
+    std::iota(result.vertices.begin(), result.vertices.end(), IndexType{});
+    return result;
+}
+
+
+/**
+ * Executes one step of the nested dissection: It computes a vertex separator
+ * of the problem, writes its vertices to the end of permutation and returns
+ * the problems for both remaining sides, whose orderings need to be written
+ * to the beginning of permutation, in this order. Small problems are ordered
+ * completely, returning two empty problems.
+ */
+template <typename IndexType>
+std::pair<problem<IndexType>, problem<IndexType>> dissect(
+    std::shared_ptr<const Executor> exec, const problem<IndexType>& p,
+    IndexType* permutation)
+{
+    const auto n = p.size();
+    std::pair<problem<IndexType>, problem<IndexType>> result{
+        problem<IndexType>{exec}, problem<IndexType>{exec}};
+    if (n <= leaf_size) {
+        order_leaf(exec, p, permutation);
+        return result;
+    }
+    const auto side = compute_separator(exec, p.adjacency);
+    vector<IndexType> local_index(n, exec);
+    result.first = extract_side(exec, p, side, 0, local_index);
+    result.second = extract_side(exec, p, side, 1, local_index);
+    if (result.first.size() == 0 || result.second.size() == 0) {
+        // no useful separator, e.g. for dense graphs
+        std::copy(p.vertices.begin(), p.vertices.end(), permutation);
+        return {problem<IndexType>{exec}, problem<IndexType>{exec}};
+    }
+    auto out = permutation + result.first.size() + result.second.size();
+    for (IndexType vertex = 0; vertex < n; vertex++) {
+        if (side[vertex] == separator) {
+            *out++ = p.vertices[vertex];
+        }
+    }
+    return result;
+}
+
+
+}  // namespace nd
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_CORE_REORDER_NESTED_DISSECTION_HPP_
@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/reordered.hpp>
+
+
+#include <utility>
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+
+
+template <typename ValueType, typename IndexType>
+Reordered<ValueType, IndexType>::Reordered(
+    std::shared_ptr<const Executor> exec)
+    : EnableLinOp<Reordered>(std::move(exec))
+{}
+
+
+template <typename ValueType, typename IndexType>
+Reordered<ValueType, IndexType>::Reordered(
+    const Factory* factory, std::shared_ptr<const LinOp> system_matrix)
+    : EnableLinOp<Reordered>(factory->get_executor(),
+                             system_matrix->get_size()),
+      parameters_{factory->get_parameters()}
+{
+    GKO_ASSERT_IS_SQUARE_MATRIX(system_matrix);
+    const auto exec = this->get_executor();
+    system_matrix_ = system_matrix;
+    if (parameters_.reordering) {
+        permutation_ = as<permutation_type>(
+            parameters_.reordering->generate(system_matrix));
+        if (auto permutable = dynamic_cast<const Permutable<IndexType>*>(
+                system_matrix.get())) {
+            const auto permutation_array =
+                make_const_array_view(exec, this->get_size()[0],
+                                      permutation_->get_const_permutation())
+                    .copy_to_array();
+            system_matrix_ = permutable->permute(&permutation_array);
+        } else {
+            using csr_type = matrix::Csr<ValueType, IndexType>;
+            system_matrix_ = copy_and_convert_to<csr_type>(exec, system_matrix)
+                                 ->permute(permutation_);
+        }
+    }
+    if (parameters_.inner_operator) {
+        inner_operator_ = parameters_.inner_operator->generate(system_matrix_);
+    } else {
+        inner_operator_ =
+            matrix::Identity<ValueType>::create(exec, this->get_size()[0]);
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+matrix::Dense<ValueType>* Reordered<ValueType, IndexType>::apply_permuted(
+    const matrix::Dense<ValueType>* b, const matrix::Dense<ValueType>* x) const
+{
+    if (cache_.inner_b == nullptr ||
+        cache_.inner_b->get_size() != b->get_size()) {
+        const auto exec = this->get_executor();
+        cache_.inner_b = matrix::Dense<ValueType>::create(exec, b->get_size());
+        cache_.inner_x = matrix::Dense<ValueType>::create(exec, b->get_size());
+    }
+    b->permute(permutation_, cache_.inner_b, matrix::permute_mode::rows);
+    // x is overwritten anyways if the inner operator does not use it
+    if (inner_operator_->apply_uses_initial_guess()) {
+        x->permute(permutation_, cache_.inner_x, matrix::permute_mode::rows);
+    }
+    inner_operator_->apply(cache_.inner_b, cache_.inner_x);
+    return cache_.inner_x.get();
+}
+
+
+template <typename ValueType, typename IndexType>
+void Reordered<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                 LinOp* x) const
+{
+    if (!permutation_) {
+        inner_operator_->apply(b, x);
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->apply_permuted(dense_b, dense_x)
+                ->permute(permutation_, dense_x,
+                          matrix::permute_mode::inverse_rows);
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void Reordered<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                 const LinOp* b,
+                                                 const LinOp* beta,
+                                                 LinOp* x) const
+{
+    if (!permutation_) {
+        inner_operator_->apply(alpha, b, beta, x);
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto inner_x = this->apply_permuted(dense_b, dense_x);
+            if (cache_.outer_x == nullptr ||
+                cache_.outer_x->get_size() != inner_x->get_size()) {
+                cache_.outer_x = matrix::Dense<ValueType>::create(
+                    this->get_executor(), inner_x->get_size());
+            }
+            inner_x->permute(permutation_, cache_.outer_x,
+                             matrix::permute_mode::inverse_rows);
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, cache_.outer_x);
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_REORDERED(ValueType, IndexType) \
+    class Reordered<ValueType, IndexType>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_REORDERED);
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
@@ -13,6 +13,9 @@
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
 #include <ginkgo/core/matrix/batch_identity.hpp>
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
 #include <ginkgo/core/preconditioner/batch_jacobi.hpp>
 #include <ginkgo/core/solver/batch_bicgstab.hpp>
 #include <ginkgo/core/stop/batch_stop_enum.hpp>
@@ -113,6 +116,8 @@ using DeviceValueType = ValueType;
 #include "reference/matrix/batch_struct.hpp"
 #include "reference/preconditioner/batch_block_jacobi.hpp"
 #include "reference/preconditioner/batch_identity.hpp"
+#include "reference/preconditioner/batch_ilu.hpp"
+#include "reference/preconditioner/batch_isai.hpp"
 #include "reference/preconditioner/batch_scalar_jacobi.hpp"
 #include "reference/stop/batch_criteria.hpp"
 
@@ -259,6 +264,35 @@ public:
                                            block_ptrs_arr, row_block_map_arr),
                     b_item, x_item);
             }
+        } else if (auto prec = dynamic_cast<
+                       const batch::preconditioner::Ilu<value_type>*>(
+                       precond_)) {
+#if defined GKO_COMPILING_CUDA || defined GKO_COMPILING_HIP || \
+    defined GKO_COMPILING_DPCPP
+            GKO_NOT_IMPLEMENTED;
+#else
+            dispatch_on_stop(
+                logger, mat_item,
+                device::batch_preconditioner::Ilu<device_value_type>(
+                    device::get_batch_struct(
+                        prec->get_const_factorized_matrix().get()),
+                    prec->get_const_diag_locations()),
+                b_item, x_item);
+#endif
+        } else if (auto prec = dynamic_cast<
+                       const batch::preconditioner::Isai<value_type>*>(
+                       precond_)) {
+#if defined GKO_COMPILING_CUDA || defined GKO_COMPILING_HIP || \
+    defined GKO_COMPILING_DPCPP
+            GKO_NOT_IMPLEMENTED;
+#else
+            dispatch_on_stop(
+                logger, mat_item,
+                device::batch_preconditioner::Isai<device_value_type>(
+                    device::get_batch_struct(
+                        prec->get_const_approximate_inverse().get())),
+                b_item, x_item);
+#endif
         } else {
             GKO_NOT_IMPLEMENTED;
         }
@@ -274,7 +308,8 @@ public:
         if (logger_type_ ==
             log::detail::log_type::simple_convergence_completion) {
             device::batch_log::SimpleFinalLogger<real_type> logger(
-                log_data.res_norms.get_data(), log_data.iter_counts.get_data());
+                log_data.res_norms.get_data(), log_data.iter_counts.get_data(),
+                b_item.num_rhs);
             dispatch_on_preconditioner(logger, amat, b_item, x_item);
         } else {
             GKO_NOT_IMPLEMENTED;
@@ -300,6 +335,16 @@ public:
                        const batch::matrix::Csr<ValueType, int32>*>(mat_)) {
             auto mat_item = device::get_batch_struct(batch_mat);
             dispatch_on_logger(mat_item, b_item, x_item, log_data);
+        } else if (auto batch_mat = dynamic_cast<
+                       const batch::matrix::VariableCsr<ValueType, int32>*>(
+                       mat_)) {
+#if defined GKO_COMPILING_CUDA || defined GKO_COMPILING_HIP || \
+    defined GKO_COMPILING_DPCPP
+            GKO_NOT_IMPLEMENTED;
+#else
+            auto mat_item = device::get_batch_struct(batch_mat);
+            dispatch_on_logger(mat_item, b_item, x_item, log_data);
+#endif
         } else {
             GKO_NOT_SUPPORTED(mat_);
         }
@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_CORE_SOLVER_BATCH_GMRES_KERNELS_HPP_
+#define GKO_CORE_SOLVER_BATCH_GMRES_KERNELS_HPP_
+
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/log/batch_logger.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/stop/batch_stop_enum.hpp>
+
+
+#include "core/base/kernel_declaration.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace batch_gmres {
+
+
+/**
+ * Options controlling the batch Gmres solver.
+ */
+template <typename RealType>
+struct settings {
+    static_assert(std::is_same<RealType, remove_complex<RealType>>::value,
+                  "Template parameter must be a real type");
+    int max_iterations;
+    RealType residual_tol;
+    ::gko::batch::stop::tolerance_type tol_type;
+    int restart_num;
+};
+
+
+/**
+ * Calculates the amount of in-solver storage needed by batch::Gmres.
+ *
+ * The calculation includes multivectors for
+ * - r
+ * - z
+ * - w
+ * - the restart + 1 Krylov basis vectors
+ * and small arrays for
+ * - the (restart + 1) x restart Hessenberg matrix
+ * - the Givens rotation sines and cosines
+ * - the restart + 1 entries of the least-squares right hand side
+ * - the restart entries of the least-squares solution
+ */
+template <typename ValueType>
+inline int local_memory_requirement(const int num_rows, const int num_rhs,
+                                    const int restart)
+{
+    return ((3 + restart + 1) * num_rows * num_rhs +
+            ((restart + 1) * restart + 2 * restart + restart + 1 + restart) *
+                num_rhs) *
+           sizeof(ValueType);
+}
+
+
+}  // namespace batch_gmres
+
+
+#define GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL(_type)                          \
+    void apply(                                                              \
+        std::shared_ptr<const DefaultExecutor> exec,                         \
+        const gko::kernels::batch_gmres::settings<remove_complex<_type>>&    \
+            options,                                                         \
+        const batch::BatchLinOp* a, const batch::BatchLinOp* preconditioner, \
+        const batch::MultiVector<_type>* b, batch::MultiVector<_type>* x,    \
+        gko::batch::log::detail::log_data<remove_complex<_type>>& logdata)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES \
+    template <typename ValueType>    \
+    GKO_DECLARE_BATCH_GMRES_APPLY_KERNEL(ValueType)
+
+
+GKO_DECLARE_FOR_ALL_EXECUTOR_NAMESPACES(batch_gmres,
+                                        GKO_DECLARE_ALL_AS_TEMPLATES);
+
+
+#undef GKO_DECLARE_ALL_AS_TEMPLATES
+
+
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_CORE_SOLVER_BATCH_GMRES_KERNELS_HPP_
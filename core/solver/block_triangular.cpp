@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/block_triangular.hpp>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/precision_dispatch.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+
+
+#include "core/matrix/fbcsr_kernels.hpp"
+
+
+namespace gko {
+namespace solver {
+namespace block_triangular {
+namespace {
+
+
+GKO_REGISTER_OPERATION(invert_diagonal_blocks, fbcsr::invert_diagonal_blocks);
+GKO_REGISTER_OPERATION(lower_trs, fbcsr::lower_trs);
+GKO_REGISTER_OPERATION(upper_trs, fbcsr::upper_trs);
+
+
+template <typename ValueType, typename IndexType>
+void invert_diagonal_blocks(const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                            bool unit_diagonal,
+                            array<ValueType>& inv_diag_blocks)
+{
+    if (!mtx || unit_diagonal) {
+        inv_diag_blocks.clear();
+        return;
+    }
+    const auto block_size = static_cast<size_type>(mtx->get_block_size());
+    inv_diag_blocks.resize_and_reset(mtx->get_num_block_rows() * block_size *
+                                     block_size);
+    mtx->get_executor()->run(
+        make_invert_diagonal_blocks(mtx, inv_diag_blocks.get_data()));
+}
+
+
+}  // anonymous namespace
+}  // namespace block_triangular
+
+
+template <typename ValueType, typename IndexType>
+BlockLowerTrs<ValueType, IndexType>::BlockLowerTrs(const BlockLowerTrs& other)
+    : EnableLinOp<BlockLowerTrs>(other.get_executor()),
+      inv_diag_blocks_{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockLowerTrs<ValueType, IndexType>::BlockLowerTrs(BlockLowerTrs&& other)
+    : EnableLinOp<BlockLowerTrs>(other.get_executor()),
+      inv_diag_blocks_{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockLowerTrs<ValueType, IndexType>&
+BlockLowerTrs<ValueType, IndexType>::operator=(const BlockLowerTrs& other)
+{
+    if (this != &other) {
+        EnableLinOp<BlockLowerTrs>::operator=(other);
+        EnableSolverBase<BlockLowerTrs, FbcsrMatrix>::operator=(other);
+        this->parameters_ = other.parameters_;
+        this->generate();
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockLowerTrs<ValueType, IndexType>&
+BlockLowerTrs<ValueType, IndexType>::operator=(BlockLowerTrs&& other)
+{
+    if (this != &other) {
+        EnableLinOp<BlockLowerTrs>::operator=(std::move(other));
+        EnableSolverBase<BlockLowerTrs, FbcsrMatrix>::operator=(
+            std::move(other));
+        this->parameters_ = std::exchange(other.parameters_, parameters_type{});
+        if (this->get_executor() == other.get_executor()) {
+            this->inv_diag_blocks_ = std::move(other.inv_diag_blocks_);
+        } else {
+            this->generate();
+        }
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> BlockLowerTrs<ValueType, IndexType>::transpose() const
+{
+    return transposed_type::build()
+        .with_unit_diagonal(this->parameters_.unit_diagonal)
+        .on(this->get_executor())
+        ->generate(share(this->get_system_matrix()->transpose()));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> BlockLowerTrs<ValueType, IndexType>::conj_transpose()
+    const
+{
+    return transposed_type::build()
+        .with_unit_diagonal(this->parameters_.unit_diagonal)
+        .on(this->get_executor())
+        ->generate(share(this->get_system_matrix()->conj_transpose()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockLowerTrs<ValueType, IndexType>::generate()
+{
+    block_triangular::invert_diagonal_blocks(this->get_system_matrix().get(),
+                                             parameters_.unit_diagonal,
+                                             inv_diag_blocks_);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockLowerTrs<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                     LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(block_triangular::make_lower_trs(
+                this->get_system_matrix().get(),
+                parameters_.unit_diagonal
+                    ? nullptr
+                    : inv_diag_blocks_.get_const_data(),
+                dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockLowerTrs<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                     const LinOp* b,
+                                                     const LinOp* beta,
+                                                     LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockUpperTrs<ValueType, IndexType>::BlockUpperTrs(const BlockUpperTrs& other)
+    : EnableLinOp<BlockUpperTrs>(other.get_executor()),
+      inv_diag_blocks_{other.get_executor()}
+{
+    *this = other;
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockUpperTrs<ValueType, IndexType>::BlockUpperTrs(BlockUpperTrs&& other)
+    : EnableLinOp<BlockUpperTrs>(other.get_executor()),
+      inv_diag_blocks_{other.get_executor()}
+{
+    *this = std::move(other);
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockUpperTrs<ValueType, IndexType>&
+BlockUpperTrs<ValueType, IndexType>::operator=(const BlockUpperTrs& other)
+{
+    if (this != &other) {
+        EnableLinOp<BlockUpperTrs>::operator=(other);
+        EnableSolverBase<BlockUpperTrs, FbcsrMatrix>::operator=(other);
+        this->parameters_ = other.parameters_;
+        this->generate();
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+BlockUpperTrs<ValueType, IndexType>&
+BlockUpperTrs<ValueType, IndexType>::operator=(BlockUpperTrs&& other)
+{
+    if (this != &other) {
+        EnableLinOp<BlockUpperTrs>::operator=(std::move(other));
+        EnableSolverBase<BlockUpperTrs, FbcsrMatrix>::operator=(
+            std::move(other));
+        this->parameters_ = std::exchange(other.parameters_, parameters_type{});
+        if (this->get_executor() == other.get_executor()) {
+            this->inv_diag_blocks_ = std::move(other.inv_diag_blocks_);
+        } else {
+            this->generate();
+        }
+    }
+    return *this;
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> BlockUpperTrs<ValueType, IndexType>::transpose() const
+{
+    return transposed_type::build()
+        .with_unit_diagonal(this->parameters_.unit_diagonal)
+        .on(this->get_executor())
+        ->generate(share(this->get_system_matrix()->transpose()));
+}
+
+
+template <typename ValueType, typename IndexType>
+std::unique_ptr<LinOp> BlockUpperTrs<ValueType, IndexType>::conj_transpose()
+    const
+{
+    return transposed_type::build()
+        .with_unit_diagonal(this->parameters_.unit_diagonal)
+        .on(this->get_executor())
+        ->generate(share(this->get_system_matrix()->conj_transpose()));
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockUpperTrs<ValueType, IndexType>::generate()
+{
+    block_triangular::invert_diagonal_blocks(this->get_system_matrix().get(),
+                                             parameters_.unit_diagonal,
+                                             inv_diag_blocks_);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockUpperTrs<ValueType, IndexType>::apply_impl(const LinOp* b,
+                                                     LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_b, auto dense_x) {
+            this->get_executor()->run(block_triangular::make_upper_trs(
+                this->get_system_matrix().get(),
+                parameters_.unit_diagonal
+                    ? nullptr
+                    : inv_diag_blocks_.get_const_data(),
+                dense_b, dense_x));
+        },
+        b, x);
+}
+
+
+template <typename ValueType, typename IndexType>
+void BlockUpperTrs<ValueType, IndexType>::apply_impl(const LinOp* alpha,
+                                                     const LinOp* b,
+                                                     const LinOp* beta,
+                                                     LinOp* x) const
+{
+    if (!this->get_system_matrix()) {
+        return;
+    }
+    precision_dispatch_real_complex<ValueType>(
+        [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
+            auto x_clone = dense_x->clone();
+            this->apply_impl(dense_b, x_clone.get());
+            dense_x->scale(dense_beta);
+            dense_x->add_scaled(dense_alpha, x_clone);
+        },
+        alpha, b, beta, x);
+}
+
+
+#define GKO_DECLARE_BLOCK_LOWER_TRS(_vtype, _itype) \
+    class BlockLowerTrs<_vtype, _itype>
+#define GKO_DECLARE_BLOCK_UPPER_TRS(_vtype, _itype) \
+    class BlockUpperTrs<_vtype, _itype>
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BLOCK_LOWER_TRS);
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_BLOCK_UPPER_TRS);
+
+
+}  // namespace solver
+}  // namespace gko
@@ -85,7 +85,7 @@ void Cg<ValueType>::apply_dense_impl(const VectorType* dense_b,
     constexpr uint8 RelativeStoppingId{1};
 
     auto exec = this->get_executor();
-    this->setup_workspace();
+    const auto workspace_scope = this->setup_workspace();
 
     GKO_SOLVER_VECTOR(r, dense_b);
     GKO_SOLVER_VECTOR(z, dense_b);
@@ -165,7 +165,7 @@ void Direct<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
         [this](auto dense_b, auto dense_x) {
             using Vector = matrix::Dense<ValueType>;
             using ws = gko::solver::workspace_traits<Direct>;
-            this->setup_workspace();
+            const auto workspace_scope = this->setup_workspace();
             auto intermediate = this->create_workspace_op_with_config_of(
                 ws::intermediate, dense_b);
             lower_solver_->apply(dense_b, intermediate);
@@ -188,7 +188,7 @@ void Direct<ValueType, IndexType>::apply_impl(const LinOp* alpha,
         [this](auto dense_alpha, auto dense_b, auto dense_beta, auto dense_x) {
             using Vector = matrix::Dense<ValueType>;
             using ws = gko::solver::workspace_traits<Direct>;
-            this->setup_workspace();
+            const auto workspace_scope = this->setup_workspace();
             auto intermediate = this->create_workspace_op_with_config_of(
                 ws::intermediate, dense_b);
             lower_solver_->apply(dense_b, intermediate);
@@ -91,7 +91,7 @@ void Gcr<ValueType>::apply_dense_impl(const VectorType* dense_b,
     constexpr uint8 RelativeStoppingId{1};
 
     auto exec = this->get_executor();
-    this->setup_workspace();
+    const auto workspace_scope = this->setup_workspace();
 
     const auto num_rows = this->get_size()[0];
     const auto num_rhs = dense_b->get_size()[1];
@@ -73,7 +73,7 @@ void Idr<ValueType>::iterate(const VectorType* dense_b,
     using ws = workspace_traits<Idr>;
 
     auto exec = this->get_executor();
-    this->setup_workspace();
+    const auto workspace_scope = this->setup_workspace();
 
     constexpr uint8 RelativeStoppingId{1};
 
@@ -5,9 +5,15 @@
 #include <ginkgo/core/solver/ir.hpp>
 
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+
 #include <ginkgo/core/base/precision_dispatch.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/solver/solver_base.hpp>
+#include <ginkgo/core/solver/workspace_pool.hpp>
 
 
 #include "core/distributed/helpers.hpp"
@@ -23,6 +29,7 @@ namespace {
 
 
 GKO_REGISTER_OPERATION(initialize, ir::initialize);
+GKO_REGISTER_OPERATION(add_correction, ir::add_correction);
 
 
 }  // anonymous namespace
@@ -44,6 +51,15 @@ void Ir<ValueType>::set_solver(std::shared_ptr<const LinOp> new_solver)
 }
 
 
+template <typename ValueType>
+void Ir<ValueType>::set_workspace_pool(
+    std::shared_ptr<WorkspacePool> pool) const
+{
+    detail::SolverBaseLinOp::set_workspace_pool(pool);
+    solver::set_workspace_pool(solver_.get(), std::move(pool));
+}
+
+
 template <typename ValueType>
 void Ir<ValueType>::set_relaxation_factor(
     std::shared_ptr<const matrix::Dense<ValueType>> new_factor)
@@ -66,6 +82,7 @@ Ir<ValueType>& Ir<ValueType>::operator=(const Ir& other)
         this->parameters_ = other.parameters_;
         this->set_solver(other.get_solver());
         this->set_relaxation_factor(other.relaxation_factor_);
+        promoted_solver_ = other.promoted_solver_;
         parameters_ = other.parameters_;
     }
     return *this;
@@ -82,6 +99,7 @@ Ir<ValueType>& Ir<ValueType>::operator=(Ir&& other)
         this->parameters_ = std::exchange(other.parameters_, parameters_type{});
         this->set_solver(other.get_solver());
         this->set_relaxation_factor(other.relaxation_factor_);
+        promoted_solver_ = std::exchange(other.promoted_solver_, nullptr);
         other.set_solver(nullptr);
         other.set_relaxation_factor(nullptr);
         parameters_ = other.parameters_;
@@ -107,28 +125,48 @@ Ir<ValueType>::Ir(Ir&& other) : Ir(other.get_executor())
 template <typename ValueType>
 std::unique_ptr<LinOp> Ir<ValueType>::transpose() const
 {
-    return build()
-        .with_generated_solver(
-            share(as<Transposable>(this->get_solver())->transpose()))
-        .with_criteria(this->get_stop_criterion_factory())
-        .with_relaxation_factor(parameters_.relaxation_factor)
-        .on(this->get_executor())
-        ->generate(
-            share(as<Transposable>(this->get_system_matrix())->transpose()));
+    auto transposed =
+        build()
+            .with_generated_solver(
+                share(as<Transposable>(this->get_solver())->transpose()))
+            .with_criteria(this->get_stop_criterion_factory())
+            .with_relaxation_factor(parameters_.relaxation_factor)
+            .with_mixed_precision(parameters_.mixed_precision)
+            .with_stagnation_factor(parameters_.stagnation_factor)
+            .with_stagnation_check_interval(
+                parameters_.stagnation_check_interval)
+            .on(this->get_executor())
+            ->generate(share(
+                as<Transposable>(this->get_system_matrix())->transpose()));
+    if (promoted_solver_) {
+        as<Ir>(transposed.get())->promoted_solver_ =
+            share(as<Transposable>(promoted_solver_)->transpose());
+    }
+    return transposed;
 }
 
 
 template <typename ValueType>
 std::unique_ptr<LinOp> Ir<ValueType>::conj_transpose() const
 {
-    return build()
-        .with_generated_solver(
-            share(as<Transposable>(this->get_solver())->conj_transpose()))
-        .with_criteria(this->get_stop_criterion_factory())
-        .with_relaxation_factor(conj(parameters_.relaxation_factor))
-        .on(this->get_executor())
-        ->generate(share(
-            as<Transposable>(this->get_system_matrix())->conj_transpose()));
+    auto transposed =
+        build()
+            .with_generated_solver(
+                share(as<Transposable>(this->get_solver())->conj_transpose()))
+            .with_criteria(this->get_stop_criterion_factory())
+            .with_relaxation_factor(conj(parameters_.relaxation_factor))
+            .with_mixed_precision(parameters_.mixed_precision)
+            .with_stagnation_factor(parameters_.stagnation_factor)
+            .with_stagnation_check_interval(
+                parameters_.stagnation_check_interval)
+            .on(this->get_executor())
+            ->generate(share(
+                as<Transposable>(this->get_system_matrix())->conj_transpose()));
+    if (promoted_solver_) {
+        as<Ir>(transposed.get())->promoted_solver_ =
+            share(as<Transposable>(promoted_solver_)->conj_transpose());
+    }
+    return transposed;
 }
 
 
@@ -156,6 +194,31 @@ void Ir<ValueType>::apply_with_initial_guess_impl(
 }
 
 
+template <typename ValueType>
+void Ir<ValueType>::apply_lower_precision_correction(
+    const matrix::Dense<ValueType>* residual,
+    matrix::Dense<ValueType>* x) const
+{
+    using LowerVector = matrix::Dense<lower_precision_type>;
+    using ws = workspace_traits<Ir>;
+
+    auto exec = this->get_executor();
+    auto lower_residual = this->template create_workspace_op<LowerVector>(
+        ws::lower_precision_residual, residual->get_size());
+    auto lower_solution = this->template create_workspace_op<LowerVector>(
+        ws::lower_precision_solution, residual->get_size());
+    residual->convert_to(lower_residual);
+    if (solver_->apply_uses_initial_guess()) {
+        lower_solution->copy_from(lower_residual);
+    }
+    // lower_solution = A \ round(residual)
+    solver_->apply(lower_residual, lower_solution);
+    // x = x + relaxation_factor * lower_solution
+    exec->run(ir::make_add_correction(relaxation_factor_.get(),
+                                      lower_solution, x));
+}
+
+
 template <typename ValueType>
 template <typename VectorType>
 void Ir<ValueType>::apply_dense_impl(const VectorType* dense_b,
@@ -164,10 +227,11 @@ void Ir<ValueType>::apply_dense_impl(const VectorType* dense_b,
 {
     using Vector = matrix::Dense<ValueType>;
     using ws = workspace_traits<Ir>;
+    using real_type = remove_complex<ValueType>;
     constexpr uint8 relative_stopping_id{1};
 
     auto exec = this->get_executor();
-    this->setup_workspace();
+    const auto workspace_scope = this->setup_workspace();
 
     GKO_SOLVER_VECTOR(residual, dense_b);
     GKO_SOLVER_VECTOR(inner_solution, dense_b);
@@ -191,6 +255,39 @@ void Ir<ValueType>::apply_dense_impl(const VectorType* dense_b,
         std::shared_ptr<const LinOp>(dense_b, [](const LinOp*) {}), dense_x,
         residual_ptr);
 
+    // In mixed precision mode with a promoted solver, we track the residual
+    // norms to detect when the lower precision correction stagnates.
+    // The norms are only checked every check_interval iterations, against the
+    // reduction expected over the whole interval.
+    bool monitor_stagnation = promoted_solver_ != nullptr;
+    bool promoted = false;
+    const auto check_interval =
+        std::max<size_type>(parameters_.stagnation_check_interval, 1);
+    const auto interval_factor = static_cast<real_type>(
+        std::pow(parameters_.stagnation_factor, check_interval));
+    std::vector<real_type> previous_norms;
+    auto check_stagnation = [&] {
+        auto residual_norm = this->template create_workspace_scalar<real_type>(
+            ws::residual_norm, dense_b->get_size()[1]);
+        residual_ptr->compute_norm2(residual_norm);
+        auto host_norm = make_temporary_clone(exec->get_master(),
+                                              residual_norm);
+        const array<stopping_status> host_stop{exec->get_master(),
+                                               stop_status};
+        bool stagnated = false;
+        for (size_type i = 0; i < previous_norms.size(); ++i) {
+            if (!host_stop.get_const_data()[i].has_stopped() &&
+                host_norm->at(0, i) >
+                    interval_factor * previous_norms[i]) {
+                stagnated = true;
+            }
+        }
+        previous_norms.assign(
+            host_norm->get_const_values(),
+            host_norm->get_const_values() + dense_b->get_size()[1]);
+        return stagnated;
+    };
+
     int iter = -1;
     while (true) {
         ++iter;
@@ -243,18 +340,30 @@ void Ir<ValueType>::apply_dense_impl(const VectorType* dense_b,
             }
         }
 
-        if (solver_->apply_uses_initial_guess()) {
+        if (monitor_stagnation && iter % check_interval == 0 &&
+            check_stagnation()) {
+            // the remaining corrections are computed in full precision
+            monitor_stagnation = false;
+            promoted = true;
+        }
+
+        if (parameters_.mixed_precision && !promoted) {
+            this->apply_lower_precision_correction(residual_ptr, dense_x);
+            continue;
+        }
+        const auto solver = promoted ? promoted_solver_ : solver_;
+        if (solver->apply_uses_initial_guess()) {
             // Use the inner solver to solve
             // A * inner_solution = residual
             // with residual as initial guess.
             inner_solution->copy_from(residual_ptr);
-            solver_->apply(residual_ptr, inner_solution);
+            solver->apply(residual_ptr, inner_solution);
 
             // x = x + relaxation_factor * inner_solution
             dense_x->add_scaled(relaxation_factor_, inner_solution);
         } else {
             // x = x + relaxation_factor * A \ residual
-            solver_->apply(relaxation_factor_, residual_ptr, one_op, dense_x);
+            solver->apply(relaxation_factor_, residual_ptr, one_op, dense_x);
         }
     }
 }
@@ -299,7 +408,7 @@ int workspace_traits<Ir<ValueType>>::num_arrays(const Solver&)
 template <typename ValueType>
 int workspace_traits<Ir<ValueType>>::num_vectors(const Solver&)
 {
-    return 4;
+    return 7;
 }
 
 
@@ -312,6 +421,9 @@ std::vector<std::string> workspace_traits<Ir<ValueType>>::op_names(
         "inner_solution",
         "one",
         "minus_one",
+        "lower_precision_residual",
+        "lower_precision_solution",
+        "residual_norm",
     };
 }
 
@@ -327,14 +439,15 @@ std::vector<std::string> workspace_traits<Ir<ValueType>>::array_names(
 template <typename ValueType>
 std::vector<int> workspace_traits<Ir<ValueType>>::scalars(const Solver&)
 {
-    return {};
+    return {residual_norm};
 }
 
 
 template <typename ValueType>
 std::vector<int> workspace_traits<Ir<ValueType>>::vectors(const Solver&)
 {
-    return {residual, inner_solution};
+    return {residual, inner_solution, lower_precision_residual,
+            lower_precision_solution};
 }
 
 
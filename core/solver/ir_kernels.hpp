@@ -12,6 +12,7 @@
 #include <ginkgo/core/base/array.hpp>
 #include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
 #include <ginkgo/core/stop/stopping_status.hpp>
 
 
@@ -28,7 +29,17 @@ namespace ir {
                     array<stopping_status>* stop_status)
 
 
-#define GKO_DECLARE_ALL_AS_TEMPLATES GKO_DECLARE_IR_INITIALIZE_KERNEL
+#define GKO_DECLARE_IR_ADD_CORRECTION_KERNEL(_ctype, _vtype)         \
+    void add_correction(std::shared_ptr<const DefaultExecutor> exec, \
+                        const matrix::Dense<_vtype>* alpha,          \
+                        const matrix::Dense<_ctype>* correction,     \
+                        matrix::Dense<_vtype>* x)
+
+
+#define GKO_DECLARE_ALL_AS_TEMPLATES                         \
+    GKO_DECLARE_IR_INITIALIZE_KERNEL;                      \
+    template <typename CorrectionType, typename ValueType> \
+    GKO_DECLARE_IR_ADD_CORRECTION_KERNEL(CorrectionType, ValueType)
 
 
 }  // namespace ir
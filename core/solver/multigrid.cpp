@@ -23,6 +23,7 @@
 #include <ginkgo/core/solver/direct.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
 #include <ginkgo/core/solver/ir.hpp>
+#include <ginkgo/core/solver/workspace_pool.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
 
@@ -569,6 +570,19 @@ void MultigridState::run_cycle(multigrid::cycle cycle, size_type level,
 }  // namespace multigrid
 
 
+void Multigrid::set_workspace_pool(std::shared_ptr<WorkspacePool> pool) const
+{
+    detail::SolverBaseLinOp::set_workspace_pool(pool);
+    for (const auto list :
+         {&pre_smoother_list_, &mid_smoother_list_, &post_smoother_list_}) {
+        for (const auto& smoother : *list) {
+            solver::set_workspace_pool(smoother.get(), pool);
+        }
+    }
+    solver::set_workspace_pool(coarsest_solver_.get(), std::move(pool));
+}
+
+
 void Multigrid::generate()
 {
     // generate coarse matrix until reaching max_level or min_coarse_rows
@@ -760,7 +774,7 @@ void Multigrid::apply_dense_impl(const VectorType* b, VectorType* x,
                                  initial_guess_mode guess) const
 {
     using ws = workspace_traits<Multigrid>;
-    this->setup_workspace();
+    const auto workspace_scope = this->setup_workspace();
     this->create_state();
     if (cache_.state->nrhs != b->get_size()[1]) {
         cache_.state->generate(this->get_system_matrix().get(), this,
@@ -132,7 +132,7 @@ void UpperTrs<ValueType, IndexType>::apply_impl(const LinOp* b, LinOp* x) const
             using Vector = matrix::Dense<ValueType>;
             using ws = workspace_traits<UpperTrs>;
             const auto exec = this->get_executor();
-            this->setup_workspace();
+            const auto workspace_scope = this->setup_workspace();
 
             // This kernel checks if a transpose is needed for the multiple rhs
             // case. Currently only the algorithm for HIP needs this
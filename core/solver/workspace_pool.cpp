@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/workspace_pool.hpp>
+
+
+#include <algorithm>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+WorkspacePool::WorkspacePool(std::shared_ptr<const Executor> exec)
+    : exec_{std::move(exec)},
+      num_buffers_{},
+      num_leased_{},
+      allocated_bytes_{}
+{}
+
+
+std::shared_ptr<WorkspacePool> WorkspacePool::create(
+    std::shared_ptr<const Executor> exec)
+{
+    return std::shared_ptr<WorkspacePool>{new WorkspacePool{std::move(exec)}};
+}
+
+
+array<char> WorkspacePool::lease(size_type num_bytes)
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    // best fit: the smallest available buffer that is large enough
+    auto best = available_.end();
+    for (auto it = available_.begin(); it != available_.end(); ++it) {
+        if (it->get_size() >= num_bytes &&
+            (best == available_.end() || it->get_size() < best->get_size())) {
+            best = it;
+        }
+    }
+    num_leased_++;
+    if (best != available_.end()) {
+        auto result = std::move(*best);
+        available_.erase(best);
+        return result;
+    }
+    num_buffers_++;
+    allocated_bytes_ += num_bytes;
+    return array<char>{exec_, num_bytes};
+}
+
+
+void WorkspacePool::release(array<char> buffer)
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    GKO_ASSERT(num_leased_ > 0);
+    num_leased_--;
+    available_.push_back(std::move(buffer));
+}
+
+
+void WorkspacePool::clear()
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    for (const auto& buffer : available_) {
+        allocated_bytes_ -= buffer.get_size();
+    }
+    num_buffers_ -= available_.size();
+    available_.clear();
+}
+
+
+size_type WorkspacePool::get_num_buffers() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_buffers_;
+}
+
+
+size_type WorkspacePool::get_num_leased_buffers() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return num_leased_;
+}
+
+
+size_type WorkspacePool::get_allocated_bytes() const
+{
+    std::lock_guard<std::mutex> guard{mutex_};
+    return allocated_bytes_;
+}
+
+
+void set_workspace_pool(const LinOp* op, std::shared_ptr<WorkspacePool> pool)
+{
+    if (auto solver = dynamic_cast<const detail::SolverBaseLinOp*>(op)) {
+        solver->set_workspace_pool(pool);
+    }
+    if (auto precond = dynamic_cast<const Preconditionable*>(op)) {
+        set_workspace_pool(precond->get_preconditioner().get(), pool);
+    }
+}
+
+
+}  // namespace solver
+}  // namespace gko
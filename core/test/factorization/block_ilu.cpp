@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/factorization/block_ilu.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BlockIlu : public ::testing::Test {
+public:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using ilu_factory_type =
+        gko::factorization::BlockIlu<value_type, index_type>;
+
+protected:
+    BlockIlu() : ref(gko::ReferenceExecutor::create()) {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+};
+
+TYPED_TEST_SUITE(BlockIlu, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BlockIlu, SetBlockSize)
+{
+    auto factory =
+        TestFixture::ilu_factory_type::build().with_block_size(3).on(this->ref);
+
+    ASSERT_EQ(factory->get_parameters().block_size, 3);
+}
+
+
+TYPED_TEST(BlockIlu, SetSkip)
+{
+    auto factory =
+        TestFixture::ilu_factory_type::build().with_skip_sorting(true).on(
+            this->ref);
+
+    ASSERT_EQ(factory->get_parameters().skip_sorting, true);
+}
+
+
+TYPED_TEST(BlockIlu, SetDefaults)
+{
+    auto factory = TestFixture::ilu_factory_type::build().on(this->ref);
+
+    ASSERT_EQ(factory->get_parameters().block_size, 1);
+    ASSERT_EQ(factory->get_parameters().skip_sorting, false);
+}
+
+
+TYPED_TEST(BlockIlu, ThrowsOnRectangularMatrix)
+{
+    using Dense = gko::matrix::Dense<typename TestFixture::value_type>;
+    auto factory = TestFixture::ilu_factory_type::build().on(this->ref);
+
+    ASSERT_THROW(factory->generate(Dense::create(this->ref, gko::dim<2>{2, 3})),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
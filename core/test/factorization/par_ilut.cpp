@@ -88,6 +88,28 @@ TYPED_TEST(ParIlut, SetFillIn)
 }
 
 
+TYPED_TEST(ParIlut, SetAlgorithm)
+{
+    auto factory =
+        TestFixture::ilut_factory_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .on(this->ref);
+
+    ASSERT_EQ(factory->get_parameters().algorithm,
+              gko::factorization::ilut_algorithm::row_wise);
+}
+
+
+TYPED_TEST(ParIlut, SetDropTolerance)
+{
+    auto factory =
+        TestFixture::ilut_factory_type::build().with_drop_tolerance(1e-3).on(
+            this->ref);
+
+    ASSERT_EQ(factory->get_parameters().drop_tolerance, 1e-3);
+}
+
+
 TYPED_TEST(ParIlut, SetLStrategy)
 {
     auto strategy = std::make_shared<typename TestFixture::strategy_type>();
@@ -121,6 +143,9 @@ TYPED_TEST(ParIlut, SetDefaults)
     ASSERT_EQ(factory->get_parameters().approximate_select, true);
     ASSERT_EQ(factory->get_parameters().deterministic_sample, false);
     ASSERT_EQ(factory->get_parameters().fill_in_limit, 2.0);
+    ASSERT_EQ(factory->get_parameters().algorithm,
+              gko::factorization::ilut_algorithm::fixed_point);
+    ASSERT_EQ(factory->get_parameters().drop_tolerance, 0.0);
     ASSERT_EQ(factory->get_parameters().l_strategy, nullptr);
     ASSERT_EQ(factory->get_parameters().u_strategy, nullptr);
 }
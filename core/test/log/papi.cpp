@@ -501,4 +501,48 @@ TYPED_TEST(Papi, CatchesIterationComplete)
 }
 
 
+
+TYPED_TEST(Papi, CatchesCommunicationStarted)
+{
+    auto str = this->init(gko::log::Logger::communication_started_mask,
+                          "communication_started_send", this->exec.get());
+    std::ostringstream os_out;
+    os_out << "sde:::" << this->logger->get_handle_name()
+           << "::communication_started_recv::"
+           << reinterpret_cast<gko::uintptr>(this->exec.get());
+    this->add_event(str);
+    this->add_event(os_out.str());
+
+    this->start();
+    this->logger->template on<gko::log::Logger::communication_started>(
+        this->exec.get(), "send_recv", 1, 42, 21);
+    long long int values[2];
+    this->stop(values);
+
+    ASSERT_EQ(values[0], 42);
+    ASSERT_EQ(values[1], 21);
+}
+
+
+TYPED_TEST(Papi, CatchesCommunicationCompleted)
+{
+    auto str = this->init(gko::log::Logger::communication_completed_mask,
+                          "communication_completed_send", this->exec.get());
+    std::ostringstream os_out;
+    os_out << "sde:::" << this->logger->get_handle_name()
+           << "::communication_completed_recv::"
+           << reinterpret_cast<gko::uintptr>(this->exec.get());
+    this->add_event(str);
+    this->add_event(os_out.str());
+
+    this->start();
+    this->logger->template on<gko::log::Logger::communication_completed>(
+        this->exec.get(), "send_recv", 1, 42, 21);
+    long long int values[2];
+    this->stop(values);
+
+    ASSERT_EQ(values[0], 42);
+    ASSERT_EQ(values[1], 21);
+}
+
 }  // namespace
@@ -6,6 +6,9 @@
 
 
 #include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
 #include <string>
 
 
@@ -13,6 +16,9 @@
 
 
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
 #include <ginkgo/core/solver/ir.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 
@@ -378,6 +384,219 @@ TEST(ProfilerHook, NestedSummaryWorks)
 }
 
 
+std::string read_trace(std::shared_ptr<gko::log::ProfilerHook> logger,
+                       const std::string& path)
+{
+    // the trace is written when the logger is destroyed
+    logger.reset();
+    std::ifstream stream{path};
+    std::stringstream ss;
+    ss << stream.rdbuf();
+    std::remove(path.c_str());
+    return ss.str();
+}
+
+
+int count_occurrences(const std::string& str, const std::string& pattern)
+{
+    int count{};
+    for (auto pos = str.find(pattern); pos != std::string::npos;
+         pos = str.find(pattern, pos + 1)) {
+        count++;
+    }
+    return count;
+}
+
+
+TEST(ProfilerHook, TraceFileWorks)
+{
+    const std::string path = "profiler_hook_trace.json";
+    auto logger = gko::log::ProfilerHook::create_trace_file(path);
+
+    call_ranges(logger);
+    {
+        auto range = logger->user_range("quote\"d");
+    }
+    auto trace = read_trace(std::move(logger), path);
+
+    ASSERT_EQ(trace.substr(0, 40),
+              "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    ASSERT_EQ(count_occurrences(trace, "\"ph\":\"X\""), 8);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"foo\""), 3);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"bar\""), 1);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"baz\""), 2);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"bazz\""), 1);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"quote\\\"d\""), 1);
+    ASSERT_EQ(count_occurrences(trace, "\"cat\":\"user\""), 8);
+    ASSERT_EQ(trace.substr(trace.size() - 4), "\n]}\n");
+}
+
+
+TEST(ProfilerHook, TraceFileSamplesOutermostRanges)
+{
+    const std::string path = "profiler_hook_trace_sampled.json";
+    auto logger = gko::log::ProfilerHook::create_trace_file(path, 3);
+
+    for (int i = 0; i < 7; i++) {
+        auto outer = logger->user_range(("outer" + std::to_string(i)).c_str());
+        auto inner = logger->user_range("inner");
+    }
+    auto trace = read_trace(std::move(logger), path);
+
+    ASSERT_EQ(count_occurrences(trace, "\"ph\":\"X\""), 6);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"inner\""), 3);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"outer0\""), 1);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"outer3\""), 1);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"outer6\""), 1);
+}
+
+
+TEST(ProfilerHook, TraceFileKeepsNewestRanges)
+{
+    const std::string path = "profiler_hook_trace_ring.json";
+    auto logger = gko::log::ProfilerHook::create_trace_file(path, 1, 2);
+
+    for (int i = 0; i < 5; i++) {
+        auto range = logger->user_range(("range" + std::to_string(i)).c_str());
+    }
+    auto trace = read_trace(std::move(logger), path);
+
+    ASSERT_EQ(count_occurrences(trace, "\"ph\":\"X\""), 2);
+    ASSERT_LT(trace.find("\"name\":\"range3\""),
+              trace.find("\"name\":\"range4\""));
+    ASSERT_EQ(trace.find("\"name\":\"range2\""), std::string::npos);
+}
+
+
+TEST(ProfilerHook, TraceFileDistinguishesNamesInReusedBuffer)
+{
+    const std::string path = "profiler_hook_trace_buffer.json";
+    auto logger = gko::log::ProfilerHook::create_trace_file(path);
+    char name[] = "name0";
+
+    for (int i = 0; i < 3; i++) {
+        name[4] = static_cast<char>('0' + i % 2);
+        auto range = logger->user_range(name);
+    }
+    auto trace = read_trace(std::move(logger), path);
+
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"name0\""), 2);
+    ASSERT_EQ(count_occurrences(trace, "\"name\":\"name1\""), 1);
+}
+
+
+TEST(ProfilerHook, TraceFileThrowsOnInvalidPath)
+{
+    ASSERT_THROW(gko::log::ProfilerHook::create_trace_file(
+                     "nonexistent_directory/trace.json"),
+                 gko::StreamError);
+}
+
+
+TEST(ProfilerHook, EstimatesApplyWork)
+{
+    using Mtx = gko::matrix::Csr<double, gko::int32>;
+    using Vec = gko::matrix::Dense<double>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Mtx>({{1.0, 2.0, 0.0}, {0.0, 3.0, 0.0}}, exec);
+    auto id = gko::matrix::Identity<double>::create(exec, 3);
+    auto b = gko::initialize<Vec>({{1.0, 2.0}, {3.0, 4.0}, {5.0, 6.0}}, exec);
+    auto x = Vec::create(exec, gko::dim<2>{2, 2});
+
+    auto work = gko::log::ProfilerHook::estimate_apply_work(
+        mtx.get(), b.get(), x.get(), false);
+    auto advanced_work = gko::log::ProfilerHook::estimate_apply_work(
+        mtx.get(), b.get(), x.get(), true);
+    auto unknown_work = gko::log::ProfilerHook::estimate_apply_work(
+        id.get(), b.get(), b.get(), false);
+
+    // 3 values, 3 column indices, 3 row pointers, 6 entries of b and 4 of x
+    ASSERT_EQ(work.bytes, 3 * 8 + 3 * 4 + 3 * 4 + 6 * 8 + 4 * 8);
+    ASSERT_EQ(work.flops, 2 * 3 * 2);
+    ASSERT_EQ(advanced_work.bytes, work.bytes + 4 * 8);
+    ASSERT_EQ(advanced_work.flops, work.flops + 3 * 4);
+    ASSERT_EQ(unknown_work.bytes, 0);
+    ASSERT_EQ(unknown_work.flops, 0);
+}
+
+
+struct TestWorkSummaryWriter : gko::log::ProfilerHook::SummaryWriter,
+                               gko::log::ProfilerHook::NestedSummaryWriter {
+    void write(const std::vector<gko::log::ProfilerHook::summary_entry>& e,
+               std::chrono::nanoseconds overhead) override
+    {
+        ASSERT_EQ(e.size(), 2);
+        ASSERT_EQ(e[0].name, "total");
+        ASSERT_EQ(e[0].flops, 0);
+        ASSERT_EQ(e[1].name, "apply(mtx)");
+        ASSERT_EQ(e[1].count, 2);
+        ASSERT_EQ(e[1].flops, 2 * expected.flops);
+        ASSERT_EQ(e[1].bytes, 2 * expected.bytes);
+    }
+
+    void write_nested(const gko::log::ProfilerHook::nested_summary_entry& e,
+                      std::chrono::nanoseconds overhead) override
+    {
+        ASSERT_EQ(e.name, "total");
+        ASSERT_EQ(e.flops, 0);
+        ASSERT_EQ(e.children.size(), 1);
+        ASSERT_EQ(e.children[0].name, "apply(mtx)");
+        ASSERT_EQ(e.children[0].count, 2);
+        ASSERT_EQ(e.children[0].flops, 2 * expected.flops);
+        ASSERT_EQ(e.children[0].bytes, 2 * expected.bytes);
+    }
+
+    gko::log::ProfilerHook::work_estimate expected;
+};
+
+
+void apply_twice(std::shared_ptr<gko::log::ProfilerHook> logger,
+                 TestWorkSummaryWriter* writer)
+{
+    using Mtx = gko::matrix::Csr<double, gko::int32>;
+    using Vec = gko::matrix::Dense<double>;
+    auto exec = gko::ReferenceExecutor::create();
+    auto mtx = gko::initialize<Mtx>({{1.0, 2.0}, {0.0, 3.0}}, exec);
+    auto b = gko::initialize<Vec>({1.0, 2.0}, exec);
+    auto x = Vec::create(exec, gko::dim<2>{2, 1});
+    writer->expected = gko::log::ProfilerHook::estimate_apply_work(
+        mtx.get(), b.get(), x.get(), false);
+    logger->set_object_name(mtx, "mtx");
+    mtx->add_logger(logger);
+
+    mtx->apply(b, x);
+    mtx->apply(b, x);
+
+    mtx->remove_logger(logger);
+}
+
+
+TEST(ProfilerHook, SummaryRecordsWork)
+{
+    auto writer = std::make_unique<TestWorkSummaryWriter>();
+    auto writer_ptr = writer.get();
+    auto logger = gko::log::ProfilerHook::create_summary(
+        std::make_unique<gko::CpuTimer>(), std::move(writer));
+
+    apply_twice(logger, writer_ptr);
+
+    // The assertions happen in the destructor of `logger`
+}
+
+
+TEST(ProfilerHook, NestedSummaryRecordsWork)
+{
+    auto writer = std::make_unique<TestWorkSummaryWriter>();
+    auto writer_ptr = writer.get();
+    auto logger = gko::log::ProfilerHook::create_nested_summary(
+        std::make_unique<gko::CpuTimer>(), std::move(writer));
+
+    apply_twice(logger, writer_ptr);
+
+    // The assertions happen in the destructor of `logger`
+}
+
+
 TEST(ProfilerHookTableSummaryWriter, SummaryWorks)
 {
     using gko::log::ProfilerHook;
@@ -443,3 +662,55 @@ Overhead estimate 1.0 ns
 
     ASSERT_EQ(ss.str(), expected);
 }
+
+
+TEST(ProfilerHookThroughputSummaryWriter, SummaryWorks)
+{
+    using gko::log::ProfilerHook;
+    using namespace std::chrono_literals;
+    std::stringstream ss;
+    ProfilerHook::ThroughputSummaryWriter writer(ss, "Test header");
+    std::vector<ProfilerHook::summary_entry> entries;
+    entries.push_back({"empty", 0ns, 0ns, 0});  // division by zero
+    entries.push_back({"total", 2ms, 1ms, 1});  // no work estimate
+    entries.push_back({"spmv", 1ms, 1ms, 4, 2'000'000, 12'500'000});
+    const auto expected = R"(Test header
+Overhead estimate 1.0 s 
+| name  | total  | count |   avg    | GFLOP/s | GB/s  |
+|-------|-------:|------:|---------:|--------:|------:|
+| total | 2.0 ms |     1 |   2.0 ms |       - |     - |
+| spmv  | 1.0 ms |     4 | 250.0 us |    2.00 | 12.50 |
+| empty | 0.0 ns |     0 |   0.0 ns |       - |     - |
+)";
+
+    writer.write(entries, 1s);
+
+    ASSERT_EQ(ss.str(), expected);
+}
+
+
+TEST(ProfilerHookThroughputSummaryWriter, NestedSummaryWorks)
+{
+    using gko::log::ProfilerHook;
+    using namespace std::chrono_literals;
+    std::stringstream ss;
+    ProfilerHook::ThroughputSummaryWriter writer(ss, "Test header");
+    ProfilerHook::nested_summary_entry entry{
+        "root",
+        2us,
+        1,
+        {ProfilerHook::nested_summary_entry{"foo", 100ns, 5, {}, 50, 400},
+         ProfilerHook::nested_summary_entry{"bar", 1000ns, 2, {}}}};
+    const auto expected = R"(Test header
+Overhead estimate 1.0 ns
+| name  |  total   | fraction | count | GFLOP/s | GB/s |
+|-------|---------:|---------:|------:|--------:|-----:|
+| root  |   2.0 us |  100.0 % |     1 |       - |    - |
+|   bar |   1.0 us |   50.0 % |     2 |       - |    - |
+|   foo | 100.0 ns |    5.0 % |     5 |    0.50 | 4.00 |
+)";
+
+    writer.write_nested(entry, 1ns);
+
+    ASSERT_EQ(ss.str(), expected);
+}
@@ -578,4 +578,40 @@ TEST(Record, CatchesIterations)
 }
 
 
+
+TEST(Record, CatchesCommunicationStarted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        gko::log::Logger::communication_started_mask);
+
+    logger->on<gko::log::Logger::communication_started>(exec.get(), "send", 3,
+                                                        42, 0);
+
+    auto& data = logger->get().communication_started.back();
+    ASSERT_EQ(data->exec, exec.get());
+    ASSERT_EQ(data->name, "send");
+    ASSERT_EQ(data->peer, 3);
+    ASSERT_EQ(data->send_bytes, 42);
+    ASSERT_EQ(data->recv_bytes, 0);
+}
+
+
+TEST(Record, CatchesCommunicationCompleted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = gko::log::Record::create(
+        gko::log::Logger::communication_completed_mask);
+
+    logger->on<gko::log::Logger::communication_completed>(
+        exec.get(), "i_recv_wait", 2, 0, 42);
+
+    auto& data = logger->get().communication_completed.back();
+    ASSERT_EQ(data->exec, exec.get());
+    ASSERT_EQ(data->name, "i_recv_wait");
+    ASSERT_EQ(data->peer, 2);
+    ASSERT_EQ(data->send_bytes, 0);
+    ASSERT_EQ(data->recv_bytes, 42);
+}
+
 }  // namespace
@@ -807,4 +807,40 @@ TYPED_TEST(Stream, CatchesIterationsWithVerbose)
 }
 
 
+
+TYPED_TEST(Stream, CatchesCommunicationStarted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::stringstream out;
+    auto logger = gko::log::Stream<TypeParam>::create(
+        gko::log::Logger::communication_started_mask, out);
+
+    logger->template on<gko::log::Logger::communication_started>(
+        exec.get(), "send", 3, 42, 0);
+
+    auto os = out.str();
+    GKO_ASSERT_STR_CONTAINS(os, "communication send started");
+    GKO_ASSERT_STR_CONTAINS(os, "with peer 3");
+    GKO_ASSERT_STR_CONTAINS(os, "sending Bytes[42]");
+    GKO_ASSERT_STR_CONTAINS(os, "receiving Bytes[0]");
+}
+
+
+TYPED_TEST(Stream, CatchesCommunicationCompleted)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    std::stringstream out;
+    auto logger = gko::log::Stream<TypeParam>::create(
+        gko::log::Logger::communication_completed_mask, out);
+
+    logger->template on<gko::log::Logger::communication_completed>(
+        exec.get(), "i_recv_wait", 2, 0, 42);
+
+    auto os = out.str();
+    GKO_ASSERT_STR_CONTAINS(os, "communication i_recv_wait completed");
+    GKO_ASSERT_STR_CONTAINS(os, "with peer 2");
+    GKO_ASSERT_STR_CONTAINS(os, "sending Bytes[0]");
+    GKO_ASSERT_STR_CONTAINS(os, "receiving Bytes[42]");
+}
+
 }  // namespace
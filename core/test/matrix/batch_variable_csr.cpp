@@ -0,0 +1,223 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+template <typename T>
+class VariableCsr : public ::testing::Test {
+protected:
+    using value_type = T;
+    using index_type = gko::int32;
+    using BatchCsrMtx = gko::batch::matrix::VariableCsr<value_type, index_type>;
+    using CsrMtx = gko::matrix::Csr<value_type, index_type>;
+    using size_type = gko::size_type;
+    VariableCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          small_mtx(gko::initialize<CsrMtx>(
+              {I<T>({2.0, -1.0}), I<T>({-1.0, 2.0})}, exec)),
+          large_mtx(gko::initialize<CsrMtx>(
+              {I<T>({4.0, 0.0, 1.0}), I<T>({0.0, 3.0, 0.0}),
+               I<T>({1.0, 0.0, 5.0})},
+              exec)),
+          mtx(BatchCsrMtx::create_from_items(
+              exec, {small_mtx.get(), large_mtx.get()}))
+    {}
+
+    static void assert_equal_to_original_mtx(const BatchCsrMtx* m)
+    {
+        ASSERT_EQ(m->get_num_batch_items(), 2);
+        ASSERT_EQ(m->get_common_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(m->get_num_stored_elements(), 9);
+        ASSERT_EQ(m->get_max_num_elements_per_item(), 5);
+        EXPECT_EQ(m->get_const_item_row_offsets()[0], index_type{0});
+        EXPECT_EQ(m->get_const_item_row_offsets()[1], index_type{2});
+        EXPECT_EQ(m->get_const_item_row_offsets()[2], index_type{5});
+        EXPECT_EQ(m->get_const_item_nnz_offsets()[0], index_type{0});
+        EXPECT_EQ(m->get_const_item_nnz_offsets()[1], index_type{4});
+        EXPECT_EQ(m->get_const_item_nnz_offsets()[2], index_type{9});
+        EXPECT_EQ(m->get_const_row_ptrs()[0], index_type{0});
+        EXPECT_EQ(m->get_const_row_ptrs()[1], index_type{2});
+        EXPECT_EQ(m->get_const_row_ptrs()[2], index_type{4});
+        EXPECT_EQ(m->get_const_row_ptrs()[3], index_type{0});
+        EXPECT_EQ(m->get_const_row_ptrs()[4], index_type{2});
+        EXPECT_EQ(m->get_const_row_ptrs()[5], index_type{3});
+        EXPECT_EQ(m->get_const_row_ptrs()[6], index_type{5});
+        EXPECT_EQ(m->get_const_col_idxs()[4], index_type{0});
+        EXPECT_EQ(m->get_const_col_idxs()[5], index_type{2});
+        EXPECT_EQ(m->get_const_col_idxs()[6], index_type{1});
+        EXPECT_EQ(m->get_const_values()[0], value_type{2.0});
+        EXPECT_EQ(m->get_const_values()[4], value_type{4.0});
+        EXPECT_EQ(m->get_const_values()[8], value_type{5.0});
+    }
+
+    static void assert_empty(BatchCsrMtx* m)
+    {
+        ASSERT_EQ(m->get_num_batch_items(), 0);
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<CsrMtx> small_mtx;
+    std::unique_ptr<CsrMtx> large_mtx;
+    std::unique_ptr<BatchCsrMtx> mtx;
+};
+
+TYPED_TEST_SUITE(VariableCsr, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(VariableCsr, KnowsItsSizeAndValues)
+{
+    this->assert_equal_to_original_mtx(this->mtx.get());
+}
+
+
+TYPED_TEST(VariableCsr, KnowsItsItemSizes)
+{
+    ASSERT_EQ(this->mtx->get_item_size(0), gko::dim<2>(2, 2));
+    ASSERT_EQ(this->mtx->get_item_size(1), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_elements_for_item(0), 4);
+    ASSERT_EQ(this->mtx->get_num_elements_for_item(1), 5);
+}
+
+
+TYPED_TEST(VariableCsr, CanBeEmpty)
+{
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+
+    auto empty = BatchCsrMtx::create(this->exec);
+
+    this->assert_empty(empty.get());
+    ASSERT_EQ(empty->get_const_values(), nullptr);
+}
+
+
+TYPED_TEST(VariableCsr, CanCreateItemViews)
+{
+    GKO_ASSERT_MTX_NEAR(this->mtx->create_view_for_item(0), this->small_mtx,
+                        0.0);
+    GKO_ASSERT_MTX_NEAR(this->mtx->create_const_view_for_item(1),
+                        this->large_mtx, 0.0);
+}
+
+
+TYPED_TEST(VariableCsr, CanBeCopied)
+{
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+
+    auto mtx_copy = BatchCsrMtx::create(this->exec);
+
+    mtx_copy->copy_from(this->mtx.get());
+
+    this->assert_equal_to_original_mtx(this->mtx.get());
+    this->mtx->get_values()[0] = 7;
+    this->assert_equal_to_original_mtx(mtx_copy.get());
+}
+
+
+TYPED_TEST(VariableCsr, CanBeMoved)
+{
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+
+    auto mtx_copy = BatchCsrMtx::create(this->exec);
+
+    this->mtx->move_to(mtx_copy);
+
+    this->assert_equal_to_original_mtx(mtx_copy.get());
+}
+
+
+TYPED_TEST(VariableCsr, CanBeCloned)
+{
+    auto mtx_clone = this->mtx->clone();
+
+    this->assert_equal_to_original_mtx(
+        dynamic_cast<decltype(this->mtx.get())>(mtx_clone.get()));
+}
+
+
+TYPED_TEST(VariableCsr, CanBeCleared)
+{
+    this->mtx->clear();
+
+    this->assert_empty(this->mtx.get());
+}
+
+
+TYPED_TEST(VariableCsr, CanBeConstructedFromExistingData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+    value_type values[] = {2.0, -1.0, -1.0, 2.0, 4.0, 1.0, 3.0, 1.0, 5.0};
+    index_type col_idxs[] = {0, 1, 0, 1, 0, 2, 1, 0, 2};
+    index_type row_ptrs[] = {0, 2, 4, 0, 2, 3, 5};
+    index_type row_offsets[] = {0, 2, 5};
+    index_type nnz_offsets[] = {0, 4, 9};
+
+    auto m = BatchCsrMtx::create(
+        this->exec, 2, gko::array<value_type>::view(this->exec, 9, values),
+        gko::array<index_type>::view(this->exec, 9, col_idxs),
+        gko::array<index_type>::view(this->exec, 7, row_ptrs),
+        gko::array<index_type>::view(this->exec, 3, row_offsets),
+        gko::array<index_type>::view(this->exec, 3, nnz_offsets));
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(VariableCsr, CanBeConstructedFromExistingConstData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+    const value_type values[] = {2.0, -1.0, -1.0, 2.0, 4.0,
+                                 1.0, 3.0,  1.0,  5.0};
+    const index_type col_idxs[] = {0, 1, 0, 1, 0, 2, 1, 0, 2};
+    const index_type row_ptrs[] = {0, 2, 4, 0, 2, 3, 5};
+    const index_type row_offsets[] = {0, 2, 5};
+    const index_type nnz_offsets[] = {0, 4, 9};
+
+    auto m = BatchCsrMtx::create_const(
+        this->exec, 2,
+        gko::array<value_type>::const_view(this->exec, 9, values),
+        gko::array<index_type>::const_view(this->exec, 9, col_idxs),
+        gko::array<index_type>::const_view(this->exec, 7, row_ptrs),
+        gko::array<index_type>::const_view(this->exec, 3, row_offsets),
+        gko::array<index_type>::const_view(this->exec, 3, nnz_offsets));
+
+    this->assert_equal_to_original_mtx(m.get());
+}
+
+
+TYPED_TEST(VariableCsr, ThrowsOnInconsistentOffsets)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using BatchCsrMtx = typename TestFixture::BatchCsrMtx;
+    value_type values[] = {2.0, -1.0, -1.0, 2.0};
+    index_type col_idxs[] = {0, 1, 0, 1};
+    index_type row_ptrs[] = {0, 2, 4};
+    index_type row_offsets[] = {0, 2};
+    index_type nnz_offsets[] = {0, 5};
+
+    EXPECT_THROW(BatchCsrMtx::create(
+                     this->exec, 1,
+                     gko::array<value_type>::view(this->exec, 4, values),
+                     gko::array<index_type>::view(this->exec, 4, col_idxs),
+                     gko::array<index_type>::view(this->exec, 3, row_ptrs),
+                     gko::array<index_type>::view(this->exec, 2, row_offsets),
+                     gko::array<index_type>::view(this->exec, 2, nnz_offsets)),
+                 gko::ValueMismatch);
+}
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class ReducedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::ReducedCsr<value_type, index_type>;
+
+    ReducedCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(
+              exec,
+              gko::initialize<Csr>({{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}}, exec)
+                  .get(),
+              gko::matrix::reduced_storage::bfloat16))
+    {}
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_packed_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(ReducedCsr, gko::test::RealValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ReducedCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+    ASSERT_EQ(mtx->get_storage(), gko::matrix::reduced_storage::float16);
+}
+
+
+TYPED_TEST(ReducedCsr, KnowsItsSizeAndStorage)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 4);
+    ASSERT_EQ(this->mtx->get_storage(), gko::matrix::reduced_storage::bfloat16);
+}
+
+
+TYPED_TEST(ReducedCsr, StoresPattern)
+{
+    auto r = this->mtx->get_const_row_ptrs();
+    auto c = this->mtx->get_const_col_idxs();
+
+    EXPECT_EQ(r[0], 0);
+    EXPECT_EQ(r[1], 3);
+    EXPECT_EQ(r[2], 4);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 1);
+    EXPECT_EQ(c[2], 2);
+    EXPECT_EQ(c[3], 1);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto moved = Mtx::create(this->exec);
+
+    *moved = std::move(*this->mtx);
+
+    ASSERT_EQ(moved->get_size(), gko::dim<2>(2, 3));
+    ASSERT_EQ(moved->get_storage(), gko::matrix::reduced_storage::bfloat16);
+    this->assert_empty(this->mtx.get());
+}
+
+
+}  // namespace
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/exception.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::dim<3>{3, 4, 1},
+                          gko::matrix::stencil_type::five_point,
+                          gko::array<value_type>{
+                              exec, {1.0, 2.0, 3.0, 4.0, 5.0}}))
+    {}
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_grid_size(), gko::dim<3>(0, 0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_coefficients(), nullptr);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(Stencil, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Stencil, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(Stencil, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(12, 12));
+    ASSERT_EQ(this->mtx->get_grid_size(), gko::dim<3>(3, 4, 1));
+    ASSERT_EQ(this->mtx->get_stencil_type(),
+              gko::matrix::stencil_type::five_point);
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+    ASSERT_FALSE(this->mtx->has_variable_coefficients());
+}
+
+
+TYPED_TEST(Stencil, KnowsItsNumberOfPoints)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using stencil_type = gko::matrix::stencil_type;
+    const gko::dim<3> grid{2, 2, 2};
+
+    ASSERT_EQ(Mtx::create_laplacian(this->exec, {2, 2, 1},
+                                    stencil_type::five_point)
+                  ->get_num_points(),
+              5);
+    ASSERT_EQ(Mtx::create_laplacian(this->exec, {2, 2, 1},
+                                    stencil_type::nine_point)
+                  ->get_num_points(),
+              9);
+    ASSERT_EQ(Mtx::create_laplacian(this->exec, grid,
+                                    stencil_type::seven_point)
+                  ->get_num_points(),
+              7);
+    ASSERT_EQ(Mtx::create_laplacian(this->exec, grid,
+                                    stencil_type::twenty_seven_point)
+                  ->get_num_points(),
+              27);
+}
+
+
+TYPED_TEST(Stencil, CanHaveVariableCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec, gko::dim<3>{3, 4, 5},
+                           gko::matrix::stencil_type::seven_point,
+                           gko::array<value_type>{this->exec, 7 * 60});
+
+    ASSERT_EQ(mtx->get_size(), gko::dim<2>(60, 60));
+    ASSERT_EQ(mtx->get_num_stored_elements(), 7 * 60);
+    ASSERT_TRUE(mtx->has_variable_coefficients());
+}
+
+
+TYPED_TEST(Stencil, CreatesLaplacian)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    auto mtx = Mtx::create_laplacian(this->exec, {3, 4, 1},
+                                     gko::matrix::stencil_type::nine_point);
+
+    ASSERT_EQ(mtx->get_num_stored_elements(), 9);
+    for (int p = 0; p < 9; ++p) {
+        EXPECT_EQ(mtx->get_const_coefficients()[p],
+                  p == 4 ? value_type{8.0} : value_type{-1.0});
+    }
+}
+
+
+TYPED_TEST(Stencil, ThrowsOnWrongNumberOfCoefficients)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+
+    ASSERT_THROW(Mtx::create(this->exec, gko::dim<3>{3, 4, 1},
+                             gko::matrix::stencil_type::five_point,
+                             gko::array<value_type>{this->exec, 9}),
+                 gko::ValueMismatch);
+}
+
+
+TYPED_TEST(Stencil, Throws2DStencilOn3DGrid)
+{
+    using Mtx = typename TestFixture::Mtx;
+
+    ASSERT_THROW(Mtx::create_laplacian(this->exec, {3, 4, 2},
+                                       gko::matrix::stencil_type::nine_point),
+                 gko::InvalidStateError);
+}
+
+
+TYPED_TEST(Stencil, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(12, 12));
+    ASSERT_EQ(copy->get_grid_size(), gko::dim<3>(3, 4, 1));
+    ASSERT_EQ(copy->get_num_stored_elements(), 5);
+    ASSERT_NE(copy->get_const_coefficients(),
+              this->mtx->get_const_coefficients());
+}
+
+
+TYPED_TEST(Stencil, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto moved = Mtx::create(this->exec);
+
+    *moved = std::move(*this->mtx);
+
+    ASSERT_EQ(moved->get_size(), gko::dim<2>(12, 12));
+    ASSERT_EQ(moved->get_grid_size(), gko::dim<3>(3, 4, 1));
+    ASSERT_EQ(moved->get_num_stored_elements(), 5);
+    this->assert_empty(this->mtx.get());
+}
+
+
+}  // namespace
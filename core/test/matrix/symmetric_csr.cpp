@@ -0,0 +1,137 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create(exec, gko::initialize<Csr>({{4.0, 1.0, 2.0},
+                                                      {1.0, 5.0, 0.0},
+                                                      {2.0, 0.0, 6.0}},
+                                                     exec)
+                                    .get()))
+    {}
+
+    void assert_empty(const Mtx* m)
+    {
+        ASSERT_EQ(m->get_size(), gko::dim<2>(0, 0));
+        ASSERT_EQ(m->get_num_stored_elements(), 0);
+        ASSERT_EQ(m->get_const_values(), nullptr);
+        ASSERT_EQ(m->get_const_col_idxs(), nullptr);
+        ASSERT_NE(m->get_const_row_ptrs(), nullptr);
+        ASSERT_EQ(m->get_const_row_ptrs()[0], 0);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<Mtx> mtx;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, CanBeEmpty)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec);
+
+    this->assert_empty(mtx.get());
+}
+
+
+TYPED_TEST(SymmetricCsr, KnowsItsSize)
+{
+    ASSERT_EQ(this->mtx->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(this->mtx->get_num_stored_elements(), 5);
+}
+
+
+TYPED_TEST(SymmetricCsr, StoresUpperTriangle)
+{
+    using value_type = typename TestFixture::value_type;
+    auto r = this->mtx->get_const_row_ptrs();
+    auto c = this->mtx->get_const_col_idxs();
+    auto v = this->mtx->get_const_values();
+
+    EXPECT_EQ(r[0], 0);
+    EXPECT_EQ(r[1], 3);
+    EXPECT_EQ(r[2], 4);
+    EXPECT_EQ(r[3], 5);
+    EXPECT_EQ(c[0], 0);
+    EXPECT_EQ(c[1], 1);
+    EXPECT_EQ(c[2], 2);
+    EXPECT_EQ(c[3], 1);
+    EXPECT_EQ(c[4], 2);
+    EXPECT_EQ(v[0], value_type{4.0});
+    EXPECT_EQ(v[1], value_type{1.0});
+    EXPECT_EQ(v[2], value_type{2.0});
+    EXPECT_EQ(v[3], value_type{5.0});
+    EXPECT_EQ(v[4], value_type{6.0});
+}
+
+
+TYPED_TEST(SymmetricCsr, ThrowsOnRectangularMatrix)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto csr = Csr::create(this->exec, gko::dim<2>{2, 3});
+
+    ASSERT_THROW(Mtx::create(this->exec, csr.get()), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto copy = Mtx::create(this->exec);
+
+    copy->copy_from(this->mtx);
+
+    ASSERT_EQ(copy->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(copy->get_num_stored_elements(), 5);
+    ASSERT_NE(copy->get_const_values(), this->mtx->get_const_values());
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto moved = Mtx::create(this->exec);
+
+    *moved = std::move(*this->mtx);
+
+    ASSERT_EQ(moved->get_size(), gko::dim<2>(3, 3));
+    ASSERT_EQ(moved->get_num_stored_elements(), 5);
+    this->assert_empty(this->mtx.get());
+}
+
+
+}  // namespace
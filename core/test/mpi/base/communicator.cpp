@@ -9,7 +9,9 @@
 
 
 #include <ginkgo/config.hpp>
+#include <ginkgo/core/base/executor.hpp>
 #include <ginkgo/core/base/mpi.hpp>
+#include <ginkgo/core/log/logger.hpp>
 
 
 namespace {
@@ -30,6 +32,48 @@ protected:
 };
 
 
+struct CommunicationLogger : gko::log::Logger {
+    struct event {
+        bool started;
+        std::string name;
+        int peer;
+        gko::size_type send_bytes;
+        gko::size_type recv_bytes;
+    };
+
+    void on_communication_started(const gko::Executor*, const char* name,
+                                  int peer, gko::size_type send_bytes,
+                                  gko::size_type recv_bytes) const override
+    {
+        events.push_back({true, name, peer, send_bytes, recv_bytes});
+    }
+
+    void on_communication_completed(const gko::Executor*, const char* name,
+                                    int peer, gko::size_type send_bytes,
+                                    gko::size_type recv_bytes) const override
+    {
+        events.push_back({false, name, peer, send_bytes, recv_bytes});
+    }
+
+    mutable std::vector<event> events;
+};
+
+
+void assert_event_pair(const std::vector<CommunicationLogger::event>& events,
+                       std::string name, int peer, gko::size_type send_bytes,
+                       gko::size_type recv_bytes)
+{
+    ASSERT_EQ(events.size(), 2);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_EQ(events[i].started, i == 0);
+        ASSERT_EQ(events[i].name, name);
+        ASSERT_EQ(events[i].peer, peer);
+        ASSERT_EQ(events[i].send_bytes, send_bytes);
+        ASSERT_EQ(events[i].recv_bytes, recv_bytes);
+    }
+}
+
+
 TEST_F(Communicator, CommKnowsItsSize)
 {
     int size;
@@ -99,6 +143,88 @@ TEST_F(Communicator, CommunicatorCanBeSynchronized)
 }
 
 
+TEST_F(Communicator, LogsAllReduce)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = std::make_shared<CommunicationLogger>();
+    exec->add_logger(logger);
+    int values[2] = {rank, 1};
+
+    comm.all_reduce(exec, values, 2, MPI_SUM);
+
+    ASSERT_EQ(values[0], 28);
+    ASSERT_EQ(values[1], 8);
+    assert_event_pair(logger->events, "all_reduce", -1, 2 * sizeof(int),
+                      2 * sizeof(int));
+}
+
+
+TEST_F(Communicator, LogsBroadcast)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = std::make_shared<CommunicationLogger>();
+    exec->add_logger(logger);
+    double values[3] = {1.0, 2.0, 3.0};
+
+    comm.broadcast(exec, values, 3, 2);
+
+    const auto bytes = 3 * sizeof(double);
+    assert_event_pair(logger->events, "broadcast", 2, rank == 2 ? bytes : 0,
+                      rank == 2 ? 0 : bytes);
+}
+
+
+TEST_F(Communicator, LogsAllToAllV)
+{
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = std::make_shared<CommunicationLogger>();
+    exec->add_logger(logger);
+    // every rank sends rank + 1 values to every other rank
+    std::vector<int> send_counts(8, rank + 1);
+    std::vector<int> send_offsets(8);
+    std::vector<int> recv_counts(8);
+    std::vector<int> recv_offsets(8);
+    for (int i = 0; i < 8; i++) {
+        send_offsets[i] = i * (rank + 1);
+        recv_counts[i] = i + 1;
+        recv_offsets[i] = i * (i + 1) / 2;
+    }
+    std::vector<float> send_buffer(8 * (rank + 1), rank);
+    std::vector<float> recv_buffer(36);
+
+    comm.all_to_all_v(exec, send_buffer.data(), send_counts.data(),
+                      send_offsets.data(), recv_buffer.data(),
+                      recv_counts.data(), recv_offsets.data());
+
+    assert_event_pair(logger->events, "all_to_all_v", -1,
+                      8 * (rank + 1) * sizeof(float), 36 * sizeof(float));
+}
+
+
+TEST_F(Communicator, LogsWaitOfNonBlockingAllReduce)
+{
+    using event = CommunicationLogger::event;
+    auto exec = gko::ReferenceExecutor::create();
+    auto logger = std::make_shared<CommunicationLogger>();
+    exec->add_logger(logger);
+    int values[2] = {rank, 1};
+
+    auto req = comm.i_all_reduce(exec, values, 2, MPI_SUM);
+    req.wait();
+
+    ASSERT_EQ(values[0], 28);
+    ASSERT_EQ(values[1], 8);
+    ASSERT_EQ(logger->events.size(), 4);
+    assert_event_pair(std::vector<event>(logger->events.begin(),
+                                         logger->events.begin() + 2),
+                      "i_all_reduce", -1, 0, 0);
+    assert_event_pair(std::vector<event>(logger->events.begin() + 2,
+                                         logger->events.end()),
+                      "i_all_reduce_wait", -1, 2 * sizeof(int),
+                      2 * sizeof(int));
+}
+
+
 TEST_F(Communicator, CanSetCustomCommunicator)
 {
     auto world_rank = comm.rank();
@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+
+
+class BatchIluFactory : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using batch_ilu_prec =
+        gko::batch::preconditioner::Ilu<value_type, index_type>;
+
+    BatchIluFactory() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::shared_ptr<const gko::Executor> exec;
+};
+
+
+TEST_F(BatchIluFactory, KnowsItsExecutor)
+{
+    auto batch_ilu_factory = batch_ilu_prec::build().on(this->exec);
+
+    ASSERT_EQ(batch_ilu_factory->get_executor(), this->exec);
+}
+
+
+TEST_F(BatchIluFactory, ThrowsOnNonCsrMatrix)
+{
+    auto batch_ilu_factory = batch_ilu_prec::build().on(this->exec);
+    auto mtx = gko::share(gko::batch::matrix::Dense<value_type>::create(
+        this->exec, gko::batch_dim<2>(2, gko::dim<2>(3))));
+
+    ASSERT_THROW(batch_ilu_factory->generate(mtx), gko::NotSupported);
+}
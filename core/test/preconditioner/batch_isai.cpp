@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+
+
+class BatchIsaiFactory : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = gko::int32;
+    using batch_isai_prec =
+        gko::batch::preconditioner::Isai<value_type, index_type>;
+
+    BatchIsaiFactory() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::shared_ptr<const gko::Executor> exec;
+};
+
+
+TEST_F(BatchIsaiFactory, KnowsItsExecutor)
+{
+    auto batch_isai_factory = batch_isai_prec::build().on(this->exec);
+
+    ASSERT_EQ(batch_isai_factory->get_executor(), this->exec);
+}
+
+
+TEST_F(BatchIsaiFactory, HasDefaultParameters)
+{
+    using input_type = gko::batch::preconditioner::batch_isai_input_matrix_type;
+    auto batch_isai_factory = batch_isai_prec::build().on(this->exec);
+
+    const auto& params = batch_isai_factory->get_parameters();
+    ASSERT_EQ(params.isai_input_matrix_type, input_type::general);
+    ASSERT_EQ(params.sparsity_power, 1);
+}
+
+
+TEST_F(BatchIsaiFactory, CanSetInputMatrixType)
+{
+    auto batch_isai_factory =
+        batch_isai_prec::build()
+            .with_isai_input_matrix_type(
+                gko::batch::preconditioner::batch_isai_input_matrix_type::upper)
+            .on(this->exec);
+
+    ASSERT_EQ(batch_isai_factory->get_parameters().isai_input_matrix_type,
+              gko::batch::preconditioner::batch_isai_input_matrix_type::upper);
+}
+
+
+TEST_F(BatchIsaiFactory, CanSetSparsityPower)
+{
+    auto batch_isai_factory =
+        batch_isai_prec::build().with_sparsity_power(3).on(this->exec);
+
+    ASSERT_EQ(batch_isai_factory->get_parameters().sparsity_power, 3);
+}
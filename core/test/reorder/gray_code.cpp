@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/gray_code.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class GrayCode : public ::testing::Test {
+protected:
+    using i_type = int;
+    using reorder_type = gko::experimental::reorder::GrayCode<i_type>;
+
+    GrayCode() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::shared_ptr<const gko::Executor> exec;
+};
+
+
+TEST_F(GrayCode, FactoryKnowsItsExecutor)
+{
+    auto factory = reorder_type::build().on(exec);
+
+    ASSERT_EQ(factory->get_executor(), exec);
+}
+
+
+TEST_F(GrayCode, HasDefaultParameters)
+{
+    auto param = reorder_type::build();
+
+    ASSERT_EQ(param.num_column_blocks, 64);
+}
+
+
+TEST_F(GrayCode, SetsParameters)
+{
+    auto factory = reorder_type::build().with_num_column_blocks(8).on(exec);
+
+    ASSERT_EQ(factory->get_parameters().num_column_blocks, 8);
+}
+
+
+TEST_F(GrayCode, ThrowsOnInvalidNumColumnBlocks)
+{
+    ASSERT_THROW(reorder_type::build().with_num_column_blocks(0).on(exec),
+                 gko::InvalidStateError);
+    ASSERT_THROW(reorder_type::build().with_num_column_blocks(65).on(exec),
+                 gko::InvalidStateError);
+}
+
+
+}  // namespace
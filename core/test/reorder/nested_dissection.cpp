@@ -40,4 +40,26 @@ TEST_F(NestedDissection, KnowsItsExecutor)
     ASSERT_EQ(this->nd_factory->get_executor(), this->exec);
 }
 
+TEST_F(NestedDissection, DefaultAlgorithmDependsOnMetisSupport)
+{
+#if GKO_HAVE_METIS
+    ASSERT_EQ(this->nd_factory->get_parameters().algorithm,
+              gko::experimental::reorder::nd_algorithm::metis);
+#else
+    ASSERT_EQ(this->nd_factory->get_parameters().algorithm,
+              gko::experimental::reorder::nd_algorithm::native);
+#endif
+}
+
+TEST_F(NestedDissection, SetsAlgorithm)
+{
+    auto factory =
+        reorder_type::build()
+            .with_algorithm(gko::experimental::reorder::nd_algorithm::native)
+            .on(this->exec);
+
+    ASSERT_EQ(factory->get_parameters().algorithm,
+              gko::experimental::reorder::nd_algorithm::native);
+}
+
 }  // namespace
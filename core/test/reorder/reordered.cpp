@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/reordered.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/reorder/rcm.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+class Reordered : public ::testing::Test {
+protected:
+    using v_type = double;
+    using i_type = int;
+    using reordered_type =
+        gko::experimental::reorder::Reordered<v_type, i_type>;
+    using rcm_type = gko::experimental::reorder::Rcm<i_type>;
+    using cg_type = gko::solver::Cg<v_type>;
+
+    Reordered() : exec(gko::ReferenceExecutor::create()) {}
+
+    std::shared_ptr<const gko::Executor> exec;
+};
+
+
+TEST_F(Reordered, FactoryKnowsItsExecutor)
+{
+    auto factory = reordered_type::build().on(exec);
+
+    ASSERT_EQ(factory->get_executor(), exec);
+}
+
+
+TEST_F(Reordered, HasNoOperatorsByDefault)
+{
+    auto factory = reordered_type::build().on(exec);
+
+    ASSERT_EQ(factory->get_parameters().inner_operator, nullptr);
+    ASSERT_EQ(factory->get_parameters().reordering, nullptr);
+}
+
+
+TEST_F(Reordered, SetsOperators)
+{
+    auto inner = gko::share(cg_type::build().on(exec));
+    auto reordering = gko::share(rcm_type::build().on(exec));
+
+    auto factory = reordered_type::build()
+                       .with_inner_operator(inner)
+                       .with_reordering(reordering)
+                       .on(exec);
+
+    ASSERT_EQ(factory->get_parameters().inner_operator, inner);
+    ASSERT_EQ(factory->get_parameters().reordering, reordering);
+}
+
+
+}  // namespace
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/block_triangular.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BlockTriangular : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using LowerSolver = gko::solver::BlockLowerTrs<value_type, index_type>;
+    using UpperSolver = gko::solver::BlockUpperTrs<value_type, index_type>;
+
+    BlockTriangular()
+        : exec(gko::ReferenceExecutor::create()),
+          lower_factory(LowerSolver::build().on(exec)),
+          upper_factory(UpperSolver::build().with_unit_diagonal(true).on(exec))
+    {}
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::unique_ptr<typename LowerSolver::Factory> lower_factory;
+    std::unique_ptr<typename UpperSolver::Factory> upper_factory;
+};
+
+TYPED_TEST_SUITE(BlockTriangular, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BlockTriangular, FactoriesKnowTheirExecutor)
+{
+    ASSERT_EQ(this->lower_factory->get_executor(), this->exec);
+    ASSERT_EQ(this->upper_factory->get_executor(), this->exec);
+}
+
+
+TYPED_TEST(BlockTriangular, FactoriesKnowTheirParameters)
+{
+    ASSERT_FALSE(this->lower_factory->get_parameters().unit_diagonal);
+    ASSERT_TRUE(this->upper_factory->get_parameters().unit_diagonal);
+}
+
+
+TYPED_TEST(BlockTriangular, ThrowsOnRectangularMatrixInFactory)
+{
+    using Mtx = typename TestFixture::Mtx;
+    std::shared_ptr<Mtx> rectangular_matrix =
+        Mtx::create(this->exec, gko::dim<2>{1, 2});
+
+    ASSERT_THROW(this->lower_factory->generate(rectangular_matrix),
+                 gko::DimensionMismatch);
+    ASSERT_THROW(this->upper_factory->generate(rectangular_matrix),
+                 gko::DimensionMismatch);
+}
+
+
+}  // namespace
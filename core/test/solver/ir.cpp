@@ -311,6 +311,36 @@ TYPED_TEST(Ir, DefaultRelaxationFactor)
 }
 
 
+TYPED_TEST(Ir, DefaultMixedPrecisionParameters)
+{
+    using real_type = gko::remove_complex<typename TestFixture::value_type>;
+    auto solver = this->ir_factory->generate(this->mtx);
+
+    ASSERT_FALSE(solver->get_parameters().mixed_precision);
+    ASSERT_EQ(solver->get_parameters().stagnation_factor, real_type{0.9});
+    ASSERT_EQ(solver->get_parameters().stagnation_check_interval, 4);
+    ASSERT_EQ(solver->get_parameters().promoted_solver, nullptr);
+}
+
+
+TYPED_TEST(Ir, ThrowsOnMixedPrecisionWithoutLowerPrecision)
+{
+    using value_type = typename TestFixture::value_type;
+    using Solver = typename TestFixture::Solver;
+    auto factory =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .with_mixed_precision(true)
+            .on(this->exec);
+
+    if (std::is_same<gko::remove_complex<value_type>, double>::value) {
+        ASSERT_NO_THROW(factory->generate(this->mtx));
+    } else {
+        ASSERT_THROW(factory->generate(this->mtx), gko::InvalidStateError);
+    }
+}
+
+
 TYPED_TEST(Ir, UseAsRichardson)
 {
     using value_type = typename TestFixture::value_type;
@@ -0,0 +1,181 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/workspace_pool.hpp>
+
+
+#include <typeinfo>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/workspace.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+class WorkspacePool : public ::testing::Test {
+protected:
+    using Vec = gko::matrix::Dense<double>;
+
+    WorkspacePool()
+        : exec(gko::ReferenceExecutor::create()),
+          pool(gko::solver::WorkspacePool::create(exec))
+    {}
+
+    Vec* create_vector(gko::solver::detail::workspace& ws, int op_id,
+                       gko::dim<2> size)
+    {
+        return ws.template create_or_get_op<Vec>(
+            op_id, [&] { return Vec::create(exec, size); }, typeid(Vec), size,
+            size[1]);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<gko::solver::WorkspacePool> pool;
+};
+
+
+TEST_F(WorkspacePool, IsEmptyAfterCreation)
+{
+    ASSERT_EQ(pool->get_executor(), exec);
+    ASSERT_EQ(pool->get_num_buffers(), 0);
+    ASSERT_EQ(pool->get_num_leased_buffers(), 0);
+    ASSERT_EQ(pool->get_allocated_bytes(), 0);
+}
+
+
+TEST_F(WorkspacePool, LeasesNewBuffers)
+{
+    auto buffer1 = pool->lease(16);
+    auto buffer2 = pool->lease(32);
+
+    ASSERT_EQ(buffer1.get_size(), 16);
+    ASSERT_EQ(buffer2.get_size(), 32);
+    ASSERT_EQ(buffer1.get_executor(), exec);
+    ASSERT_EQ(pool->get_num_buffers(), 2);
+    ASSERT_EQ(pool->get_num_leased_buffers(), 2);
+    ASSERT_EQ(pool->get_allocated_bytes(), 48);
+}
+
+
+TEST_F(WorkspacePool, ReusesSmallestFittingBuffer)
+{
+    auto buffer1 = pool->lease(64);
+    auto buffer2 = pool->lease(16);
+    auto buffer3 = pool->lease(32);
+    const auto ptr3 = buffer3.get_const_data();
+    pool->release(std::move(buffer1));
+    pool->release(std::move(buffer2));
+    pool->release(std::move(buffer3));
+
+    auto buffer = pool->lease(20);
+
+    ASSERT_EQ(buffer.get_const_data(), ptr3);
+    ASSERT_EQ(pool->get_num_buffers(), 3);
+    ASSERT_EQ(pool->get_num_leased_buffers(), 1);
+}
+
+
+TEST_F(WorkspacePool, ClearFreesAvailableBuffers)
+{
+    auto buffer1 = pool->lease(64);
+    auto buffer2 = pool->lease(16);
+    pool->release(std::move(buffer1));
+
+    pool->clear();
+
+    ASSERT_EQ(pool->get_num_buffers(), 1);
+    ASSERT_EQ(pool->get_num_leased_buffers(), 1);
+    ASSERT_EQ(pool->get_allocated_bytes(), 16);
+}
+
+
+TEST_F(WorkspacePool, WorkspaceLeasesVectorsInsideScope)
+{
+    gko::solver::detail::workspace ws{exec};
+    ws.set_size(2, 0);
+    ws.set_pool(pool);
+
+    {
+        gko::solver::detail::workspace::scope scope{&ws};
+        auto vec1 = create_vector(ws, 0, gko::dim<2>{4, 2});
+        auto vec2 = create_vector(ws, 1, gko::dim<2>{3, 1});
+
+        ASSERT_EQ(vec1->get_size(), gko::dim<2>(4, 2));
+        ASSERT_EQ(vec2->get_size(), gko::dim<2>(3, 1));
+        ASSERT_EQ(vec1, create_vector(ws, 0, gko::dim<2>{4, 2}));
+        ASSERT_EQ(pool->get_num_leased_buffers(), 2);
+        ASSERT_EQ(pool->get_allocated_bytes(), 11 * sizeof(double));
+    }
+
+    ASSERT_EQ(pool->get_num_leased_buffers(), 0);
+    ASSERT_EQ(ws.get_op(0), nullptr);
+    ASSERT_EQ(ws.get_op(1), nullptr);
+}
+
+
+TEST_F(WorkspacePool, WorkspacesShareBuffersOutsideOfScope)
+{
+    gko::solver::detail::workspace ws1{exec};
+    gko::solver::detail::workspace ws2{exec};
+    ws1.set_size(1, 0);
+    ws2.set_size(1, 0);
+    ws1.set_pool(pool);
+    ws2.set_pool(pool);
+
+    {
+        gko::solver::detail::workspace::scope scope{&ws1};
+        create_vector(ws1, 0, gko::dim<2>{8, 1});
+    }
+    {
+        gko::solver::detail::workspace::scope scope{&ws2};
+        create_vector(ws2, 0, gko::dim<2>{4, 1});
+    }
+
+    ASSERT_EQ(pool->get_num_buffers(), 1);
+    ASSERT_EQ(pool->get_allocated_bytes(), 8 * sizeof(double));
+}
+
+
+TEST_F(WorkspacePool, NestedWorkspacesUseSeparateBuffers)
+{
+    gko::solver::detail::workspace ws1{exec};
+    gko::solver::detail::workspace ws2{exec};
+    ws1.set_size(1, 0);
+    ws2.set_size(1, 0);
+    ws1.set_pool(pool);
+    ws2.set_pool(pool);
+
+    {
+        gko::solver::detail::workspace::scope scope1{&ws1};
+        auto vec1 = create_vector(ws1, 0, gko::dim<2>{8, 1});
+        {
+            gko::solver::detail::workspace::scope scope2{&ws2};
+            auto vec2 = create_vector(ws2, 0, gko::dim<2>{4, 1});
+
+            ASSERT_NE(vec1->get_const_values(), vec2->get_const_values());
+        }
+        ASSERT_EQ(ws1.get_op(0), vec1);
+    }
+
+    ASSERT_EQ(pool->get_num_buffers(), 2);
+}
+
+
+TEST_F(WorkspacePool, WorkspaceOwnsVectorsOutsideOfScope)
+{
+    gko::solver::detail::workspace ws{exec};
+    ws.set_size(1, 0);
+    ws.set_pool(pool);
+
+    auto vec = create_vector(ws, 0, gko::dim<2>{4, 2});
+
+    ASSERT_EQ(ws.get_op(0), vec);
+    ASSERT_EQ(pool->get_num_buffers(), 0);
+}
@@ -330,7 +330,7 @@ ResultWithLogData<typename MatrixType::value_type> solve_linear_system(
     result.x->fill(zero<value_type>());
 
     auto log_data = std::make_unique<batch::log::detail::log_data<real_type>>(
-        exec, num_batch_items);
+        exec, num_batch_items, num_rhs);
 
     std::unique_ptr<gko::batch::BatchLinOp> precond;
     if (precond_factory) {
@@ -344,7 +344,7 @@ ResultWithLogData<typename MatrixType::value_type> solve_linear_system(
 
 
     result.log_data = std::make_unique<batch::log::detail::log_data<real_type>>(
-        exec->get_master(), num_batch_items);
+        exec->get_master(), num_batch_items, num_rhs);
     result.log_data->iter_counts = log_data->iter_counts;
     result.log_data->res_norms = log_data->res_norms;
 
@@ -41,6 +41,7 @@ void init_nvtx()
     NAMED_CATEGORY(criterion);
     NAMED_CATEGORY(user);
     NAMED_CATEGORY(internal);
+    NAMED_CATEGORY(communication);
 #undef NAMED_CATEGORY
 }
 
@@ -116,6 +116,19 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PAR_ILUT_COMPUTE_LU_FACTORS_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void row_wise_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* a,
+                        remove_complex<ValueType> drop_tolerance,
+                        double fill_in_limit,
+                        matrix::Csr<ValueType, IndexType>* l,
+                        matrix::Csr<ValueType, IndexType>* u)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_ROW_WISE_FACTORIZE_KERNEL);
+
+
 }  // namespace par_ilut_factorization
 }  // namespace cuda
 }  // namespace kernels
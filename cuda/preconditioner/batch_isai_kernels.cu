@@ -0,0 +1,46 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+namespace batch_isai {
+
+
+template <typename ValueType, typename IndexType>
+void extract_dense_linear_sys_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* first_sys_csr,
+    const matrix::Csr<ValueType, IndexType>* first_approx_inv,
+    IndexType* dense_mat_pattern, IndexType* rhs_one_idxs,
+    IndexType* sizes) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_DENSE_LINEAR_SYSTEM_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_values_dense_mat_and_solve(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const batch::matrix::Csr<ValueType, IndexType>* sys_csr,
+    batch::matrix::Csr<ValueType, IndexType>* approx_inv,
+    const IndexType* dense_mat_pattern, const IndexType* rhs_one_idxs,
+    const IndexType* sizes) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_FILL_VALUES_DENSE_MATRIX_AND_SOLVE_KERNEL);
+
+
+}  // namespace batch_isai
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
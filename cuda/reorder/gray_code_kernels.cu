@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/gray_code_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace gray_code {
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_rows, IndexType num_cols,
+                         const IndexType* row_ptrs, const IndexType* col_idxs,
+                         int num_column_blocks,
+                         IndexType* permutation) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace gray_code
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
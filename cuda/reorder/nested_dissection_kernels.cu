@@ -0,0 +1,35 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace cuda {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_vertices, const IndexType* row_ptrs,
+                         const IndexType* col_idxs,
+                         IndexType* permutation) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ND_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace cuda
+}  // namespace kernels
+}  // namespace gko
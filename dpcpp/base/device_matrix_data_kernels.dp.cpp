@@ -122,6 +122,31 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void sort_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,
+                         const dim<2>& size, array<ValueType>& values,
+                         array<IndexType>& row_idxs,
+                         array<IndexType>& col_idxs, bool filter_zeros)
+{
+    device_matrix_data<ValueType, IndexType> data{
+        exec, size, std::move(row_idxs), std::move(col_idxs),
+        std::move(values)};
+    sort_row_major(exec, data);
+    auto arrays = data.empty_out();
+    sum_duplicates(exec, size[0], arrays.values, arrays.row_idxs,
+                   arrays.col_idxs);
+    if (filter_zeros) {
+        remove_zeros(exec, arrays.values, arrays.row_idxs, arrays.col_idxs);
+    }
+    values = std::move(arrays.values);
+    row_idxs = std::move(arrays.row_idxs);
+    col_idxs = std::move(arrays.col_idxs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_SUM_DUPLICATES_KERNEL);
+
+
 }  // namespace components
 }  // namespace dpcpp
 }  // namespace kernels
@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/factorization/elimination_forest_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+/**
+ * @brief The elimination forest namespace.
+ *
+ * @ingroup factor
+ */
+namespace elimination_forest {
+
+
+template <typename IndexType>
+void compute_parents(std::shared_ptr<const DefaultExecutor> exec,
+                     const IndexType* row_ptrs, const IndexType* cols,
+                     IndexType size, IndexType* parents) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL);
+
+
+}  // namespace elimination_forest
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
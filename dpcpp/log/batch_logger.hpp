@@ -30,20 +30,25 @@ class SimpleFinalLogger final {
 public:
     using real_type = remove_complex<RealType>;
 
-    SimpleFinalLogger(real_type* const batch_residuals, int* const batch_iters)
-        : final_residuals_{batch_residuals}, final_iters_{batch_iters}
+    SimpleFinalLogger(real_type* const batch_residuals, int* const batch_iters,
+                      const int num_rhs = 1)
+        : final_residuals_{batch_residuals},
+          final_iters_{batch_iters},
+          num_rhs_{num_rhs}
     {}
 
     __dpct_inline__ void log_iteration(const size_type batch_idx,
-                                       const int iter, const real_type res_norm)
+                                       const int iter, const real_type res_norm,
+                                       const int rhs = 0)
     {
-        final_iters_[batch_idx] = iter;
-        final_residuals_[batch_idx] = res_norm;
+        final_iters_[batch_idx * num_rhs_ + rhs] = iter;
+        final_residuals_[batch_idx * num_rhs_ + rhs] = res_norm;
     }
 
 private:
     real_type* const final_residuals_;
     int* const final_iters_;
+    const int num_rhs_;
 };
 
 
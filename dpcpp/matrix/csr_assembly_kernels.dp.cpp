@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/csr_assembly_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+/**
+ * @brief The Csr assembly namespace.
+ * @ref CsrAssembler
+ * @ingroup csr_assembly
+ */
+namespace csr_assembly {
+
+
+template <typename IndexType>
+void build_pattern(std::shared_ptr<const DefaultExecutor> exec,
+                   const IndexType* element_dofs, size_type num_elements,
+                   size_type dofs_per_element, size_type num_rows,
+                   size_type num_dofs, IndexType* row_ptrs,
+                   array<IndexType>& col_idxs,
+                   IndexType& max_dof) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_elements(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* element_dofs,
+                  const ValueType* element_values, size_type num_elements,
+                  size_type dofs_per_element, size_type num_dofs,
+                  const IndexType* row_ptrs, const IndexType* col_idxs,
+                  const IndexType* storage_offsets, const int64* row_desc,
+                  const int32* storage, ValueType* values,
+                  IndexType& max_dof) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_values(std::shared_ptr<const DefaultExecutor> exec,
+                const IndexType* row_idxs, const IndexType* entry_cols,
+                const ValueType* entry_values, size_type num_entries,
+                size_type num_rows, size_type num_cols,
+                const IndexType* row_ptrs, const IndexType* col_idxs,
+                const IndexType* storage_offsets, const int64* row_desc,
+                const int32* storage, ValueType* values, IndexType& max_row,
+                IndexType& max_col) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL);
+
+
+}  // namespace csr_assembly
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
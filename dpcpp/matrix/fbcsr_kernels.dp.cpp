@@ -127,6 +127,37 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void invert_diagonal_blocks(std::shared_ptr<const DpcppExecutor> exec,
+                            const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                            ValueType* inv_diag_blocks) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void lower_trs(std::shared_ptr<const DpcppExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b,
+               matrix::Dense<ValueType>* x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void upper_trs(std::shared_ptr<const DpcppExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b,
+               matrix::Dense<ValueType>* x) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL);
+
+
 }  // namespace fbcsr
 }  // namespace dpcpp
 }  // namespace kernels
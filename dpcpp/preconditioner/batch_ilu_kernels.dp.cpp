@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+namespace batch_ilu {
+
+
+template <typename ValueType, typename IndexType>
+void find_diagonal_locations(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const batch::matrix::Csr<ValueType, IndexType>* mat,
+    IndexType* diag_locs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_FIND_DIAGONAL_LOCATIONS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_ilu0_factorization(
+    std::shared_ptr<const DefaultExecutor> exec, const IndexType* diag_locs,
+    batch::matrix::Csr<ValueType, IndexType>* mat_factorized)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_COMPUTE_ILU0_FACTORIZATION_KERNEL);
+
+
+}  // namespace batch_ilu
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
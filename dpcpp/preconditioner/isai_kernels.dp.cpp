@@ -749,6 +749,29 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void select_pattern_extension(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* input,
+    const matrix::Csr<ValueType, IndexType>* inverse, IndexType fill,
+    remove_complex<ValueType> tolerance, bool lower, bool upper,
+    IndexType* extension, IndexType* extended_row_ptrs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_SELECT_PATTERN_EXTENSION_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extend_pattern(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* inverse,
+                    const IndexType* extension, IndexType fill,
+                    matrix::Csr<ValueType, IndexType>* extended)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_EXTEND_PATTERN_KERNEL);
+
+
 }  // namespace isai
 }  // namespace dpcpp
 }  // namespace kernels
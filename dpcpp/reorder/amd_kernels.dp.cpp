@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/amd_kernels.hpp"
+
+
+#include <ginkgo/core/base/exception_helpers.hpp>
+
+
+namespace gko {
+namespace kernels {
+namespace dpcpp {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace amd {
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const DefaultExecutor> exec,
+                         IndexType num_vertices, const IndexType* row_ptrs,
+                         const IndexType* col_idxs,
+                         IndexType* permutation) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+}  // namespace dpcpp
+}  // namespace kernels
+}  // namespace gko
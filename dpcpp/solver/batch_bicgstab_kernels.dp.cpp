@@ -124,7 +124,9 @@ public:
         const size_type num_batch_items = mat.num_batch_items;
         const auto num_rows = mat.num_rows;
         const auto num_rhs = b.num_rhs;
-        GKO_ASSERT(num_rhs == 1);
+        if (num_rhs > 1) {
+            GKO_NOT_IMPLEMENTED;
+        }
 
         auto device = exec_->get_queue()->get_device();
         auto max_group_size =
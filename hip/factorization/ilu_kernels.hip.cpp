@@ -62,6 +62,27 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void initialize_block_row_ptrs_l_u(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+    IndexType* l_row_ptrs, IndexType* u_row_ptrs) GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_block_lu(std::shared_ptr<const DefaultExecutor> exec,
+                      const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+                      matrix::Fbcsr<ValueType, IndexType>* l_factor,
+                      matrix::Fbcsr<ValueType, IndexType>* u_factor)
+    GKO_NOT_IMPLEMENTED;
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL);
+
+
 }  // namespace ilu_factorization
 }  // namespace hip
 }  // namespace kernels
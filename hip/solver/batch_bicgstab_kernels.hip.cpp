@@ -118,6 +118,9 @@ public:
         const gko::batch::multi_vector::uniform_batch<value_type>& x) const
     {
         using real_type = gko::remove_complex<value_type>;
+        if (b.num_rhs > 1) {
+            GKO_NOT_IMPLEMENTED;
+        }
         const size_type num_batch_items = mat.num_batch_items;
         constexpr int align_multiple = 8;
         const int padded_num_rows =
@@ -135,6 +135,14 @@ public:
      */
     void sum_duplicates();
 
+    /**
+     * Sums up all duplicate entries pointing to the same non-zero location and
+     * removes all entries that are zero afterwards. This is equivalent to
+     * calling sum_duplicates() followed by remove_zeros(), but only traverses
+     * the sorted entries once.
+     */
+    void sum_duplicates_and_remove_zeros();
+
     /**
      * Returns the executor used to store the device_matrix_data entries.
      *
@@ -710,6 +710,35 @@ private:
 };
 
 
+/**
+ * A LinOp generated from a system matrix implementing this interface can
+ * recompute its numerical values for a new system matrix with the same
+ * sparsity pattern, reusing the symbolic information (block structure,
+ * sparsity patterns of factors, ...) computed during the generation.
+ *
+ * This is useful if a sequence of systems with a fixed sparsity pattern but
+ * changing values is solved, as it happens for example in time-stepping
+ * schemes.
+ *
+ * @ingroup LinOp
+ */
+class ValueUpdatable {
+public:
+    virtual ~ValueUpdatable() = default;
+
+    /**
+     * Recomputes the numerical values of the operator from a new system
+     * matrix.
+     *
+     * @param new_matrix  the new system matrix. It must have the same size and
+     *                    sparsity pattern as the matrix the operator was
+     *                    generated from, otherwise an InvalidStateError is
+     *                    thrown.
+     */
+    virtual void update_values(std::shared_ptr<const LinOp> new_matrix) = 0;
+};
+
+
 /**
  * The diagonal of a LinOp can be extracted. It will be implemented by
  * DiagonalExtractable<ValueType>, so the class does not need to implement it.
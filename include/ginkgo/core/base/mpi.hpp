@@ -313,6 +313,67 @@ private:
 };
 
 
+namespace detail {
+
+
+/** Returns the size of an MPI_Datatype in bytes. */
+inline size_type get_type_size(MPI_Datatype type)
+{
+    int size{};
+    GKO_ASSERT_NO_MPI_ERRORS(MPI_Type_size(type, &size));
+    return static_cast<size_type>(size);
+}
+
+
+/**
+ * Scope guard that emits the communication_started event to the loggers of an
+ * executor on construction and the communication_completed event on
+ * destruction.
+ */
+class communication_log_guard {
+public:
+    communication_log_guard(const Executor* exec, const char* name, int peer,
+                            size_type send_bytes, size_type recv_bytes)
+        : exec_{exec},
+          name_{name},
+          peer_{peer},
+          send_bytes_{send_bytes},
+          recv_bytes_{recv_bytes}
+    {
+        this->log<log::Logger::communication_started>();
+    }
+
+    communication_log_guard(const communication_log_guard&) = delete;
+
+    communication_log_guard& operator=(const communication_log_guard&) =
+        delete;
+
+    ~communication_log_guard()
+    {
+        this->log<log::Logger::communication_completed>();
+    }
+
+private:
+    template <size_type Event>
+    void log() const
+    {
+        for (const auto& logger : exec_->get_loggers()) {
+            logger->template on<Event>(exec_, name_, peer_, send_bytes_,
+                                       recv_bytes_);
+        }
+    }
+
+    const Executor* exec_;
+    const char* name_;
+    int peer_;
+    size_type send_bytes_;
+    size_type recv_bytes_;
+};
+
+
+}  // namespace detail
+
+
 /**
  * The request class is a light, move-only wrapper around the MPI_Request
  * handle.
@@ -325,6 +386,27 @@ public:
      */
     request() : req_(MPI_REQUEST_NULL) {}
 
+    /**
+     * Creates a null MPI_Request whose completion in wait() is reported to
+     * the loggers of an executor as a communication with the given name.
+     *
+     * @param exec  the executor on which the message buffers are located
+     * @param name  the name of the communication, e.g. "i_send_wait"
+     * @param peer  the rank of the communication partner, see
+     *              Logger::on_communication_started
+     * @param send_bytes  the number of bytes sent by this rank
+     * @param recv_bytes  the number of bytes received by this rank
+     */
+    request(std::shared_ptr<const Executor> exec, const char* name, int peer,
+            size_type send_bytes, size_type recv_bytes)
+        : req_(MPI_REQUEST_NULL),
+          exec_{std::move(exec)},
+          name_{name},
+          peer_{peer},
+          send_bytes_{send_bytes},
+          recv_bytes_{recv_bytes}
+    {}
+
     request(const request&) = delete;
 
     request& operator=(const request&) = delete;
@@ -335,6 +417,11 @@ public:
     {
         if (this != &o) {
             this->req_ = std::exchange(o.req_, MPI_REQUEST_NULL);
+            this->exec_ = std::move(o.exec_);
+            this->name_ = o.name_;
+            this->peer_ = o.peer_;
+            this->send_bytes_ = o.send_bytes_;
+            this->recv_bytes_ = o.recv_bytes_;
         }
         return *this;
     }
@@ -357,7 +444,9 @@ public:
     MPI_Request* get() { return &this->req_; }
 
     /**
-     * Allows a rank to wait on a particular request handle.
+     * Allows a rank to wait on a particular request handle. If the request was
+     * created by a non-blocking communicator call, the wait is reported to the
+     * loggers of the executor the call was made with.
      *
      * @param req  The request to wait on.
      * @param status  The status variable that can be queried.
@@ -365,13 +454,24 @@ public:
     status wait()
     {
         status status;
-        GKO_ASSERT_NO_MPI_ERRORS(MPI_Wait(&req_, status.get()));
+        if (exec_) {
+            detail::communication_log_guard log_guard{
+                exec_.get(), name_, peer_, send_bytes_, recv_bytes_};
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_Wait(&req_, status.get()));
+        } else {
+            GKO_ASSERT_NO_MPI_ERRORS(MPI_Wait(&req_, status.get()));
+        }
         return status;
     }
 
 
 private:
     MPI_Request req_;
+    std::shared_ptr<const Executor> exec_{};
+    const char* name_{};
+    int peer_{};
+    size_type send_bytes_{};
+    size_type recv_bytes_{};
 };
 
 
@@ -530,6 +630,9 @@ public:
               const int send_tag) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "send", destination_rank, send_count * sizeof(SendType),
+            0};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Send(send_buffer, send_count, type_impl<SendType>::get_type(),
                      destination_rank, send_tag, this->get()));
@@ -557,7 +660,11 @@ public:
                    const int destination_rank, const int send_tag) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_send", destination_rank, 0, 0};
+        request req{
+            exec, "i_send_wait", destination_rank,
+            send_count * sizeof(SendType), 0};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Isend(send_buffer, send_count, type_impl<SendType>::get_type(),
                       destination_rank, send_tag, this->get(), req.get()));
@@ -585,6 +692,8 @@ public:
                 const int recv_tag) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "recv", source_rank, 0, recv_count * sizeof(RecvType)};
         status st;
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Recv(recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -613,7 +722,10 @@ public:
                    const int recv_tag) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_recv", source_rank, 0, 0};
+        request req{
+            exec, "i_recv_wait", source_rank, 0, recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Irecv(recv_buffer, recv_count, type_impl<RecvType>::get_type(),
                       source_rank, recv_tag, this->get(), req.get()));
@@ -637,6 +749,10 @@ public:
                    int count, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "broadcast", root_rank,
+            this->on_root(root_rank, count * sizeof(BroadcastType)),
+            this->on_non_root(root_rank, count * sizeof(BroadcastType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Bcast(buffer, count,
                                            type_impl<BroadcastType>::get_type(),
                                            root_rank, this->get()));
@@ -662,7 +778,12 @@ public:
                         BroadcastType* buffer, int count, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_broadcast", root_rank, 0, 0};
+        request req{
+            exec, "i_broadcast_wait", root_rank,
+            this->on_root(root_rank, count * sizeof(BroadcastType)),
+            this->on_non_root(root_rank, count * sizeof(BroadcastType))};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Ibcast(buffer, count, type_impl<BroadcastType>::get_type(),
                        root_rank, this->get(), req.get()));
@@ -689,6 +810,9 @@ public:
                 int count, MPI_Op operation, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "reduce", root_rank, count * sizeof(ReduceType),
+            this->on_root(root_rank, count * sizeof(ReduceType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Reduce(send_buffer, recv_buffer, count,
                                             type_impl<ReduceType>::get_type(),
                                             operation, root_rank, this->get()));
@@ -716,7 +840,11 @@ public:
                      int count, MPI_Op operation, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_reduce", root_rank, 0, 0};
+        request req{
+            exec, "i_reduce_wait", root_rank, count * sizeof(ReduceType),
+            this->on_root(root_rank, count * sizeof(ReduceType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Ireduce(
             send_buffer, recv_buffer, count, type_impl<ReduceType>::get_type(),
             operation, root_rank, this->get(), req.get()));
@@ -741,6 +869,9 @@ public:
                     ReduceType* recv_buffer, int count, MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_reduce", -1, count * sizeof(ReduceType),
+            count * sizeof(ReduceType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Allreduce(
             MPI_IN_PLACE, recv_buffer, count, type_impl<ReduceType>::get_type(),
             operation, this->get()));
@@ -767,7 +898,11 @@ public:
                          MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_reduce", -1, 0, 0};
+        request req{
+            exec, "i_all_reduce_wait", -1, count * sizeof(ReduceType),
+            count * sizeof(ReduceType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Iallreduce(
             MPI_IN_PLACE, recv_buffer, count, type_impl<ReduceType>::get_type(),
             operation, this->get(), req.get()));
@@ -794,6 +929,9 @@ public:
                     int count, MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_reduce", -1, count * sizeof(ReduceType),
+            count * sizeof(ReduceType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Allreduce(
             send_buffer, recv_buffer, count, type_impl<ReduceType>::get_type(),
             operation, this->get()));
@@ -821,7 +959,11 @@ public:
                          int count, MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_reduce", -1, 0, 0};
+        request req{
+            exec, "i_all_reduce_wait", -1, count * sizeof(ReduceType),
+            count * sizeof(ReduceType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Iallreduce(
             send_buffer, recv_buffer, count, type_impl<ReduceType>::get_type(),
             operation, this->get(), req.get()));
@@ -851,6 +993,10 @@ public:
                 int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "gather", root_rank, send_count * sizeof(SendType),
+            this->on_root(root_rank,
+                          this->size() * recv_count * sizeof(RecvType))};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Gather(send_buffer, send_count, type_impl<SendType>::get_type(),
                        recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -883,7 +1029,12 @@ public:
                      int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_gather", root_rank, 0, 0};
+        request req{
+            exec, "i_gather_wait", root_rank, send_count * sizeof(SendType),
+            this->on_root(root_rank,
+                          this->size() * recv_count * sizeof(RecvType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Igather(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(), root_rank,
@@ -916,6 +1067,10 @@ public:
                   const int* displacements, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "gather_v", root_rank, send_count * sizeof(SendType),
+            this->on_root(root_rank,
+                          this->sum_counts(recv_counts) * sizeof(RecvType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Gatherv(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_counts, displacements,
@@ -949,7 +1104,12 @@ public:
                        const int* displacements, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_gather_v", root_rank, 0, 0};
+        request req{
+            exec, "i_gather_v_wait", root_rank, send_count * sizeof(SendType),
+            this->on_root(root_rank,
+                          this->sum_counts(recv_counts) * sizeof(RecvType))};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Igatherv(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_counts, displacements,
@@ -979,6 +1139,9 @@ public:
                     RecvType* recv_buffer, const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_gather", -1, send_count * sizeof(SendType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Allgather(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1009,7 +1172,11 @@ public:
                          RecvType* recv_buffer, const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_gather", -1, 0, 0};
+        request req{
+            exec, "i_all_gather_wait", -1, send_count * sizeof(SendType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Iallgather(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1039,6 +1206,11 @@ public:
                  int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "scatter", root_rank,
+            this->on_root(root_rank,
+                          this->size() * send_count * sizeof(SendType)),
+            recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Scatter(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(), root_rank,
@@ -1070,7 +1242,13 @@ public:
                       int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_scatter", root_rank, 0, 0};
+        request req{
+            exec, "i_scatter_wait", root_rank,
+            this->on_root(root_rank,
+                          this->size() * send_count * sizeof(SendType)),
+            recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Iscatter(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(), root_rank,
@@ -1103,6 +1281,11 @@ public:
                    const int recv_count, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "scatter_v", root_rank,
+            this->on_root(root_rank,
+                          this->sum_counts(send_counts) * sizeof(SendType)),
+            recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Scatterv(
             send_buffer, send_counts, displacements,
             type_impl<SendType>::get_type(), recv_buffer, recv_count,
@@ -1136,7 +1319,13 @@ public:
                         const int recv_count, int root_rank) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_scatter_v", root_rank, 0, 0};
+        request req{
+            exec, "i_scatter_v_wait", root_rank,
+            this->on_root(root_rank,
+                          this->sum_counts(send_counts) * sizeof(SendType)),
+            recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(
             MPI_Iscatterv(send_buffer, send_counts, displacements,
                           type_impl<SendType>::get_type(), recv_buffer,
@@ -1166,6 +1355,10 @@ public:
                     const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_to_all", -1,
+            this->size() * recv_count * sizeof(RecvType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Alltoall(
             MPI_IN_PLACE, recv_count, type_impl<RecvType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1195,7 +1388,12 @@ public:
                          RecvType* recv_buffer, const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_to_all", -1, 0, 0};
+        request req{
+            exec, "i_all_to_all_wait", -1,
+            this->size() * recv_count * sizeof(RecvType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Ialltoall(
             MPI_IN_PLACE, recv_count, type_impl<RecvType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1225,6 +1423,10 @@ public:
                     RecvType* recv_buffer, const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_to_all", -1,
+            this->size() * send_count * sizeof(SendType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Alltoall(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1255,7 +1457,12 @@ public:
                          RecvType* recv_buffer, const int recv_count) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_to_all", -1, 0, 0};
+        request req{
+            exec, "i_all_to_all_wait", -1,
+            this->size() * send_count * sizeof(SendType),
+            this->size() * recv_count * sizeof(RecvType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Ialltoall(
             send_buffer, send_count, type_impl<SendType>::get_type(),
             recv_buffer, recv_count, type_impl<RecvType>::get_type(),
@@ -1316,6 +1523,10 @@ public:
                       const int* recv_offsets, MPI_Datatype recv_type) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "all_to_all_v", -1,
+            this->sum_counts(send_counts) * detail::get_type_size(send_type),
+            this->sum_counts(recv_counts) * detail::get_type_size(recv_type)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Alltoallv(
             send_buffer, send_counts, send_offsets, send_type, recv_buffer,
             recv_counts, recv_offsets, recv_type, this->get()));
@@ -1348,7 +1559,12 @@ public:
                            MPI_Datatype recv_type) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_all_to_all_v", -1, 0, 0};
+        request req{
+            exec, "i_all_to_all_v_wait", -1,
+            this->sum_counts(send_counts) * detail::get_type_size(send_type),
+            this->sum_counts(recv_counts) * detail::get_type_size(recv_type)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Ialltoallv(
             send_buffer, send_counts, send_offsets, send_type, recv_buffer,
             recv_counts, recv_offsets, recv_type, this->get(), req.get()));
@@ -1407,6 +1623,9 @@ public:
               ScanType* recv_buffer, int count, MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
+        detail::communication_log_guard log_guard{
+            exec.get(), "scan", -1, count * sizeof(ScanType),
+            count * sizeof(ScanType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Scan(send_buffer, recv_buffer, count,
                                           type_impl<ScanType>::get_type(),
                                           operation, this->get()));
@@ -1434,7 +1653,11 @@ public:
                    int count, MPI_Op operation) const
     {
         auto guard = exec->get_scoped_device_id_guard();
-        request req;
+        detail::communication_log_guard log_guard{
+            exec.get(), "i_scan", -1, 0, 0};
+        request req{
+            exec, "i_scan_wait", -1, count * sizeof(ScanType),
+            count * sizeof(ScanType)};
         GKO_ASSERT_NO_MPI_ERRORS(MPI_Iscan(send_buffer, recv_buffer, count,
                                            type_impl<ScanType>::get_type(),
                                            operation, this->get(), req.get()));
@@ -1445,6 +1668,32 @@ private:
     std::shared_ptr<MPI_Comm> comm_;
     bool force_host_buffer_;
 
+    /** Returns bytes on the root rank and 0 on all other ranks. */
+    size_type on_root(int root_rank, size_type bytes) const
+    {
+        return this->rank() == root_rank ? bytes : 0;
+    }
+
+    /** Returns 0 on the root rank and bytes on all other ranks. */
+    size_type on_non_root(int root_rank, size_type bytes) const
+    {
+        return this->rank() == root_rank ? 0 : bytes;
+    }
+
+    /** Returns the sum of counts over all ranks, or 0 if counts is null. */
+    size_type sum_counts(const int* counts) const
+    {
+        if (!counts) {
+            return 0;
+        }
+        const auto num_ranks = this->size();
+        size_type sum{};
+        for (int i = 0; i < num_ranks; i++) {
+            sum += counts[i];
+        }
+        return sum;
+    }
+
     int get_my_rank() const
     {
         int my_rank = 0;
@@ -153,6 +153,9 @@ class half;
 using float16 = half;
 
 
+class bfloat16;
+
+
 /**
  * Single precision floating point type.
  */
@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_FACTORIZATION_BLOCK_ILU_HPP_
+#define GKO_PUBLIC_CORE_FACTORIZATION_BLOCK_ILU_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/composition.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+
+
+namespace gko {
+namespace factorization {
+
+
+/**
+ * Represents a block incomplete LU factorization -- block ILU(0) -- of a
+ * sparse matrix with a fixed block structure.
+ *
+ * It consists of a lower triangular factor $L$ with identity diagonal blocks
+ * and an upper triangular factor $U$, both stored as matrix::Fbcsr, with the
+ * block sparsity pattern $\mathcal S(L + U)$ = $\mathcal S(A)$ fulfilling
+ * $LU = A$ at every non-zero block of $A$. The diagonal blocks of $U$ are
+ * inverted densely during the elimination, so this is more robust than
+ * the scalar ILU(0) for systems with strongly coupled degrees of freedom
+ * per node. The factors can be used with solver::BlockLowerTrs and
+ * solver::BlockUpperTrs, e.g. inside a preconditioner::Ilu, to keep the whole
+ * preconditioned solve in block format.
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup factor
+ * @ingroup LinOp
+ */
+template <typename ValueType = gko::default_precision,
+          typename IndexType = gko::int32>
+class BlockIlu : public Composition<ValueType> {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = matrix::Fbcsr<ValueType, IndexType>;
+
+    std::shared_ptr<const matrix_type> get_l_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[0]);
+    }
+
+    std::shared_ptr<const matrix_type> get_u_factor() const
+    {
+        // Can be `static_cast` since the type is guaranteed in this class
+        return std::static_pointer_cast<const matrix_type>(
+            this->get_operators()[1]);
+    }
+
+    // Remove the possibility of calling `create`, which was enabled by
+    // `Composition`
+    template <typename... Args>
+    static std::unique_ptr<Composition<ValueType>> create(Args&&... args) =
+        delete;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The block size used to convert the system matrix to Fbcsr if it is
+         * not already stored in this format. For an Fbcsr system matrix, its
+         * own block size is used instead.
+         */
+        int GKO_FACTORY_PARAMETER_SCALAR(block_size, 1);
+
+        /**
+         * The `system_matrix`, which will be given to this factory, must be
+         * sorted (first by block row, then by block column) in order for the
+         * algorithm to work. If it is known that the matrix will be sorted,
+         * this parameter can be set to `true` to skip the sorting.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(BlockIlu, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    BlockIlu(const Factory* factory,
+             std::shared_ptr<const gko::LinOp> system_matrix)
+        : Composition<ValueType>{factory->get_executor()},
+          parameters_{factory->get_parameters()}
+    {
+        generate_l_u(system_matrix)->move_to(this);
+    }
+
+    /**
+     * Generates the block incomplete LU factors, which will be returned as a
+     * composition of the lower (first element of the composition) and the
+     * upper factor (second element), both of type matrix_type.
+     *
+     * @param system_matrix  the source matrix used to generate the factors.
+     *                       @note: system_matrix must be convertible to an
+     *                              Fbcsr matrix, otherwise, an exception is
+     *                              thrown.
+     * @return  A Composition, containing the block incomplete LU factors for
+     *          the given system_matrix (first element is L, then U)
+     */
+    std::unique_ptr<Composition<ValueType>> generate_l_u(
+        const std::shared_ptr<const LinOp>& system_matrix) const;
+};
+
+
+}  // namespace factorization
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_FACTORIZATION_BLOCK_ILU_HPP_
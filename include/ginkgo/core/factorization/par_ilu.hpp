@@ -66,7 +66,7 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlu : public Composition<ValueType> {
+class ParIlu : public Composition<ValueType>, public ValueUpdatable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -94,6 +94,18 @@ public:
     static std::unique_ptr<Composition<ValueType>> create(Args&&... args) =
         delete;
 
+    /**
+     * Recomputes the factors for a new system matrix, reusing the sparsity
+     * patterns of L and U. Since the factors are computed by the same
+     * fixed-point iteration as during the generation, the previous factors
+     * are not used as initial guess.
+     *
+     * @param new_matrix  the new system matrix, which needs to have the same
+     *                    size and sparsity pattern as the matrix the factors
+     *                    were generated from
+     */
+    void update_values(std::shared_ptr<const LinOp> new_matrix) override;
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -172,7 +184,13 @@ protected:
     std::unique_ptr<Composition<ValueType>> generate_l_u(
         const std::shared_ptr<const LinOp>& system_matrix, bool skip_sorting,
         std::shared_ptr<typename matrix_type::strategy_type> l_strategy,
-        std::shared_ptr<typename matrix_type::strategy_type> u_strategy) const;
+        std::shared_ptr<typename matrix_type::strategy_type> u_strategy);
+
+private:
+    uint64 pattern_hash_{};
+    // the matrix the factors were generated from, kept until its pattern is
+    // hashed by the first call to update_values
+    std::shared_ptr<const LinOp> pattern_source_;
 };
 
 
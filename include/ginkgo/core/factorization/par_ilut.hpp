@@ -24,6 +24,26 @@ namespace gko {
 namespace factorization {
 
 
+/**
+ * The algorithms ParIlut can use to compute the factors.
+ */
+enum class ilut_algorithm {
+    /**
+     * Improves the sparsity pattern and the values of the factors with
+     * fixed-point iterations, see ParIlut.
+     */
+    fixed_point,
+    /**
+     * Computes the factors row by row with the classical ILUT(p, tau)
+     * algorithm by Saad, which drops entries of each row below the
+     * `drop_tolerance` relative to the norm of the row of A and keeps only
+     * the largest entries of the lower and upper part of the row. Rows are
+     * computed in parallel as soon as all rows they depend on are finished.
+     */
+    row_wise
+};
+
+
 /**
  * ParILUT is an incomplete threshold-based LU factorization which is computed
  * in parallel.
@@ -57,6 +77,10 @@ namespace factorization {
  * This ParILUT algorithm thus improves the sparsity pattern and the
  * approximation of $L$ and $U$ simultaneously.
  *
+ * Alternatively, the factors can be computed with the classical row-wise
+ * ILUT(p, tau) algorithm with exact dual dropping (see ilut_algorithm), which
+ * needs no iterations and produces factors with comparable fill-in.
+ *
  * The implementation follows the design of H. Anzt et al.,
  * ParILUT - A Parallel Threshold ILU for GPUs, 2019 IEEE International
  * Parallel and Distributed Processing Symposium (IPDPS), pp. 231–241.
@@ -68,7 +92,7 @@ namespace factorization {
  * @ingroup LinOp
  */
 template <typename ValueType = default_precision, typename IndexType = int32>
-class ParIlut : public Composition<ValueType> {
+class ParIlut : public Composition<ValueType>, public ValueUpdatable {
 public:
     using value_type = ValueType;
     using index_type = IndexType;
@@ -96,6 +120,18 @@ public:
     static std::unique_ptr<Composition<ValueType>> create(Args&&... args) =
         delete;
 
+    /**
+     * Recomputes the factors for a new system matrix, reusing the sparsity
+     * patterns of L and U selected during the generation. No candidates are
+     * added or removed; instead, `iterations` fixed-point sweeps are executed
+     * on the fixed patterns, starting from the previous factors.
+     *
+     * @param new_matrix  the new system matrix, which needs to have the same
+     *                    size and sparsity pattern as the matrix the factors
+     *                    were generated from
+     */
+    void update_values(std::shared_ptr<const LinOp> new_matrix) override;
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -173,6 +209,35 @@ public:
          */
         double GKO_FACTORY_PARAMETER_SCALAR(fill_in_limit, 2.0);
 
+        /**
+         * @brief The algorithm used to compute the factors.
+         *
+         * With ilut_algorithm::row_wise, the `iterations`,
+         * `approximate_select` and `deterministic_sample` parameters are only
+         * used by update_values. The `fill_in_limit` is applied to each row
+         * instead of the whole factor: every row of L and U keeps at most
+         * `fill_in_limit` times as many entries as the same row of the
+         * ILU(0) factors.
+         *
+         * The default value is ilut_algorithm::fixed_point.
+         *
+         * @note ilut_algorithm::row_wise is only implemented for the
+         *       Reference and OpenMP executors.
+         */
+        ilut_algorithm GKO_FACTORY_PARAMETER_SCALAR(
+            algorithm, ilut_algorithm::fixed_point);
+
+        /**
+         * @brief The drop tolerance of ilut_algorithm::row_wise.
+         *
+         * Entries of a row whose magnitude is smaller than `drop_tolerance`
+         * times the 2-norm of the corresponding row of A are dropped.
+         *
+         * The default value is 0, i.e. only the `fill_in_limit` is used to
+         * drop entries.
+         */
+        double GKO_FACTORY_PARAMETER_SCALAR(drop_tolerance, 0.0);
+
         /**
          * Strategy which will be used by the L matrix. The default value
          * `nullptr` will result in the strategy `classical`.
@@ -220,7 +285,13 @@ protected:
      *          given system_matrix (first element is L, then U)
      */
     std::unique_ptr<Composition<ValueType>> generate_l_u(
-        const std::shared_ptr<const LinOp>& system_matrix) const;
+        const std::shared_ptr<const LinOp>& system_matrix);
+
+private:
+    uint64 pattern_hash_{};
+    // the matrix the factors were generated from, kept until its pattern is
+    // hashed by the first call to update_values
+    std::shared_ptr<const LinOp> pattern_source_;
 };
 
 
@@ -28,52 +28,55 @@ namespace detail {
 /**
  * Stores logging data for batch solver kernels.
  *
- * @note Supports only single rhs
+ * With multiple right hand sides, the values of right hand side `j` of batch
+ * item `i` are stored at index `i * num_rhs + j`.
  */
 template <typename ValueType>
 struct log_data final {
     using real_type = remove_complex<ValueType>;
 
-    log_data(std::shared_ptr<const Executor> exec, size_type num_batch_items)
+    log_data(std::shared_ptr<const Executor> exec, size_type num_batch_items,
+             size_type num_rhs = 1)
         : res_norms(exec), iter_counts(exec)
     {
-        const size_type workspace_size =
-            num_batch_items * (sizeof(real_type) + sizeof(int));
-        if (num_batch_items > 0) {
-            iter_counts.resize_and_reset(num_batch_items);
-            res_norms.resize_and_reset(num_batch_items);
+        if (num_batch_items > 0 && num_rhs > 0) {
+            iter_counts.resize_and_reset(num_batch_items * num_rhs);
+            res_norms.resize_and_reset(num_batch_items * num_rhs);
         } else {
             GKO_INVALID_STATE("Invalid num batch items passed in");
         }
     }
 
     log_data(std::shared_ptr<const Executor> exec, size_type num_batch_items,
-             array<unsigned char>& workspace)
+             array<unsigned char>& workspace, size_type num_rhs = 1)
         : res_norms(exec), iter_counts(exec)
     {
+        const size_type num_entries = num_batch_items * num_rhs;
         const size_type workspace_size =
-            num_batch_items * (sizeof(real_type) + sizeof(int));
-        if (num_batch_items > 0 && !workspace.is_owning() &&
+            num_entries * (sizeof(real_type) + sizeof(int));
+        if (num_entries > 0 && !workspace.is_owning() &&
             workspace.get_size() >= workspace_size) {
             iter_counts =
-                array<int>::view(exec, num_batch_items,
+                array<int>::view(exec, num_entries,
                                  reinterpret_cast<int*>(workspace.get_data()));
             res_norms = array<real_type>::view(
-                exec, num_batch_items,
+                exec, num_entries,
                 reinterpret_cast<real_type*>(workspace.get_data() +
-                                             (sizeof(int) * num_batch_items)));
+                                             (sizeof(int) * num_entries)));
         } else {
             GKO_INVALID_STATE("invalid workspace or num batch items passed in");
         }
     }
 
     /**
-     * Stores residual norm values for every linear system in the batch.
+     * Stores residual norm values for every linear system and right hand side
+     * in the batch.
      */
     array<real_type> res_norms;
 
     /**
-     * Stores convergence iteration counts for every matrix in the batch
+     * Stores convergence iteration counts for every linear system and right
+     * hand side in the batch
      */
     array<int> iter_counts;
 };
@@ -88,6 +91,10 @@ struct log_data final {
  * The purpose of this logger is to give simple access to standard data
  * generated by the solver once it has converged.
  *
+ * Each right hand side is tracked separately: for a batch with `num_rhs`
+ * right hand sides per item, the iteration count and residual norm of right
+ * hand side `j` of batch item `i` are stored at index `i * num_rhs + j`.
+ *
  * @note The final logged residuals are the implicit residuals that have been
  * computed within the solver process. Depending on the solver algorithm, this
  * may be significantly different from the true residual (||b - Ax||).
@@ -125,7 +132,8 @@ public:
     }
 
     /**
-     * @return  The number of iterations for entire batch
+     * @return  The number of iterations for every right hand side of the
+     *          entire batch
      */
     const array<int>& get_num_iterations() const noexcept
     {
@@ -133,7 +141,8 @@ public:
     }
 
     /**
-     * @return  The residual norms for the entire batch.
+     * @return  The residual norms for every right hand side of the entire
+     *          batch.
      */
     const array<real_type>& get_residual_norm() const noexcept
     {
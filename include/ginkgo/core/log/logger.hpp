@@ -580,6 +580,41 @@ protected:
         const array<int>& iters, const array<float>& residual_norms) const
     {}
 
+    /**
+     * Communication started event, emitted by the wrappers of
+     * experimental::mpi::communicator. Non-blocking communication is reported
+     * as two separate communications: posting it, named after the call, e.g.
+     * "i_send", and waiting for its completion in request::wait, named e.g.
+     * "i_send_wait". The transferred bytes are only reported for the wait,
+     * the posting reports zero bytes.
+     *
+     * @param exec  the executor on which the message buffers are located
+     * @param name  the name of the communication operation, e.g. "all_reduce"
+     * @param peer  the rank of the communication partner for point-to-point
+     *              communication, the root rank for rooted collectives, or -1
+     *              for collectives without a root
+     * @param send_bytes  the number of bytes sent by this rank
+     * @param recv_bytes  the number of bytes received by this rank
+     */
+    GKO_LOGGER_REGISTER_EVENT(27, communication_started, const Executor* exec,
+                              const char* name, int peer,
+                              size_type send_bytes, size_type recv_bytes)
+
+    /**
+     * Communication completed event.
+     *
+     * @param exec  the executor on which the message buffers are located
+     * @param name  the name of the communication operation, e.g. "all_reduce"
+     * @param peer  the rank of the communication partner for point-to-point
+     *              communication, the root rank for rooted collectives, or -1
+     *              for collectives without a root
+     * @param send_bytes  the number of bytes sent by this rank
+     * @param recv_bytes  the number of bytes received by this rank
+     */
+    GKO_LOGGER_REGISTER_EVENT(28, communication_completed, const Executor* exec,
+                              const char* name, int peer,
+                              size_type send_bytes, size_type recv_bytes)
+
 public:
 #undef GKO_LOGGER_REGISTER_EVENT
 
@@ -636,6 +671,12 @@ public:
     static constexpr mask_type criterion_events_mask =
         criterion_check_started_mask | criterion_check_completed_mask;
 
+    /**
+     * Bitset Mask which activates all communication events
+     */
+    static constexpr mask_type communication_events_mask =
+        communication_started_mask | communication_completed_mask;
+
     /**
      * Returns true if this logger, when attached to an Executor, needs to be
      * forwarded all events from objects on this executor.
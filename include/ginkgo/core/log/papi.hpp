@@ -50,6 +50,11 @@ static std::mutex papi_count_mutex;
  * + criterion_check_completed event: the residual norm is stored in a record
  *   (per criterion)
  * + iteration_complete event: the number of iteration is counted (per solver)
+ * + communication_started: number of bytes sent (received) per executor, in
+ *   communication_started_send (respectively communication_started_recv).
+ * + communication_completed: number of bytes sent (received) per executor, in
+ *   communication_completed_send (respectively
+ *   communication_completed_recv).
  *
  * @tparam ValueType  the type of values stored in the class (e.g. residuals)
  *
@@ -172,6 +177,15 @@ public:
         const LinOp* residual_norm,
         const LinOp* implicit_sq_residual_norm) const override;
 
+    /* Communication events */
+    void on_communication_started(const Executor* exec, const char* name,
+                                  int peer, size_type send_bytes,
+                                  size_type recv_bytes) const override;
+
+    void on_communication_completed(const Executor* exec, const char* name,
+                                    int peer, size_type send_bytes,
+                                    size_type recv_bytes) const override;
+
     /**
      * Creates a Papi Logger.
      *
@@ -332,6 +346,15 @@ private:
     mutable papi_queue<LinOp> iteration_complete{&papi_handle,
                                                  "iteration_complete"};
 
+    mutable papi_queue<Executor> communication_started_send{
+        &papi_handle, "communication_started_send"};
+    mutable papi_queue<Executor> communication_started_recv{
+        &papi_handle, "communication_started_recv"};
+    mutable papi_queue<Executor> communication_completed_send{
+        &papi_handle, "communication_completed_send"};
+    mutable papi_queue<Executor> communication_completed_recv{
+        &papi_handle, "communication_completed_recv"};
+
 
     std::string name{"ginkgo"};
     papi_handle_t papi_handle;
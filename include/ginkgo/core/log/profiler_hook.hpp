@@ -39,6 +39,8 @@ enum class profile_event_category {
     user,
     /** For development use. */
     internal,
+    /** Communication events. */
+    communication,
 };
 
 
@@ -152,6 +154,15 @@ public:
         const array<stopping_status>* status, const bool& one_changed,
         const bool& all_stopped) const override;
 
+    /* Communication events */
+    void on_communication_started(const Executor* exec, const char* name,
+                                  int peer, size_type send_bytes,
+                                  size_type recv_bytes) const override;
+
+    void on_communication_completed(const Executor* exec, const char* name,
+                                    int peer, size_type send_bytes,
+                                    size_type recv_bytes) const override;
+
     /* Internal solver events */
     void on_iteration_complete(
         const LinOp* solver, const LinOp* right_hand_side,
@@ -258,6 +269,16 @@ public:
         std::chrono::nanoseconds exclusive{0};
         /** The total number of invocations of the range. */
         int64 count{};
+        /**
+         * The estimated number of floating point operations of all invocations
+         * of the range, or 0 if no estimate is available.
+         */
+        int64 flops{};
+        /**
+         * The estimated number of bytes read and written by all invocations of
+         * the range, or 0 if no estimate is available.
+         */
+        int64 bytes{};
     };
 
     struct nested_summary_entry {
@@ -269,8 +290,41 @@ public:
         int64 count{};
         /** The nested ranges inside this range. */
         std::vector<nested_summary_entry> children{};
+        /**
+         * The estimated number of floating point operations of all invocations
+         * of the range, or 0 if no estimate is available.
+         */
+        int64 flops{};
+        /**
+         * The estimated number of bytes read and written by all invocations of
+         * the range, or 0 if no estimate is available.
+         */
+        int64 bytes{};
     };
 
+    /**
+     * The estimated amount of work of a single LinOp application, computed
+     * from the format, the number of stored elements and the value and index
+     * type sizes of the operator and its vectors.
+     */
+    struct work_estimate {
+        /** The number of floating point operations. */
+        int64 flops{};
+        /** The number of bytes read from and written to memory. */
+        int64 bytes{};
+    };
+
+    using work_hook_function = std::function<void(const work_estimate&)>;
+
+    /**
+     * Estimates the amount of work of x = A * b or x = alpha * A * b + beta * x
+     * (for advanced = true). Dense, Csr, Coo, Ell, Sellp, Hybrid, Fbcsr and
+     * Diagonal matrices are supported, for all other operators the estimate
+     * is empty.
+     */
+    static work_estimate estimate_apply_work(const LinOp* A, const LinOp* b,
+                                             const LinOp* x, bool advanced);
+
     /** Receives the results from ProfilerHook::create_summary(). */
     class SummaryWriter {
     public:
@@ -329,6 +383,37 @@ public:
         std::string header_;
     };
 
+    /**
+     * Writes the results from ProfilerHook::create_summary() and
+     * ProfilerHook::create_nested_summary() to a ASCII table in Markdown
+     * format, including the achieved floating point throughput and memory
+     * bandwidth of all ranges with a work estimate. Currently, these are the
+     * LinOp applications of the formats supported by estimate_apply_work and
+     * the MPI communication, where only the transferred bytes are counted.
+     */
+    class ThroughputSummaryWriter : public SummaryWriter,
+                                    public NestedSummaryWriter {
+    public:
+        /**
+         * Constructs a writer on an output stream.
+         *
+         * @param output  the output stream to write the table to.
+         * @param header  the header to write above the table.
+         */
+        ThroughputSummaryWriter(std::ostream& output = std::cerr,
+                                std::string header = "Throughput summary");
+
+        void write(const std::vector<summary_entry>& entries,
+                   std::chrono::nanoseconds overhead) override;
+
+        void write_nested(const nested_summary_entry& root,
+                          std::chrono::nanoseconds overhead) override;
+
+    private:
+        std::ostream* output_;
+        std::string header_;
+    };
+
     /**
      * Creates a logger measuring the runtime of Ginkgo events and printing a
      * summary when it is destroyed.
@@ -374,6 +459,29 @@ public:
             std::make_unique<TableSummaryWriter>(),
         bool debug_check_nesting = false);
 
+    /**
+     * Creates a logger recording the begin and end times of Ginkgo events on
+     * each thread and writing them to a file in the Chrome trace event JSON
+     * format when it is destroyed. The trace can be viewed in Perfetto or
+     * chrome://tracing. Every thread records into its own buffer, so
+     * recording needs no synchronization between threads.
+     *
+     * @param path  the path of the output file. It is opened immediately.
+     * @param sample_interval  only every sample_interval-th outermost range
+     *                         of each thread is recorded, together with all
+     *                         ranges nested inside it. The default value 1
+     *                         records all ranges.
+     * @param buffer_size  the maximum number of ranges stored per thread. If
+     *                     more ranges are recorded, the oldest ranges are
+     *                     overwritten.
+     *
+     * @note For this logger to provide reliable GPU timings, enable
+     *       synchronization via `set_synchronization(true)`.
+     */
+    static std::shared_ptr<ProfilerHook> create_trace_file(
+        std::string path, int64 sample_interval = 1,
+        size_type buffer_size = size_type{1} << 20);
+
     /**
      * Creates a logger annotating Ginkgo events with a custom set of functions
      * for range begin and end.
@@ -382,7 +490,8 @@ public:
                                                        hook_function end);
 
 private:
-    ProfilerHook(hook_function begin, hook_function end);
+    ProfilerHook(hook_function begin, hook_function end,
+                 work_hook_function work = {});
 
     void maybe_synchronize(const Executor* exec) const;
 
@@ -392,6 +501,7 @@ private:
     bool synchronize_;
     hook_function begin_hook_;
     hook_function end_hook_;
+    work_hook_function work_hook_;
 };
 
 
@@ -8,6 +8,7 @@
 
 #include <deque>
 #include <memory>
+#include <string>
 
 
 #include <ginkgo/core/log/logger.hpp>
@@ -81,6 +82,18 @@ struct executor_data {
 };
 
 
+/**
+ * Struct representing communication related data
+ */
+struct communication_data {
+    const Executor* exec;
+    const std::string name;
+    const int peer;
+    const size_type send_bytes;
+    const size_type recv_bytes;
+};
+
+
 /**
  * Struct representing Operator related data
  */
@@ -260,6 +273,10 @@ public:
 
         std::deque<std::unique_ptr<iteration_complete_data>>
             iteration_completed;
+
+        std::deque<std::unique_ptr<communication_data>> communication_started;
+        std::deque<std::unique_ptr<communication_data>>
+            communication_completed;
     };
 
     /* Executor events */
@@ -391,6 +408,15 @@ public:
         const LinOp* residual_norm,
         const LinOp* implicit_sq_residual_norm) const override;
 
+    /* Communication events */
+    void on_communication_started(const Executor* exec, const char* name,
+                                  int peer, size_type send_bytes,
+                                  size_type recv_bytes) const override;
+
+    void on_communication_completed(const Executor* exec, const char* name,
+                                    int peer, size_type send_bytes,
+                                    size_type recv_bytes) const override;
+
     /**
      * Creates a Record logger. This dynamically allocates the memory,
      * constructs the object and returns an std::unique_ptr to this object.
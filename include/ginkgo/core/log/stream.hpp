@@ -153,6 +153,15 @@ public:
         const LinOp* residual_norm,
         const LinOp* implicit_sq_residual_norm) const override;
 
+    /* Communication events */
+    void on_communication_started(const Executor* exec, const char* name,
+                                  int peer, size_type send_bytes,
+                                  size_type recv_bytes) const override;
+
+    void on_communication_completed(const Executor* exec, const char* name,
+                                    int peer, size_type send_bytes,
+                                    size_type recv_bytes) const override;
+
     /**
      * Creates a Stream logger. This dynamically allocates the memory,
      * constructs the object and returns an std::unique_ptr to this object.
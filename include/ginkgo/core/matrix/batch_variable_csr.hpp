@@ -0,0 +1,368 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_BATCH_VARIABLE_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_BATCH_VARIABLE_CSR_HPP_
+
+
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace matrix {
+
+
+/**
+ * VariableCsr is a batched CSR format in which every batch item has its own
+ * size and its own sparsity pattern. In contrast to batch::matrix::Csr, no
+ * pattern is shared between the items, so batches of systems coming from
+ * different cell types can be stored without padding the matrices.
+ *
+ * The items are stored one after another. `item_row_offsets` (of size
+ * `num_batch_items + 1`) holds the cumulative number of rows, and
+ * `item_nnz_offsets` (of size `num_batch_items + 1`) the cumulative number of
+ * stored elements of the items. The row pointers of item `i` are stored
+ * starting at position `item_row_offsets[i] + i` of the row pointer array and
+ * are local to the item, i.e. they start at zero.
+ *
+ * The common size of the batch is the size of the largest item. Batch
+ * multi-vectors applied to this matrix use this common size, and an item with
+ * `n` rows only reads and writes the first `n` rows of the corresponding
+ * multi-vector item.
+ *
+ * @note All the batch items need to be square.
+ *
+ * @note Currently only IndexType of int32 is supported.
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of matrix elements
+ *
+ * @ingroup batch_variable_csr
+ * @ingroup mat_formats
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class VariableCsr final
+    : public EnableBatchLinOp<VariableCsr<ValueType, IndexType>>,
+      public ConvertibleTo<VariableCsr<next_precision<ValueType>, IndexType>> {
+    friend class EnablePolymorphicObject<VariableCsr, BatchLinOp>;
+    friend class VariableCsr<to_complex<ValueType>, IndexType>;
+    friend class VariableCsr<next_precision<ValueType>, IndexType>;
+    static_assert(std::is_same<IndexType, int32>::value,
+                  "IndexType must be a 32 bit integer");
+
+public:
+    using EnableBatchLinOp<VariableCsr>::convert_to;
+    using EnableBatchLinOp<VariableCsr>::move_to;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using unbatch_type = gko::matrix::Csr<value_type, index_type>;
+    using absolute_type = remove_complex<VariableCsr>;
+    using complex_type = to_complex<VariableCsr>;
+
+    void convert_to(VariableCsr<next_precision<ValueType>, IndexType>* result)
+        const override;
+
+    void move_to(
+        VariableCsr<next_precision<ValueType>, IndexType>* result) override;
+
+    /**
+     * Creates a mutable view (of matrix::Csr type) of one item of the batch.
+     * Does not perform any deep copies, but only returns a view of the data.
+     *
+     * @param item_id  The index of the batch item
+     *
+     * @return  a matrix::Csr object with the data from the batch item at the
+     *          given index.
+     */
+    std::unique_ptr<unbatch_type> create_view_for_item(size_type item_id);
+
+    /**
+     * @copydoc create_view_for_item(size_type)
+     */
+    std::unique_ptr<const unbatch_type> create_const_view_for_item(
+        size_type item_id) const;
+
+    /**
+     * Returns the size of one batch item.
+     *
+     * @param item_id  The index of the batch item
+     *
+     * @return the size of the batch item
+     */
+    dim<2> get_item_size(size_type item_id) const;
+
+    /**
+     * Returns the number of elements stored in one batch item.
+     *
+     * @param item_id  The index of the batch item
+     *
+     * @return the number of elements stored in the batch item
+     */
+    size_type get_num_elements_for_item(size_type item_id) const;
+
+    /**
+     * Returns the largest number of elements stored in any batch item.
+     *
+     * @return the largest number of elements stored in any batch item
+     */
+    size_type get_max_num_elements_per_item() const noexcept
+    {
+        return max_num_elements_per_item_;
+    }
+
+    /**
+     * Returns a pointer to the array of values of the matrix
+     *
+     * @return the pointer to the array of values
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns a pointer to the array of column indices of the matrix
+     *
+     * @return the pointer to the array of column indices
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc get_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns a pointer to the array of (item-local) row pointers of the
+     * matrix
+     *
+     * @return the pointer to the array of row pointers
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns a pointer to the cumulative row counts of the batch items.
+     *
+     * @return the pointer to the array of item row offsets
+     */
+    const index_type* get_const_item_row_offsets() const noexcept
+    {
+        return item_row_offsets_.get_const_data();
+    }
+
+    /**
+     * Returns a pointer to the cumulative stored element counts of the batch
+     * items.
+     *
+     * @return the pointer to the array of item nonzero offsets
+     */
+    const index_type* get_const_item_nnz_offsets() const noexcept
+    {
+        return item_nnz_offsets_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the batch matrix,
+     * cumulative across all the batch items.
+     *
+     * @return the number of elements explicitly stored in the matrix,
+     *         cumulative across all the batch items
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Creates an empty VariableCsr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<VariableCsr> create(
+        std::shared_ptr<const Executor> exec);
+
+    /**
+     * Creates a VariableCsr matrix from already allocated (and initialized)
+     * arrays.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param num_batch_items  the number of batch items
+     * @param values  the values of all batch items, stored one after another
+     * @param col_idxs  the column indices of all batch items, stored one after
+     *                  another
+     * @param row_ptrs  the item-local row pointers of all batch items, stored
+     *                  one after another
+     * @param item_row_offsets  the cumulative number of rows of the items
+     * @param item_nnz_offsets  the cumulative number of stored elements of the
+     *                          items
+     *
+     * @note If the arrays are not rvalues or are on the wrong executor, an
+     *       internal copy will be created, and the original array data will
+     *       not be used in the matrix.
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<VariableCsr> create(
+        std::shared_ptr<const Executor> exec, size_type num_batch_items,
+        array<value_type> values, array<index_type> col_idxs,
+        array<index_type> row_ptrs, array<index_type> item_row_offsets,
+        array<index_type> item_nnz_offsets);
+
+    /**
+     * Creates a VariableCsr matrix by copying a list of (square) matrices
+     * that may have different sizes and sparsity patterns.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param items  the matrices forming the batch items
+     *
+     * @return A smart pointer to the newly created matrix.
+     */
+    static std::unique_ptr<VariableCsr> create_from_items(
+        std::shared_ptr<const Executor> exec,
+        const std::vector<const unbatch_type*>& items);
+
+    /**
+     * Creates a constant (immutable) VariableCsr matrix from constant arrays.
+     *
+     * @param exec  the executor to create the matrix on
+     * @param num_batch_items  the number of batch items
+     * @param values  the value array of the matrix
+     * @param col_idxs  the column index array of the matrix
+     * @param row_ptrs  the item-local row pointer array of the matrix
+     * @param item_row_offsets  the cumulative number of rows of the items
+     * @param item_nnz_offsets  the cumulative number of stored elements of the
+     *                          items
+     *
+     * @return A smart pointer to the constant matrix wrapping the input
+     * arrays (if they reside on the same executor as the matrix) or a copy of
+     * the arrays on the correct executor.
+     */
+    static std::unique_ptr<const VariableCsr> create_const(
+        std::shared_ptr<const Executor> exec, size_type num_batch_items,
+        gko::detail::const_array_view<value_type>&& values,
+        gko::detail::const_array_view<index_type>&& col_idxs,
+        gko::detail::const_array_view<index_type>&& row_ptrs,
+        gko::detail::const_array_view<index_type>&& item_row_offsets,
+        gko::detail::const_array_view<index_type>&& item_nnz_offsets);
+
+    /**
+     * Apply the matrix to a multi-vector. Represents the matrix vector
+     * multiplication, x = A * b, where x and b are both multi-vectors.
+     *
+     * @param b  the multi-vector to be applied to
+     * @param x  the output multi-vector
+     *
+     * @note Rows of x beyond the size of the respective batch item are set to
+     *       zero.
+     */
+    VariableCsr* apply(ptr_param<const MultiVector<value_type>> b,
+                       ptr_param<MultiVector<value_type>> x);
+
+    /**
+     * Apply the matrix to a multi-vector with a linear combination of the given
+     * input vector. Represents the matrix vector multiplication, x = alpha * A
+     * * b + beta * x, where x and b are both multi-vectors.
+     *
+     * @param alpha  the scalar to scale the matrix-vector product with
+     * @param b      the multi-vector to be applied to
+     * @param beta   the scalar to scale the x vector with
+     * @param x      the output multi-vector
+     *
+     * @note Rows of x beyond the size of the respective batch item are only
+     *       scaled by beta.
+     */
+    VariableCsr* apply(ptr_param<const MultiVector<value_type>> alpha,
+                       ptr_param<const MultiVector<value_type>> b,
+                       ptr_param<const MultiVector<value_type>> beta,
+                       ptr_param<MultiVector<value_type>> x);
+
+    /**
+     * @copydoc apply(const MultiVector<value_type>*, MultiVector<value_type>*)
+     */
+    const VariableCsr* apply(ptr_param<const MultiVector<value_type>> b,
+                             ptr_param<MultiVector<value_type>> x) const;
+
+    /**
+     * @copydoc apply(const MultiVector<value_type>*, const
+     * MultiVector<value_type>*, const MultiVector<value_type>*,
+     * MultiVector<value_type>*)
+     */
+    const VariableCsr* apply(ptr_param<const MultiVector<value_type>> alpha,
+                             ptr_param<const MultiVector<value_type>> b,
+                             ptr_param<const MultiVector<value_type>> beta,
+                             ptr_param<MultiVector<value_type>> x) const;
+
+private:
+    VariableCsr(std::shared_ptr<const Executor> exec);
+
+    VariableCsr(std::shared_ptr<const Executor> exec, size_type num_batch_items,
+                array<value_type> values, array<index_type> col_idxs,
+                array<index_type> row_ptrs, array<index_type> item_row_offsets,
+                array<index_type> item_nnz_offsets);
+
+    void apply_impl(const MultiVector<value_type>* b,
+                    MultiVector<value_type>* x) const;
+
+    void apply_impl(const MultiVector<value_type>* alpha,
+                    const MultiVector<value_type>* b,
+                    const MultiVector<value_type>* beta,
+                    MultiVector<value_type>* x) const;
+
+    array<value_type> values_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+    array<index_type> item_row_offsets_;
+    array<index_type> item_nnz_offsets_;
+    size_type max_num_elements_per_item_;
+};
+
+
+}  // namespace matrix
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_BATCH_VARIABLE_CSR_HPP_
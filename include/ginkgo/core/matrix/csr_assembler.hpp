@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_CSR_ASSEMBLER_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_CSR_ASSEMBLER_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * CsrAssembler adds values into a Csr matrix with a fixed sparsity pattern.
+ *
+ * This is intended for finite element codes that repeatedly assemble a matrix
+ * with the same sparsity pattern, e.g. the Jacobian in every Newton step.
+ * Instead of collecting the entries in a matrix_assembly_data or
+ * matrix_data object and building a new matrix from it, the contributions are
+ * added directly into the values of the existing matrix. The assembler builds
+ * a lookup structure for the sparsity pattern once, which finds the storage
+ * location of an entry in (nearly) constant time. The contributions are added
+ * in parallel, conflicting updates to the same entry are resolved by atomic
+ * additions.
+ *
+ * The sparsity pattern can either be provided as an existing Csr matrix with
+ * sorted column indices, or computed from the element connectivity: every
+ * pair of degrees of freedom that share an element is coupled. In the latter
+ * case, each thread collects and sorts the couplings of its elements, and the
+ * per-thread patterns are merged row-by-row in parallel.
+ *
+ * ```cpp
+ * // element_dofs stores the degrees of freedom of each element
+ * auto assembler = gko::matrix::CsrAssembler<double, int>::create(
+ *     exec, gko::dim<2>{num_dofs}, element_dofs, dofs_per_element);
+ * auto A = assembler->get_matrix();
+ * while (!converged) {
+ *     // element_matrices stores a dense row-major matrix per element
+ *     assembler->zero_values();
+ *     assembler->add_elements(element_dofs, element_matrices,
+ *                             dofs_per_element);
+ *     solver->generate(A)->apply(residual, update);
+ * }
+ * ```
+ *
+ * @note Only the reference and OpenMP executors implement the assembly.
+ *
+ * @tparam ValueType  the value type of the matrix
+ * @tparam IndexType  the index type of the matrix
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class CsrAssembler {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = Csr<ValueType, IndexType>;
+
+    /**
+     * Creates an assembler for the sparsity pattern of the given matrix.
+     * The assembler adds values to this matrix, so changes to its values are
+     * visible to all users of the matrix.
+     *
+     * @param mtx  the matrix to assemble into. Its column indices need to be
+     *             sorted.
+     */
+    static std::unique_ptr<CsrAssembler> create(
+        std::shared_ptr<matrix_type> mtx);
+
+    /**
+     * Creates an assembler together with a matrix whose sparsity pattern
+     * consists of all couplings between degrees of freedom that share an
+     * element. The values of the matrix are initialized to zero.
+     *
+     * @param exec  the executor to create the matrix on
+     * @param size  the size of the matrix
+     * @param element_dofs  the degrees of freedom of all elements, stored
+     *                      consecutively with dofs_per_element entries per
+     *                      element. Negative entries are ignored, which can
+     *                      be used for eliminated degrees of freedom or
+     *                      elements with fewer degrees of freedom.
+     * @param dofs_per_element  the number of degrees of freedom per element
+     *
+     * @throws OutOfBoundsError  if a degree of freedom exceeds the matrix size
+     */
+    static std::unique_ptr<CsrAssembler> create(
+        std::shared_ptr<const Executor> exec, dim<2> size,
+        const array<index_type>& element_dofs, size_type dofs_per_element);
+
+    /** Returns the matrix the assembler adds values to. */
+    std::shared_ptr<matrix_type> get_matrix() const { return mtx_; }
+
+    /** Sets all values of the matrix to zero. */
+    void zero_values();
+
+    /**
+     * Adds dense element matrices into the matrix. For each element e and
+     * each pair (i, j) of local degrees of freedom, the value
+     * `element_values[(e * dofs_per_element + i) * dofs_per_element + j]` is
+     * added to the entry (element_dofs[e * dofs_per_element + i],
+     * element_dofs[e * dofs_per_element + j]).
+     *
+     * @param element_dofs  the degrees of freedom of all elements, stored
+     *                      consecutively with dofs_per_element entries per
+     *                      element. Negative entries are ignored.
+     * @param element_values  the row-major element matrices, stored
+     *                        consecutively with dofs_per_element^2 entries
+     *                        per element
+     * @param dofs_per_element  the number of degrees of freedom per element
+     *
+     * @throws OutOfBoundsError  if a degree of freedom exceeds the matrix
+     *                           size. The bounds are checked while adding,
+     *                           so the entries within bounds have been added
+     *                           when the error is thrown.
+     *
+     * @note Entries outside the sparsity pattern are ignored.
+     */
+    void add_elements(const array<index_type>& element_dofs,
+                      const array<value_type>& element_values,
+                      size_type dofs_per_element);
+
+    /**
+     * Adds individual values into the matrix. Duplicate entries are summed.
+     *
+     * @param row_idxs  the row indices of the entries
+     * @param col_idxs  the column indices of the entries
+     * @param values  the values to add
+     *
+     * @throws OutOfBoundsError  if a row or column index exceeds the matrix
+     *                           size. The bounds are checked while adding,
+     *                           so the entries within bounds have been added
+     *                           when the error is thrown.
+     *
+     * @note Entries outside the sparsity pattern are ignored.
+     */
+    void add_values(const array<index_type>& row_idxs,
+                    const array<index_type>& col_idxs,
+                    const array<value_type>& values);
+
+private:
+    explicit CsrAssembler(std::shared_ptr<matrix_type> mtx);
+
+    std::shared_ptr<matrix_type> mtx_;
+    array<index_type> storage_offsets_;
+    array<int64> row_descs_;
+    array<int32> storage_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_CSR_ASSEMBLER_HPP_
@@ -0,0 +1,249 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+/**
+ * The 16-bit floating point formats a ReducedCsr matrix can store its values
+ * in.
+ */
+enum class reduced_storage {
+    /**
+     * IEEE 754 half precision: 5 exponent bits and 10 significand bits.
+     * Values with a magnitude above 65504 overflow to infinity.
+     */
+    float16,
+    /**
+     * bfloat16: 8 exponent bits and 7 significand bits. It has the same range
+     * as single precision, but only about 3 significant decimal digits.
+     */
+    bfloat16
+};
+
+
+/**
+ * ReducedCsr is a compressed sparse row matrix that stores its values in a
+ * 16-bit floating point format, while all arithmetic is carried out in
+ * ValueType.
+ *
+ * Compared to a Csr matrix in single precision, this halves the memory
+ * footprint of the values, which reduces the memory traffic of the
+ * memory-bound SpMV. The values are converted to ValueType on the fly, so the
+ * accumulation happens in (at least) single precision. This makes the format
+ * suitable for operators that only need to be applied approximately, e.g.
+ * inside preconditioners or inner solvers of mixed-precision methods.
+ *
+ * The matrix is usually created from an existing matrix, whose values are
+ * rounded to the storage format. Converting it back to Csr yields the rounded
+ * values.
+ *
+ * @note Only the reference and OpenMP executors implement this format.
+ *
+ * @tparam ValueType  precision of the arithmetic and of vectors in apply
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = float, typename IndexType = int32>
+class ReducedCsr : public EnableLinOp<ReducedCsr<ValueType, IndexType>>,
+                   public ConvertibleTo<Csr<ValueType, IndexType>>,
+                   public ReadableFromMatrixData<ValueType, IndexType>,
+                   public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<ReducedCsr, LinOp>;
+
+public:
+    using EnableLinOp<ReducedCsr>::convert_to;
+    using EnableLinOp<ReducedCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    /**
+     * Returns the format the values are stored in.
+     *
+     * @return the format the values are stored in
+     */
+    reduced_storage get_storage() const noexcept { return storage_; }
+
+    /**
+     * Returns the bit patterns of the stored values of the matrix, encoded in
+     * the format returned by get_storage().
+     *
+     * @return the encoded values of the matrix.
+     */
+    uint16* get_packed_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc ReducedCsr::get_packed_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const uint16* get_const_packed_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes of the matrix.
+     *
+     * @return the column indexes of the matrix.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc ReducedCsr::get_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the matrix.
+     *
+     * @return the row pointers of the matrix.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc ReducedCsr::get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Creates an empty ReducedCsr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param storage  the format the values are stored in
+     */
+    static std::unique_ptr<ReducedCsr> create(
+        std::shared_ptr<const Executor> exec,
+        reduced_storage storage = reduced_storage::float16);
+
+    /**
+     * Creates a ReducedCsr matrix from an existing matrix, rounding its values
+     * to the storage format.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param matrix  the input matrix, which needs to be convertible to
+     *                Csr<ValueType, IndexType>
+     * @param storage  the format the values are stored in
+     */
+    static std::unique_ptr<ReducedCsr> create(
+        std::shared_ptr<const Executor> exec, const LinOp* matrix,
+        reduced_storage storage = reduced_storage::float16);
+
+    /**
+     * Copy-assigns a ReducedCsr matrix. Preserves executor, copies everything
+     * else.
+     */
+    ReducedCsr& operator=(const ReducedCsr&);
+
+    /**
+     * Move-assigns a ReducedCsr matrix. Preserves executor, moves the data and
+     * leaves the moved-from object in an empty state (0x0 LinOp with unchanged
+     * executor, no nonzeros and valid row pointers).
+     */
+    ReducedCsr& operator=(ReducedCsr&&);
+
+    /**
+     * Copy-constructs a ReducedCsr matrix. Inherits executor and data.
+     */
+    ReducedCsr(const ReducedCsr&);
+
+    /**
+     * Move-constructs a ReducedCsr matrix. Inherits executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    ReducedCsr(ReducedCsr&&);
+
+protected:
+    ReducedCsr(std::shared_ptr<const Executor> exec,
+               reduced_storage storage = reduced_storage::float16);
+
+    /**
+     * Replaces the content of this matrix by the rounded values and the
+     * sparsity pattern of the given Csr matrix.
+     */
+    void compress(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    reduced_storage storage_;
+    array<uint16> values_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_REDUCED_CSR_HPP_
@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_SPMV_AUTOTUNER_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_SPMV_AUTOTUNER_HPP_
+
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/utils_helper.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+/**
+ * SpmvAutotuner selects the sparse matrix format and SpMV strategy that is
+ * fastest for a specific matrix on a specific executor.
+ *
+ * Instead of relying on fixed heuristics, it converts the matrix to each of
+ * the candidate formats and times a few SpMVs with each of them on the
+ * matrix' executor. The winner is stored in a cache keyed by the executor
+ * type, the value and index type and a fingerprint of the matrix: its size,
+ * number of nonzeros and a histogram of its row lengths in power-of-two
+ * buckets. Matrices with the same fingerprint reuse the cached decision
+ * without running any benchmarks. If a cache file is provided, the decisions
+ * are loaded from it on construction and written back after every new
+ * decision, so they persist between runs of an application.
+ *
+ * The candidates are identified by names, which the SpMV benchmarks use as
+ * well:
+ *
+ * - `csr`: Csr with the automatical strategy
+ * - `csri`: Csr with the load_balance strategy
+ * - `csrm`: Csr with the merge_path strategy
+ * - `csrc`: Csr with the classical strategy
+ * - `csrs`: Csr with the sparselib strategy
+ * - `coo`: Coo
+ * - `ell`: Ell, skipped if the longest row exceeds the average row length by
+ *   more than the ELL imbalance limit
+ * - `sellp`: Sellp with the default slice size
+ * - `hybrid`: Hybrid with the automatic strategy
+ * - `hybrid0`, `hybrid25`, `hybrid33`, `hybrid40`, `hybrid60`, `hybrid80`:
+ *   Hybrid with the imbalance_limit strategy for the given percentage
+ * - `hybridlimit0`, `hybridlimit25`, `hybridlimit33`: Hybrid with the
+ *   imbalance_bounded_limit strategy for the given percentage
+ * - `hybridminstorage`: Hybrid with the minimal_storage_limit strategy
+ *
+ * The `csr` and `csri` strategies fall back to the classical strategy on
+ * executors that don't support them.
+ *
+ * ```cpp
+ * gko::matrix::SpmvAutotuner<double, int> tuner{"spmv_cache.txt"};
+ * // converts A to the best format, benchmarking only on a cache miss
+ * std::shared_ptr<gko::LinOp> A_tuned = tuner.generate(A);
+ * solver_factory->generate(A_tuned)->apply(b, x);
+ * ```
+ *
+ * @tparam ValueType  the value type of the matrices
+ * @tparam IndexType  the index type of the matrices
+ *
+ * @ingroup mat_formats
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class SpmvAutotuner {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using csr = Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the candidate formats used by default: all Csr strategies,
+     * Coo, Ell, Sellp and the Hybrid strategies with distinct behavior.
+     */
+    static std::vector<std::string> get_default_candidates();
+
+    /**
+     * Creates an autotuner.
+     *
+     * @param cache_path  the file the decisions are persisted in. If it is
+     *                    empty, the decisions are only cached in memory.
+     * @param candidates  the names of the candidate formats
+     * @param num_repetitions  the number of timed SpMVs per candidate, after
+     *                         a single warmup SpMV
+     * @param ell_imbalance_limit  the maximal ratio between the longest and
+     *                             the average row length for which the ELL
+     *                             format is considered. Negative values
+     *                             mean no limit.
+     */
+    explicit SpmvAutotuner(
+        std::string cache_path = {},
+        std::vector<std::string> candidates = get_default_candidates(),
+        int num_repetitions = 5, double ell_imbalance_limit = 100.0);
+
+    /**
+     * Returns the name of the fastest candidate format for the given matrix.
+     * On a cache miss, all candidates are benchmarked on the matrix'
+     * executor and the result is stored in the cache.
+     *
+     * @param mtx  the matrix to select a format for
+     * @return the name of the selected format
+     */
+    std::string select(ptr_param<const csr> mtx);
+
+    /**
+     * Converts the given matrix to the fastest candidate format.
+     *
+     * @param mtx  the matrix to convert
+     * @return a copy of the matrix in the selected format on the matrix'
+     *         executor
+     */
+    std::unique_ptr<LinOp> generate(ptr_param<const csr> mtx);
+
+    /**
+     * Returns the names of all formats the autotuner knows.
+     */
+    static std::vector<std::string> get_formats();
+
+    /**
+     * Creates an empty matrix in the format with the given name.
+     *
+     * @param exec  the executor of the matrix
+     * @param format  the name of the format, see the class documentation
+     * @return an empty matrix in the given format, with the strategy set
+     *
+     * @throws InvalidStateError  if the format name is unknown
+     */
+    static std::unique_ptr<LinOp> create_format(
+        std::shared_ptr<const Executor> exec, const std::string& format);
+
+    /**
+     * Converts the given matrix to the format with the given name.
+     *
+     * @param mtx  the matrix to convert
+     * @param format  the name of the format, see the class documentation
+     * @return a copy of the matrix in the given format
+     *
+     * @throws InvalidStateError  if the format name is unknown
+     */
+    static std::unique_ptr<LinOp> convert(ptr_param<const csr> mtx,
+                                          const std::string& format);
+
+    /**
+     * Returns the cache key of the given matrix, consisting of the executor
+     * type with its device id, or its number of threads for OpenMP, the value
+     * and index type and the fingerprint of the matrix.
+     */
+    static std::string get_key(ptr_param<const csr> mtx);
+
+    /** Returns the file the decisions are persisted in, if any. */
+    const std::string& get_cache_path() const { return cache_path_; }
+
+    /** Returns a copy of the cache, mapping keys to format names. */
+    std::map<std::string, std::string> get_cache() const;
+
+private:
+    void load_cache();
+
+    void store_cache() const;
+
+    std::string cache_path_;
+    std::vector<std::string> candidates_;
+    int num_repetitions_;
+    double ell_imbalance_limit_;
+    mutable std::mutex mutex_;
+    std::map<std::string, std::string> cache_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_SPMV_AUTOTUNER_HPP_
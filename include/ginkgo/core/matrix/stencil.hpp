@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+template <typename ValueType>
+class Diagonal;
+
+
+/**
+ * The stencils a Stencil operator can apply. The 2D stencils are defined on
+ * grids with a single point in z-direction.
+ */
+enum class stencil_type {
+    /** 2D stencil coupling each point to its 4 direct neighbors. */
+    five_point,
+    /** 2D stencil coupling each point to all 8 neighbors of its 3x3 box. */
+    nine_point,
+    /** 3D stencil coupling each point to its 6 direct neighbors. */
+    seven_point,
+    /** 3D stencil coupling each point to all 26 neighbors of its 3x3x3 box. */
+    twenty_seven_point
+};
+
+
+/**
+ * Stencil is a matrix-free operator for structured 2D and 3D grids. It
+ * represents the matrix that applies the same stencil to every point of an
+ * `nx x ny x nz` grid, where the points are numbered lexicographically with
+ * x running fastest, i.e. the point `(ix, iy, iz)` corresponds to the row
+ * `ix + nx * (iy + ny * iz)`. Neighbors outside of the grid are dropped
+ * (homogeneous Dirichlet boundary), like in an explicitly assembled matrix.
+ *
+ * Instead of column indexes and a value for every nonzero, the operator only
+ * stores the stencil coefficients. They are either constant, i.e. one
+ * coefficient per stencil point, or variable, i.e. one coefficient per
+ * stencil point and grid point. The stencil points are ordered
+ * lexicographically by their (z, y, x) offset, which is the column order of
+ * an interior row. Variable coefficients are stored point by point: the
+ * coefficient of stencil point `p` for row `i` is stored at
+ * `p * num_rows + i`.
+ *
+ * As only the vectors need to be read and written, the apply is considerably
+ * faster than a Csr SpMV of the same matrix. Preconditioners and
+ * factorizations that need an explicit matrix can use the conversion to Csr.
+ *
+ * @note Only the reference and OpenMP executors implement this operator.
+ *
+ * @tparam ValueType  precision of the coefficients
+ * @tparam IndexType  precision of the matrix indexes when converting to Csr
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Stencil : public EnableLinOp<Stencil<ValueType, IndexType>>,
+                public ConvertibleTo<Csr<ValueType, IndexType>>,
+                public DiagonalExtractable<ValueType>,
+                public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<Stencil, LinOp>;
+
+public:
+    using EnableLinOp<Stencil>::convert_to;
+    using EnableLinOp<Stencil>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void write(mat_data& data) const override;
+
+    std::unique_ptr<Diagonal<ValueType>> extract_diagonal() const override;
+
+    /**
+     * Returns the number of grid points in x-, y- and z-direction.
+     *
+     * @return the size of the grid
+     */
+    dim<3> get_grid_size() const noexcept { return grid_size_; }
+
+    /**
+     * Returns the stencil applied by this operator.
+     *
+     * @return the stencil type
+     */
+    stencil_type get_stencil_type() const noexcept { return type_; }
+
+    /**
+     * Returns the number of points of the stencil, e.g. 5 for a five-point
+     * stencil.
+     *
+     * @return the number of stencil points
+     */
+    size_type get_num_points() const noexcept;
+
+    /**
+     * Returns whether the coefficients vary between grid points.
+     *
+     * @return true if there is one set of coefficients per grid point, false
+     *         if all grid points use the same coefficients
+     */
+    bool has_variable_coefficients() const noexcept
+    {
+        return coefficients_.get_size() > this->get_num_points();
+    }
+
+    /**
+     * Returns the stencil coefficients.
+     *
+     * @return the stencil coefficients
+     */
+    value_type* get_coefficients() noexcept
+    {
+        return coefficients_.get_data();
+    }
+
+    /**
+     * @copydoc Stencil::get_coefficients()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_coefficients() const noexcept
+    {
+        return coefficients_.get_const_data();
+    }
+
+    /**
+     * Returns the number of stored coefficients.
+     *
+     * @return the number of stored coefficients
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return coefficients_.get_size();
+    }
+
+    /**
+     * Creates an empty Stencil operator.
+     *
+     * @param exec  Executor associated to the operator
+     */
+    static std::unique_ptr<Stencil> create(
+        std::shared_ptr<const Executor> exec);
+
+    /**
+     * Creates a Stencil operator from the given coefficients.
+     *
+     * @param exec  Executor associated to the operator
+     * @param grid_size  the number of grid points in x-, y- and z-direction.
+     *                   For 2D stencils, the z-size needs to be 1.
+     * @param type  the stencil to apply
+     * @param coefficients  the stencil coefficients, either one per stencil
+     *                      point (constant coefficients) or one per stencil
+     *                      point and grid point (variable coefficients)
+     */
+    static std::unique_ptr<Stencil> create(
+        std::shared_ptr<const Executor> exec, dim<3> grid_size,
+        stencil_type type, array<value_type> coefficients);
+
+    /**
+     * Creates a Stencil operator with constant coefficients, where the
+     * center coefficient is the number of neighbors and all other
+     * coefficients are -1. This is the same matrix as the stencil matrices
+     * generated by the benchmarks.
+     *
+     * @param exec  Executor associated to the operator
+     * @param grid_size  the number of grid points in x-, y- and z-direction.
+     *                   For 2D stencils, the z-size needs to be 1.
+     * @param type  the stencil to apply
+     */
+    static std::unique_ptr<Stencil> create_laplacian(
+        std::shared_ptr<const Executor> exec, dim<3> grid_size,
+        stencil_type type);
+
+    /**
+     * Copy-assigns a Stencil operator. Preserves executor, copies everything
+     * else.
+     */
+    Stencil& operator=(const Stencil&);
+
+    /**
+     * Move-assigns a Stencil operator. Preserves executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor and empty grid).
+     */
+    Stencil& operator=(Stencil&&);
+
+    /**
+     * Copy-constructs a Stencil operator. Inherits executor and data.
+     */
+    Stencil(const Stencil&);
+
+    /**
+     * Move-constructs a Stencil operator. Inherits executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor and empty grid).
+     */
+    Stencil(Stencil&&);
+
+protected:
+    Stencil(std::shared_ptr<const Executor> exec, dim<3> grid_size = {},
+            stencil_type type = stencil_type::five_point,
+            array<value_type> coefficients = {});
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    dim<3> grid_size_;
+    stencil_type type_;
+    array<value_type> coefficients_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_STENCIL_HPP_
@@ -0,0 +1,231 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+#define GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+
+
+namespace gko {
+namespace matrix {
+
+
+template <typename ValueType, typename IndexType>
+class Csr;
+
+
+template <typename ValueType>
+class Dense;
+
+
+template <typename ValueType>
+class Diagonal;
+
+
+/**
+ * SymmetricCsr is a compressed sparse row matrix for symmetric (Hermitian for
+ * complex value types) matrices, which only stores the upper triangle
+ * including the diagonal.
+ *
+ * Compared to storing both triangles in a Csr matrix, this roughly halves the
+ * memory footprint and the memory traffic of the SpMV, which is memory-bound.
+ * Each stored off-diagonal entry a_ij is used both for row i and, conjugated,
+ * for row j of the product, so every nonzero is only read once per product.
+ *
+ * The matrix is usually created from a Csr matrix, or read from matrix data.
+ * In both cases, only the entries on and above the diagonal are used, the
+ * strictly lower triangle is assumed to be the (conjugate) transpose of the
+ * strictly upper triangle and ignored. Converting the matrix to Csr yields
+ * the full matrix with both triangles, which makes it usable with all
+ * factorizations and preconditioners taking a Csr matrix, like Cholesky or
+ * Ic.
+ *
+ * @note Only the reference and OpenMP executors implement this format.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indexes
+ *
+ * @ingroup mat_formats
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class SymmetricCsr
+    : public EnableLinOp<SymmetricCsr<ValueType, IndexType>>,
+      public ConvertibleTo<Csr<ValueType, IndexType>>,
+      public DiagonalExtractable<ValueType>,
+      public ReadableFromMatrixData<ValueType, IndexType>,
+      public WritableToMatrixData<ValueType, IndexType> {
+    friend class EnablePolymorphicObject<SymmetricCsr, LinOp>;
+
+public:
+    using EnableLinOp<SymmetricCsr>::convert_to;
+    using EnableLinOp<SymmetricCsr>::move_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::convert_to;
+    using ConvertibleTo<Csr<ValueType, IndexType>>::move_to;
+    using ReadableFromMatrixData<ValueType, IndexType>::read;
+
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using mat_data = matrix_data<ValueType, IndexType>;
+    using device_mat_data = device_matrix_data<ValueType, IndexType>;
+
+    void convert_to(Csr<ValueType, IndexType>* result) const override;
+
+    void move_to(Csr<ValueType, IndexType>* result) override;
+
+    void read(const mat_data& data) override;
+
+    void read(const device_mat_data& data) override;
+
+    void read(device_mat_data&& data) override;
+
+    void write(mat_data& data) const override;
+
+    std::unique_ptr<Diagonal<ValueType>> extract_diagonal() const override;
+
+    /**
+     * Returns the values of the upper triangle of the matrix.
+     *
+     * @return the values of the upper triangle of the matrix.
+     */
+    value_type* get_values() noexcept { return values_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_values()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const value_type* get_const_values() const noexcept
+    {
+        return values_.get_const_data();
+    }
+
+    /**
+     * Returns the column indexes of the upper triangle of the matrix.
+     *
+     * @return the column indexes of the upper triangle of the matrix.
+     */
+    index_type* get_col_idxs() noexcept { return col_idxs_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_col_idxs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_col_idxs() const noexcept
+    {
+        return col_idxs_.get_const_data();
+    }
+
+    /**
+     * Returns the row pointers of the upper triangle of the matrix.
+     *
+     * @return the row pointers of the upper triangle of the matrix.
+     */
+    index_type* get_row_ptrs() noexcept { return row_ptrs_.get_data(); }
+
+    /**
+     * @copydoc SymmetricCsr::get_row_ptrs()
+     *
+     * @note This is the constant version of the function, which can be
+     *       significantly more memory efficient than the non-constant version,
+     *       so always prefer this version.
+     */
+    const index_type* get_const_row_ptrs() const noexcept
+    {
+        return row_ptrs_.get_const_data();
+    }
+
+    /**
+     * Returns the number of elements explicitly stored in the matrix, i.e.
+     * the number of nonzeros in the upper triangle including the diagonal.
+     *
+     * @return the number of elements explicitly stored in the matrix
+     */
+    size_type get_num_stored_elements() const noexcept
+    {
+        return values_.get_size();
+    }
+
+    /**
+     * Creates an empty SymmetricCsr matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     */
+    static std::unique_ptr<SymmetricCsr> create(
+        std::shared_ptr<const Executor> exec);
+
+    /**
+     * Creates a SymmetricCsr matrix from the upper triangle of an existing
+     * square matrix.
+     *
+     * @param exec  Executor associated to the matrix
+     * @param matrix  the input matrix, which needs to be convertible to
+     *                Csr<ValueType, IndexType>. Its strictly lower triangle is
+     *                ignored.
+     */
+    static std::unique_ptr<SymmetricCsr> create(
+        std::shared_ptr<const Executor> exec, const LinOp* matrix);
+
+    /**
+     * Copy-assigns a SymmetricCsr matrix. Preserves executor, copies
+     * everything else.
+     */
+    SymmetricCsr& operator=(const SymmetricCsr&);
+
+    /**
+     * Move-assigns a SymmetricCsr matrix. Preserves executor, moves the data
+     * and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    SymmetricCsr& operator=(SymmetricCsr&&);
+
+    /**
+     * Copy-constructs a SymmetricCsr matrix. Inherits executor and data.
+     */
+    SymmetricCsr(const SymmetricCsr&);
+
+    /**
+     * Move-constructs a SymmetricCsr matrix. Inherits executor, moves the
+     * data and leaves the moved-from object in an empty state (0x0 LinOp with
+     * unchanged executor, no nonzeros and valid row pointers).
+     */
+    SymmetricCsr(SymmetricCsr&&);
+
+protected:
+    SymmetricCsr(std::shared_ptr<const Executor> exec);
+
+    /**
+     * Replaces the content of this matrix by the upper triangle of the given
+     * square Csr matrix.
+     */
+    void extract_upper(const Csr<ValueType, IndexType>* source);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+private:
+    array<value_type> values_;
+    array<index_type> col_idxs_;
+    array<index_type> row_ptrs_;
+    // workspace of the SpMV kernels, kept between applications
+    mutable array<value_type> buffer_;
+};
+
+
+}  // namespace matrix
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_MATRIX_SYMMETRIC_CSR_HPP_
@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+
+
+/**
+ * A batched incomplete LU preconditioner with zero fill-in, ILU(0).
+ *
+ * For every item of the batch, the factors L and U are computed on the
+ * sparsity pattern of the system matrix such that (L * U)_{ij} = A_{ij} for
+ * all (i, j) in the pattern of A. L has an implicit unit diagonal, so both
+ * factors are stored together in a single batch::Csr matrix with the sparsity
+ * pattern of A. Applying the preconditioner consists of a forward
+ * substitution with L followed by a backward substitution with U.
+ *
+ * The factorization is computed once when the preconditioner is generated and
+ * is reused by every subsequent solve. Since all items share a sparsity
+ * pattern, the position of the diagonal entries is determined once for the
+ * whole batch, and the items are factorized independently of each other.
+ *
+ * @note The input batch matrix must be a batch::Csr matrix with sorted column
+ *       indices and all diagonal entries stored explicitly.
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of matrix elements
+ *
+ * @ingroup ilu
+ * @ingroup precond
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Ilu final : public EnableBatchLinOp<Ilu<ValueType, IndexType>> {
+    friend class EnableBatchLinOp<Ilu>;
+    friend class EnablePolymorphicObject<Ilu, BatchLinOp>;
+
+public:
+    using EnableBatchLinOp<Ilu>::convert_to;
+    using EnableBatchLinOp<Ilu>::move_to;
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = batch::matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the factorized matrix, which stores the strictly lower
+     * triangular part of L and the upper triangular part of U for all batch
+     * items.
+     *
+     * @return the factorized matrix
+     */
+    std::shared_ptr<const matrix_type> get_const_factorized_matrix()
+        const noexcept
+    {
+        return factorized_mat_;
+    }
+
+    /**
+     * Returns the positions of the diagonal entries within the values of a
+     * single batch item of the factorized matrix.
+     *
+     * @return the diagonal locations, one per row
+     */
+    const index_type* get_const_diag_locations() const noexcept
+    {
+        return diag_locations_.get_const_data();
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory){};
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Ilu, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Ilu(std::shared_ptr<const Executor> exec);
+
+    explicit Ilu(const Factory* factory,
+                 std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void generate_precond(const BatchLinOp* const system_matrix);
+
+    std::shared_ptr<matrix_type> factorized_mat_;
+    array<index_type> diag_locations_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ILU_HPP_
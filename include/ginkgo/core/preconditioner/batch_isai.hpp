@@ -0,0 +1,120 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
+#define GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/batch_lin_op.hpp>
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception_helpers.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+
+
+namespace gko {
+namespace batch {
+namespace preconditioner {
+
+
+/**
+ * This enum lists the types of input matrices a batched ISAI can be generated
+ * for.
+ */
+enum class batch_isai_input_matrix_type {
+    /** The lower triangular part of the matrix is inverted. */
+    lower,
+    /** The upper triangular part of the matrix is inverted. */
+    upper,
+    /** The whole matrix is inverted. */
+    general
+};
+
+
+/**
+ * A batched incomplete sparse approximate inverse (ISAI) preconditioner.
+ *
+ * For every item A of the batch, the approximate inverse M is computed on a
+ * fixed sparsity pattern S such that (M * A)_{ij} = I_{ij} for all (i, j) in
+ * S. S is the sparsity pattern of A (or of its lower or upper triangular
+ * part), optionally raised to the power given by `sparsity_power`. Every row
+ * of M is obtained from a small dense linear system, and applying the
+ * preconditioner is a sparse matrix-vector product with M.
+ *
+ * Since all items share their sparsity pattern, the assembly pattern of the
+ * dense systems is computed once for the whole batch, and the items are
+ * processed independently of each other. The approximate inverse is computed
+ * when the preconditioner is generated and reused by every solve.
+ *
+ * @note The input batch matrix must be a batch::Csr matrix with sorted column
+ *       indices. The number of nonzeros in each row of the approximate
+ *       inverse is limited to 32.
+ *
+ * @tparam ValueType  value precision of matrix elements
+ * @tparam IndexType  index precision of matrix elements
+ *
+ * @ingroup isai
+ * @ingroup precond
+ * @ingroup BatchLinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Isai final : public EnableBatchLinOp<Isai<ValueType, IndexType>> {
+    friend class EnableBatchLinOp<Isai>;
+    friend class EnablePolymorphicObject<Isai, BatchLinOp>;
+
+public:
+    using EnableBatchLinOp<Isai>::convert_to;
+    using EnableBatchLinOp<Isai>::move_to;
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using matrix_type = batch::matrix::Csr<ValueType, IndexType>;
+
+    /**
+     * Returns the approximate inverse of all batch items.
+     *
+     * @return the approximate inverse
+     */
+    std::shared_ptr<const matrix_type> get_const_approximate_inverse()
+        const noexcept
+    {
+        return approx_inv_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Which part of the system matrix is inverted.
+         */
+        batch_isai_input_matrix_type GKO_FACTORY_PARAMETER_SCALAR(
+            isai_input_matrix_type, batch_isai_input_matrix_type::general);
+
+        /**
+         * The power of the (lower, upper or whole) system matrix whose
+         * sparsity pattern is used for the approximate inverse.
+         */
+        int GKO_FACTORY_PARAMETER_SCALAR(sparsity_power, 1);
+    };
+    GKO_ENABLE_BATCH_LIN_OP_FACTORY(Isai, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+private:
+    explicit Isai(std::shared_ptr<const Executor> exec);
+
+    explicit Isai(const Factory* factory,
+                  std::shared_ptr<const BatchLinOp> system_matrix);
+
+    void generate_precond(const BatchLinOp* const system_matrix);
+
+    std::shared_ptr<matrix_type> approx_inv_;
+};
+
+
+}  // namespace preconditioner
+}  // namespace batch
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_PRECONDITIONER_BATCH_ISAI_HPP_
@@ -145,6 +145,18 @@ public:
         return blocks_.get_size();
     }
 
+    /**
+     * Recomputes the inverted diagonal blocks of all batch items from a new
+     * batch matrix, reusing the block structure and the common pattern of the
+     * diagonal blocks extracted during the generation.
+     *
+     * @param new_matrix  the new batch matrix, which needs to have the same
+     *                    dimensions and sparsity pattern as the batch matrix
+     *                    this preconditioner was generated from, otherwise an
+     *                    InvalidStateError is thrown.
+     */
+    void update_values(std::shared_ptr<const BatchLinOp> new_matrix);
+
     GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
     {
         /**
@@ -211,6 +223,11 @@ private:
     array<value_type> blocks_;
     array<index_type> map_block_to_row_;
     array<index_type> blocks_cumulative_offsets_;
+    array<index_type> block_nnz_idxs_;
+    uint64 pattern_hash_;
+    // the matrix this preconditioner was generated from, kept until its
+    // pattern is hashed by the first call to update_values
+    std::shared_ptr<const BatchLinOp> pattern_source_;
 };
 
 
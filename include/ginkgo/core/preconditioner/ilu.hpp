@@ -84,7 +84,8 @@ template <typename LSolverType = solver::LowerTrs<>,
           typename IndexType = int32>
 class Ilu : public EnableLinOp<
                 Ilu<LSolverType, USolverType, ReverseApply, IndexType>>,
-            public Transposable {
+            public Transposable,
+            public ValueUpdatable {
     friend class EnableLinOp<Ilu>;
     friend class EnablePolymorphicObject<Ilu, LinOp>;
 
@@ -253,6 +254,31 @@ public:
         return std::move(transposed);
     }
 
+    /**
+     * Recomputes the factorization for a new system matrix with the same
+     * sparsity pattern and regenerates the triangular solvers.
+     *
+     * This is only supported if the preconditioner was generated from a
+     * matrix (and not from a Composition of factors), and if the
+     * factorization implements ValueUpdatable, as ParIlu and ParIlut do.
+     *
+     * @param new_matrix  the new system matrix, which needs to have the same
+     *                    size and sparsity pattern as the matrix the
+     *                    preconditioner was generated from
+     */
+    void update_values(std::shared_ptr<const LinOp> new_matrix) override
+    {
+        auto updatable =
+            std::dynamic_pointer_cast<ValueUpdatable>(factorization_);
+        if (!updatable) {
+            GKO_NOT_SUPPORTED(factorization_);
+        }
+        updatable->update_values(std::move(new_matrix));
+        this->generate_solvers(
+            std::dynamic_pointer_cast<const Composition<value_type>>(
+                factorization_));
+    }
+
     /**
      * Copy-assigns an ILU preconditioner. Preserves the executor,
      * shallow-copies the solvers and parameters. Creates a clone of the solvers
@@ -265,6 +291,7 @@ public:
             auto exec = this->get_executor();
             l_solver_ = other.l_solver_;
             u_solver_ = other.u_solver_;
+            factorization_ = other.factorization_;
             parameters_ = other.parameters_;
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
@@ -287,6 +314,7 @@ public:
             auto exec = this->get_executor();
             l_solver_ = std::move(other.l_solver_);
             u_solver_ = std::move(other.u_solver_);
+            factorization_ = std::move(other.factorization_);
             parameters_ = std::exchange(other.parameters_, parameters_type{});
             if (other.get_executor() != exec) {
                 l_solver_ = gko::clone(exec, l_solver_);
@@ -362,8 +390,6 @@ protected:
     {
         auto comp =
             std::dynamic_pointer_cast<const Composition<value_type>>(lin_op);
-        std::shared_ptr<const LinOp> l_factor;
-        std::shared_ptr<const LinOp> u_factor;
 
         // build factorization if we weren't passed a composition
         if (!comp) {
@@ -373,15 +399,29 @@ protected:
                     factorization::ParIlu<value_type, index_type>::build().on(
                         exec);
             }
-            auto fact = std::shared_ptr<const LinOp>(
-                parameters_.factorization_factory->generate(lin_op));
+            // keep the factorization to be able to update its values
+            factorization_ =
+                parameters_.factorization_factory->generate(lin_op);
             // ensure that the result is a composition
-            comp =
-                std::dynamic_pointer_cast<const Composition<value_type>>(fact);
+            comp = std::dynamic_pointer_cast<const Composition<value_type>>(
+                factorization_);
             if (!comp) {
                 GKO_NOT_SUPPORTED(comp);
             }
         }
+        this->generate_solvers(comp);
+    }
+
+    /**
+     * Generates the triangular solvers for the factors stored in a
+     * Composition.
+     *
+     * @param comp  the Composition containing the L and the U factor
+     */
+    void generate_solvers(std::shared_ptr<const Composition<value_type>> comp)
+    {
+        std::shared_ptr<const LinOp> l_factor;
+        std::shared_ptr<const LinOp> u_factor;
         if (comp->get_operators().size() == 2) {
             l_factor = comp->get_operators()[0];
             u_factor = comp->get_operators()[1];
@@ -464,6 +504,7 @@ protected:
 private:
     std::shared_ptr<const l_solver_type> l_solver_{};
     std::shared_ptr<const u_solver_type> u_solver_{};
+    std::shared_ptr<LinOp> factorization_{};
     /**
      * Manages a vector as a cache, so there is no need to allocate one every
      * time an intermediate vector is required.
@@ -50,6 +50,10 @@ enum struct isai_type { lower, upper, general, spd };
  * same as the sparsity pattern of the respective matrix. For B, the sparsity
  * pattern used for the approximate inverse is the same as the sparsity pattern
  * of the lower triangular half of B.
+ * Both can be extended to powers of the pattern (`sparsity_power`) or grown
+ * adaptively based on the residual of the approximate inverse
+ * (`adaptive_steps`), which yields an adaptive SPAI for general and an
+ * adaptive FSAI for spd matrices.
  *
  * Note that, except for the spd case, for a matrix A generally
  * ISAI(A)^T != ISAI(A^T).
@@ -188,6 +192,47 @@ public:
         remove_complex<value_type> GKO_FACTORY_PARAMETER_SCALAR(
             excess_solver_reduction,
             static_cast<remove_complex<value_type>>(1e-6));
+
+        /**
+         * @brief Number of adaptive sparsity pattern refinement steps.
+         *
+         * After computing the approximate inverse aiM on the initial sparsity
+         * pattern, every step evaluates the residual R = aiM * M - I and adds
+         * the `adaptive_fill` entries of each row of R with the largest
+         * magnitude that lie outside the current pattern, before computing
+         * the approximate inverse again on the extended pattern. For lower,
+         * upper and spd ISAI, only entries in the respective triangle are
+         * added. For spd ISAI, the selected entries are the largest
+         * components of the gradient of the Kaporin condition number, which
+         * results in an adaptive FSAI. The refinement stops early if no row
+         * was extended.
+         * Must be at least 0, default value 0 (fixed sparsity pattern).
+         *
+         * @note The adaptive refinement is only implemented for the Reference
+         *       and OpenMP executors.
+         */
+        int GKO_FACTORY_PARAMETER_SCALAR(adaptive_steps, 0);
+
+        /**
+         * @brief Maximum number of entries added to each row of the sparsity
+         *        pattern in every adaptive refinement step.
+         *
+         * Must be at least 1, default value 4.
+         */
+        int GKO_FACTORY_PARAMETER_SCALAR(adaptive_fill, 4);
+
+        /**
+         * @brief Residual threshold for the adaptive pattern refinement.
+         *
+         * A row of the sparsity pattern is only extended if the norm of the
+         * entries of its row of aiM * M outside the pattern exceeds
+         * `adaptive_tolerance` times |(aiM * M)_ii|, i.e. relative to the
+         * diagonal entry of the product, not of the residual aiM * M - I.
+         * Default value 0, i.e. every row with a nonzero entry outside the
+         * pattern is extended.
+         */
+        remove_complex<value_type> GKO_FACTORY_PARAMETER_SCALAR(
+            adaptive_tolerance, remove_complex<value_type>{});
     };
 
     GKO_ENABLE_LIN_OP_FACTORY(Isai, parameters, Factory);
@@ -185,7 +185,8 @@ template <typename ValueType = default_precision, typename IndexType = int32>
 class Jacobi : public EnableLinOp<Jacobi<ValueType, IndexType>>,
                public ConvertibleTo<matrix::Dense<ValueType>>,
                public WritableToMatrixData<ValueType, IndexType>,
-               public Transposable {
+               public Transposable,
+               public ValueUpdatable {
     friend class EnableLinOp<Jacobi>;
     friend class EnablePolymorphicObject<Jacobi, LinOp>;
 
@@ -273,6 +274,18 @@ public:
 
     std::unique_ptr<LinOp> conj_transpose() const override;
 
+    /**
+     * Recomputes the inverted diagonal blocks from a new system matrix,
+     * reusing the block structure, the storage scheme and the memory
+     * allocated during the generation. For the adaptive precision variant,
+     * the storage precision of each block is selected again.
+     *
+     * @param new_matrix  the new system matrix, which needs to have the same
+     *                    size and sparsity pattern as the matrix this
+     *                    preconditioner was generated from
+     */
+    void update_values(std::shared_ptr<const LinOp> new_matrix) override;
+
     /**
      * Copy-assigns a Jacobi preconditioner. Preserves executor, copies all
      * data and parameters.
@@ -509,7 +522,9 @@ protected:
         : EnableLinOp<Jacobi>(exec),
           num_blocks_{},
           blocks_(exec),
-          conditioning_(exec)
+          conditioning_(exec),
+          requested_precisions_(exec),
+          pattern_hash_{}
     {
         parameters_.block_pointers.set_executor(exec);
         parameters_.storage_optimization.block_wise.set_executor(exec);
@@ -533,7 +548,10 @@ protected:
           blocks_(factory->get_executor(),
                   storage_scheme_.compute_storage_space(
                       parameters_.block_pointers.get_size() - 1)),
-          conditioning_(factory->get_executor())
+          conditioning_(factory->get_executor()),
+          requested_precisions_(factory->get_executor()),
+          pattern_hash_{},
+          pattern_source_{system_matrix}
     {
         parameters_.block_pointers.set_executor(this->get_executor());
         parameters_.storage_optimization.block_wise.set_executor(
@@ -603,6 +621,14 @@ protected:
      */
     void detect_blocks(const matrix::Csr<ValueType, IndexType>* system_matrix);
 
+    /**
+     * Computes the inverted diagonal blocks of a system matrix for the block
+     * structure stored in this preconditioner.
+     *
+     * @param system_matrix  the source matrix used to compute the blocks
+     */
+    void compute_blocks(const matrix::Csr<ValueType, IndexType>* system_matrix);
+
     void apply_impl(const LinOp* b, LinOp* x) const override;
 
     void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
@@ -613,6 +639,11 @@ private:
     size_type num_blocks_;
     array<value_type> blocks_;
     array<remove_complex<value_type>> conditioning_;
+    array<precision_reduction> requested_precisions_;
+    uint64 pattern_hash_;
+    // the matrix this preconditioner was generated from, kept until its
+    // pattern is hashed by the first call to update_values
+    std::shared_ptr<const LinOp> pattern_source_;
 };
 
 
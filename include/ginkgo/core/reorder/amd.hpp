@@ -26,6 +26,28 @@ namespace experimental {
 namespace reorder {
 
 
+/**
+ * The algorithm used to compute an Amd reordering.
+ */
+enum class amd_algorithm {
+    /**
+     * The sequential AMD implementation from SuiteSparse, executed on the host.
+     */
+    suitesparse,
+    /**
+     * A parallel approximate minimum degree ordering. In each step, it
+     * eliminates a set of pivots whose approximate degree is close to the
+     * minimum degree at once. The pivots are chosen as a distance-2
+     * independent set in the quotient graph, so they can be eliminated
+     * concurrently. This uses multiple threads on the OpenMP executor, and is
+     * executed on the host for device executors. The resulting ordering is
+     * deterministic, but usually has slightly more fill-in than the
+     * suitesparse ordering.
+     */
+    parallel
+};
+
+
 /**
  * Computes a Approximate Minimum Degree (AMD) reordering of an input
  * matrix.
@@ -58,6 +80,12 @@ public:
          * symmetrization or AMD reordering may fail silently or crash.
          */
         bool GKO_FACTORY_PARAMETER_SCALAR(skip_sorting, false);
+
+        /**
+         * The algorithm used to compute the reordering.
+         */
+        amd_algorithm GKO_FACTORY_PARAMETER_SCALAR(algorithm,
+                                                   amd_algorithm::suitesparse);
     };
 
     /**
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_REORDER_GRAY_CODE_HPP_
+#define GKO_PUBLIC_CORE_REORDER_GRAY_CODE_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+
+
+/**
+ * GrayCode computes a row ordering that improves the reuse of the input
+ * vector in a sparse matrix-vector product.
+ *
+ * The columns are split into `num_column_blocks` contiguous blocks, and every
+ * row is assigned a bit signature with one bit per column block, which is set
+ * if the row has a nonzero in this block. The rows are then sorted by the
+ * rank of their signature in the binary reflected Gray code sequence, rows
+ * with equal signatures keep their relative order. Consecutive Gray codes
+ * only differ in a single bit, so neighboring rows access mostly the same
+ * blocks of the input vector, which stay in cache while the rows are
+ * processed.
+ *
+ * The ordering does not need any geometric information and is cheap to
+ * compute. It can be used as a row permutation for the SpMV only
+ * (`Csr::permute(perm, permute_mode::rows)`), or as a symmetric permutation,
+ * e.g. in a Reordered operator, where it groups rows that couple to the same
+ * parts of the matrix.
+ *
+ * @see J. Zhao et al., "Exploiting Locality in Sparse Matrix-Vector
+ *      Multiplication via Gray Code Ordering" (2018)
+ *
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup reorder
+ */
+template <typename IndexType = int32>
+class GrayCode
+    : public EnablePolymorphicObject<GrayCode<IndexType>, LinOpFactory>,
+      public EnablePolymorphicAssignment<GrayCode<IndexType>> {
+public:
+    struct parameters_type;
+    friend class EnablePolymorphicObject<GrayCode<IndexType>, LinOpFactory>;
+    friend class enable_parameters_type<parameters_type, GrayCode<IndexType>>;
+
+    using index_type = IndexType;
+    using permutation_type = matrix::Permutation<index_type>;
+
+    struct parameters_type
+        : public enable_parameters_type<parameters_type, GrayCode<IndexType>> {
+        /**
+         * The number of column blocks, i.e. the number of bits of the row
+         * signatures. It needs to be between 1 and 64. Each block should
+         * roughly correspond to the part of the input vector that fits into
+         * the cache of a single core.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(num_column_blocks, 64);
+    };
+
+    /**
+     * Returns the parameters used to construct the factory.
+     *
+     * @return the parameters used to construct the factory.
+     */
+    const parameters_type& get_parameters() { return parameters_; }
+
+    /**
+     * @copydoc LinOpFactory::generate
+     * @note This function overrides the default LinOpFactory::generate to
+     *       return a Permutation instead of a generic LinOp, which would
+     *       need to be cast to Permutation again to access its indices.
+     *       It is only necessary because smart pointers aren't covariant.
+     */
+    std::unique_ptr<permutation_type> generate(
+        std::shared_ptr<const LinOp> system_matrix) const;
+
+    /** Creates a new parameter_type to set up the factory. */
+    static parameters_type build() { return {}; }
+
+protected:
+    explicit GrayCode(std::shared_ptr<const Executor> exec,
+                      const parameters_type& params = {});
+
+    std::unique_ptr<LinOp> generate_impl(
+        std::shared_ptr<const LinOp> system_matrix) const override;
+
+    parameters_type parameters_;
+};
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_REORDER_GRAY_CODE_HPP_
@@ -9,9 +9,6 @@
 #include <ginkgo/config.hpp>
 
 
-#if GKO_HAVE_METIS
-
-
 #include <memory>
 #include <unordered_map>
 
@@ -36,9 +33,33 @@ namespace experimental {
 namespace reorder {
 
 
+/**
+ * The algorithm used to compute a NestedDissection reordering.
+ */
+enum class nd_algorithm {
+    /**
+     * The multilevel nested dissection from the METIS library, executed on
+     * the host. It is only available if Ginkgo was built with METIS support.
+     */
+    metis,
+    /**
+     * A native multilevel nested dissection: Each vertex separator is
+     * computed by coarsening the graph using heavy-edge matching, bisecting
+     * the coarsest graph by greedy graph growing and refining the bisection
+     * with Fiduccia-Mattheyses while uncoarsening. The resulting edge
+     * separator is turned into a vertex separator, which is refined again.
+     * Small subgraphs are ordered by minimum degree. The independent
+     * subgraphs are dissected concurrently by OpenMP tasks on the OpenMP
+     * executor, device executors compute the ordering on their host
+     * executor. The resulting ordering is deterministic.
+     */
+    native
+};
+
+
 /**
  * Computes a Nested Dissection (ND) reordering of an input matrix using the
- * METIS library.
+ * METIS library or a native implementation.
  *
  * @tparam ValueType  the type used to store values of the system matrix
  * @tparam IndexType  the type used to store sparsity pattern indices of the
@@ -65,9 +86,30 @@ public:
     struct parameters_type
         : public enable_parameters_type<
               parameters_type, NestedDissection<ValueType, IndexType>> {
+        /**
+         * The algorithm used to compute the reordering. It defaults to METIS
+         * if Ginkgo was built with METIS support.
+         */
+#if GKO_HAVE_METIS
+        nd_algorithm algorithm{nd_algorithm::metis};
+#else
+        nd_algorithm algorithm{nd_algorithm::native};
+#endif
+
+        /**
+         * @copydoc algorithm
+         * @return `*this` for chaining
+         */
+        parameters_type& with_algorithm(nd_algorithm algorithm)
+        {
+            this->algorithm = algorithm;
+            return *this;
+        }
+
         /**
          * The options to be passed on to METIS, stored as key-value pairs.
-         * Any options that are not set here use their default value.
+         * Any options that are not set here use their default value. They are
+         * ignored by the native algorithm.
          */
         std::unordered_map<int, int> options;
 
@@ -119,7 +161,4 @@ private:
 }  // namespace gko
 
 
-#endif  // GKO_HAVE_METIS
-
-
 #endif  // GKO_PUBLIC_CORE_REORDER_NESTED_DISSECTION_HPP_
@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_REORDER_REORDERED_HPP_
+#define GKO_PUBLIC_CORE_REORDER_REORDERED_HPP_
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+namespace gko {
+namespace experimental {
+namespace reorder {
+
+
+/**
+ * Reordered wraps an inner operator like a Krylov solver, which is generated
+ * on a symmetrically permuted system matrix P*A*P^T instead of A.
+ *
+ * The permutation is computed by a reordering factory, e.g. Rcm, Amd,
+ * NestedDissection or GrayCode, and the system matrix is permuted only once
+ * when the operator is generated. Instead of A*x = b, the inner operator
+ * solves P*A*P^T*y = P*b, and the solution is retrieved as x = P^T*y. So all
+ * vectors used inside the inner operator stay in the permuted space for the
+ * entire solve, where the SpMV of a bandwidth- or locality-reducing ordering
+ * benefits from the better cache reuse.
+ *
+ * Compared to ScaledReordered, the permutations are fused into the first and
+ * last vector operations of an apply: the right-hand side (and the initial
+ * guess, if the inner operator uses it) is gathered directly into the
+ * permuted work vectors, and the solution is scattered directly into x, so
+ * every apply reads and writes each vector only once outside of the inner
+ * operator.
+ *
+ * @note The inner system matrix is computed from a clone of A, so the
+ *       original system matrix is not changed.
+ *
+ * @tparam ValueType  Type of the values of all matrices used in this class
+ * @tparam IndexType  Type of the indices of all matrices used in this class
+ *
+ * @ingroup reorder
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class Reordered : public EnableLinOp<Reordered<ValueType, IndexType>> {
+    friend class EnableLinOp<Reordered, LinOp>;
+    friend class EnablePolymorphicObject<Reordered, LinOp>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using permutation_type = matrix::Permutation<index_type>;
+
+    /**
+     * Returns the permuted system matrix P*A*P^T the inner operator was
+     * generated on.
+     *
+     * @return the permuted system matrix
+     */
+    std::shared_ptr<const LinOp> get_system_matrix() const
+    {
+        return system_matrix_;
+    }
+
+    /**
+     * Returns the inner operator working on the permuted system.
+     *
+     * @return the inner operator
+     */
+    std::shared_ptr<const LinOp> get_inner_operator() const
+    {
+        return inner_operator_;
+    }
+
+    /**
+     * Returns the permutation P, or nullptr if no reordering was used.
+     *
+     * @return the permutation
+     */
+    std::shared_ptr<const permutation_type> get_permutation() const
+    {
+        return permutation_;
+    }
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * The inner operator factory that is to be generated on the
+         * reordered system matrix. If none is provided, the inner operator
+         * is the identity.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            inner_operator, nullptr);
+
+        /**
+         * The reordering factory, which needs to generate a
+         * Permutation<IndexType> from the system matrix. If none is provided,
+         * the system matrix is not permuted. If a reordering is provided and
+         * the system matrix is not `Permutable<IndexType>`, it needs to be
+         * convertible to Csr<ValueType, IndexType>.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_FACTORY_PARAMETER_SCALAR(
+            reordering, nullptr);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(Reordered, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+protected:
+    /**
+     * Creates an empty reordered operator (0x0 operator).
+     */
+    explicit Reordered(std::shared_ptr<const Executor> exec);
+
+    explicit Reordered(const Factory* factory,
+                       std::shared_ptr<const LinOp> system_matrix);
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    /**
+     * Gathers the right-hand side, and the initial guess if the inner
+     * operator uses it, into the permuted work vectors, applies the inner
+     * operator and returns the permuted solution.
+     */
+    matrix::Dense<ValueType>* apply_permuted(
+        const matrix::Dense<ValueType>* b,
+        const matrix::Dense<ValueType>* x) const;
+
+private:
+    std::shared_ptr<const LinOp> system_matrix_{};
+    std::shared_ptr<const LinOp> inner_operator_{};
+    std::shared_ptr<const permutation_type> permutation_{};
+
+    /**
+     * Manages the permuted work vectors as a cache, so there is no need to
+     * allocate them every time the operator is applied. Copying an instance
+     * will only yield an empty object since copying the cached vectors would
+     * not make sense.
+     *
+     * @internal  The struct is present so the whole class can be copyable
+     *            (could also be done with writing `operator=` and copy
+     *            constructor of the enclosing class by hand)
+     */
+    mutable struct cache_struct {
+        cache_struct() = default;
+
+        ~cache_struct() = default;
+
+        cache_struct(const cache_struct&) {}
+
+        cache_struct(cache_struct&&) {}
+
+        cache_struct& operator=(const cache_struct&) { return *this; }
+
+        cache_struct& operator=(cache_struct&&) { return *this; }
+
+        std::unique_ptr<matrix::Dense<value_type>> inner_b{};
+        std::unique_ptr<matrix::Dense<value_type>> inner_x{};
+        std::unique_ptr<matrix::Dense<value_type>> outer_x{};
+    } cache_;
+};
+
+
+}  // namespace reorder
+}  // namespace experimental
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_REORDER_REORDERED_HPP_
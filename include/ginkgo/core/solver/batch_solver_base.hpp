@@ -368,12 +368,15 @@ protected:
                     MultiVector<ValueType>* x) const
     {
         auto exec = this->get_executor();
-        if (b->get_common_size()[1] > 1) {
-            GKO_NOT_IMPLEMENTED;
+        const auto num_rhs = b->get_common_size()[1];
+        const size_type workspace_size = b->get_num_batch_items() * num_rhs *
+                                         (sizeof(real_type) + sizeof(int));
+        if (workspace_.get_size() < workspace_size) {
+            workspace_.resize_and_reset(workspace_size);
         }
         auto workspace_view = workspace_.as_view();
         auto log_data_ = std::make_unique<log::detail::log_data<real_type>>(
-            exec, b->get_num_batch_items(), workspace_view);
+            exec, b->get_num_batch_items(), workspace_view, num_rhs);
 
         this->solver_apply(b, x, log_data_.get());
 
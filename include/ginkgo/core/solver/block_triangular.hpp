@@ -0,0 +1,254 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_BLOCK_TRIANGULAR_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_BLOCK_TRIANGULAR_HPP_
+
+
+#include <memory>
+#include <utility>
+
+
+#include <ginkgo/core/base/abstract_factory.hpp>
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/dim.hpp>
+#include <ginkgo/core/base/lin_op.hpp>
+#include <ginkgo/core/base/polymorphic_object.hpp>
+#include <ginkgo/core/base/types.hpp>
+#include <ginkgo/core/base/utils.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/solver/solver_base.hpp>
+
+
+namespace gko {
+namespace solver {
+
+
+template <typename ValueType, typename IndexType>
+class BlockUpperTrs;
+
+
+/**
+ * BlockLowerTrs is the triangular solver which solves the system L x = b, when
+ * L is a block lower triangular matrix stored in the Fbcsr format. Only the
+ * blocks on and below the block diagonal are used. The diagonal blocks are
+ * inverted during the generation, so each block row is solved with dense
+ * block operations. If the matrix is not in Fbcsr, then the generate step
+ * converts it into an Fbcsr matrix, which fails if the matrix is not
+ * convertible to Fbcsr.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indices
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class BlockLowerTrs
+    : public EnableLinOp<BlockLowerTrs<ValueType, IndexType>>,
+      public EnableSolverBase<BlockLowerTrs<ValueType, IndexType>,
+                              matrix::Fbcsr<ValueType, IndexType>>,
+      public Transposable {
+    friend class EnableLinOp<BlockLowerTrs>;
+    friend class EnablePolymorphicObject<BlockLowerTrs, LinOp>;
+    friend class BlockUpperTrs<ValueType, IndexType>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using transposed_type = BlockUpperTrs<ValueType, IndexType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Should the solver use the diagonal blocks of the system matrix
+         * (false) or should it assume they are identity blocks (true)?
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(unit_diagonal, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(BlockLowerTrs, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Copy-constructs a block triangular solver. Preserves the executor,
+     * shallow-copies the system matrix. The inverted diagonal blocks will be
+     * regenerated.
+     */
+    BlockLowerTrs(const BlockLowerTrs&);
+
+    /**
+     * Move-constructs a block triangular solver. Preserves the executor, moves
+     * the system matrix and inverted diagonal blocks. Moved-from object is
+     * empty (0x0 and nullptr system matrix)
+     */
+    BlockLowerTrs(BlockLowerTrs&&);
+
+    /**
+     * Copy-assigns a block triangular solver. Preserves the executor,
+     * shallow-copies the system matrix. The inverted diagonal blocks will be
+     * regenerated.
+     */
+    BlockLowerTrs& operator=(const BlockLowerTrs&);
+
+    /**
+     * Move-assigns a block triangular solver. Preserves the executor, moves
+     * the system matrix. If the executors mismatch, clones system matrix onto
+     * this executor and regenerates the inverted diagonal blocks. Moved-from
+     * object is empty (0x0 and nullptr system matrix)
+     */
+    BlockLowerTrs& operator=(BlockLowerTrs&&);
+
+protected:
+    using FbcsrMatrix = matrix::Fbcsr<ValueType, IndexType>;
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    /**
+     * Inverts the diagonal blocks of the system matrix.
+     */
+    void generate();
+
+    explicit BlockLowerTrs(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<BlockLowerTrs>(exec), inv_diag_blocks_{exec}
+    {}
+
+    explicit BlockLowerTrs(const Factory* factory,
+                           std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<BlockLowerTrs>(factory->get_executor(),
+                                     gko::transpose(system_matrix->get_size())),
+          EnableSolverBase<BlockLowerTrs<ValueType, IndexType>, FbcsrMatrix>{
+              copy_and_convert_to<FbcsrMatrix>(factory->get_executor(),
+                                               system_matrix)},
+          parameters_{factory->get_parameters()},
+          inv_diag_blocks_{factory->get_executor()}
+    {
+        this->generate();
+    }
+
+private:
+    array<ValueType> inv_diag_blocks_;
+};
+
+
+/**
+ * BlockUpperTrs is the triangular solver which solves the system U x = b, when
+ * U is a block upper triangular matrix stored in the Fbcsr format. Only the
+ * blocks on and above the block diagonal are used. The diagonal blocks are
+ * inverted during the generation, so each block row is solved with dense
+ * block operations. If the matrix is not in Fbcsr, then the generate step
+ * converts it into an Fbcsr matrix, which fails if the matrix is not
+ * convertible to Fbcsr.
+ *
+ * @tparam ValueType  precision of matrix elements
+ * @tparam IndexType  precision of matrix indices
+ *
+ * @ingroup solvers
+ * @ingroup LinOp
+ */
+template <typename ValueType = default_precision, typename IndexType = int32>
+class BlockUpperTrs
+    : public EnableLinOp<BlockUpperTrs<ValueType, IndexType>>,
+      public EnableSolverBase<BlockUpperTrs<ValueType, IndexType>,
+                              matrix::Fbcsr<ValueType, IndexType>>,
+      public Transposable {
+    friend class EnableLinOp<BlockUpperTrs>;
+    friend class EnablePolymorphicObject<BlockUpperTrs, LinOp>;
+    friend class BlockLowerTrs<ValueType, IndexType>;
+
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+    using transposed_type = BlockLowerTrs<ValueType, IndexType>;
+
+    std::unique_ptr<LinOp> transpose() const override;
+
+    std::unique_ptr<LinOp> conj_transpose() const override;
+
+    GKO_CREATE_FACTORY_PARAMETERS(parameters, Factory)
+    {
+        /**
+         * Should the solver use the diagonal blocks of the system matrix
+         * (false) or should it assume they are identity blocks (true)?
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(unit_diagonal, false);
+    };
+    GKO_ENABLE_LIN_OP_FACTORY(BlockUpperTrs, parameters, Factory);
+    GKO_ENABLE_BUILD_METHOD(Factory);
+
+    /**
+     * Copy-constructs a block triangular solver. Preserves the executor,
+     * shallow-copies the system matrix. The inverted diagonal blocks will be
+     * regenerated.
+     */
+    BlockUpperTrs(const BlockUpperTrs&);
+
+    /**
+     * Move-constructs a block triangular solver. Preserves the executor, moves
+     * the system matrix and inverted diagonal blocks. Moved-from object is
+     * empty (0x0 and nullptr system matrix)
+     */
+    BlockUpperTrs(BlockUpperTrs&&);
+
+    /**
+     * Copy-assigns a block triangular solver. Preserves the executor,
+     * shallow-copies the system matrix. The inverted diagonal blocks will be
+     * regenerated.
+     */
+    BlockUpperTrs& operator=(const BlockUpperTrs&);
+
+    /**
+     * Move-assigns a block triangular solver. Preserves the executor, moves
+     * the system matrix. If the executors mismatch, clones system matrix onto
+     * this executor and regenerates the inverted diagonal blocks. Moved-from
+     * object is empty (0x0 and nullptr system matrix)
+     */
+    BlockUpperTrs& operator=(BlockUpperTrs&&);
+
+protected:
+    using FbcsrMatrix = matrix::Fbcsr<ValueType, IndexType>;
+
+    void apply_impl(const LinOp* b, LinOp* x) const override;
+
+    void apply_impl(const LinOp* alpha, const LinOp* b, const LinOp* beta,
+                    LinOp* x) const override;
+
+    /**
+     * Inverts the diagonal blocks of the system matrix.
+     */
+    void generate();
+
+    explicit BlockUpperTrs(std::shared_ptr<const Executor> exec)
+        : EnableLinOp<BlockUpperTrs>(exec), inv_diag_blocks_{exec}
+    {}
+
+    explicit BlockUpperTrs(const Factory* factory,
+                           std::shared_ptr<const LinOp> system_matrix)
+        : EnableLinOp<BlockUpperTrs>(factory->get_executor(),
+                                     gko::transpose(system_matrix->get_size())),
+          EnableSolverBase<BlockUpperTrs<ValueType, IndexType>, FbcsrMatrix>{
+              copy_and_convert_to<FbcsrMatrix>(factory->get_executor(),
+                                               system_matrix)},
+          parameters_{factory->get_parameters()},
+          inv_diag_blocks_{factory->get_executor()}
+    {
+        this->generate();
+    }
+
+private:
+    array<ValueType> inv_diag_blocks_;
+};
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_BLOCK_TRIANGULAR_HPP_
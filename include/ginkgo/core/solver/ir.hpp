@@ -6,6 +6,7 @@
 #define GKO_PUBLIC_CORE_SOLVER_IR_HPP_
 
 
+#include <type_traits>
 #include <vector>
 
 
@@ -71,6 +72,15 @@ namespace solver {
  * its eigenvalues `lambda` have to satisfy the equation `|relaxation_factor *
  * lambda - 1| < 1).
  *
+ * In mixed precision mode (`mixed_precision` factory parameter), the residual
+ * is computed in ValueType, but the correction is computed by applying the
+ * inner solver in the next lower precision, e.g. single precision for a double
+ * precision solver. This allows using a cheap inner solver like a single
+ * precision direct solver, while the solution still converges to the accuracy
+ * of ValueType. If a `promoted_solver` is given, the solver monitors the
+ * residual norm and switches to the promoted solver in ValueType once the
+ * lower precision correction stagnates.
+ *
  * @tparam ValueType  precision of matrix elements
  *
  * @ingroup solvers
@@ -89,6 +99,14 @@ class Ir : public EnableLinOp<Ir<ValueType>>,
 public:
     using value_type = ValueType;
     using transposed_type = Ir<ValueType>;
+    /**
+     * The precision of the correction in mixed precision mode. It is the next
+     * lower precision for double precision solvers, and ValueType otherwise.
+     */
+    using lower_precision_type =
+        std::conditional_t<std::is_same<remove_complex<ValueType>,
+                                        double>::value,
+                           next_precision<ValueType>, ValueType>;
 
     std::unique_ptr<LinOp> transpose() const override;
 
@@ -119,6 +137,14 @@ public:
      */
     void set_solver(std::shared_ptr<const LinOp> new_solver);
 
+    /**
+     * Sets the workspace pool of this solver and its inner solver.
+     *
+     * @param pool  the pool to use, or nullptr to let the solvers own their
+     *              workspace vectors
+     */
+    void set_workspace_pool(std::shared_ptr<WorkspacePool> pool) const override;
+
     /**
      * Copy-assigns an IR solver. Preserves the executor, shallow-copies inner
      * solver, stopping criterion and system matrix. If the executors mismatch,
@@ -178,6 +204,44 @@ public:
          */
         initial_guess_mode GKO_FACTORY_PARAMETER_SCALAR(
             default_initial_guess, initial_guess_mode::provided);
+
+        /**
+         * If set to true, the inner solver is applied to the residual rounded
+         * to lower_precision_type, and the resulting correction is converted
+         * back while it is added to the solution. The inner solver should
+         * operate in lower_precision_type, e.g. a single precision Direct
+         * solver, which can be generated from the double precision system
+         * matrix. This requires a double precision ValueType.
+         */
+        bool GKO_FACTORY_PARAMETER_SCALAR(mixed_precision, false);
+
+        /**
+         * In mixed precision mode with a promoted_solver, the iteration is
+         * considered stagnated once the residual norm of a right-hand side is
+         * reduced by less than this factor per iteration, on average over
+         * stagnation_check_interval iterations. All further corrections of
+         * the same apply are computed by the promoted_solver.
+         */
+        remove_complex<ValueType> GKO_FACTORY_PARAMETER_SCALAR(
+            stagnation_factor, 0.9);
+
+        /**
+         * The number of iterations between two stagnation checks. Each check
+         * computes the residual norms and copies them to the host, so larger
+         * intervals make the monitoring cheaper, but detect the stagnation
+         * later.
+         */
+        size_type GKO_FACTORY_PARAMETER_SCALAR(stagnation_check_interval, 4);
+
+        /**
+         * Inner solver factory used in mixed precision mode after stagnation
+         * was detected, e.g. a solver in ValueType. The solver is generated
+         * together with the Ir solver. If it is not set, the residual norm is
+         * not monitored and the lower precision inner solver is used
+         * throughout.
+         */
+        std::shared_ptr<const LinOpFactory> GKO_DEFERRED_FACTORY_PARAMETER(
+            promoted_solver);
     };
     GKO_ENABLE_LIN_OP_FACTORY(Ir, parameters, Factory);
     GKO_ENABLE_BUILD_METHOD(Factory);
@@ -202,6 +266,20 @@ protected:
     void set_relaxation_factor(
         std::shared_ptr<const matrix::Dense<ValueType>> new_factor);
 
+    /**
+     * Computes the correction in lower_precision_type and adds it to the
+     * solution: x = x + relaxation_factor * solver(round(residual))
+     */
+    void apply_lower_precision_correction(
+        const matrix::Dense<ValueType>* residual,
+        matrix::Dense<ValueType>* x) const;
+
+    template <typename VectorType>
+    void apply_lower_precision_correction(const VectorType*, VectorType*) const
+    {
+        GKO_NOT_SUPPORTED(this);
+    }
+
     explicit Ir(std::shared_ptr<const Executor> exec)
         : EnableLinOp<Ir>(std::move(exec))
     {}
@@ -227,10 +305,20 @@ protected:
         this->set_default_initial_guess(parameters_.default_initial_guess);
         relaxation_factor_ = gko::initialize<matrix::Dense<ValueType>>(
             {parameters_.relaxation_factor}, this->get_executor());
+        if (parameters_.mixed_precision &&
+            std::is_same<lower_precision_type, ValueType>::value) {
+            GKO_INVALID_STATE(
+                "Mixed precision IR requires a double precision solver");
+        }
+        if (parameters_.mixed_precision && parameters_.promoted_solver) {
+            promoted_solver_ = parameters_.promoted_solver->generate(
+                this->get_system_matrix());
+        }
     }
 
 private:
     std::shared_ptr<const LinOp> solver_{};
+    std::shared_ptr<const LinOp> promoted_solver_{};
     std::shared_ptr<const matrix::Dense<ValueType>> relaxation_factor_{};
 };
 
@@ -263,6 +351,12 @@ struct workspace_traits<Ir<ValueType>> {
     constexpr static int one = 2;
     // constant -1.0 scalar
     constexpr static int minus_one = 3;
+    // residual vector in lower precision
+    constexpr static int lower_precision_residual = 4;
+    // inner solution vector in lower precision
+    constexpr static int lower_precision_solution = 5;
+    // residual norm scalars for the stagnation check
+    constexpr static int residual_norm = 6;
 
     // stopping status array
     constexpr static int stop = 0;
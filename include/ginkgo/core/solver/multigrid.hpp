@@ -188,6 +188,15 @@ public:
      */
     void set_cycle(multigrid::cycle cycle) { parameters_.cycle = cycle; }
 
+    /**
+     * Sets the workspace pool of this solver, its smoothers and the solver on
+     * the coarsest level.
+     *
+     * @param pool  the pool to use, or nullptr to let the solvers own their
+     *              workspace vectors
+     */
+    void set_workspace_pool(std::shared_ptr<WorkspacePool> pool) const override;
+
 
     class Factory;
 
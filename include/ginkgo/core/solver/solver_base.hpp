@@ -402,6 +402,34 @@ public:
      */
     virtual std::vector<int> get_workspace_vectors() const { return {}; }
 
+    /**
+     * Sets the pool the workspace vectors are leased from during each
+     * application of the solver. The pool is ignored if it uses a different
+     * executor than the solver.
+     *
+     * @param pool  the pool to use, or nullptr to let the solver own its
+     *              workspace vectors
+     *
+     * @see set_workspace_pool(const LinOp*, std::shared_ptr<WorkspacePool>)
+     *      to set the pool for nested solvers as well
+     */
+    virtual void set_workspace_pool(std::shared_ptr<WorkspacePool> pool) const
+    {
+        if (pool && pool->get_executor() != workspace_.get_executor()) {
+            pool = nullptr;
+        }
+        workspace_.set_pool(std::move(pool));
+    }
+
+    /**
+     * Returns the pool the workspace vectors are leased from, or nullptr if
+     * the solver owns its workspace vectors.
+     */
+    std::shared_ptr<WorkspacePool> get_workspace_pool() const
+    {
+        return workspace_.get_pool();
+    }
+
 protected:
     void set_system_matrix_base(std::shared_ptr<const LinOp> system_matrix)
     {
@@ -413,6 +441,16 @@ protected:
         workspace_.set_size(num_operators, num_arrays);
     }
 
+    /**
+     * Marks the start of an application of the solver. Workspace vectors
+     * leased from the workspace pool stay valid until the returned object is
+     * destroyed.
+     */
+    detail::workspace::scope lease_workspace() const
+    {
+        return detail::workspace::scope{&workspace_};
+    }
+
     template <typename LinOpType>
     LinOpType* create_workspace_op(int vector_id, gko::dim<2> size) const
     {
@@ -639,11 +677,12 @@ protected:
         this->set_system_matrix_base(new_system_matrix);
     }
 
-    void setup_workspace() const
+    detail::workspace::scope setup_workspace() const
     {
         using traits = workspace_traits<DerivedType>;
         this->set_workspace_size(traits::num_vectors(*self()),
                                  traits::num_arrays(*self()));
+        return this->lease_workspace();
     }
 
 private:
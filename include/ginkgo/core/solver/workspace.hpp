@@ -6,10 +6,13 @@
 #define GKO_PUBLIC_CORE_SOLVER_WORKSPACE_HPP_
 
 
+#include <type_traits>
 #include <typeinfo>
+#include <utility>
 
 
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/workspace_pool.hpp>
 
 
 namespace gko {
@@ -75,10 +78,52 @@ private:
 };
 
 
+/**
+ * Type trait for the vector types whose storage can be leased from a
+ * WorkspacePool.
+ */
+template <typename LinOpType>
+struct is_poolable : std::false_type {};
+
+template <typename ValueType>
+struct is_poolable<matrix::Dense<ValueType>> : std::true_type {};
+
+
+/**
+ * Creates a Dense vector whose storage is leased from a WorkspacePool. The
+ * generic overload is never called, it only exists to make the call compile
+ * for vector types that are not poolable.
+ */
+template <typename LinOpType>
+std::unique_ptr<LinOpType> create_pooled_op(
+    const LinOpType*, std::shared_ptr<const Executor>, dim<2>, size_type,
+    WorkspacePool&, array<char>&)
+{
+    return nullptr;
+}
+
+
+template <typename ValueType>
+std::unique_ptr<matrix::Dense<ValueType>> create_pooled_op(
+    const matrix::Dense<ValueType>*, std::shared_ptr<const Executor> exec,
+    dim<2> size, size_type stride, WorkspacePool& pool, array<char>& buffer)
+{
+    const auto num_elems = size[0] * stride;
+    buffer = pool.lease(num_elems * sizeof(ValueType));
+    return matrix::Dense<ValueType>::create(
+        exec, size,
+        make_array_view(exec, num_elems,
+                        reinterpret_cast<ValueType*>(buffer.get_data())),
+        stride);
+}
+
+
 class workspace {
 public:
     workspace(std::shared_ptr<const Executor> exec) : exec_{std::move(exec)} {}
 
+    ~workspace() { this->release_leased(); }
+
     workspace(const workspace& other) : workspace{other.get_executor()} {}
 
     workspace(workspace&& other) : workspace{other.get_executor()}
@@ -86,6 +131,35 @@ public:
         other.clear();
     }
 
+    /**
+     * RAII object marking the duration of a solver application. While a
+     * scope is active, vectors are leased from the pool instead of being
+     * owned by the workspace, and they are returned to the pool when the
+     * outermost scope ends.
+     */
+    class scope {
+    public:
+        explicit scope(workspace* ws) : ws_{ws} { ws_->depth_++; }
+
+        scope(const scope&) = delete;
+
+        scope(scope&& other) : ws_{std::exchange(other.ws_, nullptr)} {}
+
+        scope& operator=(const scope&) = delete;
+
+        scope& operator=(scope&&) = delete;
+
+        ~scope()
+        {
+            if (ws_ && --ws_->depth_ == 0) {
+                ws_->release_leased();
+            }
+        }
+
+    private:
+        workspace* ws_;
+    };
+
     workspace& operator=(const workspace& other) { return *this; }
 
     workspace& operator=(workspace&& other)
@@ -104,6 +178,22 @@ public:
         // vector types may vary e.g. if users derive from Dense
         auto stored_op = operators_[op_id].get();
         LinOpType* op{};
+        if (is_poolable<LinOpType>::value && pool_ && depth_ > 0 &&
+            expected_type == typeid(LinOpType) && size[0] * stride > 0) {
+            op = dynamic_cast<LinOpType*>(stored_op);
+            // leased vectors stay valid until the scope ends
+            if (op && leased_[op_id].get_size() > 0 &&
+                op->get_size() == size && op->get_stride() == stride) {
+                return op;
+            }
+            this->release(op_id);
+            auto new_op =
+                create_pooled_op(static_cast<const LinOpType*>(nullptr),
+                                 exec_, size, stride, *pool_, leased_[op_id]);
+            op = new_op.get();
+            operators_[op_id] = std::move(new_op);
+            return op;
+        }
         if (!stored_op || typeid(*stored_op) != expected_type) {
             auto new_op = create();
             op = new_op.get();
@@ -154,14 +244,31 @@ public:
 
     std::shared_ptr<const Executor> get_executor() const { return exec_; }
 
+    /**
+     * Sets the pool to lease vectors from. Vectors owned by the workspace are
+     * freed, so they can be leased from the pool instead.
+     */
+    void set_pool(std::shared_ptr<WorkspacePool> pool)
+    {
+        this->clear();
+        pool_ = std::move(pool);
+    }
+
+    std::shared_ptr<WorkspacePool> get_pool() const { return pool_; }
+
     void set_size(int num_operators, int num_arrays)
     {
+        if (num_operators < static_cast<int>(operators_.size())) {
+            this->release_leased();
+        }
         operators_.resize(num_operators);
+        leased_.resize(num_operators, array<char>{exec_});
         arrays_.resize(num_arrays);
     }
 
     void clear()
     {
+        this->release_leased();
         for (auto& op : operators_) {
             op.reset();
         }
@@ -171,9 +278,31 @@ public:
     }
 
 private:
+    void release(int op_id)
+    {
+        auto& buffer = leased_[op_id];
+        if (buffer.get_size() > 0) {
+            operators_[op_id].reset();
+            pool_->release(std::move(buffer));
+            buffer = array<char>{exec_};
+        }
+    }
+
+    void release_leased()
+    {
+        for (int op_id = 0; op_id < static_cast<int>(leased_.size());
+             op_id++) {
+            this->release(op_id);
+        }
+    }
+
     std::shared_ptr<const Executor> exec_;
     std::vector<std::unique_ptr<LinOp>> operators_;
     std::vector<any_array> arrays_;
+    std::shared_ptr<WorkspacePool> pool_;
+    // the storage leased from the pool for each operator, or empty arrays
+    std::vector<array<char>> leased_;
+    int depth_{};
 };
 
 
@@ -0,0 +1,132 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_PUBLIC_CORE_SOLVER_WORKSPACE_POOL_HPP_
+#define GKO_PUBLIC_CORE_SOLVER_WORKSPACE_POOL_HPP_
+
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+namespace gko {
+
+
+class LinOp;
+
+
+namespace solver {
+
+
+/**
+ * WorkspacePool is a memory arena that can be shared by a hierarchy of
+ * solvers to store their workspace vectors.
+ *
+ * By default, every solver keeps its own workspace vectors alive between
+ * applications to avoid allocations. In deep preconditioner hierarchies, e.g.
+ * a Multigrid using Ir smoothers wrapping Cg solvers on every level, most of
+ * these vectors are never in use at the same time. When a pool is attached,
+ * the solvers lease the storage of their workspace vectors from the pool at
+ * the start of an application and return it once the application finishes.
+ * Nested solvers lease while their parent is still running, so they obtain
+ * different buffers, while solvers that run one after another, like the
+ * smoothers on different levels, reuse the same buffers. A lease is served by
+ * the smallest available buffer that is large enough, and new buffers are
+ * only allocated if no such buffer exists, so after the first application no
+ * further allocations happen.
+ *
+ * ```cpp
+ * auto pool = gko::solver::WorkspacePool::create(exec);
+ * auto solver = solver_factory->generate(A);
+ * gko::solver::set_workspace_pool(solver.get(), pool);
+ * solver->apply(b, x);
+ * ```
+ *
+ * @note Only workspace vectors of type matrix::Dense, including the scalars
+ *       used by the solvers, are stored in the pool. Arrays and distributed
+ *       vectors remain owned by the individual solvers.
+ * @note The workspace vectors of a solver using a pool are only available
+ *       via get_workspace_op while it is being applied.
+ */
+class WorkspacePool {
+public:
+    /**
+     * Creates an empty pool.
+     *
+     * @param exec  the executor the buffers are allocated on. Only solvers
+     *              on the same executor can use the pool.
+     */
+    static std::shared_ptr<WorkspacePool> create(
+        std::shared_ptr<const Executor> exec);
+
+    /**
+     * Leases a buffer with at least the given size from the pool.
+     *
+     * @param num_bytes  the minimum size of the buffer in bytes
+     *
+     * @return the buffer, which needs to be returned via release once it is no
+     *         longer used
+     */
+    array<char> lease(size_type num_bytes);
+
+    /**
+     * Returns a previously leased buffer to the pool.
+     *
+     * @param buffer  the buffer to return
+     */
+    void release(array<char> buffer);
+
+    /**
+     * Frees all buffers that are not currently leased.
+     */
+    void clear();
+
+    /** Returns the executor of the pool. */
+    std::shared_ptr<const Executor> get_executor() const { return exec_; }
+
+    /** Returns the number of buffers allocated by the pool. */
+    size_type get_num_buffers() const;
+
+    /** Returns the number of buffers that are currently leased. */
+    size_type get_num_leased_buffers() const;
+
+    /** Returns the total size in bytes of all buffers allocated by the pool. */
+    size_type get_allocated_bytes() const;
+
+private:
+    explicit WorkspacePool(std::shared_ptr<const Executor> exec);
+
+    std::shared_ptr<const Executor> exec_;
+    mutable std::mutex mutex_;
+    std::vector<array<char>> available_;
+    size_type num_buffers_;
+    size_type num_leased_;
+    size_type allocated_bytes_;
+};
+
+
+/**
+ * Attaches a workspace pool to a solver and all solvers nested inside it, i.e.
+ * its preconditioner, the inner solver of Ir and the smoothers and coarsest
+ * solvers of Multigrid. Operators that are not solvers or that use a different
+ * executor than the pool are skipped.
+ *
+ * @param op  the solver at the root of the hierarchy
+ * @param pool  the pool to use, or nullptr to let the solvers own their
+ *              workspace vectors again
+ */
+void set_workspace_pool(const LinOp* op, std::shared_ptr<WorkspacePool> pool);
+
+
+}  // namespace solver
+}  // namespace gko
+
+
+#endif  // GKO_PUBLIC_CORE_SOLVER_WORKSPACE_POOL_HPP_
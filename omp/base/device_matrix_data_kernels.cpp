@@ -6,6 +6,8 @@
 
 
 #include <algorithm>
+#include <array>
+#include <numeric>
 
 
 #include <omp.h>
@@ -134,21 +136,288 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SUM_DUPLICATES_KERNEL);
 
 
+namespace {
+
+
+constexpr int radix_bits = 8;
+constexpr int radix = 1 << radix_bits;
+
+
+/** Returns the number of bits necessary to represent all values below size. */
+int num_significant_bits(size_type size)
+{
+    int bits{};
+    while (bits < 64 && (size_type{1} << bits) < size) {
+        bits++;
+    }
+    return bits;
+}
+
+
+/**
+ * Sorts the keys and their associated values by the lowest num_bits bits of
+ * the keys using a stable parallel LSD radix sort. Every pass scatters
+ * between the input and the temporary buffers, so the pointers are swapped
+ * accordingly and point to the sorted data afterwards. The keys are split
+ * into contiguous chunks distributed over the threads by worksharing loops,
+ * so the sort does not depend on the size of the team executing it.
+ */
+template <typename ValueType>
+void radix_sort(std::shared_ptr<const DefaultExecutor> exec, uint64*& keys,
+                ValueType*& values, uint64*& tmp_keys, ValueType*& tmp_values,
+                size_type size, int num_bits)
+{
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    const auto per_chunk = ceildiv(size, num_chunks);
+    // digit-major, chunk-minor counts and output offsets of each chunk
+    vector<size_type> offsets(num_chunks * radix, {exec});
+    for (int shift = 0; shift < num_bits; shift += radix_bits) {
+        bool skip_pass = false;
+#pragma omp parallel
+        {
+#pragma omp for schedule(static)
+            for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+                const auto begin = std::min(size, chunk * per_chunk);
+                const auto end = std::min(size, begin + per_chunk);
+                std::array<size_type, radix> counts{};
+                for (auto i = begin; i < end; i++) {
+                    counts[(keys[i] >> shift) & (radix - 1)]++;
+                }
+                for (int digit = 0; digit < radix; digit++) {
+                    offsets[digit * num_chunks + chunk] = counts[digit];
+                }
+            }
+#pragma omp single
+            {
+                size_type offset{};
+                for (int digit = 0; digit < radix; digit++) {
+                    size_type digit_count{};
+                    for (size_type c = 0; c < num_chunks; c++) {
+                        const auto count = offsets[digit * num_chunks + c];
+                        offsets[digit * num_chunks + c] = offset;
+                        offset += count;
+                        digit_count += count;
+                    }
+                    // all keys have the same digit, the pass is a no-op
+                    skip_pass = skip_pass || digit_count == size;
+                }
+            }
+            if (!skip_pass) {
+#pragma omp for schedule(static)
+                for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+                    const auto begin = std::min(size, chunk * per_chunk);
+                    const auto end = std::min(size, begin + per_chunk);
+                    std::array<size_type, radix> counts{};
+                    for (int digit = 0; digit < radix; digit++) {
+                        counts[digit] = offsets[digit * num_chunks + chunk];
+                    }
+                    for (auto i = begin; i < end; i++) {
+                        const auto out =
+                            counts[(keys[i] >> shift) & (radix - 1)]++;
+                        tmp_keys[out] = keys[i];
+                        tmp_values[out] = values[i];
+                    }
+                }
+            }
+        }
+        if (!skip_pass) {
+            std::swap(keys, tmp_keys);
+            std::swap(values, tmp_values);
+        }
+    }
+}
+
+
+/**
+ * Sorts the entries in row-major order by packing row and column index into a
+ * single key. Returns false if the keys would not fit into 64 bits, in which
+ * case nothing is done. Otherwise, keys and values point to the sorted entries
+ * afterwards, which are stored either in the input values and key_storage or
+ * the temporary value storage and key_storage.
+ */
+template <typename ValueType, typename IndexType>
+bool radix_sort_row_major(std::shared_ptr<const DefaultExecutor> exec,
+                          const dim<2>& size, const IndexType* row_idxs,
+                          const IndexType* col_idxs, ValueType* values,
+                          size_type num_entries, array<uint64>& key_storage,
+                          array<ValueType>& tmp_value_storage, uint64*& keys,
+                          ValueType*& sorted_values)
+{
+    const auto row_bits = num_significant_bits(size[0]);
+    const auto col_bits = num_significant_bits(size[1]);
+    if (row_bits + col_bits > 64) {
+        return false;
+    }
+    key_storage.resize_and_reset(2 * num_entries);
+    tmp_value_storage.resize_and_reset(num_entries);
+    keys = key_storage.get_data();
+    auto tmp_keys = keys + num_entries;
+    sorted_values = values;
+    auto tmp_values = tmp_value_storage.get_data();
+#pragma omp parallel for
+    for (size_type i = 0; i < num_entries; i++) {
+        keys[i] = (static_cast<uint64>(row_idxs[i]) << col_bits) |
+                  static_cast<uint64>(col_idxs[i]);
+    }
+    radix_sort(exec, keys, sorted_values, tmp_keys, tmp_values, num_entries,
+               row_bits + col_bits);
+    return true;
+}
+
+
+}  // namespace
+
+
 template <typename ValueType, typename IndexType>
 void sort_row_major(std::shared_ptr<const DefaultExecutor> exec,
                     device_matrix_data<ValueType, IndexType>& data)
 {
-    array<matrix_data_entry<ValueType, IndexType>> tmp{
-        exec, data.get_num_stored_elements()};
-    soa_to_aos(exec, data, tmp);
-    std::sort(tmp.get_data(), tmp.get_data() + tmp.get_size());
-    aos_to_soa(exec, tmp, data);
+    const auto num_entries = data.get_num_stored_elements();
+    const auto col_bits = num_significant_bits(data.get_size()[1]);
+    array<uint64> key_storage{exec};
+    array<ValueType> tmp_value_storage{exec};
+    uint64* keys{};
+    ValueType* sorted_values{};
+    if (!radix_sort_row_major(exec, data.get_size(), data.get_const_row_idxs(),
+                              data.get_const_col_idxs(), data.get_values(),
+                              num_entries, key_storage, tmp_value_storage,
+                              keys, sorted_values)) {
+        array<matrix_data_entry<ValueType, IndexType>> tmp{exec, num_entries};
+        soa_to_aos(exec, data, tmp);
+        std::sort(tmp.get_data(), tmp.get_data() + tmp.get_size());
+        aos_to_soa(exec, tmp, data);
+        return;
+    }
+    const auto row_idxs = data.get_row_idxs();
+    const auto col_idxs = data.get_col_idxs();
+    const auto values = data.get_values();
+    const auto col_mask = (uint64{1} << col_bits) - 1;
+#pragma omp parallel for
+    for (size_type i = 0; i < num_entries; i++) {
+        row_idxs[i] = static_cast<IndexType>(keys[i] >> col_bits);
+        col_idxs[i] = static_cast<IndexType>(keys[i] & col_mask);
+        if (sorted_values != values) {
+            values[i] = sorted_values[i];
+        }
+    }
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_ROW_MAJOR_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void sort_sum_duplicates(std::shared_ptr<const DefaultExecutor> exec,
+                         const dim<2>& size, array<ValueType>& values,
+                         array<IndexType>& row_idxs,
+                         array<IndexType>& col_idxs, bool filter_zeros)
+{
+    const auto num_entries = values.get_size();
+    const auto col_bits = num_significant_bits(size[1]);
+    array<uint64> key_storage{exec};
+    array<ValueType> tmp_value_storage{exec};
+    uint64* keys{};
+    ValueType* sorted_values{};
+    if (!radix_sort_row_major(exec, size, row_idxs.get_const_data(),
+                              col_idxs.get_const_data(), values.get_data(),
+                              num_entries, key_storage, tmp_value_storage,
+                              keys, sorted_values)) {
+        device_matrix_data<ValueType, IndexType> data{
+            exec, size, std::move(row_idxs), std::move(col_idxs),
+            std::move(values)};
+        sort_row_major(exec, data);
+        auto arrays = data.empty_out();
+        sum_duplicates(exec, size[0], arrays.values, arrays.row_idxs,
+                       arrays.col_idxs);
+        if (filter_zeros) {
+            remove_zeros(exec, arrays.values, arrays.row_idxs,
+                         arrays.col_idxs);
+        }
+        values = std::move(arrays.values);
+        row_idxs = std::move(arrays.row_idxs);
+        col_idxs = std::move(arrays.col_idxs);
+        return;
+    }
+    const auto num_chunks = static_cast<size_type>(omp_get_max_threads());
+    const auto per_chunk = ceildiv(num_entries, num_chunks);
+    // every chunk starts at the first entry of a run of duplicates, so every
+    // run is reduced by a single chunk
+    vector<size_type> bounds(num_chunks + 1, num_entries, {exec});
+    vector<size_type> out_offsets(num_chunks + 1, {exec});
+    const auto col_mask = (uint64{1} << col_bits) - 1;
+    // sums up the run of duplicates starting at begin, returns its end
+    auto reduce_run = [&](size_type begin, ValueType& sum) {
+        sum = zero<ValueType>();
+        auto end = begin;
+        for (; end < num_entries && keys[end] == keys[begin]; end++) {
+            sum += sorted_values[end];
+        }
+        return end;
+    };
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            auto begin = std::min(num_entries, chunk * per_chunk);
+            while (begin > 0 && begin < num_entries &&
+                   keys[begin] == keys[begin - 1]) {
+                begin++;
+            }
+            bounds[chunk] = begin;
+        }
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+            size_type count{};
+            ValueType sum{};
+            for (auto i = bounds[chunk]; i < bounds[chunk + 1];) {
+                i = reduce_run(i, sum);
+                count += !filter_zeros || is_nonzero(sum);
+            }
+            out_offsets[chunk + 1] = count;
+        }
+    }
+    std::partial_sum(out_offsets.begin(), out_offsets.end(),
+                     out_offsets.begin());
+    const auto out_size = out_offsets.back();
+    // without duplicates and zeros, every entry stays at its position, so
+    // the output can overwrite the input
+    const auto in_place = out_size == num_entries;
+    const auto new_size = in_place ? size_type{} : out_size;
+    array<ValueType> new_values{exec, new_size};
+    array<IndexType> new_row_idxs{exec, new_size};
+    array<IndexType> new_col_idxs{exec, new_size};
+    const auto out_values =
+        in_place ? values.get_data() : new_values.get_data();
+    const auto out_rows =
+        in_place ? row_idxs.get_data() : new_row_idxs.get_data();
+    const auto out_cols =
+        in_place ? col_idxs.get_data() : new_col_idxs.get_data();
+#pragma omp parallel for schedule(static)
+    for (size_type chunk = 0; chunk < num_chunks; chunk++) {
+        auto out = out_offsets[chunk];
+        ValueType sum{};
+        for (auto i = bounds[chunk]; i < bounds[chunk + 1];) {
+            const auto next = reduce_run(i, sum);
+            if (!filter_zeros || is_nonzero(sum)) {
+                out_rows[out] = static_cast<IndexType>(keys[i] >> col_bits);
+                out_cols[out] = static_cast<IndexType>(keys[i] & col_mask);
+                out_values[out] = sum;
+                out++;
+            }
+            i = next;
+        }
+    }
+    if (!in_place) {
+        values = std::move(new_values);
+        row_idxs = std::move(new_row_idxs);
+        col_idxs = std::move(new_col_idxs);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_DEVICE_MATRIX_DATA_SORT_SUM_DUPLICATES_KERNEL);
+
+
 }  // namespace components
 }  // namespace omp
 }  // namespace kernels
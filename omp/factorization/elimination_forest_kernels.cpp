@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/factorization/elimination_forest_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The elimination forest namespace.
+ *
+ * @ingroup factor
+ */
+namespace elimination_forest {
+
+
+/** The minimum number of rows handled by a single thread. */
+constexpr int min_rows_per_chunk = 1024;
+
+
+/**
+ * Processes the edges (child, row) of the graph in Liu's algorithm, where the
+ * rows must be visited in increasing order. ancestors stores the current
+ * root of the compressed path for every vertex shifted by offset, and
+ * add_edge is called for every new edge in the elimination forest.
+ */
+template <typename IndexType, typename EdgeCallback>
+void add_to_forest(IndexType child, IndexType row, IndexType* ancestors,
+                   IndexType offset, EdgeCallback add_edge)
+{
+    const auto invalid = invalid_index<IndexType>();
+    auto node = child;
+    // compress the path from child to its current root
+    while (ancestors[node - offset] != invalid &&
+           ancestors[node - offset] != row) {
+        const auto next = ancestors[node - offset];
+        ancestors[node - offset] = row;
+        node = next;
+    }
+    if (ancestors[node - offset] == invalid) {
+        ancestors[node - offset] = row;
+        add_edge(node, row);
+    }
+}
+
+
+template <typename IndexType>
+void compute_parents(std::shared_ptr<const DefaultExecutor> exec,
+                     const IndexType* row_ptrs, const IndexType* cols,
+                     IndexType size, IndexType* parents)
+{
+    const auto invalid = invalid_index<IndexType>();
+    // pseudo-root one past the last row to deal with disconnected matrices
+    std::fill_n(parents, size, size);
+    const auto num_chunks = std::max<IndexType>(
+        std::min<IndexType>(omp_get_max_threads(), size / min_rows_per_chunk),
+        1);
+    vector<IndexType> ancestors(size, invalid, exec);
+    if (num_chunks == 1) {
+        for (IndexType row = 0; row < size; row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (cols[nz] < row) {
+                    add_to_forest(cols[nz], row, ancestors.data(), IndexType{},
+                                  [&](IndexType child, IndexType parent) {
+                                      parents[child] = parent;
+                                  });
+                }
+            }
+        }
+        return;
+    }
+    // The elimination forest of a graph is the elimination forest of the
+    // union of the elimination forests of any decomposition of its edges.
+    // Thus we compute the forests of the lower triangles of row blocks with
+    // balanced nonzero counts independently, and then merge their edges,
+    // which are much fewer than the nonzeros of the input.
+    vector<IndexType> chunk_begins(num_chunks + 1, exec);
+    const auto nnz = row_ptrs[size];
+    for (IndexType chunk = 0; chunk < num_chunks; chunk++) {
+        const auto chunk_nnz_begin = static_cast<IndexType>(
+            static_cast<int64>(nnz) * chunk / num_chunks);
+        chunk_begins[chunk] = static_cast<IndexType>(
+            std::lower_bound(row_ptrs, row_ptrs + size, chunk_nnz_begin) -
+            row_ptrs);
+    }
+    chunk_begins[num_chunks] = size;
+    vector<vector<std::pair<IndexType, IndexType>>> chunk_edges(
+        num_chunks, vector<std::pair<IndexType, IndexType>>(exec), exec);
+#pragma omp parallel for schedule(static, 1)
+    for (IndexType chunk = 0; chunk < num_chunks; chunk++) {
+        const auto begin = chunk_begins[chunk];
+        const auto end = chunk_begins[chunk + 1];
+        // only the columns between the smallest column index and the end of
+        // the chunk can appear in its forest
+        auto offset = begin;
+        for (auto nz = row_ptrs[begin]; nz < row_ptrs[end]; nz++) {
+            offset = std::min(offset, cols[nz]);
+        }
+        vector<IndexType> local_ancestors(end - offset, invalid, exec);
+        auto& edges = chunk_edges[chunk];
+        for (auto row = begin; row < end; row++) {
+            for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+                if (cols[nz] < row) {
+                    add_to_forest(cols[nz], row, local_ancestors.data(),
+                                  offset,
+                                  [&](IndexType child, IndexType parent) {
+                                      edges.emplace_back(child, parent);
+                                  });
+                }
+            }
+        }
+    }
+    // the edges are sorted by their parent inside each chunk, and the chunks
+    // are sorted by their rows, so they can be merged in order
+    for (const auto& edges : chunk_edges) {
+        for (const auto& edge : edges) {
+            add_to_forest(edge.first, edge.second, ancestors.data(),
+                          IndexType{}, [&](IndexType child, IndexType parent) {
+                              parents[child] = parent;
+                          });
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL);
+
+
+}  // namespace elimination_forest
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
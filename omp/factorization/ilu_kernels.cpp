@@ -5,6 +5,19 @@
 #include "core/factorization/ilu_kernels.hpp"
 
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+
+#include <ginkgo/core/base/math.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/fbcsr_block_inverse.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace omp {
@@ -24,6 +37,190 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void initialize_block_row_ptrs_l_u(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+    IndexType* l_row_ptrs, IndexType* u_row_ptrs)
+{
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto num_rows =
+        static_cast<IndexType>(system_matrix->get_num_block_rows());
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        // the diagonal block is always stored in both factors
+        IndexType l_count{1};
+        IndexType u_count{1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            l_count += col_idxs[nz] < row;
+            u_count += col_idxs[nz] > row;
+        }
+        l_row_ptrs[row] = l_count;
+        u_row_ptrs[row] = u_count;
+    }
+    components::prefix_sum_nonnegative(exec, l_row_ptrs, num_rows + 1);
+    components::prefix_sum_nonnegative(exec, u_row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL);
+
+
+namespace {
+
+
+/** Computes out = a * b for column-major blocks. */
+template <typename ValueType>
+void block_mult(int bs, const ValueType* a, const ValueType* b,
+                ValueType* out)
+{
+    std::fill_n(out, bs * bs, zero<ValueType>());
+    for (int j = 0; j < bs; j++) {
+        for (int k = 0; k < bs; k++) {
+            const auto b_val = b[k + j * bs];
+#pragma omp simd
+            for (int i = 0; i < bs; i++) {
+                out[i + j * bs] += a[i + k * bs] * b_val;
+            }
+        }
+    }
+}
+
+
+/** Computes out -= a * b for column-major blocks. */
+template <typename ValueType>
+void block_mult_sub(int bs, const ValueType* a, const ValueType* b,
+                    ValueType* out)
+{
+    for (int j = 0; j < bs; j++) {
+        for (int k = 0; k < bs; k++) {
+            const auto b_val = b[k + j * bs];
+#pragma omp simd
+            for (int i = 0; i < bs; i++) {
+                out[i + j * bs] -= a[i + k * bs] * b_val;
+            }
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void compute_block_lu(std::shared_ptr<const DefaultExecutor> exec,
+                      const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+                      matrix::Fbcsr<ValueType, IndexType>* l_factor,
+                      matrix::Fbcsr<ValueType, IndexType>* u_factor)
+{
+    const int bs = system_matrix->get_block_size();
+    const auto bs2 = bs * bs;
+    const auto num_rows =
+        static_cast<IndexType>(system_matrix->get_num_block_rows());
+    const auto num_cols = system_matrix->get_num_block_cols();
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto vals = system_matrix->get_const_values();
+    const auto l_row_ptrs = l_factor->get_const_row_ptrs();
+    const auto l_col_idxs = l_factor->get_col_idxs();
+    const auto l_vals = l_factor->get_values();
+    const auto u_row_ptrs = u_factor->get_const_row_ptrs();
+    const auto u_col_idxs = u_factor->get_col_idxs();
+    const auto u_vals = u_factor->get_values();
+    vector<std::atomic<int>> row_done(num_rows, exec);
+    // copy the blocks into the factors, the diagonal block is stored last in L
+    // and first in U
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        row_done[row].store(0, std::memory_order_relaxed);
+        auto l_nz = l_row_ptrs[row];
+        auto u_nz = u_row_ptrs[row] + 1;
+        u_col_idxs[u_row_ptrs[row]] = row;
+        std::fill_n(u_vals + u_row_ptrs[row] * bs2, bs2, zero<ValueType>());
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            ValueType* out{};
+            if (col < row) {
+                l_col_idxs[l_nz] = col;
+                out = l_vals + l_nz * bs2;
+                l_nz++;
+            } else if (col == row) {
+                out = u_vals + u_row_ptrs[row] * bs2;
+            } else {
+                u_col_idxs[u_nz] = col;
+                out = u_vals + u_nz * bs2;
+                u_nz++;
+            }
+            std::copy_n(vals + nz * bs2, bs2, out);
+        }
+        l_col_idxs[l_nz] = row;
+        const auto l_diag = l_vals + l_nz * bs2;
+        for (int i = 0; i < bs2; i++) {
+            l_diag[i] =
+                i % (bs + 1) == 0 ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+    vector<ValueType> inv_diag(num_rows * bs2, exec);
+    // a block row can be eliminated as soon as the rows of U it depends on are
+    // finished, so rows are handed out in increasing order and wait for the
+    // completion flags of their dependencies. This processes the wavefronts
+    // of the block dependency graph in parallel, and cannot deadlock since the
+    // smallest unfinished row never waits.
+    std::atomic<IndexType> next_row{0};
+#pragma omp parallel
+    {
+        // dense lookup table from block columns to the blocks of the current
+        // row, reused for all rows of a thread
+        vector<ValueType*> row_blocks(num_cols, nullptr, exec);
+        vector<ValueType> scratch(bs2, exec);
+        for (auto row = next_row++; row < num_rows; row = next_row++) {
+            const auto l_end = l_row_ptrs[row + 1] - 1;
+            for (auto nz = l_row_ptrs[row]; nz < l_end; nz++) {
+                row_blocks[l_col_idxs[nz]] = l_vals + nz * bs2;
+            }
+            for (auto nz = u_row_ptrs[row]; nz < u_row_ptrs[row + 1]; nz++) {
+                row_blocks[u_col_idxs[nz]] = u_vals + nz * bs2;
+            }
+            for (auto l_nz = l_row_ptrs[row]; l_nz < l_end; l_nz++) {
+                const auto dep = l_col_idxs[l_nz];
+                while (row_done[dep].load(std::memory_order_acquire) == 0) {
+                    // don't starve the row we wait for if the threads are
+                    // oversubscribed
+                    std::this_thread::yield();
+                }
+                // L_ik = A_ik * inv(U_kk)
+                const auto l_block = l_vals + l_nz * bs2;
+                block_mult(bs, l_block, inv_diag.data() + dep * bs2,
+                           scratch.data());
+                std::copy(scratch.begin(), scratch.end(), l_block);
+                // A_ij -= L_ik * U_kj for all U_kj in the pattern of row i
+                for (auto u_nz = u_row_ptrs[dep] + 1;
+                     u_nz < u_row_ptrs[dep + 1]; u_nz++) {
+                    const auto out = row_blocks[u_col_idxs[u_nz]];
+                    if (out) {
+                        block_mult_sub(bs, l_block, u_vals + u_nz * bs2, out);
+                    }
+                }
+            }
+            std::copy_n(u_vals + u_row_ptrs[row] * bs2, bs2, scratch.begin());
+            matrix::fbcsr::invert_block(bs, scratch.data(),
+                                        inv_diag.data() + row * bs2);
+            for (auto nz = l_row_ptrs[row]; nz < l_end; nz++) {
+                row_blocks[l_col_idxs[nz]] = nullptr;
+            }
+            for (auto nz = u_row_ptrs[row]; nz < u_row_ptrs[row + 1]; nz++) {
+                row_blocks[u_col_idxs[nz]] = nullptr;
+            }
+            row_done[row].store(1, std::memory_order_release);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL);
+
+
 }  // namespace ilu_factorization
 }  // namespace omp
 }  // namespace kernels
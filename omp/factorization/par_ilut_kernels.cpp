@@ -6,6 +6,9 @@
 
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -20,6 +23,7 @@
 #include <ginkgo/core/matrix/dense.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/base/utils.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
 #include "core/matrix/coo_builder.hpp"
@@ -436,6 +440,259 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_PAR_ILUT_ADD_CANDIDATES_KERNEL);
 
 
+/**
+ * Computes row `row` of the ILUT(p, tau) factors using Saad's dual dropping
+ * strategy: Entries of the work row with a magnitude below the drop tolerance
+ * relative to the row norm are dropped, and only the largest `l_limit` lower
+ * and `u_limit` upper off-diagonal entries are kept.
+ * The rows of U the current row depends on are only known during the
+ * elimination, so wait_for_row(k) is called before row k of U is read.
+ * The kept entries are stored in l_cols/l_vals and u_cols/u_vals, the lower
+ * row with its unit diagonal last, the upper row with its diagonal first.
+ * Returns the number of entries stored for L and U.
+ */
+template <typename ValueType, typename IndexType, typename WaitCallback>
+std::pair<IndexType, IndexType> ilut_factorize_row(
+    IndexType row, const matrix::Csr<ValueType, IndexType>* a,
+    remove_complex<ValueType> drop_tolerance, IndexType l_limit,
+    IndexType u_limit, const IndexType* u_slot_ptrs, const IndexType* u_sizes,
+    const IndexType* slot_u_cols, const ValueType* slot_u_vals,
+    IndexType* l_cols, ValueType* l_vals, IndexType* u_cols,
+    ValueType* u_vals, ValueType* work, IndexType* work_marker,
+    vector<IndexType>& lower_heap, vector<IndexType>& lower_cols,
+    vector<IndexType>& upper_cols, WaitCallback wait_for_row)
+{
+    const auto a_row_ptrs = a->get_const_row_ptrs();
+    const auto a_cols = a->get_const_col_idxs();
+    const auto a_vals = a->get_const_values();
+    lower_heap.clear();
+    lower_cols.clear();
+    upper_cols.clear();
+    remove_complex<ValueType> row_norm{};
+    // scatter the row of A into the dense work row
+    for (auto nz = a_row_ptrs[row]; nz < a_row_ptrs[row + 1]; ++nz) {
+        const auto col = a_cols[nz];
+        work_marker[col] = row;
+        work[col] = a_vals[nz];
+        row_norm += squared_norm(a_vals[nz]);
+        if (col < row) {
+            lower_heap.push_back(col);
+        } else if (col > row) {
+            upper_cols.push_back(col);
+        }
+    }
+    row_norm = sqrt(row_norm);
+    const auto threshold = drop_tolerance * row_norm;
+    if (work_marker[row] != row) {
+        work_marker[row] = row;
+        work[row] = zero<ValueType>();
+    }
+    // eliminate the lower entries in increasing column order, including the
+    // fill-in created during the elimination
+    std::make_heap(lower_heap.begin(), lower_heap.end(),
+                   std::greater<IndexType>{});
+    while (!lower_heap.empty()) {
+        std::pop_heap(lower_heap.begin(), lower_heap.end(),
+                      std::greater<IndexType>{});
+        const auto k = lower_heap.back();
+        lower_heap.pop_back();
+        wait_for_row(k);
+        const auto u_begin = u_slot_ptrs[k];
+        const auto u_end = u_begin + u_sizes[k];
+        const auto l_val = work[k] / slot_u_vals[u_begin];
+        work[k] = l_val;
+        if (is_zero(l_val) || abs(l_val) < threshold) {
+            continue;
+        }
+        lower_cols.push_back(k);
+        for (auto nz = u_begin + 1; nz < u_end; ++nz) {
+            const auto col = slot_u_cols[nz];
+            if (work_marker[col] != row) {
+                work_marker[col] = row;
+                work[col] = zero<ValueType>();
+                if (col < row) {
+                    lower_heap.push_back(col);
+                    std::push_heap(lower_heap.begin(), lower_heap.end(),
+                                   std::greater<IndexType>{});
+                } else if (col > row) {
+                    upper_cols.push_back(col);
+                }
+            }
+            work[col] -= l_val * slot_u_vals[nz];
+        }
+    }
+    // keep the largest entries, break ties by column index
+    const auto larger = [&](IndexType col_a, IndexType col_b) {
+        const auto abs_a = abs(work[col_a]);
+        const auto abs_b = abs(work[col_b]);
+        return abs_a > abs_b || (abs_a == abs_b && col_a < col_b);
+    };
+    const auto select_largest = [&](vector<IndexType>& cols, IndexType limit) {
+        cols.erase(std::remove_if(cols.begin(), cols.end(),
+                                  [&](IndexType col) {
+                                      return is_zero(work[col]) ||
+                                             abs(work[col]) < threshold;
+                                  }),
+                   cols.end());
+        if (static_cast<IndexType>(cols.size()) > limit) {
+            std::nth_element(cols.begin(), cols.begin() + limit, cols.end(),
+                             larger);
+            cols.erase(cols.begin() + limit, cols.end());
+        }
+        std::sort(cols.begin(), cols.end());
+    };
+    select_largest(lower_cols, l_limit);
+    select_largest(upper_cols, u_limit);
+    IndexType l_size{};
+    for (const auto col : lower_cols) {
+        l_cols[l_size] = col;
+        l_vals[l_size] = work[col];
+        l_size++;
+    }
+    l_cols[l_size] = row;
+    l_vals[l_size] = one<ValueType>();
+    l_size++;
+    auto diag = work[row];
+    if (is_zero(diag)) {
+        // replace zero pivots like Saad's ILUT
+        diag = static_cast<ValueType>(
+            (remove_complex<ValueType>{1e-4} + drop_tolerance) * row_norm);
+        if (is_zero(diag)) {
+            diag = one<ValueType>();
+        }
+    }
+    IndexType u_size{};
+    u_cols[u_size] = row;
+    u_vals[u_size] = diag;
+    u_size++;
+    for (const auto col : upper_cols) {
+        u_cols[u_size] = col;
+        u_vals[u_size] = work[col];
+        u_size++;
+    }
+    return {l_size, u_size};
+}
+
+
+template <typename ValueType, typename IndexType>
+void row_wise_factorize(std::shared_ptr<const DefaultExecutor> exec,
+                        const matrix::Csr<ValueType, IndexType>* a,
+                        remove_complex<ValueType> drop_tolerance,
+                        double fill_in_limit,
+                        matrix::Csr<ValueType, IndexType>* l,
+                        matrix::Csr<ValueType, IndexType>* u)
+{
+    const auto num_rows = static_cast<IndexType>(a->get_size()[0]);
+    const auto a_row_ptrs = a->get_const_row_ptrs();
+    const auto a_cols = a->get_const_col_idxs();
+    // the row sizes of the ILU(0) factors scaled by the fill-in limit bound
+    // the row sizes of the ILUT factors, so every row gets a fixed slot
+    vector<IndexType> l_limits(num_rows, exec);
+    vector<IndexType> u_limits(num_rows, exec);
+    vector<IndexType> l_slot_ptrs(num_rows + 1, exec);
+    vector<IndexType> u_slot_ptrs(num_rows + 1, exec);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        IndexType lower_count{};
+        IndexType upper_count{};
+        for (auto nz = a_row_ptrs[row]; nz < a_row_ptrs[row + 1]; ++nz) {
+            lower_count += a_cols[nz] < row;
+            upper_count += a_cols[nz] > row;
+        }
+        l_limits[row] = std::max<IndexType>(
+            static_cast<IndexType>(fill_in_limit * (lower_count + 1)) - 1, 0);
+        u_limits[row] = std::max<IndexType>(
+            static_cast<IndexType>(fill_in_limit * (upper_count + 1)) - 1, 0);
+        l_slot_ptrs[row] = l_limits[row] + 1;
+        u_slot_ptrs[row] = u_limits[row] + 1;
+    }
+    components::prefix_sum_nonnegative(exec, l_slot_ptrs.data(), num_rows + 1);
+    components::prefix_sum_nonnegative(exec, u_slot_ptrs.data(), num_rows + 1);
+    vector<IndexType> slot_l_cols(l_slot_ptrs[num_rows], exec);
+    vector<ValueType> slot_l_vals(l_slot_ptrs[num_rows], exec);
+    vector<IndexType> slot_u_cols(u_slot_ptrs[num_rows], exec);
+    vector<ValueType> slot_u_vals(u_slot_ptrs[num_rows], exec);
+    vector<IndexType> u_sizes(num_rows, exec);
+    auto l_row_ptrs = l->get_row_ptrs();
+    auto u_row_ptrs = u->get_row_ptrs();
+    const auto num_cols = a->get_size()[1];
+    // a row can only be computed once all rows of U it depends on are
+    // finished. These dependencies are only discovered during the
+    // elimination, so rows are handed out in increasing order and wait for
+    // the completion flags of their dependencies. This processes the
+    // wavefronts of the dependency graph in parallel without a symbolic
+    // phase, and cannot deadlock since the smallest unfinished row never
+    // waits.
+    vector<std::atomic<int>> row_done(num_rows, exec);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        row_done[row].store(0, std::memory_order_relaxed);
+    }
+    std::atomic<IndexType> next_row{0};
+#pragma omp parallel
+    {
+        // dense work row and index lists, reused for all rows of a thread
+        vector<ValueType> work(num_cols, zero<ValueType>(), exec);
+        vector<IndexType> work_marker(num_cols, invalid_index<IndexType>(),
+                                      exec);
+        vector<IndexType> lower_heap(exec);
+        vector<IndexType> lower_cols(exec);
+        vector<IndexType> upper_cols(exec);
+        for (auto row = next_row++; row < num_rows; row = next_row++) {
+            const auto sizes = ilut_factorize_row(
+                row, a, drop_tolerance, l_limits[row], u_limits[row],
+                u_slot_ptrs.data(), u_sizes.data(), slot_u_cols.data(),
+                slot_u_vals.data(), slot_l_cols.data() + l_slot_ptrs[row],
+                slot_l_vals.data() + l_slot_ptrs[row],
+                slot_u_cols.data() + u_slot_ptrs[row],
+                slot_u_vals.data() + u_slot_ptrs[row], work.data(),
+                work_marker.data(), lower_heap, lower_cols, upper_cols,
+                [&](IndexType dep) {
+                    while (row_done[dep].load(std::memory_order_acquire) ==
+                           0) {
+                        // don't starve the row we wait for if the threads
+                        // are oversubscribed
+                        std::this_thread::yield();
+                    }
+                });
+            l_row_ptrs[row] = sizes.first;
+            u_row_ptrs[row] = sizes.second;
+            u_sizes[row] = sizes.second;
+            row_done[row].store(1, std::memory_order_release);
+        }
+    }
+    // compact the slots into the factors
+    components::prefix_sum_nonnegative(exec, l_row_ptrs, num_rows + 1);
+    components::prefix_sum_nonnegative(exec, u_row_ptrs, num_rows + 1);
+    matrix::CsrBuilder<ValueType, IndexType> l_builder{l};
+    matrix::CsrBuilder<ValueType, IndexType> u_builder{u};
+    l_builder.get_col_idx_array().resize_and_reset(l_row_ptrs[num_rows]);
+    l_builder.get_value_array().resize_and_reset(l_row_ptrs[num_rows]);
+    u_builder.get_col_idx_array().resize_and_reset(u_row_ptrs[num_rows]);
+    u_builder.get_value_array().resize_and_reset(u_row_ptrs[num_rows]);
+    auto l_cols = l->get_col_idxs();
+    auto l_vals = l->get_values();
+    auto u_cols = u->get_col_idxs();
+    auto u_vals = u->get_values();
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        const auto l_size = l_row_ptrs[row + 1] - l_row_ptrs[row];
+        const auto u_size = u_row_ptrs[row + 1] - u_row_ptrs[row];
+        std::copy_n(slot_l_cols.data() + l_slot_ptrs[row], l_size,
+                    l_cols + l_row_ptrs[row]);
+        std::copy_n(slot_l_vals.data() + l_slot_ptrs[row], l_size,
+                    l_vals + l_row_ptrs[row]);
+        std::copy_n(slot_u_cols.data() + u_slot_ptrs[row], u_size,
+                    u_cols + u_row_ptrs[row]);
+        std::copy_n(slot_u_vals.data() + u_slot_ptrs[row], u_size,
+                    u_vals + u_row_ptrs[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_PAR_ILUT_ROW_WISE_FACTORIZE_KERNEL);
+
+
 }  // namespace par_ilut_factorization
 }  // namespace omp
 }  // namespace kernels
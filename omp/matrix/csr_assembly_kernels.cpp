@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/csr_assembly_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/csr_lookup.hpp"
+#include "omp/components/atomic.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The Csr assembly namespace.
+ * @ref CsrAssembler
+ * @ingroup csr_assembly
+ */
+namespace csr_assembly {
+
+
+/**
+ * Builds the pattern in a single counting pass: the entries contributed by
+ * the elements, including duplicates, are counted per row and scattered into
+ * a row-wise buffer, whose rows are then sorted and made unique independently.
+ */
+template <typename IndexType>
+void build_pattern(std::shared_ptr<const DefaultExecutor> exec,
+                   const IndexType* element_dofs, size_type num_elements,
+                   size_type dofs_per_element, size_type num_rows,
+                   size_type num_dofs, IndexType* row_ptrs,
+                   array<IndexType>& col_idxs, IndexType& max_dof)
+{
+    auto max = invalid_index<IndexType>();
+#pragma omp parallel for reduction(max : max)
+    for (size_type i = 0; i < num_elements * dofs_per_element; i++) {
+        max = std::max(max, element_dofs[i]);
+    }
+    max_dof = max;
+    // the caller reports the out-of-bounds degree of freedom
+    if (max >= 0 && static_cast<size_type>(max) >= num_dofs) {
+        return;
+    }
+    const auto num_valid_dofs = [&](const IndexType* dofs) {
+        return static_cast<int64>(
+            std::count_if(dofs, dofs + dofs_per_element,
+                          [](IndexType dof) { return dof >= 0; }));
+    };
+    // the row pointers of the buffer, which contains duplicate entries
+    vector<int64> buffer_ptrs(num_rows + 1, 0, {exec});
+#pragma omp parallel for
+    for (size_type element = 0; element < num_elements; element++) {
+        const auto dofs = element_dofs + element * dofs_per_element;
+        const auto num_valid = num_valid_dofs(dofs);
+        for (size_type i = 0; i < dofs_per_element; i++) {
+            if (dofs[i] >= 0) {
+#pragma omp atomic
+                buffer_ptrs[dofs[i]] += num_valid;
+            }
+        }
+    }
+    components::prefix_sum_nonnegative(exec, buffer_ptrs.data(),
+                                       num_rows + 1);
+    vector<int64> fill_ptrs(buffer_ptrs.begin(), buffer_ptrs.end(), {exec});
+    vector<IndexType> buffer(buffer_ptrs[num_rows], {exec});
+#pragma omp parallel for
+    for (size_type element = 0; element < num_elements; element++) {
+        const auto dofs = element_dofs + element * dofs_per_element;
+        const auto num_valid = num_valid_dofs(dofs);
+        for (size_type i = 0; i < dofs_per_element; i++) {
+            if (dofs[i] < 0) {
+                continue;
+            }
+            int64 out{};
+#pragma omp atomic capture
+            {
+                out = fill_ptrs[dofs[i]];
+                fill_ptrs[dofs[i]] += num_valid;
+            }
+            for (size_type j = 0; j < dofs_per_element; j++) {
+                if (dofs[j] >= 0) {
+                    buffer[out++] = dofs[j];
+                }
+            }
+        }
+    }
+#pragma omp parallel for schedule(static, 256)
+    for (size_type row = 0; row < num_rows; row++) {
+        const auto begin = buffer.begin() + buffer_ptrs[row];
+        const auto end = buffer.begin() + buffer_ptrs[row + 1];
+        std::sort(begin, end);
+        row_ptrs[row] =
+            static_cast<IndexType>(std::unique(begin, end) - begin);
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+    col_idxs.resize_and_reset(row_ptrs[num_rows]);
+    const auto out_cols = col_idxs.get_data();
+#pragma omp parallel for schedule(static, 256)
+    for (size_type row = 0; row < num_rows; row++) {
+        std::copy_n(buffer.begin() + buffer_ptrs[row],
+                    row_ptrs[row + 1] - row_ptrs[row],
+                    out_cols + row_ptrs[row]);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_elements(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* element_dofs,
+                  const ValueType* element_values, size_type num_elements,
+                  size_type dofs_per_element, size_type num_dofs,
+                  const IndexType* row_ptrs, const IndexType* col_idxs,
+                  const IndexType* storage_offsets, const int64* row_desc,
+                  const int32* storage, ValueType* values, IndexType& max_dof)
+{
+    // out-of-bounds degrees of freedom are skipped and reported by the caller
+    const auto is_valid = [&](IndexType dof) {
+        return dof >= 0 && static_cast<size_type>(dof) < num_dofs;
+    };
+    auto max = invalid_index<IndexType>();
+    // elements sharing degrees of freedom update the same entries, so the
+    // updates need to be atomic
+#pragma omp parallel for reduction(max : max)
+    for (size_type element = 0; element < num_elements; element++) {
+        const auto dofs = element_dofs + element * dofs_per_element;
+        const auto local_values =
+            element_values + element * dofs_per_element * dofs_per_element;
+        for (size_type i = 0; i < dofs_per_element; i++) {
+            const auto row = dofs[i];
+            max = std::max(max, row);
+            if (!is_valid(row)) {
+                continue;
+            }
+            const matrix::csr::device_sparsity_lookup<IndexType> lookup{
+                row_ptrs, col_idxs, storage_offsets, storage, row_desc,
+                static_cast<size_type>(row)};
+            for (size_type j = 0; j < dofs_per_element; j++) {
+                const auto col = dofs[j];
+                const auto local_idx =
+                    is_valid(col) ? lookup[col] : invalid_index<IndexType>();
+                if (local_idx != invalid_index<IndexType>()) {
+                    atomic_add(values[row_ptrs[row] + local_idx],
+                               local_values[i * dofs_per_element + j]);
+                }
+            }
+        }
+    }
+    max_dof = max;
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_values(std::shared_ptr<const DefaultExecutor> exec,
+                const IndexType* row_idxs, const IndexType* entry_cols,
+                const ValueType* entry_values, size_type num_entries,
+                size_type num_rows, size_type num_cols,
+                const IndexType* row_ptrs, const IndexType* col_idxs,
+                const IndexType* storage_offsets, const int64* row_desc,
+                const int32* storage, ValueType* values, IndexType& max_row,
+                IndexType& max_col)
+{
+    auto local_max_row = invalid_index<IndexType>();
+    auto local_max_col = invalid_index<IndexType>();
+#pragma omp parallel for reduction(max : local_max_row, local_max_col)
+    for (size_type i = 0; i < num_entries; i++) {
+        const auto row = row_idxs[i];
+        const auto col = entry_cols[i];
+        local_max_row = std::max(local_max_row, row);
+        local_max_col = std::max(local_max_col, col);
+        // out-of-bounds entries are skipped and reported by the caller
+        if (row < 0 || col < 0 || static_cast<size_type>(row) >= num_rows ||
+            static_cast<size_type>(col) >= num_cols) {
+            continue;
+        }
+        const matrix::csr::device_sparsity_lookup<IndexType> lookup{
+            row_ptrs, col_idxs, storage_offsets, storage, row_desc,
+            static_cast<size_type>(row)};
+        const auto local_idx = lookup[col];
+        if (local_idx != invalid_index<IndexType>()) {
+            atomic_add(values[row_ptrs[row] + local_idx], entry_values[i]);
+        }
+    }
+    max_row = local_max_row;
+    max_col = local_max_col;
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL);
+
+
+}  // namespace csr_assembly
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <numeric>
+#include <type_traits>
 #include <utility>
 
 
@@ -27,6 +28,7 @@
 #include "core/base/utils.hpp"
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/fbcsr_block_inverse.hpp"
 #include "core/synthesizer/implementation_selection.hpp"
 
 
@@ -41,44 +43,132 @@ namespace omp {
 namespace fbcsr {
 
 
-template <typename ValueType, typename IndexType>
-void spmv(std::shared_ptr<const OmpExecutor> exec,
-          const matrix::Fbcsr<ValueType, IndexType>* const a,
-          const matrix::Dense<ValueType>* const b,
-          matrix::Dense<ValueType>* const c)
+namespace {
+
+
+/** Checks whether specialized kernels are compiled for the block size. */
+bool is_compiled_block_size(int block_size)
 {
-    const int bs = a->get_block_size();
-    const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
-    const IndexType nbrows = a->get_num_block_rows();
-    const size_type nbnz = a->get_num_stored_blocks();
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    const acc::range<acc::block_col_major<const ValueType, 3>> avalues{
-        to_std_array<acc::size_type>(nbnz, bs, bs), a->get_const_values()};
+    const auto compiled_sizes = syn::as_array(fixedblock::compiled_kernels());
+    return std::find(compiled_sizes.begin(), compiled_sizes.end(),
+                     block_size) != compiled_sizes.end();
+}
 
-#pragma omp parallel for
-    for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
-        for (IndexType row = ibrow * bs; row < (ibrow + 1) * bs; ++row) {
-            for (IndexType rhs = 0; rhs < nvecs; rhs++) {
-                c->at(row, rhs) = zero<ValueType>();
+
+/**
+ * Computes a block row of the product of an Fbcsr matrix with a dense matrix
+ * into the local buffer `sum`, which stores the block_size x num_rhs result
+ * in column-major order. The dense micro-kernel for each block is vectorized
+ * over the rows of the block.
+ */
+template <typename ValueType, typename IndexType, typename BlockSize>
+void spmv_block_row(BlockSize block_size, IndexType ibrow,
+                    const IndexType* row_ptrs, const IndexType* col_idxs,
+                    const ValueType* values,
+                    const matrix::Dense<ValueType>* b, ValueType* sum)
+{
+    const int bs = block_size;
+    const auto nvecs = b->get_size()[1];
+    std::fill_n(sum, bs * nvecs, zero<ValueType>());
+    for (auto inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1]; ++inz) {
+        const auto block = values + inz * bs * bs;
+        const auto col_base = col_idxs[inz] * bs;
+        for (size_type j = 0; j < nvecs; ++j) {
+            const auto local_sum = sum + j * bs;
+            for (int jb = 0; jb < bs; jb++) {
+                const auto b_val = b->at(col_base + jb, j);
+#pragma omp simd
+                for (int ib = 0; ib < bs; ib++) {
+                    local_sum[ib] += block[ib + jb * bs] * b_val;
+                }
             }
         }
-        for (IndexType inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
-             ++inz) {
-            for (int ib = 0; ib < bs; ib++) {
-                const IndexType row = ibrow * bs + ib;
-                for (int jb = 0; jb < bs; jb++) {
-                    const auto val = avalues(inz, ib, jb);
-                    const auto col = col_idxs[inz] * bs + jb;
-                    for (size_type j = 0; j < nvecs; ++j) {
-                        c->at(row, j) += val * b->at(col, j);
-                    }
+    }
+}
+
+
+template <typename ValueType, typename IndexType, typename BlockSize,
+          typename OutputOp>
+void spmv_blocks(std::shared_ptr<const OmpExecutor> exec,
+                 BlockSize block_size,
+                 const matrix::Fbcsr<ValueType, IndexType>* a,
+                 const matrix::Dense<ValueType>* b,
+                 matrix::Dense<ValueType>* c, OutputOp out_op)
+{
+    const int bs = block_size;
+    const auto nvecs = b->get_size()[1];
+    const auto nbrows = static_cast<IndexType>(a->get_num_block_rows());
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto values = a->get_const_values();
+#pragma omp parallel
+    {
+        vector<ValueType> sum(bs * nvecs, exec);
+#pragma omp for
+        for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
+            spmv_block_row(block_size, ibrow, row_ptrs, col_idxs, values, b,
+                           sum.data());
+            for (size_type j = 0; j < nvecs; ++j) {
+                for (int ib = 0; ib < bs; ib++) {
+                    const auto row = ibrow * bs + ib;
+                    c->at(row, j) = out_op(sum[ib + j * bs], c->at(row, j));
                 }
             }
         }
     }
 }
 
+
+template <int block_size, typename ValueType, typename IndexType,
+          typename OutputOp>
+void spmv_impl(syn::value_list<int, block_size>,
+               std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* a,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+               OutputOp out_op)
+{
+    spmv_blocks(exec, std::integral_constant<int, block_size>{}, a, b, c,
+                out_op);
+}
+
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_spmv, spmv_impl);
+
+
+/**
+ * Dispatches to a kernel specialized for the block size of the matrix if one
+ * is compiled, and to the generic kernel otherwise.
+ */
+template <typename ValueType, typename IndexType, typename OutputOp>
+void dispatch_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Fbcsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* c, OutputOp out_op)
+{
+    const int bs = a->get_block_size();
+    if (is_compiled_block_size(bs)) {
+        select_spmv(
+            fixedblock::compiled_kernels(),
+            [bs](int compiled_block_size) { return bs == compiled_block_size; },
+            syn::value_list<int>(), syn::type_list<>(), exec, a, b, c, out_op);
+    } else {
+        spmv_blocks(exec, bs, a, b, c, out_op);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Fbcsr<ValueType, IndexType>* const a,
+          const matrix::Dense<ValueType>* const b,
+          matrix::Dense<ValueType>* const c)
+{
+    dispatch_spmv(exec, a, b, c,
+                  [](ValueType sum, ValueType) { return sum; });
+}
+
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_FBCSR_SPMV_KERNEL);
 
 
@@ -90,37 +180,11 @@ void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
                    const matrix::Dense<ValueType>* const beta,
                    matrix::Dense<ValueType>* const c)
 {
-    const int bs = a->get_block_size();
-    const auto nvecs = static_cast<IndexType>(b->get_size()[1]);
-    const IndexType nbrows = a->get_num_block_rows();
-    const size_type nbnz = a->get_num_stored_blocks();
-    auto row_ptrs = a->get_const_row_ptrs();
-    auto col_idxs = a->get_const_col_idxs();
-    auto valpha = alpha->at(0, 0);
-    auto vbeta = beta->at(0, 0);
-    const acc::range<acc::block_col_major<const ValueType, 3>> avalues{
-        to_std_array<acc::size_type>(nbnz, bs, bs), a->get_const_values()};
-
-#pragma omp parallel for
-    for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
-        for (IndexType row = ibrow * bs; row < (ibrow + 1) * bs; ++row) {
-            for (IndexType rhs = 0; rhs < nvecs; rhs++) {
-                c->at(row, rhs) *= vbeta;
-            }
-        }
-        for (IndexType inz = row_ptrs[ibrow]; inz < row_ptrs[ibrow + 1];
-             ++inz) {
-            for (int ib = 0; ib < bs; ib++) {
-                const IndexType row = ibrow * bs + ib;
-                for (int jb = 0; jb < bs; jb++) {
-                    const auto val = avalues(inz, ib, jb);
-                    const auto col = col_idxs[inz] * bs + jb;
-                    for (size_type j = 0; j < nvecs; ++j)
-                        c->at(row, j) += valpha * val * b->at(col, j);
-                }
-            }
-        }
-    }
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    dispatch_spmv(exec, a, b, c, [valpha, vbeta](ValueType sum, ValueType old) {
+        return valpha * sum + vbeta * old;
+    });
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
@@ -474,6 +538,194 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void invert_diagonal_blocks(std::shared_ptr<const OmpExecutor> exec,
+                            const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                            ValueType* inv_diag_blocks)
+{
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto values = mtx->get_const_values();
+    const int bs = mtx->get_block_size();
+    const auto bs2 = bs * bs;
+    const IndexType nbrows = mtx->get_num_block_rows();
+#pragma omp parallel
+    {
+        vector<ValueType> block(bs2, exec);
+#pragma omp for
+        for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
+            std::fill(block.begin(), block.end(), zero<ValueType>());
+            for (auto idx = row_ptrs[ibrow]; idx < row_ptrs[ibrow + 1];
+                 ++idx) {
+                if (col_idxs[idx] == ibrow) {
+                    std::copy_n(values + idx * bs2, bs2, block.begin());
+                }
+            }
+            matrix::fbcsr::invert_block(bs, block.data(),
+                                        inv_diag_blocks + ibrow * bs2);
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL);
+
+
+namespace {
+
+
+/**
+ * Solves a block triangular system for a single right-hand side, visiting the
+ * block rows in the order given by `first_row`, `end_row` and `step`. Only the
+ * blocks in columns accepted by `is_off_diagonal` are eliminated, the diagonal
+ * block is applied via its precomputed inverse.
+ */
+template <typename ValueType, typename IndexType, typename BlockSize,
+          typename Predicate>
+void block_trs_rhs(BlockSize block_size,
+                   const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                   const ValueType* inv_diag_blocks, IndexType first_row,
+                   IndexType end_row, IndexType step, size_type rhs,
+                   const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* x, ValueType* residual,
+                   Predicate is_off_diagonal)
+{
+    const int bs = block_size;
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto values = mtx->get_const_values();
+    for (auto ibrow = first_row; ibrow != end_row; ibrow += step) {
+        for (int ib = 0; ib < bs; ib++) {
+            residual[ib] = b->at(ibrow * bs + ib, rhs);
+        }
+        for (auto idx = row_ptrs[ibrow]; idx < row_ptrs[ibrow + 1]; ++idx) {
+            const auto col = col_idxs[idx];
+            if (!is_off_diagonal(col, ibrow)) {
+                continue;
+            }
+            const auto block = values + idx * bs * bs;
+            for (int jb = 0; jb < bs; jb++) {
+                const auto x_val = x->at(col * bs + jb, rhs);
+#pragma omp simd
+                for (int ib = 0; ib < bs; ib++) {
+                    residual[ib] -= block[ib + jb * bs] * x_val;
+                }
+            }
+        }
+        if (inv_diag_blocks) {
+            const auto inv_diag = inv_diag_blocks + ibrow * bs * bs;
+            for (int ib = 0; ib < bs; ib++) {
+                x->at(ibrow * bs + ib, rhs) = zero<ValueType>();
+            }
+            for (int jb = 0; jb < bs; jb++) {
+                const auto res_val = residual[jb];
+                for (int ib = 0; ib < bs; ib++) {
+                    x->at(ibrow * bs + ib, rhs) +=
+                        inv_diag[ib + jb * bs] * res_val;
+                }
+            }
+        } else {
+            for (int ib = 0; ib < bs; ib++) {
+                x->at(ibrow * bs + ib, rhs) = residual[ib];
+            }
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType, typename BlockSize>
+void block_trs(std::shared_ptr<const OmpExecutor> exec, BlockSize block_size,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks, bool lower,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    const IndexType nbrows = mtx->get_num_block_rows();
+    const auto nrhs = b->get_size()[1];
+#pragma omp parallel
+    {
+        vector<ValueType> residual(static_cast<int>(block_size), exec);
+#pragma omp for
+        for (size_type rhs = 0; rhs < nrhs; ++rhs) {
+            if (lower) {
+                block_trs_rhs(
+                    block_size, mtx, inv_diag_blocks, IndexType{}, nbrows,
+                    IndexType{1}, rhs, b, x, residual.data(),
+                    [](IndexType col, IndexType row) { return col < row; });
+            } else {
+                block_trs_rhs(
+                    block_size, mtx, inv_diag_blocks, nbrows - 1,
+                    IndexType{-1}, IndexType{-1}, rhs, b, x, residual.data(),
+                    [](IndexType col, IndexType row) { return col > row; });
+            }
+        }
+    }
+}
+
+
+template <int block_size, typename ValueType, typename IndexType>
+void block_trs_impl(syn::value_list<int, block_size>,
+                    std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                    const ValueType* inv_diag_blocks, bool lower,
+                    const matrix::Dense<ValueType>* b,
+                    matrix::Dense<ValueType>* x)
+{
+    block_trs(exec, std::integral_constant<int, block_size>{}, mtx,
+              inv_diag_blocks, lower, b, x);
+}
+
+GKO_ENABLE_IMPLEMENTATION_SELECTION(select_block_trs, block_trs_impl);
+
+
+template <typename ValueType, typename IndexType>
+void dispatch_block_trs(std::shared_ptr<const OmpExecutor> exec,
+                        const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                        const ValueType* inv_diag_blocks, bool lower,
+                        const matrix::Dense<ValueType>* b,
+                        matrix::Dense<ValueType>* x)
+{
+    const int bs = mtx->get_block_size();
+    if (is_compiled_block_size(bs)) {
+        select_block_trs(
+            fixedblock::compiled_kernels(),
+            [bs](int compiled_block_size) { return bs == compiled_block_size; },
+            syn::value_list<int>(), syn::type_list<>(), exec, mtx,
+            inv_diag_blocks, lower, b, x);
+    } else {
+        block_trs(exec, bs, mtx, inv_diag_blocks, lower, b, x);
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void lower_trs(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    dispatch_block_trs(exec, mtx, inv_diag_blocks, true, b, x);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void upper_trs(std::shared_ptr<const OmpExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    dispatch_block_trs(exec, mtx, inv_diag_blocks, false, b, x);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL);
+
+
 }  // namespace fbcsr
 }  // namespace omp
 }  // namespace kernels
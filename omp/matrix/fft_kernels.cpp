@@ -5,6 +5,14 @@
 #include "core/matrix/fft_kernels.hpp"
 
 
+#include <algorithm>
+#include <array>
+#include <complex>
+
+
+#include <omp.h>
+
+
 #include <ginkgo/core/base/exception_helpers.hpp>
 #include <ginkgo/core/base/math.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
@@ -24,39 +32,268 @@ namespace omp {
 namespace fft {
 
 
-template <typename InValueType, typename OutValueType>
-void bfly(const matrix::Dense<InValueType>* b, matrix::Dense<OutValueType>* x,
-          int64 lo, int64 hi, OutValueType root)
+/**
+ * Transforms whose working set has at most this many entries are completed
+ * block by block, so all of their remaining passes run in cache.
+ */
+constexpr int64 cache_block_size = 1 << 14;
+
+/** The minimum number of entries a thread processes in a single task. */
+constexpr int64 min_chunk_size = 1 << 10;
+
+/** The number of int64 values preceding the twiddle tables in the buffer. */
+constexpr int num_header_entries = 8;
+
+
+/**
+ * A batch of 1D transforms along one axis of a multidimensional FFT: Row
+ * (outer, pos, inner) of the input and output is stored at row
+ * (outer * length + pos) * num_inner + inner.
+ */
+struct axis_layout {
+    int64 num_outer;
+    int64 length;
+    int64 num_inner;
+};
+
+
+/**
+ * Strided access to the entries of a row-major Dense matrix.
+ */
+template <typename ValueType>
+struct strided_view {
+    ValueType* values;
+    int64 stride;
+};
+
+
+/**
+ * Complex multiplication without the overflow handling of std::complex,
+ * which prevents vectorization.
+ */
+template <typename ValueType>
+inline std::complex<ValueType> mul(std::complex<ValueType> a,
+                                   std::complex<ValueType> b)
+{
+    return {a.real() * b.real() - a.imag() * b.imag(),
+            a.real() * b.imag() + a.imag() * b.real()};
+}
+
+
+/**
+ * Calls fn(in_offset, out_offset) for the entries [begin, end) of a group of
+ * rows, where entries are enumerated row by row.
+ */
+template <typename ValueType, typename Fn>
+inline void for_each_entry(const strided_view<const ValueType>& in,
+                           const strided_view<ValueType>& out, int64 nrhs,
+                           int64 begin, int64 end, Fn fn)
+{
+    if (in.stride == nrhs && out.stride == nrhs) {
+        // contiguous rows, so the loop can be vectorized
+        for (auto entry = begin; entry < end; entry++) {
+            fn(entry, entry);
+        }
+    } else {
+        for (auto entry = begin; entry < end; entry++) {
+            const auto row = entry / nrhs;
+            const auto col = entry % nrhs;
+            fn(row * in.stride + col, row * out.stride + col);
+        }
+    }
+}
+
+
+/**
+ * Applies the butterflies [group_begin, group_end) of a decimation in
+ * frequency pass to the entries [entry_begin, entry_end) of each row group of
+ * the given outer index. For block size m >= 4, this combines the radix-2
+ * passes with block size m and m / 2 into a radix-4 pass, for m = 2 it is a
+ * radix-2 pass. twiddles points to the twiddle tables of the axis.
+ */
+template <typename ValueType>
+void apply_pass(const strided_view<const std::complex<ValueType>>& in,
+                const strided_view<std::complex<ValueType>>& out, int64 nrhs,
+                const axis_layout& axis,
+                const std::complex<ValueType>* twiddles, int64 outer, int64 m,
+                int64 group_begin, int64 group_end, int64 entry_begin,
+                int64 entry_end)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        auto lo_val = b->at(lo, rhs);
-        auto hi_val = b->at(hi, rhs);
-        x->at(lo, rhs) = lo_val + hi_val;
-        x->at(hi, rhs) = (lo_val - hi_val) * root;
+    using complex_type = std::complex<ValueType>;
+    const auto group_rows = axis.num_inner;
+    const auto row_of = [&](int64 pos) {
+        return (outer * axis.length + pos) * group_rows;
+    };
+    // the table for block size m starts at offset length - m
+    const auto tw = twiddles + (axis.length - m);
+    if (m == 2) {
+        for (auto group = group_begin; group < group_end; group++) {
+            const auto row0 = row_of(2 * group);
+            const auto row1 = row0 + group_rows;
+            const strided_view<const complex_type> in0{
+                in.values + row0 * in.stride, in.stride};
+            const auto in1 = in.values + row1 * in.stride;
+            const strided_view<complex_type> out0{
+                out.values + row0 * out.stride, out.stride};
+            const auto out1 = out.values + row1 * out.stride;
+            for_each_entry(in0, out0, nrhs, entry_begin, entry_end,
+                           [&](int64 in_idx, int64 out_idx) {
+                               const auto a = in0.values[in_idx];
+                               const auto b = in1[in_idx];
+                               out0.values[out_idx] = a + b;
+                               out1[out_idx] = a - b;
+                           });
+        }
+        return;
+    }
+    const auto quarter = m / 4;
+    const auto tw_half = twiddles + (axis.length - m / 2);
+    for (auto group = group_begin; group < group_end; group++) {
+        const auto block = group / quarter;
+        const auto k = group % quarter;
+        const auto row0 = row_of(block * m + k);
+        const auto row_step = quarter * group_rows;
+        const strided_view<const complex_type> in0{
+            in.values + row0 * in.stride, in.stride};
+        const strided_view<complex_type> out0{out.values + row0 * out.stride,
+                                              out.stride};
+        const auto in_step = row_step * in.stride;
+        const auto out_step = row_step * out.stride;
+        const auto w1 = tw[k];
+        const auto w2 = tw[k + quarter];
+        const auto w3 = tw_half[k];
+        for_each_entry(
+            in0, out0, nrhs, entry_begin, entry_end,
+            [&](int64 in_idx, int64 out_idx) {
+                const auto a = in0.values[in_idx];
+                const auto b = in0.values[in_idx + in_step];
+                const auto c = in0.values[in_idx + 2 * in_step];
+                const auto d = in0.values[in_idx + 3 * in_step];
+                const auto t0 = a + c;
+                const auto t1 = b + d;
+                const auto t2 = mul(a - c, w1);
+                const auto t3 = mul(b - d, w2);
+                out0.values[out_idx] = t0 + t1;
+                out0.values[out_idx + out_step] = mul(t0 - t1, w3);
+                out0.values[out_idx + 2 * out_step] = t2 + t3;
+                out0.values[out_idx + 3 * out_step] = mul(t2 - t3, w3);
+            });
     }
 }
 
 
+/** Returns the number of butterfly groups of a pass with block size m. */
+inline int64 num_groups(const axis_layout& axis, int64 m)
+{
+    return m == 2 ? axis.length / 2 : axis.length / 4;
+}
+
+
+/**
+ * Computes the 1D transforms along one axis using decimation in frequency,
+ * leaving the results in bit-reversed order. Passes over blocks that do not
+ * fit into cache are parallelized over butterflies and row entries. Once the
+ * blocks fit into cache, each thread completes all remaining passes on its
+ * blocks.
+ */
 template <typename ValueType>
-void bfly(matrix::Dense<ValueType>* x, int64 lo, int64 hi, ValueType root)
+void transform_axis(const strided_view<const std::complex<ValueType>>& in,
+                    const strided_view<std::complex<ValueType>>& out,
+                    int64 nrhs, const axis_layout& axis,
+                    const std::complex<ValueType>* twiddles)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        auto lo_val = x->at(lo, rhs);
-        auto hi_val = x->at(hi, rhs);
-        x->at(lo, rhs) = lo_val + hi_val;
-        x->at(hi, rhs) = (lo_val - hi_val) * root;
+    using complex_type = std::complex<ValueType>;
+    const strided_view<const complex_type> out_as_in{out.values, out.stride};
+    const auto num_entries = axis.num_inner * nrhs;
+    auto first_pass = true;
+    auto m = axis.length;
+    for (; m >= 2 && m * num_entries > cache_block_size;
+         m = m == 2 ? 1 : m / 4) {
+        const auto& src = first_pass ? in : out_as_in;
+        const auto groups = num_groups(axis, m);
+        const auto num_chunks =
+            std::max<int64>(num_entries / min_chunk_size, 1);
+        const auto chunk_size = ceildiv(num_entries, num_chunks);
+        const auto num_tasks = axis.num_outer * groups * num_chunks;
+#pragma omp parallel for
+        for (int64 task = 0; task < num_tasks; task++) {
+            const auto chunk = task % num_chunks;
+            const auto group = task / num_chunks % groups;
+            const auto outer = task / num_chunks / groups;
+            apply_pass(src, out, nrhs, axis, twiddles, outer, m, group,
+                       group + 1, chunk * chunk_size,
+                       std::min((chunk + 1) * chunk_size, num_entries));
+        }
+        first_pass = false;
+    }
+    if (m < 2) {
+        return;
+    }
+    // the remaining blocks of size m fit into cache
+    const auto block_size = m;
+    const auto num_blocks = axis.length / block_size;
+    const auto& block_src = first_pass ? in : out_as_in;
+#pragma omp parallel for
+    for (int64 task = 0; task < axis.num_outer * num_blocks; task++) {
+        const auto block = task % num_blocks;
+        const auto outer = task / num_blocks;
+        const auto* src = &block_src;
+        for (auto cur_m = block_size; cur_m >= 2;
+             cur_m = cur_m == 2 ? 1 : cur_m / 4) {
+            const auto groups_per_block =
+                num_groups(axis, cur_m) / num_blocks;
+            apply_pass(*src, out, nrhs, axis, twiddles, outer, cur_m,
+                       block * groups_per_block,
+                       (block + 1) * groups_per_block, 0, num_entries);
+            src = &out_as_in;
+        }
     }
 }
 
 
+/**
+ * Returns the twiddle tables for the given FFT sizes, which are cached in the
+ * buffer of the Fft object. For each axis of length n, the table for block
+ * size m contains the m / 2 roots of unity w_m^k at offset n - m.
+ */
 template <typename ValueType>
-void bit_rev_swap(matrix::Dense<ValueType>* x, int64 i, int64 rev_i)
+const std::complex<ValueType>* get_twiddles(
+    std::shared_ptr<const DefaultExecutor> exec, array<char>& buffer,
+    const std::array<int64, 3>& sizes, int64 sign)
 {
-    for (size_type rhs = 0; rhs < x->get_size()[1]; rhs++) {
-        if (i < rev_i) {
-            std::swap(x->at(i, rhs), x->at(rev_i, rhs));
+    using complex_type = std::complex<ValueType>;
+    const std::array<int64, num_header_entries> header{
+        {sizes[0], sizes[1], sizes[2], sign,
+         static_cast<int64>(sizeof(ValueType))}};
+    const auto header_bytes = sizeof(int64) * num_header_entries;
+    const auto total_length = sizes[0] + sizes[1] + sizes[2];
+    const auto required_bytes =
+        header_bytes + sizeof(complex_type) * total_length;
+    const auto is_cached =
+        buffer.get_size() == required_bytes &&
+        std::equal(header.begin(), header.end(),
+                   reinterpret_cast<const int64*>(buffer.get_const_data()));
+    if (!is_cached) {
+        buffer.set_executor(exec);
+        buffer.resize_and_reset(required_bytes);
+        std::copy(header.begin(), header.end(),
+                  reinterpret_cast<int64*>(buffer.get_data()));
+        auto table = reinterpret_cast<complex_type*>(buffer.get_data() +
+                                                     header_bytes);
+        for (auto length : sizes) {
+            for (auto m = length; m >= 2; m /= 2) {
+                const auto tw = table + (length - m);
+#pragma omp parallel for
+                for (int64 k = 0; k < m / 2; k++) {
+                    tw[k] = unit_root<complex_type>(length,
+                                                    sign * k * (length / m));
+                }
+            }
+            table += length;
         }
     }
+    return reinterpret_cast<const complex_type*>(buffer.get_const_data() +
+                                                 header_bytes);
 }
 
 
@@ -70,15 +307,82 @@ int64 bit_rev(int64 i, int64 size)
 }
 
 
+/**
+ * Computes the multidimensional FFT of the rows of b, with the row index
+ * interpreted as a row-major index of the given sizes.
+ */
 template <typename ValueType>
-vector<ValueType> build_unit_roots(std::shared_ptr<const DefaultExecutor> exec,
-                                   int64 size, int64 sign)
+void fft_nd(std::shared_ptr<const DefaultExecutor> exec,
+            const matrix::Dense<std::complex<ValueType>>* b,
+            matrix::Dense<std::complex<ValueType>>* x,
+            const std::array<int64, 3>& sizes, bool inverse,
+            array<char>& buffer)
 {
-    vector<ValueType> roots(size / 2, {exec});
-    for (int64 i = 0; i < size / 2; i++) {
-        roots[i] = unit_root<ValueType>(size, sign * i);
+    using complex_type = std::complex<ValueType>;
+    const int64 sign = inverse ? 1 : -1;
+    const auto nrhs = static_cast<int64>(b->get_size()[1]);
+    for (auto length : sizes) {
+        GKO_ASSERT_IS_POWER_OF_TWO(length);
+    }
+    const auto twiddles = get_twiddles<ValueType>(exec, buffer, sizes, sign);
+    const strided_view<const complex_type> in{
+        b->get_const_values(), static_cast<int64>(b->get_stride())};
+    const strided_view<complex_type> out{x->get_values(),
+                                         static_cast<int64>(x->get_stride())};
+    const strided_view<const complex_type> out_as_in{out.values, out.stride};
+    const auto num_rows = sizes[0] * sizes[1] * sizes[2];
+    // minor dimension first, only the first transform reads from b
+    auto first = true;
+    auto twiddle_offset = sizes[0] + sizes[1];
+    for (int axis = 2; axis >= 0; axis--) {
+        const auto length = sizes[axis];
+        const auto num_inner = axis == 2   ? int64{1}
+                               : axis == 1 ? sizes[2]
+                                           : sizes[1] * sizes[2];
+        if (length > 1) {
+            transform_axis(first ? in : out_as_in, out, nrhs,
+                           axis_layout{num_rows / (length * num_inner), length,
+                                       num_inner},
+                           twiddles + twiddle_offset);
+            first = false;
+        }
+        twiddle_offset -= axis > 0 ? sizes[axis - 1] : 0;
+    }
+    if (first) {
+        // all sizes are 1, so the transform is the identity
+        for (int64 rhs = 0; rhs < nrhs; rhs++) {
+            out.values[rhs] = in.values[rhs];
+        }
+        return;
+    }
+    // bit reversal
+    vector<int64> rev(sizes[0] + sizes[1] + sizes[2], exec);
+    auto rev1 = rev.data();
+    auto rev2 = rev1 + sizes[0];
+    auto rev3 = rev2 + sizes[1];
+    for (int64 i = 0; i < sizes[0]; i++) {
+        rev1[i] = bit_rev(i, sizes[0]) * sizes[1] * sizes[2];
+    }
+    for (int64 i = 0; i < sizes[1]; i++) {
+        rev2[i] = bit_rev(i, sizes[1]) * sizes[2];
+    }
+    for (int64 i = 0; i < sizes[2]; i++) {
+        rev3[i] = bit_rev(i, sizes[2]);
+    }
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; row++) {
+        const auto i3 = row % sizes[2];
+        const auto i2 = row / sizes[2] % sizes[1];
+        const auto i1 = row / sizes[2] / sizes[1];
+        const auto rev_row = rev1[i1] + rev2[i2] + rev3[i3];
+        if (row < rev_row) {
+            const auto row_values = out.values + row * out.stride;
+            const auto rev_values = out.values + rev_row * out.stride;
+            for (int64 rhs = 0; rhs < nrhs; rhs++) {
+                std::swap(row_values[rhs], rev_values[rhs]);
+            }
+        }
     }
-    return roots;
 }
 
 
@@ -88,37 +392,8 @@ void fft(std::shared_ptr<const DefaultExecutor> exec,
          matrix::Dense<std::complex<ValueType>>* x, bool inverse,
          array<char>& buffer)
 {
-    using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
-    const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto size = static_cast<int64>(b->get_size()[0]);
-    GKO_ASSERT_IS_POWER_OF_TWO(size);
-    auto roots = build_unit_roots<complex_type>(exec, size, sign);
-    // first butterfly step
-    auto d = size / 2;
-#pragma omp parallel for
-    for (int64 k = 0; k < size / 2; k++) {
-        bfly(b, x, k, k + d, roots[k]);
-    }
-    // remaining butterfly steps
-    for (d = size / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots[i] = roots[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 base = 0; base < size; base += d * 2) {
-            for (int64 k = base; k < base + d; k++) {
-                bfly(x, k, k + d, roots[k - base]);
-            }
-        }
-    }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k = 0; k < size; k++) {
-        bit_rev_swap(x, k, bit_rev(k, size));
-    }
+    fft_nd(exec, b, x, {{1, 1, static_cast<int64>(b->get_size()[0])}},
+           inverse, buffer);
 }
 
 GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT_KERNEL);
@@ -130,66 +405,9 @@ void fft2(std::shared_ptr<const DefaultExecutor> exec,
           matrix::Dense<std::complex<ValueType>>* x, size_type size1,
           size_type size2, bool inverse, array<char>& buffer)
 {
-    using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
-    const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto ssize1 = static_cast<int64>(size1);
-    const auto ssize2 = static_cast<int64>(size2);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize1);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize2);
-    const auto idx = [&](int64 x, int64 y) { return x * ssize2 + y; };
-    auto roots1 = build_unit_roots<complex_type>(exec, ssize1, sign);
-    auto roots2 = build_unit_roots<complex_type>(exec, ssize2, sign);
-    // minor dimension first: size1 FFTs
-    // first butterfly step
-    auto d = ssize2 / 2;
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2 / 2; k2++) {
-            bfly(b, x, idx(k1, k2), idx(k1, k2 + d), roots2[k2]);
-        }
-    }
-    // remaining butterfly steps
-    for (d = ssize2 / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots2[i] = roots2[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 k1 = 0; k1 < ssize1; k1++) {
-            for (int64 base = 0; base < ssize2; base += d * 2) {
-                for (int64 k2 = base; k2 < base + d; k2++) {
-                    bfly(x, idx(k1, k2), idx(k1, k2 + d), roots2[k2 - base]);
-                }
-            }
-        }
-    }
-    // then major dimension: 1 ssize2-wide FFT
-    // butterfly steps
-    for (d = ssize1 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize1; base += d * 2) {
-            for (int64 k1 = base; k1 < base + d; k1++) {
-                auto root = roots1[k1 - base];
-                for (int64 k2 = 0; k2 < ssize2; k2++) {
-                    bfly(x, idx(k1, k2), idx(k1 + d, k2), root);
-                }
-            }
-        }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots1[i] = roots1[2 * i];
-        }
-    }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            bit_rev_swap(x, idx(k1, k2),
-                         idx(bit_rev(k1, ssize1), bit_rev(k2, ssize2)));
-        }
-    }
+    fft_nd(exec, b, x,
+           {{1, static_cast<int64>(size1), static_cast<int64>(size2)}},
+           inverse, buffer);
 }
 
 GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT2_KERNEL);
@@ -201,100 +419,10 @@ void fft3(std::shared_ptr<const DefaultExecutor> exec,
           matrix::Dense<std::complex<ValueType>>* x, size_type size1,
           size_type size2, size_type size3, bool inverse, array<char>& buffer)
 {
-    using complex_type = std::complex<ValueType>;
-    using real_type = ValueType;
-    const int64 sign = inverse ? 1 : -1;
-    const auto nrhs = b->get_size()[1];
-    const auto ssize1 = static_cast<int64>(size1);
-    const auto ssize2 = static_cast<int64>(size2);
-    const auto ssize3 = static_cast<int64>(size3);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize1);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize2);
-    GKO_ASSERT_IS_POWER_OF_TWO(ssize3);
-    const auto idx = [&](int64 x, int64 y, int64 z) {
-        return x * ssize2 * ssize3 + y * ssize3 + z;
-    };
-    auto roots1 = build_unit_roots<complex_type>(exec, ssize1, sign);
-    auto roots2 = build_unit_roots<complex_type>(exec, ssize2, sign);
-    auto roots3 = build_unit_roots<complex_type>(exec, ssize3, sign);
-    // minor dimension first: size1*size2 FFTs
-    // first butterfly step
-    auto d = ssize3 / 2;
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            for (int64 k3 = 0; k3 < ssize3 / 2; k3++) {
-                bfly(b, x, idx(k1, k2, k3), idx(k1, k2, k3 + d), roots3[k3]);
-            }
-        }
-    }
-    // remaining butterfly steps
-    for (d = ssize3 / 4; d > 0; d /= 2) {
-        // square roots
-        for (int64 i = 0; i < d; i++) {
-            roots3[i] = roots3[2 * i];
-        }
-#pragma omp parallel for
-        for (int64 k1 = 0; k1 < ssize1; k1++) {
-            for (int64 k2 = 0; k2 < ssize2; k2++) {
-                for (int64 base = 0; base < ssize3; base += d * 2) {
-                    for (int64 k3 = base; k3 < base + d; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1, k2, k3 + d),
-                             roots3[k3 - base]);
-                    }
-                }
-            }
-        }
-    }
-    // then second dimension: 1 ssize1*ssize3-wide FFT
-    // butterfly steps
-    for (d = ssize2 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize2; base += d * 2) {
-            for (int64 k2 = base; k2 < base + d; k2++) {
-                auto root = roots2[k2 - base];
-                for (int64 k1 = 0; k1 < ssize1; k1++) {
-                    for (int64 k3 = 0; k3 < ssize3; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1, k2 + d, k3), root);
-                    }
-                }
-            }
-        }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots2[i] = roots2[2 * i];
-        }
-    }
-    // then major dimension: 1 ssize2*ssize3-wide FFT
-    // butterfly steps
-    for (d = ssize1 / 2; d > 0; d /= 2) {
-#pragma omp parallel for
-        for (int64 base = 0; base < ssize1; base += d * 2) {
-            for (int64 k1 = base; k1 < base + d; k1++) {
-                auto root = roots1[k1 - base];
-                for (int64 k2 = 0; k2 < ssize2; k2++) {
-                    for (int64 k3 = 0; k3 < ssize3; k3++) {
-                        bfly(x, idx(k1, k2, k3), idx(k1 + d, k2, k3), root);
-                    }
-                }
-            }
-        }
-        // square roots
-        for (int64 i = 0; i < d / 2; i++) {
-            roots1[i] = roots1[2 * i];
-        }
-    }
-// bit reversal
-#pragma omp parallel for
-    for (int64 k1 = 0; k1 < ssize1; k1++) {
-        for (int64 k2 = 0; k2 < ssize2; k2++) {
-            for (int64 k3 = 0; k3 < ssize3; k3++) {
-                bit_rev_swap(x, idx(k1, k2, k3),
-                             idx(bit_rev(k1, ssize1), bit_rev(k2, ssize2),
-                                 bit_rev(k3, ssize3)));
-            }
-        }
-    }
+    fft_nd(exec, b, x,
+           {{static_cast<int64>(size1), static_cast<int64>(size2),
+             static_cast<int64>(size3)}},
+           inverse, buffer);
 }
 
 GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_TYPE(GKO_DECLARE_FFT3_KERNEL);
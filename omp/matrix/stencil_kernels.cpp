@@ -0,0 +1,278 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/stencil_points.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The matrix-free structured grid stencil namespace.
+ * @ref Stencil
+ * @ingroup stencil
+ */
+namespace stencil {
+namespace {
+
+
+// number of grid lines in y-direction processed by a single task, so the
+// neighboring lines of a line are still cached when it is processed
+constexpr int64 y_block_size = 16;
+// number of grid points in x-direction processed at once, so a block of
+// neighboring lines fits into the cache for long lines
+constexpr int64 x_block_size = 1024;
+
+
+/**
+ * Computes c = alpha * A * b + beta * c, or c = A * b if alpha and beta are
+ * nullptr.
+ *
+ * The grid is split into blocks of y_block_size lines in y-direction, which
+ * are distributed among the threads. Each block is traversed in chunks of
+ * x_block_size points in x-direction, and for every line in the chunk the
+ * contributions of all stencil points are accumulated one point at a time.
+ * This makes the innermost loop a contiguous loop over x without any
+ * branches, which can be vectorized. Only the x-range is clipped at the
+ * grid boundary, stencil points whose neighbor line lies outside of the grid
+ * are skipped entirely.
+ */
+template <typename ValueType, typename IndexType>
+void stencil_spmv(const matrix::Stencil<ValueType, IndexType>* a,
+                  const matrix::Dense<ValueType>* alpha,
+                  const matrix::Dense<ValueType>* b,
+                  const matrix::Dense<ValueType>* beta,
+                  matrix::Dense<ValueType>* c)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto grid = a->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto num_rhs = static_cast<int64>(c->get_size()[1]);
+    const auto b_stride = static_cast<int64>(b->get_stride());
+    const auto c_stride = static_cast<int64>(c->get_stride());
+    const auto b_vals = b->get_const_values();
+    auto c_vals = c->get_values();
+    const auto coefs = a->get_const_coefficients();
+    const auto variable = a->has_variable_coefficients();
+    const auto valpha = alpha ? alpha->at(0, 0) : one<ValueType>();
+    const auto vbeta = beta ? beta->at(0, 0) : zero<ValueType>();
+    const auto num_y_blocks = ceildiv(ny, y_block_size);
+#pragma omp parallel for collapse(2) schedule(static)
+    for (int64 iz = 0; iz < nz; ++iz) {
+        for (int64 y_block = 0; y_block < num_y_blocks; ++y_block) {
+            const auto y_begin = y_block * y_block_size;
+            const auto y_end = std::min(ny, y_begin + y_block_size);
+            for (int64 x_begin = 0; x_begin < nx; x_begin += x_block_size) {
+                const auto x_end = std::min(nx, x_begin + x_block_size);
+                for (auto iy = y_begin; iy < y_end; ++iy) {
+                    const auto line = nx * (iy + ny * iz);
+                    for (int64 j = 0; j < num_rhs; ++j) {
+                        const auto out = c_vals + line * c_stride + j;
+                        if (beta) {
+#pragma omp simd
+                            for (auto ix = x_begin; ix < x_end; ++ix) {
+                                out[ix * c_stride] *= vbeta;
+                            }
+                        } else {
+#pragma omp simd
+                            for (auto ix = x_begin; ix < x_end; ++ix) {
+                                out[ix * c_stride] = zero<ValueType>();
+                            }
+                        }
+                    }
+                    for (int p = 0; p < points.num_points; ++p) {
+                        const auto jy = iy + points.dy[p];
+                        const auto jz = iz + points.dz[p];
+                        if (jy < 0 || jy >= ny || jz < 0 || jz >= nz) {
+                            continue;
+                        }
+                        const auto dx = points.dx[p];
+                        const auto begin =
+                            std::max(x_begin, int64{dx < 0 ? 1 : 0});
+                        const auto end = std::min(x_end, dx > 0 ? nx - 1 : nx);
+                        const auto in_begin = nx * (jy + ny * jz) + dx;
+                        for (int64 j = 0; j < num_rhs; ++j) {
+                            const auto out = c_vals + line * c_stride + j;
+                            if (variable) {
+                                const auto coef = coefs + p * num_rows + line;
+#pragma omp simd
+                                for (auto ix = begin; ix < end; ++ix) {
+                                    out[ix * c_stride] +=
+                                        valpha * coef[ix] *
+                                        b_vals[(in_begin + ix) * b_stride + j];
+                                }
+                            } else {
+                                const auto val = valpha * coefs[p];
+#pragma omp simd
+                                for (auto ix = begin; ix < end; ++ix) {
+                                    out[ix * c_stride] +=
+                                        val *
+                                        b_vals[(in_begin + ix) * b_stride + j];
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/**
+ * Calls `fn(p, col)` for every stencil point `p` whose neighbor `col` of the
+ * given row lies inside the grid, in ascending column order.
+ */
+template <typename ValueType, typename IndexType, typename Function>
+void for_each_neighbor(const matrix::Stencil<ValueType, IndexType>* a,
+                       const matrix::stencil::stencil_points& points,
+                       int64 row, Function fn)
+{
+    const auto grid = a->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const auto ix = row % nx;
+    const auto iy = row / nx % ny;
+    const auto iz = row / nx / ny;
+    for (int p = 0; p < points.num_points; ++p) {
+        const auto jx = ix + points.dx[p];
+        const auto jy = iy + points.dy[p];
+        const auto jz = iz + points.dz[p];
+        if (jx >= 0 && jx < nx && jy >= 0 && jy < ny && jz >= 0 && jz < nz) {
+            fn(p, jx + nx * (jy + ny * jz));
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+ValueType get_coefficient(const matrix::Stencil<ValueType, IndexType>* a,
+                          int point, int64 row)
+{
+    return a->has_variable_coefficients()
+               ? a->get_const_coefficients()[point * a->get_size()[0] + row]
+               : a->get_const_coefficients()[point];
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::Stencil<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    stencil_spmv<ValueType, IndexType>(a, nullptr, b, nullptr, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Stencil<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    stencil_spmv(a, alpha, b, beta, c);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_row_ptrs(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* a,
+                      IndexType* row_ptrs)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        IndexType count{};
+        for_each_neighbor(a, points, row, [&](int, int64) { count++; });
+        row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_COMPUTE_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const OmpExecutor> exec,
+                 const matrix::Stencil<ValueType, IndexType>* a,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto num_rows = static_cast<int64>(a->get_size()[0]);
+    const auto row_ptrs = result->get_const_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        auto out = row_ptrs[row];
+        for_each_neighbor(a, points, row, [&](int p, int64 col) {
+            col_idxs[out] = static_cast<IndexType>(col);
+            vals[out] = get_coefficient(a, p, row);
+            out++;
+        });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* a,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto center =
+        matrix::stencil::get_stencil_points(a->get_stencil_type()).center;
+    const auto num_rows = static_cast<int64>(diag->get_size()[0]);
+    auto diag_values = diag->get_values();
+#pragma omp parallel for
+    for (int64 row = 0; row < num_rows; ++row) {
+        diag_values[row] = get_coefficient(a, center, row);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
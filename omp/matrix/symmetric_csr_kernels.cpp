@@ -0,0 +1,335 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The upper triangle storage symmetric Csr matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+namespace {
+
+
+/**
+ * Computes c = alpha * A * b + beta * c, or c = alpha * A * b if beta is
+ * nullptr, reading every stored entry of A only once.
+ *
+ * The rows are split into contiguous chunks of roughly equal numbers of
+ * nonzeros. An entry a_ij of the upper triangle contributes to row i, which
+ * belongs to the chunk, and to row j >= i. If row j belongs to the same chunk,
+ * the contribution is added to c directly, otherwise it is accumulated in a
+ * chunk-private buffer covering the rows between the end of the chunk and the
+ * largest column index of the chunk. The buffers are summed into c after all
+ * chunks are done, so no atomics or coloring are needed. The chunks are
+ * distributed over the threads by a worksharing loop, so the result does not
+ * depend on the size of the team executing it.
+ */
+template <typename ValueType, typename IndexType>
+void symmetric_spmv(std::shared_ptr<const OmpExecutor> exec,
+                    const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                    const matrix::Dense<ValueType>* b, ValueType alpha,
+                    const ValueType* beta, matrix::Dense<ValueType>* c,
+                    array<ValueType>& buffer)
+{
+    const auto row_ptrs = a->get_const_row_ptrs();
+    const auto col_idxs = a->get_const_col_idxs();
+    const auto vals = a->get_const_values();
+    const auto num_rows = a->get_size()[0];
+    const auto num_rhs = c->get_size()[1];
+    const auto nnz = static_cast<size_type>(row_ptrs[num_rows]);
+    const auto num_chunks = std::max<size_type>(
+        std::min<size_type>(omp_get_max_threads(), num_rows), 1);
+    vector<size_type> row_bounds(num_chunks + 1, exec);
+    vector<size_type> buffer_ends(num_chunks, exec);
+    vector<size_type> buffer_offsets(num_chunks + 1, exec);
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto target = static_cast<IndexType>(nnz * chunk / num_chunks);
+        row_bounds[chunk] = std::min<size_type>(
+            std::lower_bound(row_ptrs, row_ptrs + num_rows + 1, target) -
+                row_ptrs,
+            num_rows);
+    }
+    row_bounds[num_chunks] = num_rows;
+#pragma omp parallel for schedule(static)
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto end = row_bounds[chunk + 1];
+        auto buffer_end = end;
+        for (auto k = row_ptrs[row_bounds[chunk]]; k < row_ptrs[end]; ++k) {
+            buffer_end =
+                std::max(buffer_end, static_cast<size_type>(col_idxs[k]) + 1);
+        }
+        buffer_ends[chunk] = buffer_end;
+    }
+    for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+        buffer_offsets[chunk + 1] =
+            buffer_offsets[chunk] +
+            (buffer_ends[chunk] - row_bounds[chunk + 1]) * num_rhs;
+    }
+    if (buffer.get_size() < buffer_offsets[num_chunks]) {
+        buffer.resize_and_reset(buffer_offsets[num_chunks]);
+    }
+    const auto buffer_data = buffer.get_data();
+
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+            const auto begin = row_bounds[chunk];
+            const auto end = row_bounds[chunk + 1];
+            const auto local = buffer_data + buffer_offsets[chunk];
+            std::fill(local, buffer_data + buffer_offsets[chunk + 1],
+                      zero<ValueType>());
+            for (auto row = begin; row < end; ++row) {
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(row, j) =
+                        beta ? *beta * c->at(row, j) : zero<ValueType>();
+                }
+            }
+            for (auto row = begin; row < end; ++row) {
+                for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                    const auto col = static_cast<size_type>(col_idxs[k]);
+                    const auto val = alpha * vals[k];
+                    for (size_type j = 0; j < num_rhs; ++j) {
+                        c->at(row, j) += val * b->at(col, j);
+                    }
+                    if (col == row) {
+                        continue;
+                    }
+                    const auto conj_val = conj(vals[k]);
+                    if (col < end) {
+                        const auto scaled_conj_val = alpha * conj_val;
+                        for (size_type j = 0; j < num_rhs; ++j) {
+                            c->at(col, j) += scaled_conj_val * b->at(row, j);
+                        }
+                    } else {
+                        const auto out = local + (col - end) * num_rhs;
+                        for (size_type j = 0; j < num_rhs; ++j) {
+                            out[j] += conj_val * b->at(row, j);
+                        }
+                    }
+                }
+            }
+        }
+#pragma omp for
+        for (size_type row = 0; row < num_rows; ++row) {
+            for (size_type other = 0;
+                 other < num_chunks && row_bounds[other + 1] <= row;
+                 ++other) {
+                if (row >= buffer_ends[other]) {
+                    continue;
+                }
+                const auto in = buffer_data + buffer_offsets[other] +
+                                (row - row_bounds[other + 1]) * num_rhs;
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(row, j) += alpha * in[j];
+                }
+            }
+        }
+    }
+}
+
+
+}  // anonymous namespace
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const OmpExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<ValueType>& buffer)
+{
+    symmetric_spmv<ValueType, IndexType>(exec, a, b, one<ValueType>(), nullptr,
+                                         c, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const OmpExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<ValueType>& buffer)
+{
+    const auto vbeta = beta->at(0, 0);
+    symmetric_spmv(exec, a, b, alpha->at(0, 0), &vbeta, c, buffer);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_upper_row_ptrs(std::shared_ptr<const OmpExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType>* source,
+                            IndexType* row_ptrs)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        IndexType count{};
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            count += static_cast<size_type>(src_col_idxs[k]) >= row ? 1 : 0;
+        }
+        row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_UPPER_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_upper(std::shared_ptr<const OmpExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* source,
+                const IndexType* row_ptrs, IndexType* col_idxs,
+                ValueType* values)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto src_vals = source->get_const_values();
+#pragma omp parallel for
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out = row_ptrs[row];
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(src_col_idxs[k]) >= row) {
+                col_idxs[out] = src_col_idxs[k];
+                values[out] = src_vals[k];
+                out++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_full_row_ptrs(
+    std::shared_ptr<const OmpExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_ptrs)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_ptrs[row] = src_row_ptrs[row + 1] - src_row_ptrs[row];
+    }
+    // the mirrored strictly upper entries form the lower triangle, counting
+    // them is a transposition like in csr::transpose
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(src_col_idxs[k]) != row) {
+                row_ptrs[src_col_idxs[k]]++;
+            }
+        }
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_FULL_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const OmpExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto src_vals = source->get_const_values();
+    const auto row_ptrs = result->get_const_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    // the upper triangle of every row is stored at the end of the output row
+#pragma omp parallel for
+    for (size_type row = 0; row < num_rows; ++row) {
+        const auto row_nnz = src_row_ptrs[row + 1] - src_row_ptrs[row];
+        const auto out = row_ptrs[row + 1] - row_nnz;
+        std::copy_n(src_col_idxs + src_row_ptrs[row], row_nnz,
+                    col_idxs + out);
+        std::copy_n(src_vals + src_row_ptrs[row], row_nnz, vals + out);
+    }
+    // the mirrored entries in front of it are placed in row order, so they
+    // end up sorted
+    vector<IndexType> next(row_ptrs, row_ptrs + num_rows, exec);
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            const auto col = src_col_idxs[k];
+            if (static_cast<size_type>(col) != row) {
+                const auto mirror = next[col]++;
+                col_idxs[mirror] = static_cast<IndexType>(row);
+                vals[mirror] = conj(src_vals[k]);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const OmpExecutor> exec,
+                      const matrix::SymmetricCsr<ValueType, IndexType>* orig,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto row_ptrs = orig->get_const_row_ptrs();
+    const auto col_idxs = orig->get_const_col_idxs();
+    const auto values = orig->get_const_values();
+    auto diag_values = diag->get_values();
+
+#pragma omp parallel for
+    for (size_type row = 0; row < diag->get_size()[0]; ++row) {
+        for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+            if (static_cast<size_type>(col_idxs[idx]) == row) {
+                diag_values[row] = values[idx];
+                break;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
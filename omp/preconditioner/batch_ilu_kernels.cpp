@@ -0,0 +1,72 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_ilu_kernels.hpp"
+
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+#include "reference/base/batch_struct.hpp"
+#include "reference/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace batch_ilu {
+
+
+namespace {
+
+
+#include "reference/preconditioner/batch_ilu_kernels.hpp.inc"
+
+
+}  // unnamed namespace
+
+
+template <typename ValueType, typename IndexType>
+void find_diagonal_locations(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const batch::matrix::Csr<ValueType, IndexType>* const mat,
+    IndexType* const diag_locs)
+{
+    const auto num_rows = static_cast<IndexType>(mat->get_common_size()[0]);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        find_diagonal_location_impl(row, mat->get_const_row_ptrs(),
+                                    mat->get_const_col_idxs(), diag_locs);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_FIND_DIAGONAL_LOCATIONS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_ilu0_factorization(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const IndexType* const diag_locs,
+    batch::matrix::Csr<ValueType, IndexType>* const mat_factorized)
+{
+    const auto mat_factorized_batch = host::get_batch_struct(mat_factorized);
+    // the items are independent of each other and share the diagonal
+    // locations, so they are factorized in parallel
+#pragma omp parallel for
+    for (size_type batch_id = 0;
+         batch_id < mat_factorized_batch.num_batch_items; batch_id++) {
+        compute_ilu0_factorization_impl(
+            batch::matrix::extract_batch_item(mat_factorized_batch, batch_id),
+            diag_locs);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ILU_COMPUTE_ILU0_FACTORIZATION_KERNEL);
+
+
+}  // namespace batch_ilu
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
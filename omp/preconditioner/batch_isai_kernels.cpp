@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/preconditioner/batch_isai_kernels.hpp"
+
+
+#include <algorithm>
+
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+#include "reference/base/batch_struct.hpp"
+#include "reference/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace batch_isai {
+
+
+namespace {
+
+
+#include "reference/preconditioner/batch_isai_kernels.hpp.inc"
+
+
+}  // unnamed namespace
+
+
+template <typename ValueType, typename IndexType>
+void extract_dense_linear_sys_pattern(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Csr<ValueType, IndexType>* const first_sys_csr,
+    const matrix::Csr<ValueType, IndexType>* const first_approx_inv,
+    IndexType* const dense_mat_pattern, IndexType* const rhs_one_idxs,
+    IndexType* const sizes)
+{
+    const auto num_rows =
+        static_cast<IndexType>(first_approx_inv->get_size()[0]);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; row++) {
+        extract_dense_linear_sys_pattern_impl(
+            row, first_sys_csr->get_const_row_ptrs(),
+            first_sys_csr->get_const_col_idxs(),
+            first_approx_inv->get_const_row_ptrs(),
+            first_approx_inv->get_const_col_idxs(), dense_mat_pattern,
+            rhs_one_idxs, sizes);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_EXTRACT_DENSE_LINEAR_SYSTEM_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_values_dense_mat_and_solve(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const batch::matrix::Csr<ValueType, IndexType>* const sys_csr,
+    batch::matrix::Csr<ValueType, IndexType>* const approx_inv,
+    const IndexType* const dense_mat_pattern,
+    const IndexType* const rhs_one_idxs, const IndexType* const sizes)
+{
+    const auto sys_batch = host::get_batch_struct(sys_csr);
+    const auto approx_inv_batch = host::get_batch_struct(approx_inv);
+    const auto num_rows = static_cast<size_type>(sys_batch.num_rows);
+    // all rows of all items are independent of each other
+#pragma omp parallel for
+    for (size_type i = 0; i < sys_batch.num_batch_items * num_rows; i++) {
+        const auto batch_id = i / num_rows;
+        const auto row = static_cast<IndexType>(i % num_rows);
+        fill_values_dense_mat_and_solve_impl(
+            row, batch::matrix::extract_batch_item(sys_batch, batch_id),
+            batch::matrix::extract_batch_item(approx_inv_batch, batch_id),
+            dense_mat_pattern, rhs_one_idxs, sizes);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INT32_TYPE(
+    GKO_DECLARE_BATCH_ISAI_FILL_VALUES_DENSE_MATRIX_AND_SOLVE_KERNEL);
+
+
+}  // namespace batch_isai
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
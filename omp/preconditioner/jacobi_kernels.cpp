@@ -63,8 +63,20 @@ inline bool has_same_nonzero_pattern(const IndexType* prev_row_ptr,
 }
 
 
+/**
+ * Finds the natural blocks, i.e. runs of consecutive rows with the same
+ * sparsity pattern split into pieces of at most max_block_size rows.
+ *
+ * The rows are split into contiguous chunks. For each row of a chunk, the
+ * start of the run containing it is computed assuming that the chunk starts a
+ * new run. Runs crossing chunk boundaries are merged afterwards, and a row
+ * starts a block if its distance to the start of its run is a multiple of
+ * max_block_size. The chunks are distributed over the threads by worksharing
+ * loops, so the result does not depend on the size of the team executing it.
+ */
 template <typename ValueType, typename IndexType>
-size_type find_natural_blocks(const matrix::Csr<ValueType, IndexType>* mtx,
+size_type find_natural_blocks(std::shared_ptr<const OmpExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType>* mtx,
                               uint32 max_block_size, IndexType* block_ptrs)
 {
     const auto rows = mtx->get_size()[0];
@@ -74,24 +86,75 @@ size_type find_natural_blocks(const matrix::Csr<ValueType, IndexType>* mtx,
     if (rows == 0) {
         return 0;
     }
-    size_type num_blocks = 1;
-    int32 current_block_size = 1;
-    for (size_type i = 1; i < rows; ++i) {
-        const auto prev_row_ptr = col_idx + row_ptrs[i - 1];
-        const auto curr_row_ptr = col_idx + row_ptrs[i];
-        const auto next_row_ptr = col_idx + row_ptrs[i + 1];
-        if (current_block_size < max_block_size &&
-            has_same_nonzero_pattern(prev_row_ptr, curr_row_ptr,
-                                     next_row_ptr)) {
-            ++current_block_size;
-        } else {
-            block_ptrs[num_blocks] =
-                block_ptrs[num_blocks - 1] + current_block_size;
-            ++num_blocks;
-            current_block_size = 1;
+    const auto continues_run = [&](size_type row) {
+        return row > 0 && has_same_nonzero_pattern(col_idx + row_ptrs[row - 1],
+                                                   col_idx + row_ptrs[row],
+                                                   col_idx + row_ptrs[row + 1]);
+    };
+    const auto num_chunks =
+        std::min<size_type>(std::max(omp_get_max_threads(), 1), rows);
+    const auto per_chunk = ceildiv(rows, num_chunks);
+    const auto chunk_begin = [&](size_type chunk) {
+        return std::min(rows, chunk * per_chunk);
+    };
+    vector<size_type> run_starts(rows, {exec});
+    // the start of the run containing the first row of each chunk
+    vector<size_type> chunk_run_starts(num_chunks, {exec});
+    vector<size_type> block_offsets(num_chunks + 1, {exec});
+#pragma omp parallel
+    {
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+            const auto begin = chunk_begin(chunk);
+            const auto end = chunk_begin(chunk + 1);
+            for (auto row = begin; row < end; ++row) {
+                run_starts[row] = row > begin && continues_run(row)
+                                      ? run_starts[row - 1]
+                                      : row;
+            }
+        }
+#pragma omp single
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+            const auto begin = chunk_begin(chunk);
+            chunk_run_starts[chunk] = begin;
+            if (chunk > 0 && begin < rows && continues_run(begin)) {
+                const auto prev_last = run_starts[begin - 1];
+                chunk_run_starts[chunk] = prev_last == chunk_begin(chunk - 1)
+                                              ? chunk_run_starts[chunk - 1]
+                                              : prev_last;
+            }
+        }
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+            const auto begin = chunk_begin(chunk);
+            const auto end = chunk_begin(chunk + 1);
+            size_type num_local_blocks{};
+            for (auto row = begin; row < end; ++row) {
+                if (run_starts[row] == begin) {
+                    run_starts[row] = chunk_run_starts[chunk];
+                }
+                num_local_blocks +=
+                    (row - run_starts[row]) % max_block_size == 0;
+            }
+            block_offsets[chunk + 1] = num_local_blocks;
+        }
+#pragma omp single
+        std::partial_sum(block_offsets.begin(), block_offsets.end(),
+                         block_offsets.begin());
+#pragma omp for schedule(static)
+        for (size_type chunk = 0; chunk < num_chunks; ++chunk) {
+            auto out = block_offsets[chunk];
+            for (auto row = chunk_begin(chunk); row < chunk_begin(chunk + 1);
+                 ++row) {
+                if ((row - run_starts[row]) % max_block_size == 0) {
+                    block_ptrs[out] = static_cast<IndexType>(row);
+                    ++out;
+                }
+            }
         }
     }
-    block_ptrs[num_blocks] = block_ptrs[num_blocks - 1] + current_block_size;
+    const auto num_blocks = block_offsets[num_chunks];
+    block_ptrs[num_blocks] = static_cast<IndexType>(rows);
     return num_blocks;
 }
 
@@ -130,7 +193,7 @@ void find_blocks(std::shared_ptr<const OmpExecutor> exec,
                  uint32 max_block_size, size_type& num_blocks,
                  array<IndexType>& block_pointers)
 {
-    num_blocks = find_natural_blocks(system_matrix, max_block_size,
+    num_blocks = find_natural_blocks(exec, system_matrix, max_block_size,
                                      block_pointers.get_data());
     num_blocks = agglomerate_supervariables(max_block_size, num_blocks,
                                             block_pointers.get_data());
@@ -297,6 +360,75 @@ inline bool invert_block(IndexType block_size, IndexType* perm,
 }
 
 
+/**
+ * Inverts num_blocks blocks of the same size at once. The blocks are stored in
+ * an interleaved layout, i.e. entry (row, col) of block b is stored at
+ * (row * block_size + col) * num_blocks + b, so the innermost loops of the
+ * Gauss-Jordan elimination run over all blocks with unit stride and can be
+ * vectorized. Pivots are chosen individually for each block, and the row
+ * swaps only touch O(block_size) entries per step.
+ */
+template <typename ValueType, typename IndexType>
+inline bool invert_interleaved_blocks(IndexType block_size,
+                                      size_type num_blocks, IndexType* perms,
+                                      size_type perm_stride, ValueType* blocks,
+                                      ValueType* pivots)
+{
+    using std::swap;
+    const auto entry = [&](IndexType row, IndexType col) {
+        return blocks + (row * block_size + col) * num_blocks;
+    };
+    for (IndexType k = 0; k < block_size; ++k) {
+        for (size_type b = 0; b < num_blocks; ++b) {
+            IndexType cp = k;
+            for (IndexType i = k + 1; i < block_size; ++i) {
+                if (abs(entry(cp, k)[b]) < abs(entry(i, k)[b])) {
+                    cp = i;
+                }
+            }
+            for (IndexType j = 0; j < block_size; ++j) {
+                swap(entry(k, j)[b], entry(cp, j)[b]);
+            }
+            swap(perms[b * perm_stride + k], perms[b * perm_stride + cp]);
+            pivots[b] = entry(k, k)[b];
+            if (is_zero(pivots[b])) {
+                return false;
+            }
+        }
+        for (IndexType i = 0; i < block_size; ++i) {
+            const auto col = entry(i, k);
+            for (size_type b = 0; b < num_blocks; ++b) {
+                col[b] /= -pivots[b];
+            }
+        }
+        const auto diag = entry(k, k);
+        for (size_type b = 0; b < num_blocks; ++b) {
+            diag[b] = zero<ValueType>();
+        }
+        for (IndexType i = 0; i < block_size; ++i) {
+            const auto col = entry(i, k);
+            for (IndexType j = 0; j < block_size; ++j) {
+                const auto row = entry(k, j);
+                const auto out = entry(i, j);
+                for (size_type b = 0; b < num_blocks; ++b) {
+                    out[b] += col[b] * row[b];
+                }
+            }
+        }
+        for (IndexType j = 0; j < block_size; ++j) {
+            const auto row = entry(k, j);
+            for (size_type b = 0; b < num_blocks; ++b) {
+                row[b] /= pivots[b];
+            }
+        }
+        for (size_type b = 0; b < num_blocks; ++b) {
+            diag[b] = one<ValueType>() / pivots[b];
+        }
+    }
+    return true;
+}
+
+
 template <typename ReducedType, typename ValueType, typename IndexType>
 inline bool validate_precision_reduction_feasibility(IndexType block_size,
                                                      const ValueType* block,
@@ -353,6 +485,12 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
     array<IndexType> perm_storage{
         exec, static_cast<size_type>(parallel_blocks * max_block_size)};
     array<uint32> pr_descriptor_storage(exec, parallel_blocks);
+    // interleaved copies of the blocks and their pivots for batched inversion
+    array<ValueType> interleaved_storage{
+        exec, static_cast<size_type>(group_size * num_threads *
+                                     max_block_size * max_block_size)};
+    array<ValueType> pivot_storage{
+        exec, static_cast<size_type>(group_size * num_threads)};
 #pragma omp parallel for
     for (size_type g = 0; g < num_blocks; g += group_size) {
         const auto thread_id = omp_get_thread_num();
@@ -365,14 +503,19 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
             perm_storage.get_data() + (thread_offset * max_block_size);
         auto local_perms = local_perms_tmp + max_block_size;
         auto pr_descriptors = pr_descriptor_storage.get_data() + thread_offset;
+        auto interleaved = interleaved_storage.get_data() +
+                           thread_id * group_size * max_block_size *
+                               max_block_size;
+        auto pivots = pivot_storage.get_data() + thread_id * group_size;
         std::fill_n(pr_descriptors, group_size, uint32{} - 1);
-        // extract group of blocks, invert them, figure out storage precision
-        for (size_type b = 0; b < group_size; ++b) {
-            if (b + g >= num_blocks) {
-                break;
-            }
+        const auto local_num_blocks =
+            std::min<size_type>(group_size, num_blocks - g);
+        const auto block_stride = max_block_size * max_block_size;
+        // extract group of blocks
+        bool uniform = local_num_blocks > 1;
+        for (size_type b = 0; b < local_num_blocks; ++b) {
             const auto block_size = ptrs[g + b + 1] - ptrs[g + b];
-            auto block = &local_blocks[b * max_block_size * max_block_size];
+            auto block = &local_blocks[b * block_stride];
             auto perm = &local_perms[b * max_block_size];
             std::iota(perm, perm + block_size, IndexType{0});
             extract_block(system_matrix, block_size, ptrs[g + b], block,
@@ -381,7 +524,44 @@ void generate(std::shared_ptr<const OmpExecutor> exec,
                 cond[g + b] =
                     compute_inf_norm(block_size, block_size, block, block_size);
             }
-            invert_block(block_size, perm, block, block_size);
+            uniform = uniform && block_size == ptrs[g + 1] - ptrs[g];
+        }
+        // invert blocks of the same size together, fall back to inverting
+        // them separately if one of them is singular
+        const auto uniform_size = ptrs[g + 1] - ptrs[g];
+        if (uniform) {
+            for (size_type b = 0; b < local_num_blocks; ++b) {
+                for (IndexType i = 0; i < uniform_size * uniform_size; ++i) {
+                    interleaved[i * local_num_blocks + b] =
+                        local_blocks[b * block_stride + i];
+                }
+            }
+            uniform = invert_interleaved_blocks(
+                uniform_size, local_num_blocks, local_perms, max_block_size,
+                interleaved, pivots);
+            if (uniform) {
+                for (size_type b = 0; b < local_num_blocks; ++b) {
+                    for (IndexType i = 0; i < uniform_size * uniform_size;
+                         ++i) {
+                        local_blocks[b * block_stride + i] =
+                            interleaved[i * local_num_blocks + b];
+                    }
+                }
+            } else {
+                for (size_type b = 0; b < local_num_blocks; ++b) {
+                    auto perm = &local_perms[b * max_block_size];
+                    std::iota(perm, perm + uniform_size, IndexType{0});
+                }
+            }
+        }
+        // invert the remaining blocks, figure out storage precision
+        for (size_type b = 0; b < local_num_blocks; ++b) {
+            const auto block_size = ptrs[g + b + 1] - ptrs[g + b];
+            auto block = &local_blocks[b * block_stride];
+            auto perm = &local_perms[b * max_block_size];
+            if (!uniform) {
+                invert_block(block_size, perm, block, block_size);
+            }
             if (cond) {
                 cond[g + b] *=
                     compute_inf_norm(block_size, block_size, block, block_size);
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/gray_code_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/reorder/gray_code_signature.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace gray_code {
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
+                         IndexType num_rows, IndexType num_cols,
+                         const IndexType* row_ptrs, const IndexType* col_idxs,
+                         int num_column_blocks, IndexType* permutation)
+{
+    using experimental::reorder::gray_code::gray_code_rank;
+    using experimental::reorder::gray_code::row_signature;
+    // sorting (rank, row) pairs keeps rows with equal rank in their order,
+    // and makes the keys unique, so the result is independent of the number
+    // of threads
+    vector<std::pair<uint64, IndexType>> keys(num_rows, exec);
+#pragma omp parallel for
+    for (IndexType row = 0; row < num_rows; ++row) {
+        keys[row] = std::make_pair(
+            gray_code_rank(row_signature(row_ptrs, col_idxs, row, num_cols,
+                                         num_column_blocks)),
+            row);
+    }
+    // sort one chunk per thread, then merge pairs of chunks
+    const auto num_chunks = static_cast<int64>(omp_get_max_threads());
+    vector<int64> chunk_ptrs(num_chunks + 1, exec);
+    for (int64 chunk = 0; chunk <= num_chunks; ++chunk) {
+        chunk_ptrs[chunk] = num_rows * chunk / num_chunks;
+    }
+#pragma omp parallel for
+    for (int64 chunk = 0; chunk < num_chunks; ++chunk) {
+        std::sort(keys.begin() + chunk_ptrs[chunk],
+                  keys.begin() + chunk_ptrs[chunk + 1]);
+    }
+    for (int64 width = 1; width < num_chunks; width *= 2) {
+#pragma omp parallel for
+        for (int64 chunk = 0; chunk < num_chunks; chunk += 2 * width) {
+            const auto middle = std::min(chunk + width, num_chunks);
+            const auto end = std::min(chunk + 2 * width, num_chunks);
+            std::inplace_merge(keys.begin() + chunk_ptrs[chunk],
+                               keys.begin() + chunk_ptrs[middle],
+                               keys.begin() + chunk_ptrs[end]);
+        }
+    }
+#pragma omp parallel for
+    for (IndexType i = 0; i < num_rows; ++i) {
+        permutation[i] = keys[i].second;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace gray_code
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <omp.h>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/reorder/nested_dissection.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+/** Subproblems smaller than this are dissected without spawning tasks. */
+constexpr int min_task_size = 1024;
+
+
+template <typename IndexType>
+void dissect_recursive(std::shared_ptr<const OmpExecutor> exec,
+                       const experimental::reorder::nd::problem<IndexType>& p,
+                       IndexType* permutation)
+{
+    const auto parts =
+        experimental::reorder::nd::dissect<IndexType>(exec, p, permutation);
+    if (parts.first.size() == 0) {
+        return;
+    }
+    // both sides are independent, so they can be dissected concurrently
+    if (p.size() >= min_task_size) {
+#pragma omp task default(none) shared(exec, parts) firstprivate(permutation)
+        dissect_recursive(exec, parts.first, permutation);
+#pragma omp task default(none) shared(exec, parts) firstprivate(permutation)
+        dissect_recursive(exec, parts.second,
+                          permutation + parts.first.size());
+#pragma omp taskwait
+    } else {
+        dissect_recursive(exec, parts.first, permutation);
+        dissect_recursive(exec, parts.second,
+                          permutation + parts.first.size());
+    }
+}
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const OmpExecutor> exec,
+                         IndexType num_vertices, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    if (num_vertices == 0) {
+        return;
+    }
+    const auto problem = experimental::reorder::nd::make_problem(
+        exec, num_vertices, row_ptrs, col_idxs);
+#pragma omp parallel
+#pragma omp single
+    dissect_recursive(exec, problem, permutation);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ND_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
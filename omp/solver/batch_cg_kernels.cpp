@@ -12,6 +12,7 @@
 
 
 #include "core/solver/batch_dispatch.hpp"
+#include "omp/solver/batch_scheduling.hpp"
 
 
 namespace gko {
@@ -28,7 +29,7 @@ namespace batch_cg {
 namespace {
 
 
-constexpr int max_num_rhs = 1;
+constexpr int max_num_rhs = 16;
 
 
 #include "reference/base/batch_multi_vector_kernels.hpp.inc"
@@ -61,7 +62,6 @@ public:
         const gko::batch::multi_vector::uniform_batch<ValueType>& x) const
     {
         using real_type = typename gko::remove_complex<ValueType>;
-        const size_type num_batch_items = mat.num_batch_items;
         const auto num_rows = mat.num_rows;
         const auto num_rhs = b.num_rhs;
         if (num_rhs > max_num_rhs) {
@@ -76,8 +76,7 @@ public:
         int max_threads = omp_get_max_threads();
         auto local_space =
             array<unsigned char>(exec_, local_size_bytes * max_threads);
-#pragma omp parallel for
-        for (size_type batch_id = 0; batch_id < num_batch_items; batch_id++) {
+        batch_scheduling::for_each_item(exec_, mat, [&](size_type batch_id) {
             auto thread_local_space = gko::make_array_view(
                 exec_, local_size_bytes,
                 local_space.get_data() +
@@ -86,7 +85,7 @@ public:
                                 ValueType>(settings_, logger, precond, mat, b,
                                            x, batch_id,
                                            thread_local_space.get_data());
-        }
+        });
     }
 
 private:
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_OMP_SOLVER_BATCH_SCHEDULING_HPP_
+#define GKO_OMP_SOLVER_BATCH_SCHEDULING_HPP_
+
+
+#include <algorithm>
+#include <numeric>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace omp {
+namespace batch_scheduling {
+
+
+/**
+ * Calls `fn(batch_id)` for all items of a uniform batch. All the items have
+ * the same size, so they are distributed statically over the threads.
+ */
+template <typename BatchMatrixType, typename Function>
+void for_each_item(std::shared_ptr<const OmpExecutor> exec,
+                   const BatchMatrixType& mat, Function fn)
+{
+#pragma omp parallel for
+    for (size_type batch_id = 0; batch_id < mat.num_batch_items; batch_id++) {
+        fn(batch_id);
+    }
+}
+
+
+/**
+ * Calls `fn(batch_id)` for all items of a variable-size batch. The cost of an
+ * item can vary strongly, so the items are handed out dynamically, largest
+ * (by number of stored elements) first. This way, the threads do not end up
+ * waiting for a single large item that was scheduled last.
+ */
+template <typename ValueType, typename IndexType, typename Function>
+void for_each_item(
+    std::shared_ptr<const OmpExecutor> exec,
+    const batch::matrix::variable_csr::variable_batch<ValueType, IndexType>&
+        mat,
+    Function fn)
+{
+    const auto num_batch_items = mat.num_batch_items;
+    const auto nnz_offsets = mat.item_nnz_offsets;
+    vector<size_type> order(num_batch_items, {exec});
+    std::iota(order.begin(), order.end(), size_type{});
+    std::stable_sort(order.begin(), order.end(),
+                     [nnz_offsets](size_type a, size_type b) {
+                         return nnz_offsets[a + 1] - nnz_offsets[a] >
+                                nnz_offsets[b + 1] - nnz_offsets[b];
+                     });
+#pragma omp parallel for schedule(dynamic)
+    for (size_type i = 0; i < num_batch_items; i++) {
+        fn(order[i]);
+    }
+}
+
+
+}  // namespace batch_scheduling
+}  // namespace omp
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_OMP_SOLVER_BATCH_SCHEDULING_HPP_
@@ -8,6 +8,9 @@
 #include <algorithm>
 
 
+#include "core/base/extended_float.hpp"
+
+
 namespace gko {
 namespace kernels {
 namespace reference {
@@ -22,6 +25,8 @@ void convert_precision(std::shared_ptr<const DefaultExecutor> exec,
 }
 
 GKO_INSTANTIATE_FOR_EACH_VALUE_CONVERSION(GKO_DECLARE_CONVERT_PRECISION_KERNEL);
+GKO_INSTANTIATE_FOR_EACH_REDUCED_STORAGE_CONVERSION(
+    GKO_DECLARE_CONVERT_PRECISION_KERNEL);
 
 
 }  // namespace components
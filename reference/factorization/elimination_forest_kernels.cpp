@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/factorization/elimination_forest_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/array.hpp>
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/components/disjoint_sets.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The elimination forest namespace.
+ *
+ * @ingroup factor
+ */
+namespace elimination_forest {
+
+
+template <typename IndexType>
+void compute_parents(std::shared_ptr<const DefaultExecutor> exec,
+                     const IndexType* row_ptrs, const IndexType* cols,
+                     IndexType size, IndexType* parents)
+{
+    disjoint_sets<IndexType> subtrees{exec, size};
+    array<IndexType> subtree_root_array{exec, static_cast<size_type>(size)};
+    // pseudo-root one past the last row to deal with disconnected matrices
+    const auto unattached = size;
+    auto subtree_root = subtree_root_array.get_data();
+    for (IndexType row = 0; row < size; row++) {
+        // so far the row is an unattached singleton subtree
+        subtree_root[row] = row;
+        parents[row] = unattached;
+        auto row_rep = row;
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = cols[nz];
+            // for each lower triangular entry
+            if (col < row) {
+                // find the subtree it is contained in
+                const auto col_rep = subtrees.find(col);
+                const auto col_root = subtree_root[col_rep];
+                // if it is not yet attached, put it below row
+                // and make row its new root
+                if (parents[col_root] == unattached && col_root != row) {
+                    parents[col_root] = row;
+                    row_rep = subtrees.join(row_rep, col_rep);
+                    subtree_root[row_rep] = row;
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ELIMINATION_FOREST_COMPUTE_PARENTS_KERNEL);
+
+
+}  // namespace elimination_forest
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -12,6 +12,8 @@
 
 
 #include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/fbcsr_block_inverse.hpp"
 
 
 namespace gko {
@@ -72,6 +74,147 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ILU_COMPUTE_LU_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void initialize_block_row_ptrs_l_u(
+    std::shared_ptr<const DefaultExecutor> exec,
+    const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+    IndexType* l_row_ptrs, IndexType* u_row_ptrs)
+{
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto num_rows =
+        static_cast<IndexType>(system_matrix->get_num_block_rows());
+    for (IndexType row = 0; row < num_rows; row++) {
+        // the diagonal block is always stored in both factors
+        IndexType l_count{1};
+        IndexType u_count{1};
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            l_count += col_idxs[nz] < row;
+            u_count += col_idxs[nz] > row;
+        }
+        l_row_ptrs[row] = l_count;
+        u_row_ptrs[row] = u_count;
+    }
+    components::prefix_sum_nonnegative(exec, l_row_ptrs, num_rows + 1);
+    components::prefix_sum_nonnegative(exec, u_row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_INITIALIZE_BLOCK_ROW_PTRS_L_U_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_block_lu(std::shared_ptr<const DefaultExecutor> exec,
+                      const matrix::Fbcsr<ValueType, IndexType>* system_matrix,
+                      matrix::Fbcsr<ValueType, IndexType>* l_factor,
+                      matrix::Fbcsr<ValueType, IndexType>* u_factor)
+{
+    const int bs = system_matrix->get_block_size();
+    const auto bs2 = bs * bs;
+    const auto num_rows =
+        static_cast<IndexType>(system_matrix->get_num_block_rows());
+    const auto row_ptrs = system_matrix->get_const_row_ptrs();
+    const auto col_idxs = system_matrix->get_const_col_idxs();
+    const auto vals = system_matrix->get_const_values();
+    const auto l_row_ptrs = l_factor->get_const_row_ptrs();
+    const auto l_col_idxs = l_factor->get_col_idxs();
+    const auto l_vals = l_factor->get_values();
+    const auto u_row_ptrs = u_factor->get_const_row_ptrs();
+    const auto u_col_idxs = u_factor->get_col_idxs();
+    const auto u_vals = u_factor->get_values();
+    // copy the blocks into the factors, the diagonal block is stored last in L
+    // and first in U
+    for (IndexType row = 0; row < num_rows; row++) {
+        auto l_nz = l_row_ptrs[row];
+        auto u_nz = u_row_ptrs[row] + 1;
+        u_col_idxs[u_row_ptrs[row]] = row;
+        std::fill_n(u_vals + u_row_ptrs[row] * bs2, bs2, zero<ValueType>());
+        for (auto nz = row_ptrs[row]; nz < row_ptrs[row + 1]; nz++) {
+            const auto col = col_idxs[nz];
+            ValueType* out{};
+            if (col < row) {
+                l_col_idxs[l_nz] = col;
+                out = l_vals + l_nz * bs2;
+                l_nz++;
+            } else if (col == row) {
+                out = u_vals + u_row_ptrs[row] * bs2;
+            } else {
+                u_col_idxs[u_nz] = col;
+                out = u_vals + u_nz * bs2;
+                u_nz++;
+            }
+            std::copy_n(vals + nz * bs2, bs2, out);
+        }
+        l_col_idxs[l_nz] = row;
+        const auto l_diag = l_vals + l_nz * bs2;
+        for (int i = 0; i < bs2; i++) {
+            l_diag[i] =
+                i % (bs + 1) == 0 ? one<ValueType>() : zero<ValueType>();
+        }
+    }
+    // row-wise block elimination, the blocks of the current row are found via
+    // a dense lookup table over the block columns
+    vector<ValueType*> row_blocks(system_matrix->get_num_block_cols(), nullptr,
+                                  exec);
+    vector<ValueType> inv_diag(num_rows * bs2, exec);
+    vector<ValueType> scratch(bs2, exec);
+    for (IndexType row = 0; row < num_rows; row++) {
+        const auto l_end = l_row_ptrs[row + 1] - 1;
+        for (auto nz = l_row_ptrs[row]; nz < l_end; nz++) {
+            row_blocks[l_col_idxs[nz]] = l_vals + nz * bs2;
+        }
+        for (auto nz = u_row_ptrs[row]; nz < u_row_ptrs[row + 1]; nz++) {
+            row_blocks[u_col_idxs[nz]] = u_vals + nz * bs2;
+        }
+        for (auto l_nz = l_row_ptrs[row]; l_nz < l_end; l_nz++) {
+            const auto dep = l_col_idxs[l_nz];
+            // L_ik = A_ik * inv(U_kk)
+            const auto l_block = l_vals + l_nz * bs2;
+            const auto inv_block = inv_diag.data() + dep * bs2;
+            std::fill(scratch.begin(), scratch.end(), zero<ValueType>());
+            for (int j = 0; j < bs; j++) {
+                for (int k = 0; k < bs; k++) {
+                    for (int i = 0; i < bs; i++) {
+                        scratch[i + j * bs] +=
+                            l_block[i + k * bs] * inv_block[k + j * bs];
+                    }
+                }
+            }
+            std::copy(scratch.begin(), scratch.end(), l_block);
+            // A_ij -= L_ik * U_kj for all U_kj in the pattern of row i
+            for (auto u_nz = u_row_ptrs[dep] + 1; u_nz < u_row_ptrs[dep + 1];
+                 u_nz++) {
+                const auto out = row_blocks[u_col_idxs[u_nz]];
+                if (!out) {
+                    continue;
+                }
+                const auto u_block = u_vals + u_nz * bs2;
+                for (int j = 0; j < bs; j++) {
+                    for (int k = 0; k < bs; k++) {
+                        for (int i = 0; i < bs; i++) {
+                            out[i + j * bs] -=
+                                l_block[i + k * bs] * u_block[k + j * bs];
+                        }
+                    }
+                }
+            }
+        }
+        std::copy_n(u_vals + u_row_ptrs[row] * bs2, bs2, scratch.begin());
+        matrix::fbcsr::invert_block(bs, scratch.data(),
+                                    inv_diag.data() + row * bs2);
+        for (auto nz = l_row_ptrs[row]; nz < l_end; nz++) {
+            row_blocks[l_col_idxs[nz]] = nullptr;
+        }
+        for (auto nz = u_row_ptrs[row]; nz < u_row_ptrs[row + 1]; nz++) {
+            row_blocks[u_col_idxs[nz]] = nullptr;
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ILU_COMPUTE_BLOCK_LU_KERNEL);
+
+
 }  // namespace ilu_factorization
 }  // namespace reference
 }  // namespace kernels
@@ -18,7 +18,8 @@ namespace batch_log {
 /**
  * Logs the final residual norm and iteration count for a batch solver.
  *
- * @note Supports only a single RHS per batch item.
+ * With multiple right hand sides, the values of right hand side `j` of batch
+ * item `i` are stored at index `i * num_rhs + j`.
  */
 template <typename RealType>
 class SimpleFinalLogger final {
@@ -27,12 +28,16 @@ public:
      * Constructor
      *
      * @param batch_residuals  residuals norms of size
-     *                         num_batch_items.
+     *                         num_batch_items * num_rhs.
      * @param batch_iters  final iteration counts for each
-     *                     linear system in the batch.
+     *                     linear system and right hand side in the batch.
+     * @param num_rhs  the number of right hand sides per linear system.
      */
-    SimpleFinalLogger(RealType* const batch_residuals, int* const batch_iters)
-        : final_residuals_{batch_residuals}, final_iters_{batch_iters}
+    SimpleFinalLogger(RealType* const batch_residuals, int* const batch_iters,
+                      const int num_rhs = 1)
+        : final_residuals_{batch_residuals},
+          final_iters_{batch_iters},
+          num_rhs_{num_rhs}
     {}
 
     /**
@@ -41,17 +46,19 @@ public:
      * @param batch_idx  The index of linear system in the batch to log.
      * @param iter  The final iteration count (0-based).
      * @param res_norm  Norm of final residual norm
+     * @param rhs  The index of the right hand side to log.
      */
     void log_iteration(const size_type batch_idx, const int iter,
-                       const RealType res_norm)
+                       const RealType res_norm, const int rhs = 0)
     {
-        final_iters_[batch_idx] = iter;
-        final_residuals_[batch_idx] = res_norm;
+        final_iters_[batch_idx * num_rhs_ + rhs] = iter;
+        final_residuals_[batch_idx * num_rhs_ + rhs] = res_norm;
     }
 
 private:
     RealType* const final_residuals_;
     int* const final_iters_;
+    const int num_rhs_;
 };
 
 
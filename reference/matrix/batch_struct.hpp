@@ -13,6 +13,7 @@
 #include <ginkgo/core/matrix/batch_csr.hpp>
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
 
 
 #include "core/base/batch_struct.hpp"
@@ -132,6 +133,47 @@ inline batch::matrix::ell::uniform_batch<ValueType, IndexType> get_batch_struct(
 }
 
 
+/**
+ * Generates an immutable batch struct from a batch of variable-size csr
+ * matrices.
+ */
+template <typename ValueType, typename IndexType>
+inline batch::matrix::variable_csr::variable_batch<const ValueType,
+                                                   const IndexType>
+get_batch_struct(
+    const batch::matrix::VariableCsr<ValueType, IndexType>* const op)
+{
+    return {op->get_const_values(),
+            op->get_const_col_idxs(),
+            op->get_const_row_ptrs(),
+            op->get_const_item_row_offsets(),
+            op->get_const_item_nnz_offsets(),
+            op->get_num_batch_items(),
+            static_cast<IndexType>(op->get_common_size()[0]),
+            static_cast<IndexType>(op->get_common_size()[1]),
+            static_cast<IndexType>(op->get_max_num_elements_per_item())};
+}
+
+
+/**
+ * Generates a batch struct from a batch of variable-size csr matrices.
+ */
+template <typename ValueType, typename IndexType>
+inline batch::matrix::variable_csr::variable_batch<ValueType, IndexType>
+get_batch_struct(batch::matrix::VariableCsr<ValueType, IndexType>* const op)
+{
+    return {op->get_values(),
+            op->get_const_col_idxs(),
+            op->get_const_row_ptrs(),
+            op->get_const_item_row_offsets(),
+            op->get_const_item_nnz_offsets(),
+            op->get_num_batch_items(),
+            static_cast<IndexType>(op->get_common_size()[0]),
+            static_cast<IndexType>(op->get_common_size()[1]),
+            static_cast<IndexType>(op->get_max_num_elements_per_item())};
+}
+
+
 }  // namespace host
 }  // namespace kernels
 }  // namespace gko
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/csr_assembly_kernels.hpp"
+
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+
+#include "core/matrix/csr_lookup.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The Csr assembly namespace.
+ * @ref CsrAssembler
+ * @ingroup csr_assembly
+ */
+namespace csr_assembly {
+
+
+template <typename IndexType>
+void build_pattern(std::shared_ptr<const DefaultExecutor> exec,
+                   const IndexType* element_dofs, size_type num_elements,
+                   size_type dofs_per_element, size_type num_rows,
+                   size_type num_dofs, IndexType* row_ptrs,
+                   array<IndexType>& col_idxs, IndexType& max_dof)
+{
+    max_dof = invalid_index<IndexType>();
+    std::vector<std::pair<IndexType, IndexType>> entries;
+    for (size_type element = 0; element < num_elements; element++) {
+        const auto dofs = element_dofs + element * dofs_per_element;
+        for (size_type i = 0; i < dofs_per_element; i++) {
+            max_dof = std::max(max_dof, dofs[i]);
+            for (size_type j = 0; j < dofs_per_element; j++) {
+                if (dofs[i] >= 0 && dofs[j] >= 0) {
+                    entries.emplace_back(dofs[i], dofs[j]);
+                }
+            }
+        }
+    }
+    // the caller reports the out-of-bounds degree of freedom
+    if (max_dof >= 0 && static_cast<size_type>(max_dof) >= num_dofs) {
+        return;
+    }
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+    std::fill_n(row_ptrs, num_rows + 1, 0);
+    col_idxs.resize_and_reset(entries.size());
+    for (size_type i = 0; i < entries.size(); i++) {
+        row_ptrs[entries[i].first + 1]++;
+        col_idxs.get_data()[i] = entries[i].second;
+    }
+    std::partial_sum(row_ptrs, row_ptrs + num_rows + 1, row_ptrs);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_BUILD_PATTERN_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_elements(std::shared_ptr<const DefaultExecutor> exec,
+                  const IndexType* element_dofs,
+                  const ValueType* element_values, size_type num_elements,
+                  size_type dofs_per_element, size_type num_dofs,
+                  const IndexType* row_ptrs, const IndexType* col_idxs,
+                  const IndexType* storage_offsets, const int64* row_desc,
+                  const int32* storage, ValueType* values, IndexType& max_dof)
+{
+    // out-of-bounds degrees of freedom are skipped and reported by the caller
+    const auto is_valid = [&](IndexType dof) {
+        return dof >= 0 && static_cast<size_type>(dof) < num_dofs;
+    };
+    max_dof = invalid_index<IndexType>();
+    for (size_type element = 0; element < num_elements; element++) {
+        const auto dofs = element_dofs + element * dofs_per_element;
+        const auto local_values =
+            element_values + element * dofs_per_element * dofs_per_element;
+        for (size_type i = 0; i < dofs_per_element; i++) {
+            const auto row = dofs[i];
+            max_dof = std::max(max_dof, row);
+            if (!is_valid(row)) {
+                continue;
+            }
+            const matrix::csr::device_sparsity_lookup<IndexType> lookup{
+                row_ptrs, col_idxs, storage_offsets, storage, row_desc,
+                static_cast<size_type>(row)};
+            for (size_type j = 0; j < dofs_per_element; j++) {
+                const auto col = dofs[j];
+                const auto local_idx =
+                    is_valid(col) ? lookup[col] : invalid_index<IndexType>();
+                if (local_idx != invalid_index<IndexType>()) {
+                    values[row_ptrs[row] + local_idx] +=
+                        local_values[i * dofs_per_element + j];
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_ELEMENTS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void add_values(std::shared_ptr<const DefaultExecutor> exec,
+                const IndexType* row_idxs, const IndexType* entry_cols,
+                const ValueType* entry_values, size_type num_entries,
+                size_type num_rows, size_type num_cols,
+                const IndexType* row_ptrs, const IndexType* col_idxs,
+                const IndexType* storage_offsets, const int64* row_desc,
+                const int32* storage, ValueType* values, IndexType& max_row,
+                IndexType& max_col)
+{
+    max_row = invalid_index<IndexType>();
+    max_col = invalid_index<IndexType>();
+    for (size_type i = 0; i < num_entries; i++) {
+        const auto row = row_idxs[i];
+        const auto col = entry_cols[i];
+        max_row = std::max(max_row, row);
+        max_col = std::max(max_col, col);
+        // out-of-bounds entries are skipped and reported by the caller
+        if (row < 0 || col < 0 || static_cast<size_type>(row) >= num_rows ||
+            static_cast<size_type>(col) >= num_cols) {
+            continue;
+        }
+        const matrix::csr::device_sparsity_lookup<IndexType> lookup{
+            row_ptrs, col_idxs, storage_offsets, storage, row_desc,
+            static_cast<size_type>(row)};
+        const auto local_idx = lookup[col];
+        if (local_idx != invalid_index<IndexType>()) {
+            values[row_ptrs[row] + local_idx] += entry_values[i];
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_CSR_ASSEMBLY_ADD_VALUES_KERNEL);
+
+
+}  // namespace csr_assembly
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -26,6 +26,7 @@
 #include "core/components/fill_array_kernels.hpp"
 #include "core/components/format_conversion_kernels.hpp"
 #include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/fbcsr_block_inverse.hpp"
 #include "core/matrix/fbcsr_builder.hpp"
 #include "core/synthesizer/implementation_selection.hpp"
 
@@ -497,6 +498,123 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_FBCSR_EXTRACT_DIAGONAL);
 
 
+template <typename ValueType, typename IndexType>
+void invert_diagonal_blocks(std::shared_ptr<const ReferenceExecutor> exec,
+                            const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                            ValueType* inv_diag_blocks)
+{
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto values = mtx->get_const_values();
+    const int bs = mtx->get_block_size();
+    const auto bs2 = bs * bs;
+    const IndexType nbrows = mtx->get_num_block_rows();
+    vector<ValueType> block(bs2, exec);
+    for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
+        std::fill(block.begin(), block.end(), zero<ValueType>());
+        for (auto idx = row_ptrs[ibrow]; idx < row_ptrs[ibrow + 1]; ++idx) {
+            if (col_idxs[idx] == ibrow) {
+                std::copy_n(values + idx * bs2, bs2, block.begin());
+            }
+        }
+        matrix::fbcsr::invert_block(bs, block.data(),
+                                    inv_diag_blocks + ibrow * bs2);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_INVERT_DIAGONAL_BLOCKS_KERNEL);
+
+
+namespace {
+
+
+/**
+ * Solves the block row `ibrow` of a block triangular system, where all blocks
+ * in columns accepted by `is_off_diagonal` are already solved for.
+ */
+template <typename ValueType, typename IndexType, typename Predicate>
+void block_trs_row(const matrix::Fbcsr<ValueType, IndexType>* mtx,
+                   const ValueType* inv_diag_blocks, IndexType ibrow,
+                   const matrix::Dense<ValueType>* b,
+                   matrix::Dense<ValueType>* x, ValueType* residual,
+                   Predicate is_off_diagonal)
+{
+    const auto row_ptrs = mtx->get_const_row_ptrs();
+    const auto col_idxs = mtx->get_const_col_idxs();
+    const auto values = mtx->get_const_values();
+    const int bs = mtx->get_block_size();
+    for (size_type j = 0; j < b->get_size()[1]; ++j) {
+        for (int ib = 0; ib < bs; ib++) {
+            residual[ib] = b->at(ibrow * bs + ib, j);
+        }
+        for (auto idx = row_ptrs[ibrow]; idx < row_ptrs[ibrow + 1]; ++idx) {
+            const auto col = col_idxs[idx];
+            if (!is_off_diagonal(col)) {
+                continue;
+            }
+            const auto block = values + idx * bs * bs;
+            for (int jb = 0; jb < bs; jb++) {
+                const auto x_val = x->at(col * bs + jb, j);
+                for (int ib = 0; ib < bs; ib++) {
+                    residual[ib] -= block[ib + jb * bs] * x_val;
+                }
+            }
+        }
+        for (int ib = 0; ib < bs; ib++) {
+            auto result = residual[ib];
+            if (inv_diag_blocks) {
+                const auto inv_diag = inv_diag_blocks + ibrow * bs * bs;
+                result = zero<ValueType>();
+                for (int jb = 0; jb < bs; jb++) {
+                    result += inv_diag[ib + jb * bs] * residual[jb];
+                }
+            }
+            x->at(ibrow * bs + ib, j) = result;
+        }
+    }
+}
+
+
+}  // namespace
+
+
+template <typename ValueType, typename IndexType>
+void lower_trs(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    const IndexType nbrows = mtx->get_num_block_rows();
+    vector<ValueType> residual(mtx->get_block_size(), exec);
+    for (IndexType ibrow = 0; ibrow < nbrows; ++ibrow) {
+        block_trs_row(mtx, inv_diag_blocks, ibrow, b, x, residual.data(),
+                      [ibrow](IndexType col) { return col < ibrow; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_LOWER_TRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void upper_trs(std::shared_ptr<const ReferenceExecutor> exec,
+               const matrix::Fbcsr<ValueType, IndexType>* mtx,
+               const ValueType* inv_diag_blocks,
+               const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* x)
+{
+    const IndexType nbrows = mtx->get_num_block_rows();
+    vector<ValueType> residual(mtx->get_block_size(), exec);
+    for (auto ibrow = nbrows - 1; ibrow >= 0; --ibrow) {
+        block_trs_row(mtx, inv_diag_blocks, ibrow, b, x, residual.data(),
+                      [ibrow](IndexType col) { return col > ibrow; });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_FBCSR_UPPER_TRS_KERNEL);
+
+
 }  // namespace fbcsr
 }  // namespace reference
 }  // namespace kernels
@@ -0,0 +1,94 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/reduced_csr_storage.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The reduced-precision storage Csr matrix format namespace.
+ * @ref ReducedCsr
+ * @ingroup reduced_csr
+ */
+namespace reduced_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::ReducedCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+
+    matrix::reduced_csr::run_with_storage_type(
+        a->get_storage(), [&](auto tag) {
+            using storage_type = decltype(tag);
+            const auto vals = reinterpret_cast<const storage_type*>(
+                a->get_const_packed_values());
+            for (size_type row = 0; row < a->get_size()[0]; ++row) {
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    auto temp_val = zero<ValueType>();
+                    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                        temp_val += static_cast<ValueType>(vals[k]) *
+                                    b->at(col_idxs[k], j);
+                    }
+                    c->at(row, j) = temp_val;
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::ReducedCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+
+    matrix::reduced_csr::run_with_storage_type(
+        a->get_storage(), [&](auto tag) {
+            using storage_type = decltype(tag);
+            const auto vals = reinterpret_cast<const storage_type*>(
+                a->get_const_packed_values());
+            for (size_type row = 0; row < a->get_size()[0]; ++row) {
+                for (size_type j = 0; j < c->get_size()[1]; ++j) {
+                    auto temp_val = zero<ValueType>();
+                    for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+                        temp_val += static_cast<ValueType>(vals[k]) *
+                                    b->at(col_idxs[k], j);
+                    }
+                    c->at(row, j) = vbeta * c->at(row, j) + valpha * temp_val;
+                }
+            }
+        });
+}
+
+GKO_INSTANTIATE_FOR_EACH_NON_COMPLEX_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_REDUCED_CSR_ADVANCED_SPMV_KERNEL);
+
+
+}  // namespace reduced_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
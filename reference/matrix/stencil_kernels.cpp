@@ -0,0 +1,184 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/stencil_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/components/prefix_sum_kernels.hpp"
+#include "core/matrix/stencil_points.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The matrix-free structured grid stencil namespace.
+ * @ref Stencil
+ * @ingroup stencil
+ */
+namespace stencil {
+
+
+/**
+ * Calls `fn(p, col)` for every stencil point `p` whose neighbor `col` of the
+ * given row lies inside the grid, in ascending column order.
+ */
+template <typename ValueType, typename IndexType, typename Function>
+void for_each_neighbor(const matrix::Stencil<ValueType, IndexType>* a,
+                       const matrix::stencil::stencil_points& points,
+                       size_type row, Function fn)
+{
+    const auto grid = a->get_grid_size();
+    const auto nx = static_cast<int64>(grid[0]);
+    const auto ny = static_cast<int64>(grid[1]);
+    const auto nz = static_cast<int64>(grid[2]);
+    const auto ix = static_cast<int64>(row) % nx;
+    const auto iy = static_cast<int64>(row) / nx % ny;
+    const auto iz = static_cast<int64>(row) / nx / ny;
+    for (int p = 0; p < points.num_points; ++p) {
+        const auto jx = ix + points.dx[p];
+        const auto jy = iy + points.dy[p];
+        const auto jz = iz + points.dz[p];
+        if (jx >= 0 && jx < nx && jy >= 0 && jy < ny && jz >= 0 && jz < nz) {
+            fn(p, static_cast<size_type>(jx + nx * (jy + ny * jz)));
+        }
+    }
+}
+
+
+template <typename ValueType, typename IndexType>
+ValueType get_coefficient(const matrix::Stencil<ValueType, IndexType>* a,
+                          int point, size_type row)
+{
+    return a->has_variable_coefficients()
+               ? a->get_const_coefficients()[point * a->get_size()[0] + row]
+               : a->get_const_coefficients()[point];
+}
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::Stencil<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto num_rhs = c->get_size()[1];
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+        for_each_neighbor(a, points, row, [&](int p, size_type col) {
+            const auto val = get_coefficient(a, p, row);
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+        });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(GKO_DECLARE_STENCIL_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::Stencil<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    const auto num_rhs = c->get_size()[1];
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+        for_each_neighbor(a, points, row, [&](int p, size_type col) {
+            const auto val = valpha * get_coefficient(a, p, row);
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+        });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_row_ptrs(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* a,
+                      IndexType* row_ptrs)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto num_rows = a->get_size()[0];
+    for (size_type row = 0; row < num_rows; ++row) {
+        IndexType count{};
+        for_each_neighbor(a, points, row, [&](int, size_type) { count++; });
+        row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_COMPUTE_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                 const matrix::Stencil<ValueType, IndexType>* a,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto points =
+        matrix::stencil::get_stencil_points(a->get_stencil_type());
+    const auto row_ptrs = result->get_const_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        auto out = row_ptrs[row];
+        for_each_neighbor(a, points, row, [&](int p, size_type col) {
+            col_idxs[out] = static_cast<IndexType>(col);
+            vals[out] = get_coefficient(a, p, row);
+            out++;
+        });
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::Stencil<ValueType, IndexType>* a,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto center =
+        matrix::stencil::get_stencil_points(a->get_stencil_type()).center;
+    auto diag_values = diag->get_values();
+    for (size_type row = 0; row < diag->get_size()[0]; ++row) {
+        diag_values[row] = get_coefficient(a, center, row);
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_STENCIL_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace stencil
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
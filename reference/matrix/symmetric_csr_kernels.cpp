@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+
+
+#include <ginkgo/core/base/math.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The upper triangle storage symmetric Csr matrix format namespace.
+ * @ref SymmetricCsr
+ * @ingroup symmetric_csr
+ */
+namespace symmetric_csr {
+
+
+template <typename ValueType, typename IndexType>
+void spmv(std::shared_ptr<const ReferenceExecutor> exec,
+          const matrix::SymmetricCsr<ValueType, IndexType>* a,
+          const matrix::Dense<ValueType>* b, matrix::Dense<ValueType>* c,
+          array<ValueType>& buffer)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    const auto num_rhs = c->get_size()[1];
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            c->at(row, j) = zero<ValueType>();
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) += vals[k] * b->at(col, j);
+            }
+            if (col != row) {
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(col, j) += conj(vals[k]) * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void advanced_spmv(std::shared_ptr<const ReferenceExecutor> exec,
+                   const matrix::Dense<ValueType>* alpha,
+                   const matrix::SymmetricCsr<ValueType, IndexType>* a,
+                   const matrix::Dense<ValueType>* b,
+                   const matrix::Dense<ValueType>* beta,
+                   matrix::Dense<ValueType>* c, array<ValueType>& buffer)
+{
+    auto row_ptrs = a->get_const_row_ptrs();
+    auto col_idxs = a->get_const_col_idxs();
+    auto vals = a->get_const_values();
+    const auto valpha = alpha->at(0, 0);
+    const auto vbeta = beta->at(0, 0);
+    const auto num_rhs = c->get_size()[1];
+
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (size_type j = 0; j < num_rhs; ++j) {
+            c->at(row, j) *= vbeta;
+        }
+    }
+    for (size_type row = 0; row < a->get_size()[0]; ++row) {
+        for (auto k = row_ptrs[row]; k < row_ptrs[row + 1]; ++k) {
+            const auto col = static_cast<size_type>(col_idxs[k]);
+            const auto val = valpha * vals[k];
+            for (size_type j = 0; j < num_rhs; ++j) {
+                c->at(row, j) += val * b->at(col, j);
+            }
+            if (col != row) {
+                const auto conj_val = valpha * conj(vals[k]);
+                for (size_type j = 0; j < num_rhs; ++j) {
+                    c->at(col, j) += conj_val * b->at(row, j);
+                }
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_ADVANCED_SPMV_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_upper_row_ptrs(std::shared_ptr<const ReferenceExecutor> exec,
+                            const matrix::Csr<ValueType, IndexType>* source,
+                            IndexType* row_ptrs)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+    for (size_type row = 0; row < num_rows; ++row) {
+        IndexType count{};
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            count += static_cast<size_type>(src_col_idxs[k]) >= row ? 1 : 0;
+        }
+        row_ptrs[row] = count;
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_UPPER_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_upper(std::shared_ptr<const ReferenceExecutor> exec,
+                const matrix::Csr<ValueType, IndexType>* source,
+                const IndexType* row_ptrs, IndexType* col_idxs,
+                ValueType* values)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto src_vals = source->get_const_values();
+    for (size_type row = 0; row < source->get_size()[0]; ++row) {
+        auto out = row_ptrs[row];
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(src_col_idxs[k]) >= row) {
+                col_idxs[out] = src_col_idxs[k];
+                values[out] = src_vals[k];
+                out++;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_UPPER_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void compute_full_row_ptrs(
+    std::shared_ptr<const ReferenceExecutor> exec,
+    const matrix::SymmetricCsr<ValueType, IndexType>* source,
+    IndexType* row_ptrs)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto num_rows = source->get_size()[0];
+    for (size_type row = 0; row < num_rows; ++row) {
+        row_ptrs[row] = src_row_ptrs[row + 1] - src_row_ptrs[row];
+    }
+    // the mirrored strictly upper entries form the lower triangle
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            if (static_cast<size_type>(src_col_idxs[k]) != row) {
+                row_ptrs[src_col_idxs[k]]++;
+            }
+        }
+    }
+    components::prefix_sum_nonnegative(exec, row_ptrs, num_rows + 1);
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_COMPUTE_FULL_ROW_PTRS_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void fill_in_csr(std::shared_ptr<const ReferenceExecutor> exec,
+                 const matrix::SymmetricCsr<ValueType, IndexType>* source,
+                 matrix::Csr<ValueType, IndexType>* result)
+{
+    const auto src_row_ptrs = source->get_const_row_ptrs();
+    const auto src_col_idxs = source->get_const_col_idxs();
+    const auto src_vals = source->get_const_values();
+    const auto row_ptrs = result->get_const_row_ptrs();
+    auto col_idxs = result->get_col_idxs();
+    auto vals = result->get_values();
+    const auto num_rows = source->get_size()[0];
+    // rows are processed in order, so the mirrored entries of every row are
+    // complete and sorted before its own upper triangle is appended
+    vector<IndexType> next(row_ptrs, row_ptrs + num_rows, exec);
+    for (size_type row = 0; row < num_rows; ++row) {
+        for (auto k = src_row_ptrs[row]; k < src_row_ptrs[row + 1]; ++k) {
+            const auto col = src_col_idxs[k];
+            const auto out = next[row]++;
+            col_idxs[out] = col;
+            vals[out] = src_vals[k];
+            if (static_cast<size_type>(col) != row) {
+                const auto mirror = next[col]++;
+                col_idxs[mirror] = static_cast<IndexType>(row);
+                vals[mirror] = conj(src_vals[k]);
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_FILL_IN_CSR_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extract_diagonal(std::shared_ptr<const ReferenceExecutor> exec,
+                      const matrix::SymmetricCsr<ValueType, IndexType>* orig,
+                      matrix::Diagonal<ValueType>* diag)
+{
+    const auto row_ptrs = orig->get_const_row_ptrs();
+    const auto col_idxs = orig->get_const_col_idxs();
+    const auto values = orig->get_const_values();
+    auto diag_values = diag->get_values();
+
+    for (size_type row = 0; row < diag->get_size()[0]; ++row) {
+        for (auto idx = row_ptrs[row]; idx < row_ptrs[row + 1]; ++idx) {
+            if (static_cast<size_type>(col_idxs[idx]) == row) {
+                diag_values[row] = values[idx];
+                break;
+            }
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_SYMMETRIC_CSR_EXTRACT_DIAGONAL_KERNEL);
+
+
+}  // namespace symmetric_csr
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -93,15 +93,18 @@ public:
                 detail::batch_jacobi::get_stride(bidx, block_ptrs_arr_);
 
             for (int row = row_st; row < row_end; row++) {
-                ValueType sum = zero<ValueType>();
+                for (int j = 0; j < r.num_rhs; j++) {
+                    z.values[row * z.stride + j] = zero<ValueType>();
+                }
                 for (int col = 0; col < bsize; col++) {
                     const auto val =
                         blocks_arr_entry_[offset + (row - row_st) * stride +
                                           col];
-                    sum += val * r.values[col + row_st];
+                    for (int j = 0; j < r.num_rhs; j++) {
+                        z.values[row * z.stride + j] +=
+                            val * r.values[(col + row_st) * r.stride + j];
+                    }
                 }
-
-                z.values[row] = sum;
             }
         }
     }
@@ -0,0 +1,104 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
+
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_preconditioner {
+
+
+/**
+ * ILU(0) preconditioner for batch solvers. The factors are computed before
+ * the solve, so applying the preconditioner only requires a forward and a
+ * backward substitution on the factorized batch item.
+ */
+template <typename ValueType, typename IndexType = int>
+class Ilu final {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * @param mat_factorized  the batch of combined L and U factors, where L
+     *                        has an implicit unit diagonal
+     * @param diag_locs  the positions of the diagonal entries in a single item
+     */
+    Ilu(const gko::batch::matrix::csr::uniform_batch<const ValueType,
+                                                     const IndexType>&
+            mat_factorized,
+        const IndexType* const diag_locs)
+        : mat_factorized_batch_{mat_factorized},
+          diag_locs_{diag_locs},
+          values_entry_{}
+    {}
+
+    /**
+     * The size of the work vector required in case of dynamic allocation.
+     */
+    static constexpr int dynamic_work_size(const int, int) { return 0; }
+
+    /**
+     * Selects the factors of the given batch item. The factorization itself
+     * is computed when the preconditioner is generated.
+     */
+    template <typename batch_item_type>
+    void generate(size_type batch_id, const batch_item_type&, ValueType* const)
+    {
+        values_entry_ = mat_factorized_batch_.values +
+                        batch_id * mat_factorized_batch_.num_nnz_per_item;
+    }
+
+    void apply(const gko::batch::multi_vector::batch_item<const ValueType>& r,
+               const gko::batch::multi_vector::batch_item<ValueType>& z) const
+    {
+        const auto row_ptrs = mat_factorized_batch_.row_ptrs;
+        const auto col_idxs = mat_factorized_batch_.col_idxs;
+        const auto values = values_entry_;
+        const auto num_rows = mat_factorized_batch_.num_rows;
+
+        for (int j = 0; j < r.num_rhs; j++) {
+            // forward substitution with the unit lower triangular factor
+            for (int row = 0; row < num_rows; row++) {
+                auto sum = r.values[row * r.stride + j];
+                for (auto i = row_ptrs[row]; i < diag_locs_[row]; i++) {
+                    sum -= values[i] * z.values[col_idxs[i] * z.stride + j];
+                }
+                z.values[row * z.stride + j] = sum;
+            }
+            // backward substitution with the upper triangular factor
+            for (int row = num_rows - 1; row >= 0; row--) {
+                auto sum = z.values[row * z.stride + j];
+                for (auto i = diag_locs_[row] + 1; i < row_ptrs[row + 1];
+                     i++) {
+                    sum -= values[i] * z.values[col_idxs[i] * z.stride + j];
+                }
+                z.values[row * z.stride + j] = sum / values[diag_locs_[row]];
+            }
+        }
+    }
+
+private:
+    const gko::batch::matrix::csr::uniform_batch<const ValueType,
+                                                 const IndexType>
+        mat_factorized_batch_;
+    const IndexType* const diag_locs_;
+    const ValueType* values_entry_;
+};
+
+
+}  // namespace batch_preconditioner
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ILU_HPP_
@@ -0,0 +1,89 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
+#define GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
+
+
+#include "core/base/batch_struct.hpp"
+#include "core/matrix/batch_struct.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace host {
+namespace batch_preconditioner {
+
+
+/**
+ * ISAI preconditioner for batch solvers. The approximate inverse is computed
+ * before the solve, so applying the preconditioner is a sparse matrix-vector
+ * product with the approximate inverse of the batch item.
+ */
+template <typename ValueType, typename IndexType = int>
+class Isai final {
+public:
+    using value_type = ValueType;
+    using index_type = IndexType;
+
+    /**
+     * @param approx_inv  the batch of approximate inverses
+     */
+    Isai(const gko::batch::matrix::csr::uniform_batch<const ValueType,
+                                                      const IndexType>&
+             approx_inv)
+        : approx_inv_batch_{approx_inv}, values_entry_{}
+    {}
+
+    /**
+     * The size of the work vector required in case of dynamic allocation.
+     */
+    static constexpr int dynamic_work_size(const int, int) { return 0; }
+
+    /**
+     * Selects the approximate inverse of the given batch item.
+     */
+    template <typename batch_item_type>
+    void generate(size_type batch_id, const batch_item_type&, ValueType* const)
+    {
+        values_entry_ = approx_inv_batch_.values +
+                        batch_id * approx_inv_batch_.num_nnz_per_item;
+    }
+
+    void apply(const gko::batch::multi_vector::batch_item<const ValueType>& r,
+               const gko::batch::multi_vector::batch_item<ValueType>& z) const
+    {
+        const auto row_ptrs = approx_inv_batch_.row_ptrs;
+        const auto col_idxs = approx_inv_batch_.col_idxs;
+        const auto values = values_entry_;
+
+        for (int row = 0; row < approx_inv_batch_.num_rows; row++) {
+            for (int j = 0; j < r.num_rhs; j++) {
+                z.values[row * z.stride + j] = zero<ValueType>();
+            }
+            for (auto i = row_ptrs[row]; i < row_ptrs[row + 1]; i++) {
+                const auto val = values[i];
+                for (int j = 0; j < r.num_rhs; j++) {
+                    z.values[row * z.stride + j] +=
+                        val * r.values[col_idxs[i] * r.stride + j];
+                }
+            }
+        }
+    }
+
+private:
+    const gko::batch::matrix::csr::uniform_batch<const ValueType,
+                                                 const IndexType>
+        approx_inv_batch_;
+    const ValueType* values_entry_;
+};
+
+
+}  // namespace batch_preconditioner
+}  // namespace host
+}  // namespace kernels
+}  // namespace gko
+
+
+#endif  // GKO_REFERENCE_PRECONDITIONER_BATCH_ISAI_HPP_
@@ -15,7 +15,9 @@
 #include <ginkgo/core/matrix/csr.hpp>
 
 
+#include "core/base/allocator.hpp"
 #include "core/matrix/csr_builder.hpp"
+#include "core/preconditioner/isai_row_extension.hpp"
 
 
 namespace gko {
@@ -437,6 +439,66 @@ GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
     GKO_DECLARE_ISAI_SCATTER_EXCESS_SOLUTION_KERNEL);
 
 
+template <typename ValueType, typename IndexType>
+void select_pattern_extension(std::shared_ptr<const DefaultExecutor> exec,
+                              const matrix::Csr<ValueType, IndexType>* input,
+                              const matrix::Csr<ValueType, IndexType>* inverse,
+                              IndexType fill,
+                              remove_complex<ValueType> tolerance, bool lower,
+                              bool upper, IndexType* extension,
+                              IndexType* extended_row_ptrs)
+{
+    using ::gko::preconditioner::isai::select_row_extension;
+    const auto num_rows = static_cast<IndexType>(inverse->get_size()[0]);
+    const auto num_cols = input->get_size()[1];
+    const auto i_row_ptrs = inverse->get_const_row_ptrs();
+    vector<ValueType> residual(num_cols, zero<ValueType>(), {exec});
+    vector<IndexType> touched_marker(num_cols, invalid_index<IndexType>(),
+                                     {exec});
+    vector<IndexType> pattern_marker(num_cols, invalid_index<IndexType>(),
+                                     {exec});
+    vector<IndexType> candidates(exec);
+    for (IndexType row = 0; row < num_rows; ++row) {
+        const auto count = select_row_extension(
+            row, input, inverse, fill, tolerance, lower, upper,
+            residual.data(), touched_marker.data(), pattern_marker.data(),
+            candidates, extension + row * fill);
+        extended_row_ptrs[row] = i_row_ptrs[row + 1] - i_row_ptrs[row] + count;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_SELECT_PATTERN_EXTENSION_KERNEL);
+
+
+template <typename ValueType, typename IndexType>
+void extend_pattern(std::shared_ptr<const DefaultExecutor> exec,
+                    const matrix::Csr<ValueType, IndexType>* inverse,
+                    const IndexType* extension, IndexType fill,
+                    matrix::Csr<ValueType, IndexType>* extended)
+{
+    const auto num_rows = static_cast<IndexType>(inverse->get_size()[0]);
+    const auto i_row_ptrs = inverse->get_const_row_ptrs();
+    const auto i_cols = inverse->get_const_col_idxs();
+    const auto e_row_ptrs = extended->get_const_row_ptrs();
+    auto e_cols = extended->get_col_idxs();
+    auto e_vals = extended->get_values();
+    for (IndexType row = 0; row < num_rows; ++row) {
+        const auto i_size = i_row_ptrs[row + 1] - i_row_ptrs[row];
+        const auto count = e_row_ptrs[row + 1] - e_row_ptrs[row] - i_size;
+        const auto row_extension = extension + row * fill;
+        std::merge(i_cols + i_row_ptrs[row], i_cols + i_row_ptrs[row + 1],
+                   row_extension, row_extension + count,
+                   e_cols + e_row_ptrs[row]);
+        std::fill(e_vals + e_row_ptrs[row], e_vals + e_row_ptrs[row + 1],
+                  zero<ValueType>());
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_AND_INDEX_TYPE(
+    GKO_DECLARE_ISAI_EXTEND_PATTERN_KERNEL);
+
+
 }  // namespace isai
 }  // namespace reference
 }  // namespace kernels
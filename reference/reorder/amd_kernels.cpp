@@ -0,0 +1,380 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/amd_kernels.hpp"
+
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <utility>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/components/prefix_sum_kernels.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace amd {
+
+
+enum class node_state : uint8 { variable, element, absorbed };
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const ReferenceExecutor> exec,
+                         IndexType num_vertices, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    constexpr auto invalid = std::numeric_limits<IndexType>::max();
+    const auto n = static_cast<size_type>(num_vertices);
+    // the quotient graph: variables are adjacent to variables (pruned in
+    // place from the input pattern) and to elements, which are the
+    // eliminated pivots adjacent to a set of variables. Indistinguishable
+    // variables are merged into supervariables, represented by their first
+    // variable, with the remaining ones stored in a linked list.
+    vector<IndexType> adj(col_idxs, col_idxs + row_ptrs[n], exec);
+    vector<IndexType> adj_end(row_ptrs + 1, row_ptrs + n + 1, exec);
+    vector<vector<IndexType>> elements(n, vector<IndexType>(exec), exec);
+    vector<vector<IndexType>> element_vars(n, vector<IndexType>(exec), exec);
+    vector<IndexType> element_weight(n, 0, exec);
+    vector<node_state> state(n, node_state::variable, exec);
+    vector<IndexType> weight(n, 1, exec);
+    vector<IndexType> next_member(n, invalid, exec);
+    vector<IndexType> last_member(n, exec);
+    vector<IndexType> degree(n, exec);
+    vector<IndexType> owner(n, invalid, exec);
+    vector<IndexType> remaining(n, exec);
+    for (size_type i = 0; i < n; i++) {
+        degree[i] = row_ptrs[i + 1] - row_ptrs[i];
+    }
+    std::iota(last_member.begin(), last_member.end(), IndexType{});
+    std::iota(remaining.begin(), remaining.end(), IndexType{});
+    const auto has_priority = [&](IndexType a, IndexType b) {
+        return std::make_pair(degree[a], a) < std::make_pair(degree[b], b);
+    };
+    const auto is_variable = [&](IndexType u) {
+        return state[u] == node_state::variable;
+    };
+    const auto append_members = [&](IndexType var, IndexType other) {
+        next_member[last_member[var]] = other;
+        last_member[var] = last_member[other];
+    };
+    vector<IndexType> candidates(exec);
+    vector<IndexType> reach_ptrs(exec);
+    vector<IndexType> reach_sizes(exec);
+    vector<IndexType> reach(exec);
+    vector<IndexType> pivots(exec);
+    vector<std::pair<IndexType, IndexType>> overlaps(exec);
+    vector<std::pair<size_type, IndexType>> hashes(exec);
+    IndexType num_eliminated{};
+    size_type output_size{};
+    while (!remaining.empty()) {
+        // all variables close to the minimum degree are pivot candidates
+        IndexType min_degree = invalid;
+        for (auto var : remaining) {
+            min_degree = std::min(min_degree, degree[var]);
+        }
+        const auto threshold = min_degree + min_degree / 10;
+        candidates.clear();
+        for (auto var : remaining) {
+            if (degree[var] <= threshold) {
+                candidates.push_back(var);
+            }
+        }
+        // candidates adjacent to a higher-priority candidate or sharing an
+        // element with it are in its reach, so they can be discarded before
+        // computing their reach
+        const auto for_each_neighbor = [&](IndexType var, auto fn) {
+            fn(var);
+            std::for_each(adj.begin() + row_ptrs[var],
+                          adj.begin() + adj_end[var], fn);
+            std::for_each(elements[var].begin(), elements[var].end(), fn);
+        };
+        for (auto var : candidates) {
+            for_each_neighbor(var, [&](IndexType u) {
+                if (owner[u] == invalid || has_priority(var, owner[u])) {
+                    owner[u] = var;
+                }
+            });
+        }
+        const auto independent_end = std::stable_partition(
+            candidates.begin(), candidates.end(), [&](IndexType var) {
+                return owner[var] == var &&
+                       std::all_of(elements[var].begin(), elements[var].end(),
+                                   [&](IndexType element) {
+                                       return owner[element] == var;
+                                   });
+            });
+        for (auto var : candidates) {
+            for_each_neighbor(var, [&](IndexType u) { owner[u] = invalid; });
+        }
+        candidates.erase(independent_end, candidates.end());
+        const auto num_candidates = candidates.size();
+        // compute the variables reachable from each candidate
+        reach_ptrs.assign(num_candidates + 1, 0);
+        reach_sizes.resize(num_candidates);
+        for (size_type i = 0; i < num_candidates; i++) {
+            const auto var = candidates[i];
+            auto count = adj_end[var] - row_ptrs[var];
+            for (auto element : elements[var]) {
+                count += static_cast<IndexType>(element_vars[element].size());
+            }
+            reach_ptrs[i] = count;
+        }
+        components::prefix_sum_nonnegative(exec, reach_ptrs.data(),
+                                           num_candidates + 1);
+        reach.resize(reach_ptrs[num_candidates]);
+        for (size_type i = 0; i < num_candidates; i++) {
+            const auto var = candidates[i];
+            const auto begin = reach.begin() + reach_ptrs[i];
+            auto end = std::copy_if(adj.begin() + row_ptrs[var],
+                                    adj.begin() + adj_end[var], begin,
+                                    is_variable);
+            for (auto element : elements[var]) {
+                end = std::copy_if(element_vars[element].begin(),
+                                   element_vars[element].end(), end,
+                                   is_variable);
+            }
+            std::sort(begin, end);
+            end = std::unique(begin, end);
+            end = std::remove(begin, end, var);
+            reach_sizes[i] = end - begin;
+        }
+        // each variable is owned by the highest-priority candidate reaching
+        // it, the candidates owning their whole reach are independent
+        const auto for_each_reached = [&](size_type i, auto fn) {
+            fn(candidates[i]);
+            std::for_each(reach.begin() + reach_ptrs[i],
+                          reach.begin() + reach_ptrs[i] + reach_sizes[i], fn);
+        };
+        for (size_type i = 0; i < num_candidates; i++) {
+            const auto var = candidates[i];
+            for_each_reached(i, [&](IndexType u) {
+                if (owner[u] == invalid || has_priority(var, owner[u])) {
+                    owner[u] = var;
+                }
+            });
+        }
+        pivots.clear();
+        for (size_type i = 0; i < num_candidates; i++) {
+            const auto var = candidates[i];
+            bool independent = true;
+            for_each_reached(
+                i, [&](IndexType u) { independent &= owner[u] == var; });
+            if (independent) {
+                pivots.push_back(i);
+            }
+        }
+        std::sort(pivots.begin(), pivots.end(),
+                  [&](IndexType a, IndexType b) {
+                      return has_priority(candidates[a], candidates[b]);
+                  });
+        // eliminate the pivots, turning them into elements
+        IndexType pivot_weight{};
+        for (auto i : pivots) {
+            const auto pivot = candidates[i];
+            const auto begin = reach.begin() + reach_ptrs[i];
+            const auto end = begin + reach_sizes[i];
+            for (auto element : elements[pivot]) {
+                state[element] = node_state::absorbed;
+                vector<IndexType>(exec).swap(element_vars[element]);
+            }
+            state[pivot] = node_state::element;
+            element_vars[pivot].assign(begin, end);
+            element_weight[pivot] =
+                std::accumulate(begin, end, IndexType{},
+                                [&](IndexType sum, IndexType var) {
+                                    return sum + weight[var];
+                                });
+            vector<IndexType>(exec).swap(elements[pivot]);
+            adj_end[pivot] = row_ptrs[pivot];
+            pivot_weight += weight[pivot];
+            for (auto it = begin; it != end; ++it) {
+                const auto var = *it;
+                // variables adjacent through the new element are redundant
+                adj_end[var] =
+                    std::remove_if(adj.begin() + row_ptrs[var],
+                                   adj.begin() + adj_end[var],
+                                   [&](IndexType u) {
+                                       return u == pivot || !is_variable(u) ||
+                                              std::binary_search(begin, end, u);
+                                   }) -
+                    adj.begin();
+                auto& var_elements = elements[var];
+                var_elements.erase(
+                    std::remove_if(var_elements.begin(), var_elements.end(),
+                                   [&](IndexType element) {
+                                       return state[element] ==
+                                              node_state::absorbed;
+                                   }),
+                    var_elements.end());
+                var_elements.push_back(pivot);
+            }
+        }
+        // update the approximate external degrees |A_i \ i| + |L_p \ i| +
+        // sum |L_e \ L_p| over all other elements e adjacent to i, where
+        // |L_e \ L_p| is |L_e| minus the weight of L_p adjacent to e
+        const auto max_degree = static_cast<IndexType>(n) - num_eliminated -
+                                pivot_weight;
+        for (auto i : pivots) {
+            const auto pivot = candidates[i];
+            const auto begin = reach.begin() + reach_ptrs[i];
+            const auto end = begin + reach_sizes[i];
+            overlaps.clear();
+            for (auto it = begin; it != end; ++it) {
+                for (auto element : elements[*it]) {
+                    if (element != pivot) {
+                        overlaps.emplace_back(element, weight[*it]);
+                    }
+                }
+            }
+            std::sort(overlaps.begin(), overlaps.end());
+            auto out_it = overlaps.begin();
+            for (auto it = overlaps.begin(); it != overlaps.end();) {
+                const auto element = it->first;
+                IndexType sum{};
+                for (; it != overlaps.end() && it->first == element; ++it) {
+                    sum += it->second;
+                }
+                *out_it++ = std::make_pair(element, sum);
+            }
+            overlaps.erase(out_it, overlaps.end());
+            for (auto it = begin; it != end; ++it) {
+                const auto var = *it;
+                auto new_degree = element_weight[pivot] - weight[var];
+                for (auto u_it = adj.begin() + row_ptrs[var];
+                     u_it != adj.begin() + adj_end[var]; ++u_it) {
+                    new_degree += weight[*u_it];
+                }
+                auto& var_elements = elements[var];
+                // elements covered by the new element are absorbed
+                var_elements.erase(
+                    std::remove_if(
+                        var_elements.begin(), var_elements.end(),
+                        [&](IndexType element) {
+                            if (element == pivot) {
+                                return false;
+                            }
+                            const auto external =
+                                element_weight[element] -
+                                std::lower_bound(
+                                    overlaps.begin(), overlaps.end(),
+                                    std::make_pair(element, IndexType{}))
+                                    ->second;
+                            new_degree += external;
+                            return external == 0;
+                        }),
+                    var_elements.end());
+                degree[var] = std::min(
+                    {new_degree, max_degree - weight[var],
+                     degree[var] + element_weight[pivot] - weight[var]});
+            }
+        }
+        // variables only adjacent to the new element are indistinguishable
+        // from the pivot, and are eliminated along with it. Other
+        // indistinguishable variables are merged into supervariables.
+        for (auto i : pivots) {
+            const auto pivot = candidates[i];
+            auto& pivot_vars = element_vars[pivot];
+            const auto is_mass_eliminated = [&](IndexType var) {
+                return adj_end[var] == row_ptrs[var] &&
+                       elements[var].size() == 1;
+            };
+            IndexType mass_weight{};
+            for (auto var : pivot_vars) {
+                if (is_mass_eliminated(var)) {
+                    state[var] = node_state::absorbed;
+                    append_members(pivot, var);
+                    mass_weight += weight[var];
+                }
+            }
+            element_weight[pivot] -= mass_weight;
+            pivot_vars.erase(std::remove_if(pivot_vars.begin(),
+                                            pivot_vars.end(),
+                                            [&](IndexType var) {
+                                                return !is_variable(var);
+                                            }),
+                             pivot_vars.end());
+            hashes.clear();
+            for (auto var : pivot_vars) {
+                degree[var] -= mass_weight;
+                auto& var_elements = elements[var];
+                std::sort(adj.begin() + row_ptrs[var],
+                          adj.begin() + adj_end[var]);
+                std::sort(var_elements.begin(), var_elements.end());
+                auto hash = std::accumulate(adj.begin() + row_ptrs[var],
+                                            adj.begin() + adj_end[var],
+                                            size_type{});
+                hash = std::accumulate(var_elements.begin(),
+                                       var_elements.end(), hash);
+                hashes.emplace_back(hash, var);
+            }
+            std::sort(hashes.begin(), hashes.end());
+            for (auto it = hashes.begin(); it != hashes.end(); ++it) {
+                const auto var = it->second;
+                if (!is_variable(var)) {
+                    continue;
+                }
+                for (auto other_it = it + 1; other_it != hashes.end() &&
+                                             other_it->first == it->first;
+                     ++other_it) {
+                    const auto other = other_it->second;
+                    if (is_variable(other) &&
+                        std::equal(adj.begin() + row_ptrs[var],
+                                   adj.begin() + adj_end[var],
+                                   adj.begin() + row_ptrs[other],
+                                   adj.begin() + adj_end[other]) &&
+                        elements[var] == elements[other]) {
+                        state[other] = node_state::absorbed;
+                        append_members(var, other);
+                        weight[var] += weight[other];
+                        degree[var] -= weight[other];
+                        adj_end[other] = row_ptrs[other];
+                        vector<IndexType>(exec).swap(elements[other]);
+                    }
+                }
+            }
+            pivot_vars.erase(std::remove_if(pivot_vars.begin(),
+                                            pivot_vars.end(),
+                                            [&](IndexType var) {
+                                                return !is_variable(var);
+                                            }),
+                             pivot_vars.end());
+        }
+        for (auto i : pivots) {
+            for (auto var = candidates[i]; var != invalid;
+                 var = next_member[var]) {
+                permutation[output_size++] = var;
+            }
+        }
+        num_eliminated = static_cast<IndexType>(output_size);
+        for (size_type i = 0; i < num_candidates; i++) {
+            for_each_reached(i, [&](IndexType u) { owner[u] = invalid; });
+        }
+        remaining.erase(
+            std::remove_if(remaining.begin(), remaining.end(),
+                           [&](IndexType var) { return !is_variable(var); }),
+            remaining.end());
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(GKO_DECLARE_AMD_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace amd
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/gray_code_kernels.hpp"
+
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/base/allocator.hpp"
+#include "core/reorder/gray_code_signature.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace gray_code {
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const ReferenceExecutor> exec,
+                         IndexType num_rows, IndexType num_cols,
+                         const IndexType* row_ptrs, const IndexType* col_idxs,
+                         int num_column_blocks, IndexType* permutation)
+{
+    using experimental::reorder::gray_code::gray_code_rank;
+    using experimental::reorder::gray_code::row_signature;
+    // sorting (rank, row) pairs keeps rows with equal rank in their order
+    vector<std::pair<uint64, IndexType>> keys(num_rows, exec);
+    for (IndexType row = 0; row < num_rows; ++row) {
+        keys[row] = std::make_pair(
+            gray_code_rank(row_signature(row_ptrs, col_idxs, row, num_cols,
+                                         num_column_blocks)),
+            row);
+    }
+    std::sort(keys.begin(), keys.end());
+    for (IndexType i = 0; i < num_rows; ++i) {
+        permutation[i] = keys[i].second;
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_GRAY_CODE_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace gray_code
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
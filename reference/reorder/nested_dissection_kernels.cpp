@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/reorder/nested_dissection_kernels.hpp"
+
+
+#include <memory>
+
+
+#include <ginkgo/core/base/types.hpp>
+
+
+#include "core/reorder/nested_dissection.hpp"
+
+
+namespace gko {
+namespace kernels {
+namespace reference {
+/**
+ * @brief The reordering namespace.
+ *
+ * @ingroup reorder
+ */
+namespace nested_dissection {
+
+
+template <typename IndexType>
+void dissect_recursive(std::shared_ptr<const ReferenceExecutor> exec,
+                       const experimental::reorder::nd::problem<IndexType>& p,
+                       IndexType* permutation)
+{
+    const auto parts =
+        experimental::reorder::nd::dissect<IndexType>(exec, p, permutation);
+    if (parts.first.size() > 0) {
+        dissect_recursive(exec, parts.first, permutation);
+        dissect_recursive(exec, parts.second,
+                          permutation + parts.first.size());
+    }
+}
+
+
+template <typename IndexType>
+void compute_permutation(std::shared_ptr<const ReferenceExecutor> exec,
+                         IndexType num_vertices, const IndexType* row_ptrs,
+                         const IndexType* col_idxs, IndexType* permutation)
+{
+    if (num_vertices == 0) {
+        return;
+    }
+    dissect_recursive(exec,
+                      experimental::reorder::nd::make_problem(
+                          exec, num_vertices, row_ptrs, col_idxs),
+                      permutation);
+}
+
+GKO_INSTANTIATE_FOR_EACH_INDEX_TYPE(
+    GKO_DECLARE_ND_COMPUTE_PERMUTATION_KERNEL);
+
+
+}  // namespace nested_dissection
+}  // namespace reference
+}  // namespace kernels
+}  // namespace gko
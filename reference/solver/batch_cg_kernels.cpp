@@ -24,7 +24,7 @@ namespace batch_cg {
 namespace {
 
 
-constexpr int max_num_rhs = 1;
+constexpr int max_num_rhs = 16;
 
 
 #include "reference/base/batch_multi_vector_kernels.hpp.inc"
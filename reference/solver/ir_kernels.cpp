@@ -25,6 +25,24 @@ void initialize(std::shared_ptr<const ReferenceExecutor> exec,
 }
 
 
+template <typename CorrectionType, typename ValueType>
+void add_correction(std::shared_ptr<const ReferenceExecutor> exec,
+                    const matrix::Dense<ValueType>* alpha,
+                    const matrix::Dense<CorrectionType>* correction,
+                    matrix::Dense<ValueType>* x)
+{
+    for (size_type row = 0; row < x->get_size()[0]; ++row) {
+        for (size_type col = 0; col < x->get_size()[1]; ++col) {
+            x->at(row, col) += alpha->at(0, 0) *
+                               static_cast<ValueType>(correction->at(row, col));
+        }
+    }
+}
+
+GKO_INSTANTIATE_FOR_EACH_VALUE_CONVERSION_OR_COPY(
+    GKO_DECLARE_IR_ADD_CORRECTION_KERNEL);
+
+
 }  // namespace ir
 }  // namespace reference
 }  // namespace kernels
@@ -19,8 +19,6 @@ namespace batch_stop {
 
 /**
  * Stopping criterion for batch solvers with relative residual threshold.
- *
- * @note Supports only one right hand side.
  */
 template <typename ValueType>
 class SimpleRelResidual {
@@ -50,6 +48,19 @@ public:
         return residual_norms[0] <= (rel_tol_ * rhs_norms_[0]);
     }
 
+    /**
+     * Checks whether a single right hand side has converged.
+     *
+     * @param rhs  Index of the right hand side.
+     * @param residual_norm  Current residual norm of that right hand side.
+     *
+     * @return  true if converged, false otherwise.
+     */
+    bool check_converged(const int rhs, const real_type residual_norm) const
+    {
+        return residual_norm <= (rel_tol_ * rhs_norms_[rhs]);
+    }
+
 private:
     const real_type rel_tol_;
     const real_type* const rhs_norms_;
@@ -59,8 +70,6 @@ private:
 /**
  * Stopping criterion for batch solvers that checks for an absolute residual
  * threshold.
- *
- * @note Supports only one right hand side.
  */
 template <typename ValueType>
 class SimpleAbsResidual {
@@ -86,11 +95,61 @@ public:
         return (residual_norms[0] <= abs_tol_);
     }
 
+    /**
+     * Checks whether a single right hand side has converged.
+     *
+     * @param residual_norm  Current residual norm of that right hand side.
+     *
+     * @return  true if converged, false otherwise.
+     */
+    bool check_converged(const int, const real_type residual_norm) const
+    {
+        return residual_norm <= abs_tol_;
+    }
+
 private:
     const real_type abs_tol_;
 };
 
 
+/**
+ * Checks all right hand sides that have not converged yet. Newly converged
+ * right hand sides are marked and their iteration count and residual norm are
+ * logged, so that they can be excluded from further updates.
+ *
+ * @param stop  The stopping criterion.
+ * @param logger  The logger receiving the per right hand side results.
+ * @param batch_idx  The index of the linear system in the batch.
+ * @param iter  The current iteration count.
+ * @param num_rhs  The number of right hand sides.
+ * @param residual_norms  Current residual norm of each right hand side.
+ * @param converged  Convergence flag of each right hand side, updated in place.
+ *
+ * @return  true if all right hand sides have converged, false otherwise.
+ */
+template <typename StopType, typename LogType, typename RealType>
+inline bool check_all_converged(const StopType& stop, LogType& logger,
+                                const size_type batch_idx, const int iter,
+                                const int num_rhs,
+                                const RealType* const residual_norms,
+                                bool* const converged)
+{
+    bool all_converged = true;
+    for (int c = 0; c < num_rhs; c++) {
+        if (converged[c]) {
+            continue;
+        }
+        if (stop.check_converged(c, residual_norms[c])) {
+            converged[c] = true;
+            logger.log_iteration(batch_idx, iter, residual_norms[c], c);
+        } else {
+            all_converged = false;
+        }
+    }
+    return all_converged;
+}
+
+
 }  // namespace batch_stop
 }  // namespace host
 }  // namespace kernels
@@ -0,0 +1,237 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/factorization/block_ilu.hpp>
+
+
+#include <algorithm>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/preconditioner/ilu.hpp>
+#include <ginkgo/core/solver/block_triangular.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BlockIlu : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Dense = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+    using ilu_type = gko::factorization::BlockIlu<value_type, index_type>;
+
+    BlockIlu()
+        : ref(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx_block_tridiag(gko::initialize<Dense>(
+              {{4., 1., 1., 0., 0., 0.},
+               {1., 5., 0., 1., 0., 0.},
+               {1., 0., 6., 2., 1., 1.},
+               {0., 2., 1., 5., 0., 1.},
+               {0., 0., 2., 0., 4., 1.},
+               {0., 0., 1., 1., 0., 3.}}, ref)),
+          mtx_big(gko::initialize<Csr>(
+              {{1., 1., 1., 0., 1., 3.},
+               {1., 2., 2., 0., 2., 0.},
+               {0., 2., 0., 3., 3., 5.},
+               {1., 0., 3., 4., 4., 4.},
+               {1., 2., 0., 4., 1., 6.},
+               {0., 2., 3., 4., 5., 8.}}, ref)),
+          big_l_expected(gko::initialize<Dense>(
+              {{1., 0., 0., 0., 0., 0.},
+               {1., 1., 0., 0., 0., 0.},
+               {0., 2., 1., 0., 0., 0.},
+               {1., 0., -1., 1., 0., 0.},
+               {1., 1., 0., 0.571428571428571, 1., 0.},
+               {0., 2., -0.5, 0.785714285714286, -0.108695652173913, 1.}},
+              ref)),
+          big_u_expected(gko::initialize<Dense>(
+              {{1., 1., 1., 0., 1., 3.},
+               {0., 1., 1., 0., 1., 0.},
+               {0., 0., -2., 3., 1., 5.},
+               {0., 0., 0., 7., 4., 6.},
+               {0., 0., 0., 0., -3.28571428571429, -0.428571428571429},
+               {0., 0., 0., 0., 0., 5.73913043478261}},
+              ref)),
+          // clang-format on
+          fbcsr_block_tridiag(Fbcsr::create(ref, 2))
+    {
+        mtx_block_tridiag->convert_to(fbcsr_block_tridiag);
+    }
+
+    std::unique_ptr<Dense> to_dense(const Fbcsr* mtx)
+    {
+        auto result = Dense::create(ref);
+        mtx->convert_to(result);
+        return result;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::shared_ptr<Dense> mtx_block_tridiag;
+    std::shared_ptr<Csr> mtx_big;
+    std::shared_ptr<Dense> big_l_expected;
+    std::shared_ptr<Dense> big_u_expected;
+    std::shared_ptr<Fbcsr> fbcsr_block_tridiag;
+};
+
+TYPED_TEST_SUITE(BlockIlu, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BlockIlu, KeepsBlockSizeOfFbcsrInput)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+
+    auto fact = ilu_type::build().with_block_size(3).on(this->ref)->generate(
+        this->fbcsr_block_tridiag);
+
+    ASSERT_EQ(fact->get_l_factor()->get_block_size(), 2);
+    ASSERT_EQ(fact->get_u_factor()->get_block_size(), 2);
+}
+
+
+TYPED_TEST(BlockIlu, UsesBlockSizeForOtherInput)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+
+    auto fact = ilu_type::build().with_block_size(2).on(this->ref)->generate(
+        this->mtx_block_tridiag);
+
+    ASSERT_EQ(fact->get_l_factor()->get_block_size(), 2);
+    ASSERT_EQ(fact->get_u_factor()->get_block_size(), 2);
+}
+
+
+TYPED_TEST(BlockIlu, ComputesBlockTriangularFactors)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto fact =
+        ilu_type::build().on(this->ref)->generate(this->fbcsr_block_tridiag);
+
+    auto l_factor = fact->get_l_factor();
+    auto u_factor = fact->get_u_factor();
+    ASSERT_EQ(l_factor->get_num_stored_blocks(), 5);
+    ASSERT_EQ(u_factor->get_num_stored_blocks(), 5);
+    // the diagonal blocks are stored last in L and first in U
+    auto l_dense = this->to_dense(l_factor.get());
+    auto u_dense = this->to_dense(u_factor.get());
+    for (int row = 0; row < 6; row++) {
+        for (int col = 0; col < 6; col++) {
+            const auto block_row = row / 2;
+            const auto block_col = col / 2;
+            if (block_col > block_row) {
+                ASSERT_EQ(l_dense->at(row, col), gko::zero<value_type>());
+            } else if (block_col == block_row) {
+                ASSERT_EQ(l_dense->at(row, col),
+                          row == col ? gko::one<value_type>()
+                                     : gko::zero<value_type>());
+            }
+            if (block_col < block_row) {
+                ASSERT_EQ(u_dense->at(row, col), gko::zero<value_type>());
+            }
+        }
+    }
+}
+
+
+TYPED_TEST(BlockIlu, IsExactForBlockTridiagonalMatrix)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+
+    auto fact =
+        ilu_type::build().on(this->ref)->generate(this->fbcsr_block_tridiag);
+
+    auto product = Dense::create(this->ref, gko::dim<2>{6, 6});
+    this->to_dense(fact->get_l_factor().get())
+        ->apply(this->to_dense(fact->get_u_factor().get()), product);
+    GKO_ASSERT_MTX_NEAR(product, this->mtx_block_tridiag,
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockIlu, IsEquivalentToIluForBlockSizeOne)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+    using value_type = typename TestFixture::value_type;
+
+    auto fact = ilu_type::build().on(this->ref)->generate(this->mtx_big);
+
+    GKO_ASSERT_MTX_NEAR(this->to_dense(fact->get_l_factor().get()),
+                        this->big_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(this->to_dense(fact->get_u_factor().get()),
+                        this->big_u_expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockIlu, SortsUnsortedInput)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+    using value_type = typename TestFixture::value_type;
+    auto unsorted = gko::share(gko::clone(this->fbcsr_block_tridiag));
+    // swap the first two blocks in the middle block row
+    auto cols = unsorted->get_col_idxs();
+    auto vals = unsorted->get_values();
+    const auto begin = unsorted->get_const_row_ptrs()[1];
+    std::swap(cols[begin], cols[begin + 1]);
+    std::swap_ranges(vals + begin * 4, vals + (begin + 1) * 4,
+                     vals + (begin + 1) * 4);
+    auto expected =
+        ilu_type::build().on(this->ref)->generate(this->fbcsr_block_tridiag);
+
+    auto fact = ilu_type::build().on(this->ref)->generate(unsorted);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), expected->get_l_factor(),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), expected->get_u_factor(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockIlu, CanBeUsedInIluPreconditioner)
+{
+    using ilu_type = typename TestFixture::ilu_type;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Dense = typename TestFixture::Dense;
+    using Precond = gko::preconditioner::Ilu<
+        gko::solver::BlockLowerTrs<value_type, index_type>,
+        gko::solver::BlockUpperTrs<value_type, index_type>, false, index_type>;
+    auto precond = Precond::build()
+                       .with_factorization(ilu_type::build())
+                       .on(this->ref)
+                       ->generate(this->fbcsr_block_tridiag);
+    auto b = gko::initialize<Dense>({1., -1., 2., 0., 3., 1.}, this->ref);
+    auto x = Dense::create(this->ref, gko::dim<2>{6, 1});
+    auto result = Dense::create(this->ref, gko::dim<2>{6, 1});
+
+    precond->apply(b, x);
+
+    // the factorization is exact, so the preconditioner solves the system
+    this->mtx_block_tridiag->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, b, r<value_type>::value);
+}
+
+
+}  // namespace
@@ -721,4 +721,42 @@ TYPED_TEST(ParIlu, GenerateForReverseCsrSmall)
 }
 
 
+TYPED_TEST(ParIlu, UpdateValuesForCsrSmall)
+{
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto scaled_mtx = gko::share(gko::clone(this->mtx_csr_small));
+    scaled_mtx->scale(gko::initialize<Dense>({2.0}, this->exec));
+    auto factors = this->ilu_factory_skip->generate(scaled_mtx);
+
+    factors->update_values(this->mtx_csr_small);
+
+    auto l_factor = factors->get_l_factor();
+    auto u_factor = factors->get_u_factor();
+    GKO_ASSERT_MTX_NEAR(l_factor, this->small_l_expected, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(u_factor, this->small_u_expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(ParIlu, UpdateValuesCreatesNewFactors)
+{
+    auto factors = this->ilu_factory_skip->generate(this->mtx_csr_small);
+    auto l_factor = factors->get_l_factor();
+
+    factors->update_values(this->mtx_csr_small);
+
+    ASSERT_NE(factors->get_l_factor(), l_factor);
+    GKO_ASSERT_MTX_NEAR(l_factor, factors->get_l_factor(), 0.0);
+}
+
+
+TYPED_TEST(ParIlu, UpdateValuesThrowsOnDifferentPattern)
+{
+    auto factors = this->ilu_factory_sort->generate(this->mtx_small);
+
+    ASSERT_THROW(factors->update_values(this->identity),
+                 gko::InvalidStateError);
+}
+
+
 }  // namespace
@@ -642,4 +642,156 @@ TYPED_TEST(ParIlut, GenerateWithApproxLargeLimit)
 }
 
 
+TYPED_TEST(ParIlut, GenerateRowWiseIdentity)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .on(this->exec)
+            ->generate(this->identity);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->identity, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), this->identity, this->tol);
+}
+
+
+TYPED_TEST(ParIlut, GenerateRowWiseLowerTri)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .on(this->exec)
+            ->generate(this->lower_tri);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->lower_tri, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), this->identity, this->tol);
+}
+
+
+TYPED_TEST(ParIlut, GenerateRowWiseUpperTri)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .on(this->exec)
+            ->generate(this->upper_tri);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->identity, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), this->upper_tri, this->tol);
+}
+
+
+TYPED_TEST(ParIlut, GenerateRowWiseWithLargeLimitIsExact)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .with_fill_in_limit(2.0)
+            .on(this->exec)
+            ->generate(this->mtx_system);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->mtx_l_large_expect,
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), this->mtx_u_large_expect,
+                        this->tol);
+}
+
+
+TYPED_TEST(ParIlut, GenerateRowWiseWithSmallLimit)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Csr = typename TestFixture::Csr;
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .with_fill_in_limit(1.0)
+            .on(this->exec)
+            ->generate(this->mtx_system);
+
+    // every row keeps as many entries as the ILU(0) factors, but the largest
+    // ones instead of the original pattern
+    auto l_expect = gko::initialize<Csr>({{1., 0., 0., 0.},
+                                          {2., 1., 0., 0.},
+                                          {.5, 6. / 17., 1., 0.},
+                                          {.2, .1, -153. / 116., 1.}},
+                                         this->exec);
+    auto u_expect = gko::initialize<Csr>({{1., 6., 4., 7.},
+                                          {0., -17., -8., 0.},
+                                          {0., 0., 116. / 17., 0.},
+                                          {0., 0., 0., -1.4}},
+                                         this->exec);
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), l_expect, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), u_expect, this->tol);
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_l_factor(), l_expect);
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_u_factor(), u_expect);
+}
+
+
+TYPED_TEST(ParIlut, GenerateRowWiseWithDropTolerance)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Csr = typename TestFixture::Csr;
+    auto mtx = gko::share(gko::initialize<Csr>(
+        {{1., 1., .1}, {2., 4., 0.}, {2., 0., 4.}}, this->exec));
+
+    auto fact =
+        factorization_type::build()
+            .with_algorithm(gko::factorization::ilut_algorithm::row_wise)
+            .with_drop_tolerance(0.1)
+            .on(this->exec)
+            ->generate(mtx);
+
+    // the entry .1 is below 0.1 times the norm of the first row, so the
+    // fill-in it would cause never appears
+    auto l_expect = gko::initialize<Csr>(
+        {{1., 0., 0.}, {2., 1., 0.}, {2., -1., 1.}}, this->exec);
+    auto u_expect = gko::initialize<Csr>(
+        {{1., 1., 0.}, {0., 2., 0.}, {0., 0., 4.}}, this->exec);
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), l_expect, this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), u_expect, this->tol);
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_l_factor(), l_expect);
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_u_factor(), u_expect);
+}
+
+
+TYPED_TEST(ParIlut, UpdateValuesKeepsSparsityPattern)
+{
+    using factorization_type = typename TestFixture::factorization_type;
+    using Dense = typename TestFixture::Dense;
+    auto fact = factorization_type::build()
+                    .with_approximate_select(false)
+                    .with_fill_in_limit(0.75)
+                    .on(this->exec)
+                    ->generate(this->mtx_system);
+    auto two = gko::initialize<Dense>({2.0}, this->exec);
+    auto scaled_system = gko::share(gko::clone(this->mtx_system));
+    scaled_system->scale(two);
+    auto u_expect = gko::clone(this->mtx_u_small_expect);
+    u_expect->scale(two);
+    auto l_pattern = gko::clone(fact->get_l_factor());
+    auto u_pattern = gko::clone(fact->get_u_factor());
+
+    fact->update_values(scaled_system);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_l_factor(), l_pattern);
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_u_factor(), u_pattern);
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), this->mtx_l_small_expect,
+                        this->tol);
+    GKO_ASSERT_MTX_NEAR(fact->get_u_factor(), u_expect, this->tol);
+}
+
+
+TYPED_TEST(ParIlut, UpdateValuesThrowsOnDifferentPattern)
+{
+    auto fact = this->fact_fact->generate(this->mtx_system);
+
+    ASSERT_THROW(fact->update_values(gko::clone(this->mtx_lu)),
+                 gko::InvalidStateError);
+}
+
+
 }  // namespace
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+template <typename T>
+class VariableCsr : public ::testing::Test {
+protected:
+    using value_type = T;
+    using BMtx = gko::batch::matrix::VariableCsr<value_type>;
+    using BMVec = gko::batch::MultiVector<value_type>;
+    using CsrMtx = gko::matrix::Csr<value_type>;
+    VariableCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx_00(gko::initialize<CsrMtx>(
+              {I<T>({1.0, -1.0}), I<T>({-2.0, 2.0})}, exec)),
+          mtx_01(gko::initialize<CsrMtx>(
+              {I<T>({1.0, -2.0, 0.0}), I<T>({1.0, -2.5, 4.0}),
+               I<T>({0.0, 3.0, 1.0})},
+              exec)),
+          mtx_0(BMtx::create_from_items(exec, {mtx_00.get(), mtx_01.get()})),
+          b_0(gko::batch::initialize<BMVec>(
+              {{I<T>({1.0, 0.0}), I<T>({2.0, 1.0}), I<T>({7.0, 7.0})},
+               {I<T>({-1.0, 1.0}), I<T>({1.0, -1.0}), I<T>({1.0, 2.0})}},
+              exec)),
+          x_0(gko::batch::initialize<BMVec>(
+              {{I<T>({2.0, 0.0}), I<T>({2.0, 1.0}), I<T>({3.0, 3.0})},
+               {I<T>({-2.0, 1.0}), I<T>({1.0, -1.0}), I<T>({0.5, 1.0})}},
+              exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<CsrMtx> mtx_00;
+    std::unique_ptr<CsrMtx> mtx_01;
+    std::unique_ptr<BMtx> mtx_0;
+    std::unique_ptr<BMVec> b_0;
+    std::unique_ptr<BMVec> x_0;
+};
+
+TYPED_TEST_SUITE(VariableCsr, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(VariableCsr, AppliesToBatchMultiVector)
+{
+    using T = typename TestFixture::value_type;
+    using BMVec = typename TestFixture::BMVec;
+
+    this->mtx_0->apply(this->b_0.get(), this->x_0.get());
+
+    // the padding row of the smaller item is set to zero
+    auto ref = gko::batch::initialize<BMVec>(
+        {{I<T>({-1.0, -1.0}), I<T>({2.0, 2.0}), I<T>({0.0, 0.0})},
+         {I<T>({-3.0, 3.0}), I<T>({0.5, 11.5}), I<T>({4.0, -1.0})}},
+        this->exec);
+    GKO_ASSERT_BATCH_MTX_NEAR(this->x_0.get(), ref.get(), r<T>::value);
+}
+
+
+TYPED_TEST(VariableCsr, AppliesLinearCombinationToBatchMultiVector)
+{
+    using T = typename TestFixture::value_type;
+    using BMVec = typename TestFixture::BMVec;
+    auto alpha = gko::batch::initialize<BMVec>({{1.5}, {1.5}}, this->exec);
+    auto beta = gko::batch::initialize<BMVec>({{-1.0}, {-1.0}}, this->exec);
+
+    this->mtx_0->apply(alpha.get(), this->b_0.get(), beta.get(),
+                       this->x_0.get());
+
+    // the padding row of the smaller item is only scaled by beta
+    auto ref = gko::batch::initialize<BMVec>(
+        {{I<T>({-3.5, -1.5}), I<T>({1.0, 2.0}), I<T>({-3.0, -3.0})},
+         {I<T>({-2.5, 3.5}), I<T>({-0.25, 18.25}), I<T>({5.5, -2.5})}},
+        this->exec);
+    GKO_ASSERT_BATCH_MTX_NEAR(this->x_0.get(), ref.get(), r<T>::value);
+}
+
+
+TYPED_TEST(VariableCsr, ApplyFailsOnWrongInnerDimension)
+{
+    using BMVec = typename TestFixture::BMVec;
+    auto res =
+        BMVec::create(this->exec, gko::batch_dim<2>{2, gko::dim<2>{2, 2}});
+
+    ASSERT_THROW(this->mtx_0->apply(res.get(), this->x_0.get()),
+                 gko::DimensionMismatch);
+}
@@ -0,0 +1,240 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class CsrAssembler : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Assembler = gko::matrix::CsrAssembler<value_type, index_type>;
+
+    CsrAssembler()
+        : exec(gko::ReferenceExecutor::create()),
+          // three linear elements on a line with four nodes
+          element_dofs{exec, {0, 1, 1, 2, 2, 3}},
+          element_values{exec,
+                         {1.0, -1.0, -1.0, 1.0, 2.0, -2.0, -2.0, 2.0, 3.0,
+                          -3.0, -3.0, 3.0}}
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    gko::array<index_type> element_dofs;
+    gko::array<value_type> element_values;
+};
+
+TYPED_TEST_SUITE(CsrAssembler, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(CsrAssembler, BuildsPatternFromElements)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using Csr = typename TestFixture::Csr;
+
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+
+    auto expected_pattern = gko::initialize<Csr>({{1.0, 1.0, 0.0, 0.0},
+                                                  {1.0, 1.0, 1.0, 0.0},
+                                                  {0.0, 1.0, 1.0, 1.0},
+                                                  {0.0, 0.0, 1.0, 1.0}},
+                                                 this->exec);
+    GKO_ASSERT_MTX_EQ_SPARSITY(assembler->get_matrix(), expected_pattern);
+    GKO_ASSERT_MTX_NEAR(assembler->get_matrix(),
+                        Csr::create(this->exec, gko::dim<2>{4}), 0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, BuildsPatternIgnoringNegativeDofs)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using Csr = typename TestFixture::Csr;
+    using index_type = typename TestFixture::index_type;
+    // the first node is eliminated, the last element only has one node
+    gko::array<index_type> element_dofs{this->exec, {-1, 1, 1, 2, 2, -1}};
+
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{3}, element_dofs, 2);
+
+    auto expected_pattern = gko::initialize<Csr>(
+        {{0.0, 0.0, 0.0}, {0.0, 1.0, 1.0}, {0.0, 1.0, 1.0}}, this->exec);
+    GKO_ASSERT_MTX_EQ_SPARSITY(assembler->get_matrix(), expected_pattern);
+}
+
+
+TYPED_TEST(CsrAssembler, AddsElements)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+
+    assembler->add_elements(this->element_dofs, this->element_values, 2);
+
+    GKO_ASSERT_MTX_NEAR(assembler->get_matrix(),
+                        l<T>({{1.0, -1.0, 0.0, 0.0},
+                              {-1.0, 3.0, -2.0, 0.0},
+                              {0.0, -2.0, 5.0, -3.0},
+                              {0.0, 0.0, -3.0, 3.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, AddsElementsRepeatedly)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+    assembler->add_elements(this->element_dofs, this->element_values, 2);
+
+    assembler->zero_values();
+    assembler->add_elements(this->element_dofs, this->element_values, 2);
+    assembler->add_elements(this->element_dofs, this->element_values, 2);
+
+    GKO_ASSERT_MTX_NEAR(assembler->get_matrix(),
+                        l<T>({{2.0, -2.0, 0.0, 0.0},
+                              {-2.0, 6.0, -4.0, 0.0},
+                              {0.0, -4.0, 10.0, -6.0},
+                              {0.0, 0.0, -6.0, 6.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, AddsIntoExistingMatrix)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using Csr = typename TestFixture::Csr;
+    using T = typename TestFixture::value_type;
+    // the pattern misses the entries (2, 3) and (3, 2)
+    std::shared_ptr<Csr> mtx = gko::initialize<Csr>({{1.0, 1.0, 0.0, 1.0},
+                                                     {1.0, 1.0, 1.0, 0.0},
+                                                     {0.0, 1.0, 1.0, 0.0},
+                                                     {1.0, 0.0, 0.0, 1.0}},
+                                                    this->exec);
+    auto assembler = Assembler::create(mtx);
+
+    assembler->add_elements(this->element_dofs, this->element_values, 2);
+
+    ASSERT_EQ(assembler->get_matrix(), mtx);
+    GKO_ASSERT_MTX_NEAR(mtx,
+                        l<T>({{2.0, 0.0, 0.0, 1.0},
+                              {0.0, 4.0, -1.0, 0.0},
+                              {0.0, -1.0, 6.0, 0.0},
+                              {1.0, 0.0, 0.0, 4.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, AddsValues)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+    gko::array<index_type> rows{this->exec, {0, 2, 2, 3, 0, -1}};
+    gko::array<index_type> cols{this->exec, {1, 2, 2, 0, 1, 0}};
+    gko::array<T> values{this->exec, {1.0, 2.0, 3.0, 4.0, 5.0, 6.0}};
+
+    assembler->add_values(rows, cols, values);
+
+    // (3, 0) is not part of the pattern, row -1 is ignored
+    GKO_ASSERT_MTX_NEAR(assembler->get_matrix(),
+                        l<T>({{0.0, 6.0, 0.0, 0.0},
+                              {0.0, 0.0, 0.0, 0.0},
+                              {0.0, 0.0, 5.0, 0.0},
+                              {0.0, 0.0, 0.0, 0.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(CsrAssembler, ThrowsOnSizeMismatch)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+    gko::array<index_type> rows{this->exec, {0, 1}};
+    gko::array<index_type> cols{this->exec, {0}};
+    gko::array<T> values{this->exec, {1.0, 2.0}};
+
+    ASSERT_THROW(assembler->add_elements(this->element_dofs, values, 2),
+                 gko::ValueMismatch);
+    ASSERT_THROW(assembler->add_elements(this->element_dofs, values, 4),
+                 gko::ValueMismatch);
+    ASSERT_THROW(assembler->add_elements(this->element_dofs, values, 0),
+                 gko::InvalidStateError);
+    ASSERT_THROW(assembler->add_values(rows, cols, values),
+                 gko::ValueMismatch);
+}
+
+
+
+TYPED_TEST(CsrAssembler, ThrowsOnOutOfBoundsIndices)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+    gko::array<index_type> dofs{this->exec, {0, 4}};
+    gko::array<T> element_values{this->exec, {1.0, 2.0, 3.0, 4.0}};
+    gko::array<index_type> rows{this->exec, {0, 4}};
+    gko::array<index_type> cols{this->exec, {0, 1}};
+    gko::array<T> values{this->exec, {1.0, 2.0}};
+
+    ASSERT_THROW(Assembler::create(this->exec, gko::dim<2>{4}, dofs, 2),
+                 gko::OutOfBoundsError);
+    ASSERT_THROW(assembler->add_elements(dofs, element_values, 2),
+                 gko::OutOfBoundsError);
+    ASSERT_THROW(assembler->add_values(rows, cols, values),
+                 gko::OutOfBoundsError);
+    ASSERT_THROW(assembler->add_values(cols, rows, values),
+                 gko::OutOfBoundsError);
+}
+
+
+TYPED_TEST(CsrAssembler, AddsEntriesWithinBoundsBeforeThrowing)
+{
+    using Assembler = typename TestFixture::Assembler;
+    using T = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto assembler =
+        Assembler::create(this->exec, gko::dim<2>{4}, this->element_dofs, 2);
+    gko::array<index_type> rows{this->exec, {0, 4}};
+    gko::array<index_type> cols{this->exec, {0, 0}};
+    gko::array<T> values{this->exec, {1.0, 2.0}};
+
+    ASSERT_THROW(assembler->add_values(rows, cols, values),
+                 gko::OutOfBoundsError);
+
+    ASSERT_EQ(assembler->get_matrix()->get_const_values()[0], T{1.0});
+}
+
+}  // namespace
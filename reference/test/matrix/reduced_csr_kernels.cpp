@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/reduced_csr.hpp>
+
+
+#include <complex>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/matrix/reduced_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class ReducedCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::ReducedCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using ComplexVec = gko::matrix::Dense<std::complex<value_type>>;
+
+    ReducedCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          // all values are exactly representable in both storage formats
+          csr(gko::initialize<Csr>(
+              {{1.0, 3.0, 2.0}, {0.0, 5.0, 0.0}, {-0.5, 0.0, 0.25}}, exec))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+};
+
+TYPED_TEST_SUITE(ReducedCsr, gko::test::RealValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(ReducedCsr, CanBeCreatedFromCsr)
+{
+    using Mtx = typename TestFixture::Mtx;
+    for (auto storage : {gko::matrix::reduced_storage::float16,
+                         gko::matrix::reduced_storage::bfloat16}) {
+        auto mtx = Mtx::create(this->exec, this->csr.get(), storage);
+
+        ASSERT_EQ(mtx->get_storage(), storage);
+        ASSERT_EQ(mtx->get_size(), gko::dim<2>(3, 3));
+        ASSERT_EQ(mtx->get_num_stored_elements(), 6);
+        GKO_ASSERT_MTX_NEAR(mtx, this->csr, 0.0);
+    }
+}
+
+
+TYPED_TEST(ReducedCsr, StoresValuesInHalfPrecision)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto csr = gko::initialize<Csr>({I<T>{1.0 / 3.0}}, this->exec);
+    auto mtx = Mtx::create(this->exec, csr.get(),
+                           gko::matrix::reduced_storage::float16);
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result, csr, 1e-3);
+    ASSERT_NE(result->get_const_values()[0], csr->get_const_values()[0]);
+}
+
+
+TYPED_TEST(ReducedCsr, RoundsToNearestEvenBfloat16)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    // bfloat16 has a spacing of 2^-7 around 1, so these values lie exactly
+    // halfway between two representable values
+    auto csr = gko::initialize<Csr>(
+        {{1.0 + 1.0 / 256.0, 1.0 + 3.0 / 256.0}}, this->exec);
+    auto mtx = Mtx::create(this->exec, csr.get(),
+                           gko::matrix::reduced_storage::bfloat16);
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result, l({{1.0, 1.0 + 4.0 / 256.0}}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesToDenseVector)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    for (auto storage : {gko::matrix::reduced_storage::float16,
+                         gko::matrix::reduced_storage::bfloat16}) {
+        auto mtx = Mtx::create(this->exec, this->csr.get(), storage);
+        auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+        auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+        mtx->apply(x, y);
+
+        GKO_ASSERT_MTX_NEAR(y, l({13.0, 5.0, 0.0}), 0.0);
+    }
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesToDenseMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto mtx = Mtx::create(this->exec, this->csr.get());
+    auto x = gko::initialize<Vec>(
+        {I<T>{2.0, 3.0}, I<T>{1.0, -1.5}, I<T>{4.0, 2.5}}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(
+        y, l({{13.0, 3.5}, {5.0, -7.5}, {0.0, -0.875}}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    auto mtx = Mtx::create(this->exec, this->csr.get(),
+                           gko::matrix::reduced_storage::bfloat16);
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({2.0, 1.0, 4.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+
+    mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-11.0, -1.0, 6.0}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, AppliesToComplexVector)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using ComplexVec = typename TestFixture::ComplexVec;
+    using T = std::complex<typename TestFixture::value_type>;
+    auto mtx = Mtx::create(this->exec, this->csr.get());
+    auto x = gko::initialize<ComplexVec>(
+        {T{2.0, 1.0}, T{1.0, -1.0}, T{4.0, 0.0}}, this->exec);
+    auto y = ComplexVec::create(this->exec, gko::dim<2>{3, 1});
+
+    mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({T{13.0, -2.0}, T{5.0, -5.0}, T{0.0, -0.5}}),
+                        0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeReadFromMatrixData)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec, gko::matrix::reduced_storage::bfloat16);
+
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 3}, {{0, 0, 1.0}, {0, 2, 2.0}, {1, 1, 3.0}}});
+
+    GKO_ASSERT_MTX_NEAR(mtx, l({{1.0, 0.0, 2.0}, {0.0, 3.0, 0.0}}), 0.0);
+}
+
+
+TYPED_TEST(ReducedCsr, CanBeCopied)
+{
+    using Mtx = typename TestFixture::Mtx;
+    auto mtx = Mtx::create(this->exec, this->csr.get(),
+                           gko::matrix::reduced_storage::bfloat16);
+
+    auto copy = gko::clone(mtx);
+
+    ASSERT_EQ(copy->get_storage(), gko::matrix::reduced_storage::bfloat16);
+    GKO_ASSERT_MTX_NEAR(copy, this->csr, 0.0);
+}
+
+
+}  // namespace
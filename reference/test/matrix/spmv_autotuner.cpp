@@ -0,0 +1,267 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/spmv_autotuner.hpp>
+
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/coo.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/ell.hpp>
+#include <ginkgo/core/matrix/hybrid.hpp>
+#include <ginkgo/core/matrix/sellp.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SpmvAutotuner : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Tuner = gko::matrix::SpmvAutotuner<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SpmvAutotuner()
+        : exec(gko::ReferenceExecutor::create()),
+          // the last row is much longer than the others
+          mtx(gko::initialize<Csr>({{1.0, 0.0, 0.0, 0.0, 0.0},
+                                    {0.0, 2.0, 0.0, 0.0, 0.0},
+                                    {0.0, 0.0, 3.0, 0.0, 0.0},
+                                    {0.0, 0.0, 0.0, 4.0, 0.0},
+                                    {1.0, 2.0, 3.0, 4.0, 5.0}},
+                                   exec)),
+          b(gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0}, exec)),
+          path("spmv_autotuner_cache.txt")
+    {
+        std::remove(path.c_str());
+    }
+
+    ~SpmvAutotuner() { std::remove(path.c_str()); }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> mtx;
+    std::unique_ptr<Vec> b;
+    std::string path;
+};
+
+TYPED_TEST_SUITE(SpmvAutotuner, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SpmvAutotuner, ConvertsToAllCandidates)
+{
+    using Tuner = typename TestFixture::Tuner;
+    using Vec = typename TestFixture::Vec;
+    auto expected = Vec::create(this->exec, gko::dim<2>{5, 1});
+    auto x = expected->clone();
+    this->mtx->apply(this->b, expected);
+
+    for (const auto& format : Tuner::get_default_candidates()) {
+        SCOPED_TRACE(format);
+        auto op = Tuner::convert(this->mtx, format);
+        op->apply(this->b, x);
+
+        ASSERT_EQ(op->get_size(), this->mtx->get_size());
+        GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+    }
+}
+
+
+TYPED_TEST(SpmvAutotuner, ConvertsToMatchingType)
+{
+    using Tuner = typename TestFixture::Tuner;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Csr = typename TestFixture::Csr;
+
+    auto csrm = Tuner::convert(this->mtx, "csrm");
+    auto coo = Tuner::convert(this->mtx, "coo");
+    auto ell = Tuner::convert(this->mtx, "ell");
+    auto sellp = Tuner::convert(this->mtx, "sellp");
+    auto hybrid = Tuner::convert(this->mtx, "hybrid0");
+
+    ASSERT_EQ(gko::as<Csr>(csrm.get())->get_strategy()->get_name(),
+              "merge_path");
+    ASSERT_NO_THROW(
+        (gko::as<gko::matrix::Coo<value_type, index_type>>(coo.get())));
+    ASSERT_NO_THROW(
+        (gko::as<gko::matrix::Ell<value_type, index_type>>(ell.get())));
+    ASSERT_NO_THROW(
+        (gko::as<gko::matrix::Sellp<value_type, index_type>>(sellp.get())));
+    // the 0% quantile of the row lengths is the shortest row length
+    ASSERT_EQ((gko::as<gko::matrix::Hybrid<value_type, index_type>>(
+                   hybrid.get())
+                   ->get_ell_num_stored_elements_per_row()),
+              1);
+}
+
+
+TYPED_TEST(SpmvAutotuner, ConvertsToAllFormats)
+{
+    using Tuner = typename TestFixture::Tuner;
+    using Vec = typename TestFixture::Vec;
+    auto expected = Vec::create(this->exec, gko::dim<2>{5, 1});
+    auto x = expected->clone();
+    this->mtx->apply(this->b, expected);
+
+    for (const auto& format : Tuner::get_formats()) {
+        SCOPED_TRACE(format);
+        auto op = Tuner::convert(this->mtx, format);
+        op->apply(this->b, x);
+
+        GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+    }
+}
+
+
+TYPED_TEST(SpmvAutotuner, CreatesEmptyFormat)
+{
+    using Tuner = typename TestFixture::Tuner;
+    using Csr = typename TestFixture::Csr;
+
+    auto csrc = Tuner::create_format(this->exec, "csrc");
+
+    ASSERT_EQ(csrc->get_size(), gko::dim<2>{});
+    ASSERT_EQ(csrc->get_executor(), this->exec);
+    ASSERT_EQ(gko::as<Csr>(csrc.get())->get_strategy()->get_name(),
+              "classical");
+}
+
+
+TYPED_TEST(SpmvAutotuner, ThrowsOnUnknownFormat)
+{
+    using Tuner = typename TestFixture::Tuner;
+
+    ASSERT_THROW(Tuner::convert(this->mtx, "csr_unknown"),
+                 gko::InvalidStateError);
+    ASSERT_THROW(Tuner::create_format(this->exec, "csr_unknown"),
+                 gko::InvalidStateError);
+    ASSERT_THROW(Tuner({}, {"coo", "csr_unknown"}), gko::InvalidStateError);
+    ASSERT_THROW(Tuner({}, {}), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(SpmvAutotuner, KeyContainsFingerprint)
+{
+    using Tuner = typename TestFixture::Tuner;
+
+    auto key = Tuner::get_key(this->mtx);
+
+    // 5x5 matrix with 9 nonzeros, four rows of length 1 and one of length 5
+    ASSERT_NE(key.find("gko::ReferenceExecutor;"), std::string::npos);
+    ASSERT_NE(key.find(";5x5;9;0,4,0,1"), std::string::npos);
+}
+
+
+TYPED_TEST(SpmvAutotuner, SelectsCandidate)
+{
+    using Tuner = typename TestFixture::Tuner;
+    Tuner tuner{{}, {"coo", "csrc"}};
+
+    auto format = tuner.select(this->mtx);
+
+    ASSERT_TRUE(format == "coo" || format == "csrc");
+    ASSERT_EQ(tuner.get_cache().size(), 1);
+    ASSERT_EQ(tuner.get_cache().at(Tuner::get_key(this->mtx)), format);
+}
+
+
+TYPED_TEST(SpmvAutotuner, SkipsImbalancedEll)
+{
+    using Tuner = typename TestFixture::Tuner;
+    // the longest row has 5 entries, the average row length is 1.8
+    Tuner tuner{{}, {"ell", "coo"}, 1, 2.0};
+
+    ASSERT_EQ(tuner.select(this->mtx), "coo");
+}
+
+
+TYPED_TEST(SpmvAutotuner, GeneratesSelectedFormat)
+{
+    using Tuner = typename TestFixture::Tuner;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    Tuner tuner{{}, {"sellp"}};
+    auto expected = Vec::create(this->exec, gko::dim<2>{5, 1});
+    auto x = expected->clone();
+    this->mtx->apply(this->b, expected);
+
+    auto op = tuner.generate(this->mtx);
+    op->apply(this->b, x);
+
+    ASSERT_NO_THROW(
+        (gko::as<gko::matrix::Sellp<value_type, index_type>>(op.get())));
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+TYPED_TEST(SpmvAutotuner, PersistsDecisions)
+{
+    using Tuner = typename TestFixture::Tuner;
+    std::string format;
+    {
+        Tuner tuner{this->path, {"coo", "ell"}};
+        format = tuner.select(this->mtx);
+    }
+
+    Tuner tuner{this->path, {"csrc"}};
+
+    // the cached decision is used, even though it is no candidate anymore
+    ASSERT_EQ(tuner.get_cache().size(), 1);
+    ASSERT_EQ(tuner.select(this->mtx), format);
+}
+
+
+TYPED_TEST(SpmvAutotuner, ReadsCacheFile)
+{
+    using Tuner = typename TestFixture::Tuner;
+    {
+        std::ofstream cache{this->path};
+        cache << Tuner::get_key(this->mtx) << "\thybrid80\n"
+              << "other key\tcoo\n";
+    }
+    Tuner tuner{this->path, {"csrc"}};
+
+    ASSERT_EQ(tuner.select(this->mtx), "hybrid80");
+}
+
+
+TYPED_TEST(SpmvAutotuner, MergesCacheFile)
+{
+    using Tuner = typename TestFixture::Tuner;
+    Tuner tuner{this->path, {"coo"}};
+    {
+        std::ofstream cache{this->path};
+        cache << "other key\tcsrs\n";
+    }
+
+    tuner.select(this->mtx);
+
+    auto cache = Tuner{this->path}.get_cache();
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_EQ(cache.at("other key"), "csrs");
+    ASSERT_EQ(cache.at(Tuner::get_key(this->mtx)), "coo");
+}
+
+
+}  // namespace
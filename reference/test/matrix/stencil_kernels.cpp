@@ -0,0 +1,354 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/preconditioner/jacobi.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/stencil_kernels.hpp"
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Stencil : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using stencil_type = gko::matrix::stencil_type;
+
+    Stencil()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(Mtx::create_laplacian(exec, {3, 2, 1},
+                                    stencil_type::five_point)),
+          rand_engine(42)
+    {}
+
+    /**
+     * Assembles the matrix of the given stencil on the given grid, where
+     * coefs[p * num_rows + row] is the coefficient of the p-th stencil point
+     * in the given row.
+     */
+    std::unique_ptr<Csr> assemble(gko::dim<3> grid, stencil_type type,
+                                  const std::vector<value_type>& coefs)
+    {
+        const auto restricted = type == stencil_type::five_point ||
+                                type == stencil_type::seven_point;
+        const auto is_3d = type == stencil_type::seven_point ||
+                           type == stencil_type::twenty_seven_point;
+        const int nx = grid[0];
+        const int ny = grid[1];
+        const int nz = grid[2];
+        const int num_rows = nx * ny * nz;
+        gko::matrix_data<value_type, index_type> data{
+            gko::dim<2>(num_rows, num_rows)};
+        for (int iz = 0; iz < nz; ++iz) {
+            for (int iy = 0; iy < ny; ++iy) {
+                for (int ix = 0; ix < nx; ++ix) {
+                    const auto row = ix + nx * (iy + ny * iz);
+                    int p = 0;
+                    for (int dz = is_3d ? -1 : 0; dz <= (is_3d ? 1 : 0);
+                         ++dz) {
+                        for (int dy = -1; dy <= 1; ++dy) {
+                            for (int dx = -1; dx <= 1; ++dx) {
+                                if (restricted &&
+                                    (dz == 0) + (dy == 0) + (dx == 0) < 2) {
+                                    continue;
+                                }
+                                const auto jx = ix + dx;
+                                const auto jy = iy + dy;
+                                const auto jz = iz + dz;
+                                if (jx >= 0 && jx < nx && jy >= 0 && jy < ny &&
+                                    jz >= 0 && jz < nz) {
+                                    data.nonzeros.emplace_back(
+                                        row, jx + nx * (jy + ny * jz),
+                                        coefs[p * num_rows + row]);
+                                }
+                                p++;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        auto result = Csr::create(exec);
+        result->read(data);
+        return result;
+    }
+
+    std::unique_ptr<Csr> assemble_constant(gko::dim<3> grid,
+                                           stencil_type type,
+                                           const Mtx* stencil)
+    {
+        const auto num_rows = stencil->get_size()[0];
+        std::vector<value_type> coefs;
+        for (gko::size_type p = 0; p < stencil->get_num_points(); ++p) {
+            coefs.insert(coefs.end(), num_rows,
+                         stencil->get_const_coefficients()[p]);
+        }
+        return assemble(grid, type, coefs);
+    }
+
+    std::unique_ptr<Mtx> gen_variable(gko::dim<3> grid, stencil_type type)
+    {
+        const auto num_points =
+            Mtx::create_laplacian(exec, grid, type)->get_num_points();
+        const auto size = num_points * grid[0] * grid[1] * grid[2];
+        auto coefs = gko::test::generate_random_array<value_type>(
+            size,
+            std::uniform_real_distribution<gko::remove_complex<value_type>>(
+                -1.0, 1.0),
+            rand_engine, exec);
+        return Mtx::create(exec, grid, type, std::move(coefs));
+    }
+
+    std::unique_ptr<Vec> gen_vec(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<gko::remove_complex<value_type>>(),
+            rand_engine, exec);
+    }
+
+    template <typename TestFunction>
+    void for_each_stencil(TestFunction fn)
+    {
+        fn(gko::dim<3>{7, 5, 1}, stencil_type::five_point);
+        fn(gko::dim<3>{7, 5, 1}, stencil_type::nine_point);
+        fn(gko::dim<3>{5, 4, 3}, stencil_type::seven_point);
+        fn(gko::dim<3>{5, 4, 3}, stencil_type::twenty_seven_point);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Mtx> mtx;
+    std::default_random_engine rand_engine;
+};
+
+TYPED_TEST_SUITE(Stencil, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Stencil, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{6, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-2.0, -1.0, 4.0, 10.0, 8.0, 16.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 1.0, 1.0, 1.0, 1.0, 1.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({4.0, 3.0, -2.0, -8.0, -6.0, -14.0}), 0.0);
+}
+
+
+TYPED_TEST(Stencil, ConvertsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_NEAR(result,
+                        l({{4.0, -1.0, 0.0, -1.0, 0.0, 0.0},
+                           {-1.0, 4.0, -1.0, 0.0, -1.0, 0.0},
+                           {0.0, -1.0, 4.0, 0.0, 0.0, -1.0},
+                           {-1.0, 0.0, 0.0, 4.0, -1.0, 0.0},
+                           {0.0, -1.0, 0.0, -1.0, 4.0, -1.0},
+                           {0.0, 0.0, -1.0, 0.0, -1.0, 4.0}}),
+                        0.0);
+    ASSERT_EQ(result->get_num_stored_elements(), 20);
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(Stencil, ConvertsLaplacianToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    this->for_each_stencil([this](gko::dim<3> grid, auto type) {
+        auto mtx = Mtx::create_laplacian(this->exec, grid, type);
+        auto expected = this->assemble_constant(grid, type, mtx.get());
+        auto result = Csr::create(this->exec);
+
+        mtx->convert_to(result);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(result, expected);
+        GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+    });
+}
+
+
+TYPED_TEST(Stencil, ConvertsVariableCoefficientsToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    this->for_each_stencil([this](gko::dim<3> grid, auto type) {
+        auto mtx = this->gen_variable(grid, type);
+        auto expected = this->assemble(
+            grid, type,
+            {mtx->get_const_coefficients(),
+             mtx->get_const_coefficients() + mtx->get_num_stored_elements()});
+        auto result = Csr::create(this->exec);
+
+        mtx->convert_to(result);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(result, expected);
+        GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+    });
+}
+
+
+TYPED_TEST(Stencil, IsEquivalentToCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    this->for_each_stencil([this](gko::dim<3> grid, auto type) {
+        for (bool variable : {false, true}) {
+            SCOPED_TRACE(variable);
+            auto mtx = variable ? this->gen_variable(grid, type)
+                                : Mtx::create_laplacian(this->exec, grid, type);
+            auto csr = Csr::create(this->exec);
+            mtx->convert_to(csr);
+            const auto num_rows = mtx->get_size()[0];
+            auto x = this->gen_vec(num_rows, 3);
+            auto alpha = this->gen_vec(1, 1);
+            auto beta = this->gen_vec(1, 1);
+            auto y = this->gen_vec(num_rows, 3);
+            auto expected_y = y->clone();
+            auto advanced_y = y->clone();
+            auto expected_advanced_y = y->clone();
+
+            mtx->apply(x, y);
+            mtx->apply(alpha, x, beta, advanced_y);
+            csr->apply(x, expected_y);
+            csr->apply(alpha, x, beta, expected_advanced_y);
+
+            GKO_ASSERT_MTX_NEAR(y, expected_y, r<value_type>::value);
+            GKO_ASSERT_MTX_NEAR(advanced_y, expected_advanced_y,
+                                r<value_type>::value);
+        }
+    });
+}
+
+
+TYPED_TEST(Stencil, WritesMatrixData)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(6, 6));
+    ASSERT_EQ(data.nonzeros.size(), 20);
+    EXPECT_EQ(data.nonzeros[0],
+              (gko::matrix_data_entry<value_type, index_type>{0, 0, 4.0}));
+    EXPECT_EQ(data.nonzeros[2],
+              (gko::matrix_data_entry<value_type, index_type>{0, 3, -1.0}));
+}
+
+
+TYPED_TEST(Stencil, ExtractsDiagonal)
+{
+    auto diag = this->mtx->extract_diagonal();
+
+    ASSERT_EQ(diag->get_size(), gko::dim<2>(6, 6));
+    for (int row = 0; row < 6; ++row) {
+        EXPECT_EQ(diag->get_const_values()[row],
+                  typename TestFixture::value_type{4.0});
+    }
+}
+
+
+TYPED_TEST(Stencil, ExtractsVariableDiagonal)
+{
+    using stencil_type = typename TestFixture::stencil_type;
+    const gko::dim<3> grid{5, 4, 3};
+    auto mtx = this->gen_variable(grid, stencil_type::twenty_seven_point);
+    auto expected = this->assemble(
+        grid, stencil_type::twenty_seven_point,
+        {mtx->get_const_coefficients(),
+         mtx->get_const_coefficients() + mtx->get_num_stored_elements()});
+
+    auto diag = mtx->extract_diagonal();
+
+    GKO_ASSERT_MTX_NEAR(diag, expected->extract_diagonal(), 0.0);
+}
+
+
+TYPED_TEST(Stencil, SolvesWithJacobiPreconditionedCg)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using Jacobi = gko::preconditioner::Jacobi<value_type, index_type>;
+    const gko::dim<3> grid{6, 5, 4};
+    auto mtx = gko::share(Mtx::create_laplacian(
+        this->exec, grid, gko::matrix::stencil_type::twenty_seven_point));
+    const auto num_rows = mtx->get_size()[0];
+    auto x_expected = this->gen_vec(num_rows, 1);
+    auto b = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+    mtx->apply(x_expected, b);
+    for (gko::uint32 max_block_size : {1u, 4u}) {
+        SCOPED_TRACE(max_block_size);
+        auto x = Vec::create(this->exec, gko::dim<2>{num_rows, 1});
+        x->fill(gko::zero<value_type>());
+        auto solver =
+            gko::solver::Cg<value_type>::build()
+                .with_preconditioner(
+                    Jacobi::build().with_max_block_size(max_block_size))
+                .with_criteria(
+                    gko::stop::Iteration::build().with_max_iters(200u),
+                    gko::stop::ResidualNorm<value_type>::build()
+                        .with_reduction_factor(r<value_type>::value))
+                .on(this->exec)
+                ->generate(mtx);
+
+        solver->apply(b, x);
+
+        GKO_ASSERT_MTX_NEAR(x, x_expected, r<value_type>::value * 100);
+    }
+}
+
+
+}  // namespace
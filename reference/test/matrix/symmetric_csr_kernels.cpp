@@ -0,0 +1,305 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/cholesky.hpp>
+#include <ginkgo/core/factorization/ic.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/matrix/symmetric_csr_kernels.hpp"
+#include "core/test/utils.hpp"
+#include "core/utils/matrix_utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class SymmetricCsr : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr()
+        : exec(gko::ReferenceExecutor::create()),
+          csr(gko::initialize<Csr>(
+              {{4.0, 1.0, 2.0}, {1.0, 5.0, 0.0}, {2.0, 0.0, 6.0}}, exec)),
+          mtx(Mtx::create(exec, csr.get())),
+          rand_engine(42)
+    {}
+
+    std::unique_ptr<Csr> gen_hpd_csr(gko::size_type size)
+    {
+        auto data = gko::test::generate_random_matrix_data<value_type,
+                                                           index_type>(
+            size, size, std::uniform_int_distribution<>(2, 6),
+            std::uniform_real_distribution<gko::remove_complex<value_type>>(
+                0.5, 1.0),
+            rand_engine);
+        gko::utils::make_hpd(data, 1.5);
+        auto result = Csr::create(exec);
+        result->read(data);
+        return result;
+    }
+
+    std::unique_ptr<Vec> gen_vec(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<gko::remove_complex<value_type>>(),
+            rand_engine, exec);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::default_random_engine rand_engine;
+};
+
+TYPED_TEST_SUITE(SymmetricCsr, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 1});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({12.0, 11.0, 20.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesToDenseMatrix)
+{
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto x = gko::initialize<Vec>(
+        {I<T>{1.0, -1.0}, I<T>{2.0, 0.5}, I<T>{3.0, 2.0}}, this->exec);
+    auto y = Vec::create(this->exec, gko::dim<2>{3, 2});
+
+    this->mtx->apply(x, y);
+
+    GKO_ASSERT_MTX_NEAR(
+        y, l<T>({{12.0, 0.5}, {11.0, 1.5}, {20.0, 10.0}}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, AppliesLinearCombinationToDenseVector)
+{
+    using Vec = typename TestFixture::Vec;
+    auto alpha = gko::initialize<Vec>({-1.0}, this->exec);
+    auto beta = gko::initialize<Vec>({2.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+    auto y = gko::initialize<Vec>({1.0, 2.0, 3.0}, this->exec);
+
+    this->mtx->apply(alpha, x, beta, y);
+
+    GKO_ASSERT_MTX_NEAR(y, l({-10.0, -7.0, -14.0}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, IgnoresLowerTriangleOfInput)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    using T = typename TestFixture::value_type;
+    auto csr =
+        gko::initialize<Csr>({I<T>{1.0, 2.0}, I<T>{3.0, 4.0}}, this->exec);
+
+    auto mtx = Mtx::create(this->exec, csr.get());
+
+    ASSERT_EQ(mtx->get_num_stored_elements(), 3);
+    GKO_ASSERT_MTX_NEAR(mtx, l({{1.0, 2.0}, {2.0, 4.0}}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsToFullCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    auto result = Csr::create(this->exec);
+
+    this->mtx->convert_to(result);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, this->csr);
+    GKO_ASSERT_MTX_NEAR(result, this->csr, 0.0);
+    ASSERT_TRUE(result->is_sorted_by_column_index());
+}
+
+
+TYPED_TEST(SymmetricCsr, ConvertsHermitianMatrixToFullCsr)
+{
+    using Csr = typename TestFixture::Csr;
+    using Mtx = typename TestFixture::Mtx;
+    auto csr = this->gen_hpd_csr(50);
+    auto mtx = Mtx::create(this->exec, csr.get());
+    auto result = Csr::create(this->exec);
+
+    mtx->convert_to(result);
+
+    ASSERT_LT(mtx->get_num_stored_elements(), csr->get_num_stored_elements());
+    GKO_ASSERT_MTX_EQ_SPARSITY(result, csr);
+    GKO_ASSERT_MTX_NEAR(result, csr, 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, IsEquivalentToCsrForHermitianMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto csr = this->gen_hpd_csr(50);
+    auto mtx = Mtx::create(this->exec, csr.get());
+    auto x = this->gen_vec(50, 3);
+    auto alpha = this->gen_vec(1, 1);
+    auto beta = this->gen_vec(1, 1);
+    auto y = this->gen_vec(50, 3);
+    auto expected_y = y->clone();
+    auto advanced_y = y->clone();
+    auto expected_advanced_y = y->clone();
+
+    mtx->apply(x, y);
+    mtx->apply(alpha, x, beta, advanced_y);
+    csr->apply(x, expected_y);
+    csr->apply(alpha, x, beta, expected_advanced_y);
+
+    GKO_ASSERT_MTX_NEAR(y, expected_y, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(advanced_y, expected_advanced_y, r<value_type>::value);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeReadFromMatrixData)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = Mtx::create(this->exec);
+
+    mtx->read(gko::matrix_data<value_type, index_type>{
+        {2, 2}, {{0, 0, 1.0}, {0, 1, 2.0}, {1, 0, 2.0}, {1, 1, 3.0}}});
+
+    ASSERT_EQ(mtx->get_num_stored_elements(), 3);
+    GKO_ASSERT_MTX_NEAR(mtx, l({{1.0, 2.0}, {2.0, 3.0}}), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, WritesBothTriangles)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    gko::matrix_data<value_type, index_type> data;
+
+    this->mtx->write(data);
+
+    ASSERT_EQ(data.size, gko::dim<2>(3, 3));
+    ASSERT_EQ(data.nonzeros.size(), 7);
+    EXPECT_EQ(data.nonzeros[2], (gko::matrix_data_entry<value_type, index_type>{
+                                    0, 2, 2.0}));
+    EXPECT_EQ(data.nonzeros[3], (gko::matrix_data_entry<value_type, index_type>{
+                                    1, 0, 1.0}));
+    EXPECT_EQ(data.nonzeros[5], (gko::matrix_data_entry<value_type, index_type>{
+                                    2, 0, 2.0}));
+}
+
+
+TYPED_TEST(SymmetricCsr, ExtractsDiagonal)
+{
+    auto diag = this->mtx->extract_diagonal();
+
+    GKO_ASSERT_MTX_NEAR(diag, l({{4.0, 0.0, 0.0},
+                                 {0.0, 5.0, 0.0},
+                                 {0.0, 0.0, 6.0}}),
+                        0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, SolvesWithCg)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto csr = this->gen_hpd_csr(50);
+    auto mtx = gko::share(Mtx::create(this->exec, csr.get()));
+    auto x_expected = this->gen_vec(50, 1);
+    auto b = Vec::create(this->exec, gko::dim<2>{50, 1});
+    csr->apply(x_expected, b);
+    auto x = Vec::create(this->exec, gko::dim<2>{50, 1});
+    x->fill(gko::zero<value_type>());
+    auto solver =
+        gko::solver::Cg<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(200u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(mtx);
+
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, x_expected, r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeUsedWithCholesky)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using factorization_type =
+        gko::experimental::factorization::Cholesky<value_type, index_type>;
+    auto csr = gko::share(this->gen_hpd_csr(50));
+    auto mtx = gko::share(Mtx::create(this->exec, csr.get()));
+    auto factory = factorization_type::build().on(this->exec);
+
+    auto fact = factory->generate(mtx);
+    auto expected = factory->generate(csr);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(fact->get_combined(),
+                               expected->get_combined());
+    GKO_ASSERT_MTX_NEAR(fact->get_combined(), expected->get_combined(), 0.0);
+}
+
+
+TYPED_TEST(SymmetricCsr, CanBeUsedWithIc)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using factorization_type = gko::factorization::Ic<value_type, index_type>;
+    auto csr = gko::share(this->gen_hpd_csr(50));
+    auto mtx = gko::share(Mtx::create(this->exec, csr.get()));
+    auto factory = factorization_type::build().on(this->exec);
+
+    auto fact = factory->generate(mtx);
+    auto expected = factory->generate(csr);
+
+    GKO_ASSERT_MTX_NEAR(fact->get_l_factor(), expected->get_l_factor(), 0.0);
+}
+
+
+}  // namespace
@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_ilu.hpp>
+
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/ilu.hpp>
+#include <ginkgo/core/log/batch_logger.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/solver/batch_bicgstab.hpp>
+
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+template <typename T>
+class BatchIlu : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Csr<value_type>;
+    using UnbatchMtx = gko::matrix::Csr<value_type>;
+    using Dense = gko::matrix::Dense<value_type>;
+    using BIlu = gko::batch::preconditioner::Ilu<value_type>;
+    using Solver = gko::batch::solver::Bicgstab<value_type>;
+
+    BatchIlu() : exec(gko::ReferenceExecutor::create()), mtx(get_matrix()) {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    const gko::size_type nbatch = 2;
+    const int nrows = 5;
+    std::shared_ptr<const Mtx> mtx;
+
+    // a pattern for which ILU(0) drops fill-in, so the factors differ from
+    // the exact LU factors
+    std::unique_ptr<Mtx> get_matrix()
+    {
+        std::vector<gko::matrix_data<value_type, int>> data(
+            nbatch, gko::matrix_data<value_type, int>{gko::dim<2>(nrows)});
+        // (row, col, value, whether the value differs between the items)
+        const std::vector<std::tuple<int, int, double, bool>> entries{
+            {0, 0, 4.0, true},  {0, 1, -1.0, false}, {0, 3, 2.0, false},
+            {1, 0, 1.0, false}, {1, 1, 5.0, true},   {1, 2, -2.0, false},
+            {2, 1, -1.0, false}, {2, 2, 6.0, false}, {2, 4, 1.0, false},
+            {3, 0, 2.0, true},  {3, 3, 4.0, false},  {3, 4, -1.0, false},
+            {4, 2, 3.0, false}, {4, 3, -1.0, false}, {4, 4, 5.0, false}};
+        for (gko::size_type b = 0; b < nbatch; b++) {
+            for (const auto& entry : entries) {
+                const auto scale = std::get<3>(entry) ? b + 1.0 : 1.0;
+                data[b].nonzeros.emplace_back(std::get<0>(entry),
+                                              std::get<1>(entry),
+                                              std::get<2>(entry) * scale);
+            }
+        }
+        return gko::batch::read<value_type, int, Mtx>(
+            exec, data, data[0].nonzeros.size());
+    }
+};
+
+TYPED_TEST_SUITE(BatchIlu, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchIlu, GenerationIsEquivalentToUnbatched)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using UnbatchMtx = typename TestFixture::UnbatchMtx;
+    using Dense = typename TestFixture::Dense;
+    using BIlu = typename TestFixture::BIlu;
+    auto umtxs = gko::test::share(gko::batch::unbatch<Mtx>(this->mtx.get()));
+
+    auto prec = BIlu::build().on(this->exec)->generate(this->mtx);
+
+    auto factors = prec->get_const_factorized_matrix();
+    const auto row_ptrs = factors->get_const_row_ptrs();
+    const auto col_idxs = factors->get_const_col_idxs();
+    for (gko::size_type b = 0; b < umtxs.size(); b++) {
+        auto unbatch_fact = gko::factorization::Ilu<value_type, int>::build()
+                                .on(this->exec)
+                                ->generate(umtxs[b]);
+        auto l_factor = Dense::create(this->exec);
+        auto u_factor = Dense::create(this->exec);
+        gko::as<UnbatchMtx>(unbatch_fact->get_l_factor())->convert_to(l_factor);
+        gko::as<UnbatchMtx>(unbatch_fact->get_u_factor())->convert_to(u_factor);
+        const auto values = factors->get_const_values_for_item(b);
+        for (int row = 0; row < this->nrows; row++) {
+            for (auto i = row_ptrs[row]; i < row_ptrs[row + 1]; i++) {
+                const auto col = col_idxs[i];
+                const auto expected = col < row ? l_factor->at(row, col)
+                                                : u_factor->at(row, col);
+                GKO_EXPECT_NEAR(values[i], expected, r<value_type>::value);
+            }
+        }
+    }
+}
+
+
+TYPED_TEST(BatchIlu, ExactFactorizationSolvesInOneIteration)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using BIlu = typename TestFixture::BIlu;
+    using Solver = typename TestFixture::Solver;
+    // a tridiagonal matrix has no fill-in, so ILU(0) is the exact LU
+    // factorization and the preconditioned solver converges immediately
+    auto mtx =
+        gko::share(gko::test::generate_3pt_stencil_batch_matrix<const Mtx>(
+            this->exec, this->nbatch, this->nrows, 3 * this->nrows - 2));
+    auto linear_system = gko::test::generate_batch_linear_system(mtx, 1);
+    auto solver = gko::share(
+        Solver::build()
+            .with_preconditioner(BIlu::build())
+            .with_max_iterations(10)
+            .with_tolerance(r<value_type>::value)
+            .with_tolerance_type(gko::batch::stop::tolerance_type::relative)
+            .on(this->exec)
+            ->generate(mtx));
+    auto logger =
+        gko::share(gko::batch::log::BatchConvergence<value_type>::create());
+    solver->add_logger(logger);
+
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, solver);
+
+    for (gko::size_type b = 0; b < this->nbatch; b++) {
+        ASSERT_LE(logger->get_num_iterations().get_const_data()[b], 1);
+    }
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol,
+                              r<value_type>::value * 10);
+}
+
+
+TYPED_TEST(BatchIlu, ThrowsOnMissingDiagonal)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using BIlu = typename TestFixture::BIlu;
+    std::vector<gko::matrix_data<value_type, int>> data(
+        this->nbatch, gko::matrix_data<value_type, int>{
+                          gko::dim<2>(2), {{0, 0, 1.0}, {1, 0, 1.0}}});
+    auto mtx = gko::share(
+        gko::batch::read<value_type, int, Mtx>(this->exec, data, 2));
+
+    ASSERT_THROW(BIlu::build().on(this->exec)->generate(mtx),
+                 gko::InvalidStateError);
+}
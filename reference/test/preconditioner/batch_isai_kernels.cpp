@@ -0,0 +1,210 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/preconditioner/batch_isai.hpp>
+
+
+#include <memory>
+#include <tuple>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/batch_multi_vector.hpp>
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/log/batch_logger.hpp>
+#include <ginkgo/core/matrix/batch_csr.hpp>
+#include <ginkgo/core/matrix/batch_dense.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/preconditioner/isai.hpp>
+#include <ginkgo/core/solver/batch_bicgstab.hpp>
+
+
+#include "core/base/batch_utilities.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/batch_helpers.hpp"
+
+
+template <typename T>
+class BatchIsai : public ::testing::Test {
+protected:
+    using value_type = T;
+    using real_type = gko::remove_complex<value_type>;
+    using Mtx = gko::batch::matrix::Csr<value_type>;
+    using UnbatchMtx = gko::matrix::Csr<value_type>;
+    using BIsai = gko::batch::preconditioner::Isai<value_type>;
+    using Solver = gko::batch::solver::Bicgstab<value_type>;
+
+    BatchIsai()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(get_matrix(false)),
+          lower_mtx(get_matrix(true))
+    {}
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    const gko::size_type nbatch = 2;
+    const int nrows = 5;
+    std::shared_ptr<const Mtx> mtx;
+    std::shared_ptr<const Mtx> lower_mtx;
+
+    std::unique_ptr<Mtx> get_matrix(bool lower)
+    {
+        std::vector<gko::matrix_data<value_type, int>> data(
+            nbatch, gko::matrix_data<value_type, int>{gko::dim<2>(nrows)});
+        // (row, col, value, whether the value differs between the items)
+        const std::vector<std::tuple<int, int, double, bool>> entries{
+            {0, 0, 4.0, true},  {0, 1, -1.0, false}, {0, 3, 2.0, false},
+            {1, 0, 1.0, false}, {1, 1, 5.0, true},   {1, 2, -2.0, false},
+            {2, 1, -1.0, false}, {2, 2, 6.0, false}, {2, 4, 1.0, false},
+            {3, 0, 2.0, true},  {3, 3, 4.0, false},  {3, 4, -1.0, false},
+            {4, 2, 3.0, false}, {4, 3, -1.0, false}, {4, 4, 5.0, false}};
+        for (gko::size_type b = 0; b < nbatch; b++) {
+            for (const auto& entry : entries) {
+                if (lower && std::get<1>(entry) > std::get<0>(entry)) {
+                    continue;
+                }
+                const auto scale = std::get<3>(entry) ? b + 1.0 : 1.0;
+                data[b].nonzeros.emplace_back(std::get<0>(entry),
+                                              std::get<1>(entry),
+                                              std::get<2>(entry) * scale);
+            }
+        }
+        return gko::batch::read<value_type, int, Mtx>(
+            exec, data, data[0].nonzeros.size());
+    }
+
+    template <typename UnbatchPrec>
+    void assert_equivalent_to_unbatched(std::shared_ptr<const Mtx> mtx,
+                                        const BIsai* prec)
+    {
+        auto umtxs = gko::test::share(gko::batch::unbatch<Mtx>(mtx.get()));
+        auto approx_inv = prec->get_const_approximate_inverse();
+        for (gko::size_type b = 0; b < umtxs.size(); b++) {
+            auto unbatch_prec =
+                UnbatchPrec::build().on(exec)->generate(umtxs[b]);
+            auto approx_inv_item = approx_inv->create_const_view_for_item(b);
+
+            GKO_ASSERT_MTX_EQ_SPARSITY(approx_inv_item,
+                                       unbatch_prec->get_approximate_inverse());
+            GKO_ASSERT_MTX_NEAR(approx_inv_item,
+                                unbatch_prec->get_approximate_inverse(),
+                                r<value_type>::value);
+        }
+    }
+};
+
+TYPED_TEST_SUITE(BatchIsai, gko::test::ValueTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(BatchIsai, GeneralIsaiIsEquivalentToUnbatched)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIsai = typename TestFixture::BIsai;
+
+    auto prec = BIsai::build().on(this->exec)->generate(this->mtx);
+
+    this->template assert_equivalent_to_unbatched<
+        gko::preconditioner::GeneralIsai<value_type, int>>(this->mtx,
+                                                           prec.get());
+}
+
+
+TYPED_TEST(BatchIsai, LowerIsaiIsEquivalentToUnbatched)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIsai = typename TestFixture::BIsai;
+
+    auto prec =
+        BIsai::build()
+            .with_isai_input_matrix_type(
+                gko::batch::preconditioner::batch_isai_input_matrix_type::lower)
+            .on(this->exec)
+            ->generate(this->lower_mtx);
+
+    this->template assert_equivalent_to_unbatched<
+        gko::preconditioner::LowerIsai<value_type, int>>(this->lower_mtx,
+                                                         prec.get());
+}
+
+
+TYPED_TEST(BatchIsai, LowerIsaiUsesLowerTriangularPattern)
+{
+    using BIsai = typename TestFixture::BIsai;
+
+    auto prec =
+        BIsai::build()
+            .with_isai_input_matrix_type(
+                gko::batch::preconditioner::batch_isai_input_matrix_type::lower)
+            .on(this->exec)
+            ->generate(this->mtx);
+
+    auto approx_inv = prec->get_const_approximate_inverse();
+    const auto row_ptrs = approx_inv->get_const_row_ptrs();
+    const auto col_idxs = approx_inv->get_const_col_idxs();
+    ASSERT_EQ(approx_inv->get_num_elements_per_item(), 10);
+    for (int row = 0; row < this->nrows; row++) {
+        for (auto i = row_ptrs[row]; i < row_ptrs[row + 1]; i++) {
+            ASSERT_LE(col_idxs[i], row);
+        }
+    }
+}
+
+
+TYPED_TEST(BatchIsai, HigherSparsityPowerSolvesSystem)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIsai = typename TestFixture::BIsai;
+    using Solver = typename TestFixture::Solver;
+    using Mtx = typename TestFixture::Mtx;
+    const int nrows = 20;
+    gko::matrix_data<value_type, int> tridiag{gko::dim<2>(nrows)};
+    for (int row = 0; row < nrows; row++) {
+        if (row > 0) {
+            tridiag.nonzeros.emplace_back(row, row - 1, value_type{-1.0});
+        }
+        tridiag.nonzeros.emplace_back(row, row, value_type{6.0});
+        if (row < nrows - 1) {
+            tridiag.nonzeros.emplace_back(row, row + 1, value_type{-1.0});
+        }
+    }
+    auto mtx = gko::share(gko::batch::read<value_type, int, const Mtx>(
+        this->exec,
+        std::vector<gko::matrix_data<value_type, int>>(this->nbatch, tridiag),
+        tridiag.nonzeros.size()));
+    auto linear_system = gko::test::generate_batch_linear_system(mtx, 1);
+    auto solver = gko::share(
+        Solver::build()
+            .with_preconditioner(BIsai::build().with_sparsity_power(2))
+            .with_max_iterations(100)
+            .with_tolerance(r<value_type>::value)
+            .with_tolerance_type(gko::batch::stop::tolerance_type::relative)
+            .on(this->exec)
+            ->generate(mtx));
+
+    auto res =
+        gko::test::solve_linear_system(this->exec, linear_system, solver);
+
+    auto prec = gko::as<BIsai>(solver->get_preconditioner());
+    // the square of a tridiagonal matrix is pentadiagonal
+    ASSERT_EQ(prec->get_const_approximate_inverse()
+                  ->get_num_elements_per_item(),
+              5 * nrows - 6);
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol,
+                              r<value_type>::value * 100);
+}
+
+
+TYPED_TEST(BatchIsai, ThrowsOnNonCsrMatrix)
+{
+    using value_type = typename TestFixture::value_type;
+    using BIsai = typename TestFixture::BIsai;
+    auto dense_mtx = gko::share(gko::batch::matrix::Dense<value_type>::create(
+        this->exec, gko::batch_dim<2>(this->nbatch, gko::dim<2>(2))));
+
+    ASSERT_THROW(BIsai::build().on(this->exec)->generate(dense_mtx),
+                 gko::NotSupported);
+}
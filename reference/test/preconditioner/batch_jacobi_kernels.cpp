@@ -186,3 +186,70 @@ TYPED_TEST(BatchJacobi, BatchBlockJacobGenerationIsEquivalentToUnbatched)
         detail::is_equivalent_to_unbatched(i, prec, unbatch_prec);
     }
 }
+
+
+TYPED_TEST(BatchJacobi, UpdateValuesIsEquivalentToUnbatchedGeneration)
+{
+    using value_type = typename TestFixture::value_type;
+    using Mtx = typename TestFixture::Mtx;
+    using Jac = typename TestFixture::Jac;
+    using BJac = typename TestFixture::BJac;
+    auto umtxs = gko::test::share(gko::batch::unbatch<Mtx>(this->mtx.get()));
+    auto old_mtx = gko::share(gko::clone(this->mtx));
+    for (int i = 0; i < old_mtx->get_num_stored_elements(); i++) {
+        old_mtx->get_values()[i] *= value_type{3.0};
+    }
+    auto prec = BJac::build()
+                    .with_max_block_size(this->max_block_size)
+                    .with_block_pointers(this->block_ptrs)
+                    .on(this->exec)
+                    ->generate(old_mtx);
+    auto unbatch_prec_fact = Jac::build()
+                                 .with_max_block_size(this->max_block_size)
+                                 .with_block_pointers(this->block_ptrs)
+                                 .on(this->exec);
+
+    prec->update_values(this->mtx);
+
+    for (size_t i = 0; i < umtxs.size(); i++) {
+        auto unbatch_prec = unbatch_prec_fact->generate(umtxs[i]);
+        detail::is_equivalent_to_unbatched(i, prec, unbatch_prec);
+    }
+}
+
+
+TYPED_TEST(BatchJacobi, UpdateValuesThrowsOnDifferentPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using BJac = typename TestFixture::BJac;
+    auto prec = BJac::build()
+                    .with_max_block_size(this->max_block_size)
+                    .on(this->exec)
+                    ->generate(this->mtx);
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    new_mtx->get_col_idxs()[1] = 2;
+
+    ASSERT_THROW(prec->update_values(new_mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchJacobi, ScalarJacobiUpdateValuesThrowsOnDifferentPattern)
+{
+    using BJac = typename TestFixture::BJac;
+    auto prec = BJac::build().with_max_block_size(1u).on(this->exec)->generate(
+        this->mtx);
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    new_mtx->get_col_idxs()[1] = 2;
+
+    ASSERT_THROW(prec->update_values(new_mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(BatchJacobi, ScalarJacobiUpdateValuesAcceptsSamePattern)
+{
+    using BJac = typename TestFixture::BJac;
+    auto prec = BJac::build().with_max_block_size(1u).on(this->exec)->generate(
+        this->mtx);
+
+    ASSERT_NO_THROW(prec->update_values(gko::clone(this->mtx)));
+}
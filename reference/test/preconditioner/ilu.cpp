@@ -551,6 +551,15 @@ TYPED_TEST(Ilu, SolvesDifferentNumberOfRhs)
 }
 
 
+TYPED_TEST(Ilu, UpdateValuesThrowsWhenGeneratedFromComposition)
+{
+    auto preconditioner =
+        this->ilu_pre_factory->generate(this->l_u_composition);
+
+    ASSERT_THROW(preconditioner->update_values(this->mtx), gko::NotSupported);
+}
+
+
 class DefaultIlu : public ::testing::Test {
 protected:
     using Mtx = gko::matrix::Dense<>;
@@ -620,4 +629,33 @@ TEST_F(DefaultIlu, CanBeUsedAsGeneratedPreconditioner)
 }
 
 
+TEST_F(DefaultIlu, UpdateValuesSolvesNewSystem)
+{
+    auto scaled_mtx = gko::share(gko::clone(this->mtx));
+    scaled_mtx->scale(gko::initialize<Mtx>({2.0}, this->exec));
+    const auto b = gko::initialize<Mtx>({1.0, 3.0, 6.0}, this->exec);
+    auto x = Mtx::create(this->exec, gko::dim<2>{3, 1});
+    x->copy_from(b);
+    auto preconditioner =
+        default_ilu_prec_type::build().on(this->exec)->generate(scaled_mtx);
+
+    preconditioner->update_values(this->mtx);
+    preconditioner->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({-0.125, 0.25, 1.0}), 1e-14);
+}
+
+
+TEST_F(DefaultIlu, UpdateValuesThrowsOnDifferentPattern)
+{
+    auto preconditioner =
+        default_ilu_prec_type::build().on(this->exec)->generate(this->mtx);
+    auto identity = gko::share(gko::initialize<Mtx>(
+        {{1., 0., 0.}, {0., 1., 0.}, {0., 0., 1.}}, this->exec));
+
+    ASSERT_THROW(preconditioner->update_values(identity),
+                 gko::InvalidStateError);
+}
+
+
 }  // namespace
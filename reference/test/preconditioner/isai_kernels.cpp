@@ -1165,6 +1165,80 @@ TYPED_TEST(Isai, ReturnsCorrectInverseUWithU2)
 }
 
 
+TYPED_TEST(Isai, KernelSelectPatternExtensionL)
+{
+    using index_type = typename TestFixture::index_type;
+    using value_type = typename TestFixture::value_type;
+    const auto num_rows = this->l_sparse->get_size()[0];
+    gko::array<index_type> extension{this->exec, num_rows};
+    gko::array<index_type> row_ptrs{this->exec, num_rows + 1};
+
+    gko::kernels::reference::isai::select_pattern_extension(
+        this->exec, this->l_sparse.get(), this->l_sparse_inv.get(),
+        index_type{1}, gko::remove_complex<value_type>{}, true, false,
+        extension.get_data(), row_ptrs.get_data());
+
+    // rows 2 and 3 have residual entries (2, 0) and (3, 1)
+    auto row_sizes = row_ptrs.get_const_data();
+    ASSERT_EQ(row_sizes[0], 1);
+    ASSERT_EQ(row_sizes[1], 2);
+    ASSERT_EQ(row_sizes[2], 3);
+    ASSERT_EQ(row_sizes[3], 3);
+    ASSERT_EQ(extension.get_const_data()[2], 0);
+    ASSERT_EQ(extension.get_const_data()[3], 1);
+}
+
+
+TYPED_TEST(Isai, ReturnsCorrectInverseLWithAdaptivePattern)
+{
+    using value_type = typename TestFixture::value_type;
+    const auto isai = TestFixture::LowerIsai::build()
+                          .with_adaptive_steps(1)
+                          .with_adaptive_fill(1)
+                          .on(this->exec)
+                          ->generate(this->l_sparse);
+
+    auto l_inv = isai->get_approximate_inverse();
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_inv, this->l_sparse_inv2);
+    GKO_ASSERT_MTX_NEAR(l_inv, this->l_sparse_inv2, r<value_type>::value);
+}
+
+
+TYPED_TEST(Isai, ReturnsCorrectInverseLWithTwoAdaptiveSteps)
+{
+    using value_type = typename TestFixture::value_type;
+    const auto isai = TestFixture::LowerIsai::build()
+                          .with_adaptive_steps(2)
+                          .with_adaptive_fill(1)
+                          .on(this->exec)
+                          ->generate(this->l_sparse);
+
+    auto l_inv = isai->get_approximate_inverse();
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(l_inv, this->l_sparse_inv3);
+    GKO_ASSERT_MTX_NEAR(l_inv, this->l_sparse_inv3, r<value_type>::value);
+}
+
+
+TYPED_TEST(Isai, AdaptivePatternIgnoresRowsBelowTolerance)
+{
+    using value_type = typename TestFixture::value_type;
+    // the off-pattern residuals are 0.625 and 1.25 for diagonal entries of 1
+    const auto isai = TestFixture::LowerIsai::build()
+                          .with_adaptive_steps(1)
+                          .with_adaptive_fill(1)
+                          .with_adaptive_tolerance(1.0)
+                          .on(this->exec)
+                          ->generate(this->l_sparse);
+
+    auto l_inv = isai->get_approximate_inverse();
+
+    ASSERT_EQ(l_inv->get_num_stored_elements(), 8);
+    ASSERT_EQ(l_inv->get_const_row_ptrs()[3], 5);
+}
+
+
 TYPED_TEST(Isai, ReturnsCorrectInverseLWithL3)
 {
     using value_type = typename TestFixture::value_type;
@@ -1619,4 +1693,58 @@ TYPED_TEST(Isai, IsExactInverseOnFullSparsitySetLarge)
 }
 
 
+TYPED_TEST(Isai, IsExactInverseWithAdaptivePattern)
+{
+    using Isai = typename TestFixture::GeneralIsai;
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::test::generate_tridiag_matrix<Csr>(
+        12, gko::to_std_array<value_type>(-1, 2, -1), this->exec));
+    auto inv_mtx = gko::test::generate_tridiag_inverse_matrix<Dense>(
+        12, gko::to_std_array<value_type>(-1, 2, -1), this->exec);
+
+    // every step adds one band on each side of the diagonal
+    auto isai = Isai::build()
+                    .with_adaptive_steps(20)
+                    .with_adaptive_fill(2)
+                    .on(this->exec)
+                    ->generate(mtx);
+
+    ASSERT_EQ(isai->get_approximate_inverse()->get_num_stored_elements(),
+              144);
+    GKO_ASSERT_MTX_NEAR(inv_mtx, isai->get_approximate_inverse(),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Isai, SpdIsExactInverseWithAdaptivePattern)
+{
+    using Isai = typename TestFixture::SpdIsai;
+    using Csr = typename TestFixture::Csr;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    auto mtx = gko::share(gko::test::generate_tridiag_matrix<Csr>(
+        12, gko::to_std_array<value_type>(-1, 2, -1), this->exec));
+    auto inv_mtx = gko::test::generate_tridiag_inverse_matrix<Dense>(
+        12, gko::to_std_array<value_type>(-1, 2, -1), this->exec);
+    auto id = gko::matrix::Dense<value_type>::create(this->exec,
+                                                     gko::dim<2>{12, 12});
+    id->fill(gko::zero<value_type>());
+    for (gko::size_type i = 0; i < 12; ++i) {
+        id->at(i, i) = gko::one<value_type>();
+    }
+    auto result = id->clone();
+
+    auto isai = Isai::build()
+                    .with_adaptive_steps(20)
+                    .with_adaptive_fill(1)
+                    .on(this->exec)
+                    ->generate(mtx);
+    isai->apply(id, result);
+
+    GKO_ASSERT_MTX_NEAR(inv_mtx, result, 10 * r<value_type>::value);
+}
+
+
 }  // namespace
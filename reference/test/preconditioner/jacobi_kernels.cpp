@@ -574,6 +574,116 @@ TYPED_TEST(Jacobi, SelectsCorrectBlockPrecisions)
 }
 
 
+TYPED_TEST(Jacobi, UpdateValuesIsEquivalentToGeneration)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto bj = this->bj_factory->generate(this->mtx);
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    new_mtx->get_values()[0] = value_type{8.0};
+    new_mtx->get_values()[12] = value_type{5.0};
+    auto expected = Vec::create(this->exec);
+    auto result = Vec::create(this->exec);
+
+    bj->update_values(new_mtx);
+
+    result->move_from(bj);
+    expected->move_from(this->bj_factory->generate(new_mtx));
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TYPED_TEST(Jacobi, UpdateValuesReselectsBlockPrecisions)
+{
+    using Bj = typename TestFixture::Bj;
+    using Vec = typename TestFixture::Vec;
+    using T = typename TestFixture::value_type;
+    auto factory =
+        Bj::build()
+            .with_max_block_size(17u)
+            .with_block_pointers(this->block_pointers)
+            .with_storage_optimization(gko::precision_reduction::autodetect())
+            .with_accuracy(gko::remove_complex<T>{1.5e-3})
+            .on(this->exec);
+    auto bj = factory->generate(this->mtx);
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    // make the first block well-conditioned
+    new_mtx->get_values()[1] = T{};
+    new_mtx->get_values()[3] = T{};
+    auto expected = Vec::create(this->exec);
+    auto result = Vec::create(this->exec);
+
+    bj->update_values(new_mtx);
+
+    auto regenerated = factory->generate(new_mtx);
+    auto prec =
+        bj->get_parameters().storage_optimization.block_wise.get_const_data();
+    auto expected_prec = regenerated->get_parameters()
+                             .storage_optimization.block_wise.get_const_data();
+    EXPECT_EQ(prec[0], expected_prec[0]);
+    EXPECT_EQ(prec[1], expected_prec[1]);
+    result->move_from(bj);
+    expected->move_from(regenerated);
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TYPED_TEST(Jacobi, ScalarJacobiUpdateValuesIsEquivalentToGeneration)
+{
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto bj = this->scalar_j_factory->generate(this->mtx);
+    auto new_mtx = gko::share(gko::clone(this->mtx));
+    new_mtx->get_values()[0] = value_type{8.0};
+    auto expected = Vec::create(this->exec);
+    auto result = Vec::create(this->exec);
+
+    bj->update_values(new_mtx);
+
+    result->move_from(bj);
+    expected->move_from(this->scalar_j_factory->generate(new_mtx));
+    GKO_ASSERT_MTX_NEAR(result, expected, 0.0);
+}
+
+
+TYPED_TEST(Jacobi, UpdateValuesThrowsOnDifferentPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mdata = typename TestFixture::mdata;
+    auto bj = this->bj_factory->generate(this->mtx);
+    auto new_mtx = gko::share(Mtx::create(this->exec));
+    new_mtx->read(mdata::diag(gko::dim<2>{5}, 1.0));
+
+    ASSERT_THROW(bj->update_values(new_mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(Jacobi, RepeatedUpdateValuesThrowsOnDifferentPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mdata = typename TestFixture::mdata;
+    auto bj = this->bj_factory->generate(this->mtx);
+    auto new_mtx = gko::share(Mtx::create(this->exec));
+    new_mtx->read(mdata::diag(gko::dim<2>{5}, 1.0));
+    // the first update releases the generating matrix
+    bj->update_values(gko::share(gko::clone(this->mtx)));
+
+    ASSERT_THROW(bj->update_values(new_mtx), gko::InvalidStateError);
+}
+
+
+TYPED_TEST(Jacobi, ScalarJacobiUpdateValuesThrowsOnDifferentPattern)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using mdata = typename TestFixture::mdata;
+    auto bj = this->scalar_j_factory->generate(this->mtx);
+    auto new_mtx = gko::share(Mtx::create(this->exec));
+    new_mtx->read(mdata::diag(gko::dim<2>{5}, 1.0));
+
+    ASSERT_THROW(bj->update_values(new_mtx), gko::InvalidStateError);
+}
+
+
 TYPED_TEST(Jacobi, AvoidsPrecisionsThatOverflow)
 {
     using Bj = typename TestFixture::Bj;
@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/gray_code.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+template <typename IndexType>
+class GrayCode : public ::testing::Test {
+protected:
+    using index_type = IndexType;
+    using matrix_type = gko::matrix::Csr<double, index_type>;
+    using reorder_type = gko::experimental::reorder::GrayCode<index_type>;
+
+    GrayCode()
+        : exec(gko::ReferenceExecutor::create()),
+          // row signatures with 4 column blocks: 1001, 0100, 0011, 0010
+          mtx(gko::initialize<matrix_type>({{1., 0., 0., 1.},
+                                            {0., 0., 1., 0.},
+                                            {1., 1., 0., 0.},
+                                            {0., 1., 0., 0.}},
+                                           exec))
+    {}
+
+    gko::array<index_type> get_permutation(
+        std::shared_ptr<const gko::matrix::Permutation<index_type>> perm)
+    {
+        return gko::array<index_type>{
+            exec, perm->get_const_permutation(),
+            perm->get_const_permutation() + perm->get_size()[0]};
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<matrix_type> mtx;
+};
+
+TYPED_TEST_SUITE(GrayCode, gko::test::IndexTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(GrayCode, SortsRowsByGrayCodeRank)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    auto factory = reorder_type::build().with_num_column_blocks(4u).on(
+        this->exec);
+
+    auto perm = factory->generate(this->mtx);
+
+    GKO_ASSERT_ARRAY_EQ(this->get_permutation(std::move(perm)),
+                        I<index_type>({2, 3, 1, 0}));
+}
+
+
+TYPED_TEST(GrayCode, KeepsOrderOfRowsWithEqualSignature)
+{
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    auto factory = reorder_type::build().with_num_column_blocks(2u).on(
+        this->exec);
+
+    auto perm = factory->generate(this->mtx);
+
+    GKO_ASSERT_ARRAY_EQ(this->get_permutation(std::move(perm)),
+                        I<index_type>({2, 3, 0, 1}));
+}
+
+
+TYPED_TEST(GrayCode, WorksOnRectangularMatrix)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = gko::share(gko::initialize<matrix_type>(
+        {{0., 0., 0., 1.}, {1., 0., 0., 0.}, {0., 1., 0., 0.}}, this->exec));
+    auto factory = reorder_type::build().with_num_column_blocks(4u).on(
+        this->exec);
+
+    auto perm = factory->generate(mtx);
+
+    GKO_ASSERT_ARRAY_EQ(this->get_permutation(std::move(perm)),
+                        I<index_type>({1, 2, 0}));
+}
+
+
+TYPED_TEST(GrayCode, ComputesValidPermutationAni4)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    using index_type = typename TestFixture::index_type;
+    std::ifstream stream{gko::matrices::location_ani4_mtx};
+    auto mtx = gko::share(gko::read<matrix_type>(stream, this->exec));
+    auto factory = reorder_type::build().on(this->exec);
+
+    auto perm = factory->generate(mtx);
+
+    const auto num_rows = mtx->get_size()[0];
+    std::vector<index_type> sorted_perm(
+        perm->get_const_permutation(),
+        perm->get_const_permutation() + num_rows);
+    std::sort(sorted_perm.begin(), sorted_perm.end());
+    for (gko::size_type i = 0; i < num_rows; i++) {
+        ASSERT_EQ(sorted_perm[i], static_cast<index_type>(i));
+    }
+}
+
+
+}  // namespace
@@ -0,0 +1,226 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/nested_dissection.hpp>
+
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/permutation.hpp>
+
+
+#include "core/factorization/elimination_forest.hpp"
+#include "core/factorization/symbolic.hpp"
+#include "core/reorder/nested_dissection_kernels.hpp"
+#include "core/test/utils.hpp"
+#include "core/test/utils/assertions.hpp"
+#include "matrices/config.hpp"
+
+
+namespace {
+
+
+template <typename IndexType>
+class NestedDissection : public ::testing::Test {
+protected:
+    using value_type = double;
+    using index_type = IndexType;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type =
+        gko::experimental::reorder::NestedDissection<value_type, index_type>;
+
+    NestedDissection()
+        : ref(gko::ReferenceExecutor::create()),
+          nd_factory(reorder_type::build()
+                         .with_algorithm(
+                             gko::experimental::reorder::nd_algorithm::native)
+                         .on(ref))
+    {}
+
+    // creates the adjacency pattern of a 2D grid
+    void create_grid(index_type size)
+    {
+        row_ptrs.assign(1, 0);
+        col_idxs.clear();
+        for (index_type x = 0; x < size; x++) {
+            for (index_type y = 0; y < size; y++) {
+                for (auto neighbor : {std::make_pair(x - 1, y),
+                                      std::make_pair(x, y - 1),
+                                      std::make_pair(x, y + 1),
+                                      std::make_pair(x + 1, y)}) {
+                    if (neighbor.first >= 0 && neighbor.first < size &&
+                        neighbor.second >= 0 && neighbor.second < size) {
+                        col_idxs.push_back(neighbor.first * size +
+                                           neighbor.second);
+                    }
+                }
+                row_ptrs.push_back(col_idxs.size());
+            }
+        }
+    }
+
+    std::vector<index_type> compute_permutation()
+    {
+        const auto size = static_cast<index_type>(row_ptrs.size() - 1);
+        std::vector<index_type> permutation(size);
+        gko::kernels::reference::nested_dissection::compute_permutation(
+            ref, size, row_ptrs.data(), col_idxs.data(), permutation.data());
+        return permutation;
+    }
+
+    static void assert_is_permutation(std::vector<index_type> permutation)
+    {
+        std::vector<index_type> identity(permutation.size());
+        std::iota(identity.begin(), identity.end(), index_type{});
+        std::sort(permutation.begin(), permutation.end());
+        ASSERT_EQ(permutation, identity);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> ref;
+    std::unique_ptr<reorder_type> nd_factory;
+    std::vector<index_type> row_ptrs;
+    std::vector<index_type> col_idxs;
+};
+
+TYPED_TEST_SUITE(NestedDissection, gko::test::IndexTypes,
+                 TypenameNameGenerator);
+
+
+TYPED_TEST(NestedDissection, WorksOnEmptyGraph)
+{
+    this->row_ptrs.assign(1, 0);
+
+    auto permutation = this->compute_permutation();
+
+    ASSERT_TRUE(permutation.empty());
+}
+
+
+TYPED_TEST(NestedDissection, OrdersMiddleOfPathLast)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type size = 1000;
+    this->row_ptrs.assign(1, 0);
+    for (index_type i = 0; i < size; i++) {
+        if (i > 0) {
+            this->col_idxs.push_back(i - 1);
+        }
+        if (i < size - 1) {
+            this->col_idxs.push_back(i + 1);
+        }
+        this->row_ptrs.push_back(this->col_idxs.size());
+    }
+
+    auto permutation = this->compute_permutation();
+
+    this->assert_is_permutation(permutation);
+    // the top-level separator is a single vertex close to the middle
+    ASSERT_GE(permutation.back(), size * 2 / 5);
+    ASSERT_LE(permutation.back(), size * 3 / 5);
+}
+
+
+TYPED_TEST(NestedDissection, OrdersGridSeparatorLast)
+{
+    using index_type = typename TestFixture::index_type;
+    const index_type size = 40;
+    this->create_grid(size);
+
+    auto permutation = this->compute_permutation();
+
+    this->assert_is_permutation(permutation);
+    // the top-level separator is roughly a line through the grid, so
+    std::vector<bool> in_separator(size * size);
+    std::for_each(permutation.end() - 2 * size, permutation.end(),
+                  [&](index_type vertex) { in_separator[vertex] = true; });
+    std::vector<index_type> component(size * size, -1);
+    index_type num_components = 0;
+    for (index_type start = 0; start < size * size; start++) {
+        if (in_separator[start] || component[start] >= 0) {
+            continue;
+        }
+        std::vector<index_type> stack{start};
+        component[start] = num_components;
+        while (!stack.empty()) {
+            const auto vertex = stack.back();
+            stack.pop_back();
+            for (auto nz = this->row_ptrs[vertex];
+                 nz < this->row_ptrs[vertex + 1]; nz++) {
+                const auto neighbor = this->col_idxs[nz];
+                if (!in_separator[neighbor] && component[neighbor] < 0) {
+                    component[neighbor] = num_components;
+                    stack.push_back(neighbor);
+                }
+            }
+        }
+        num_components++;
+    }
+    ASSERT_GE(num_components, 2);
+}
+
+
+TYPED_TEST(NestedDissection, HandlesDisconnectedGraph)
+{
+    using index_type = typename TestFixture::index_type;
+    // two grids next to each other, followed by isolated vertices
+    this->create_grid(20);
+    const auto offset = static_cast<index_type>(this->row_ptrs.size() - 1);
+    const auto nnz = static_cast<index_type>(this->col_idxs.size());
+    for (index_type row = 0; row < offset; row++) {
+        for (auto nz = this->row_ptrs[row]; nz < this->row_ptrs[row + 1];
+             nz++) {
+            this->col_idxs.push_back(this->col_idxs[nz] + offset);
+        }
+        this->row_ptrs.push_back(this->row_ptrs[row + 1] + nnz);
+    }
+    for (index_type i = 0; i < 50; i++) {
+        this->row_ptrs.push_back(this->col_idxs.size());
+    }
+
+    auto permutation = this->compute_permutation();
+
+    ASSERT_EQ(permutation.size(), 2 * offset + 50);
+    this->assert_is_permutation(permutation);
+}
+
+
+TYPED_TEST(NestedDissection, ReducesFillInAni4)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using index_type = typename TestFixture::index_type;
+    auto mtx = gko::share(gko::read<matrix_type>(
+        std::ifstream{gko::matrices::location_ani4_mtx}, this->ref));
+
+    auto perm = this->nd_factory->generate(mtx);
+
+    const auto num_rows = mtx->get_size()[0];
+    auto perm_array = gko::make_array_view(this->ref, num_rows,
+                                           perm->get_permutation());
+    auto permuted_mtx = gko::as<matrix_type>(mtx->permute(&perm_array));
+    std::unique_ptr<gko::factorization::elimination_forest<index_type>> forest;
+    std::unique_ptr<matrix_type> factorized_mtx;
+    std::unique_ptr<matrix_type> factorized_permuted_mtx;
+    gko::factorization::symbolic_cholesky(mtx.get(), true, factorized_mtx,
+                                          forest);
+    gko::factorization::symbolic_cholesky(permuted_mtx.get(), true,
+                                          factorized_permuted_mtx, forest);
+    int fillin_mtx = factorized_mtx->get_num_stored_elements() -
+                     mtx->get_num_stored_elements();
+    int fillin_permuted = factorized_permuted_mtx->get_num_stored_elements() -
+                          permuted_mtx->get_num_stored_elements();
+    ASSERT_LE(fillin_permuted, fillin_mtx * 2 / 5);
+}
+
+
+}  // namespace
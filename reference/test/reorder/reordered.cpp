@@ -0,0 +1,295 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/reorder/reordered.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/exception.hpp>
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/reorder/gray_code.hpp>
+#include <ginkgo/core/reorder/rcm.hpp>
+#include <ginkgo/core/solver/cg.hpp>
+#include <ginkgo/core/stop/iteration.hpp>
+#include <ginkgo/core/stop/residual_norm.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class Reordered : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Csr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using Reord = gko::experimental::reorder::Reordered<value_type, index_type>;
+    using Cg = gko::solver::Cg<value_type>;
+    using Rcm = gko::experimental::reorder::Rcm<index_type>;
+    using GrayCode = gko::experimental::reorder::GrayCode<index_type>;
+
+    Reordered()
+        : exec(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx(gko::initialize<Mtx>({{4.0, 0.0, 0.0, 1.0, 1.0},
+                                    {0.0, 4.0, 1.0, 0.0, 0.0},
+                                    {0.0, 1.0, 4.0, 1.0, 0.0},
+                                    {1.0, 0.0, 1.0, 4.0, 0.0},
+                                    {1.0, 0.0, 0.0, 0.0, 4.0}},
+                                   exec)),
+          // clang-format on
+          b(gko::initialize<Vec>({1.0, 2.0, 3.0, 4.0, 5.0}, exec)),
+          x(gko::initialize<Vec>({-1.0, 1.0, 2.0, 0.5, 3.0}, exec)),
+          rcm_factory(Rcm::build().on(exec)),
+          gray_code_factory(GrayCode::build().on(exec)),
+          cg_factory(
+              Cg::build()
+                  .with_criteria(
+                      gko::stop::Iteration::build().with_max_iters(100u),
+                      gko::stop::ResidualNorm<value_type>::build()
+                          .with_reduction_factor(r<value_type>::value))
+                  .on(exec))
+    {}
+
+    std::unique_ptr<Vec> solve_without_reordering(const Vec* rhs)
+    {
+        auto result = Vec::create(exec, rhs->get_size());
+        result->fill(gko::zero<value_type>());
+        cg_factory->generate(mtx)->apply(rhs, result);
+        return result;
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<Vec> b;
+    std::shared_ptr<Vec> x;
+    std::shared_ptr<Rcm> rcm_factory;
+    std::shared_ptr<GrayCode> gray_code_factory;
+    std::shared_ptr<typename Cg::Factory> cg_factory;
+};
+
+TYPED_TEST_SUITE(Reordered, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(Reordered, BuildsWithoutReordering)
+{
+    using Reord = typename TestFixture::Reord;
+
+    auto reordered = Reord::build().on(this->exec)->generate(this->mtx);
+
+    ASSERT_EQ(reordered->get_permutation(), nullptr);
+    ASSERT_EQ(reordered->get_system_matrix(), this->mtx);
+    GKO_ASSERT_EQUAL_DIMENSIONS(reordered, this->mtx);
+}
+
+
+TYPED_TEST(Reordered, PermutesSystemMatrixOnce)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Reord = typename TestFixture::Reord;
+
+    auto reordered = Reord::build()
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+
+    auto perm = this->rcm_factory->generate(this->mtx);
+    auto reordered_perm = reordered->get_permutation();
+    GKO_ASSERT_ARRAY_EQ(
+        gko::make_const_array_view(this->exec, 5,
+                                   reordered_perm->get_const_permutation())
+            .copy_to_array(),
+        gko::make_const_array_view(this->exec, 5,
+                                   perm->get_const_permutation())
+            .copy_to_array());
+    GKO_ASSERT_MTX_NEAR(gko::as<Mtx>(reordered->get_system_matrix()),
+                        this->mtx->permute(perm), 0.0);
+}
+
+
+TYPED_TEST(Reordered, ThrowsOnNonSquareMatrix)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Reord = typename TestFixture::Reord;
+    auto rectangular_mtx = gko::share(
+        gko::initialize<Mtx>({{1., 1., 0.}, {1., 2., 1.}}, this->exec));
+    auto factory =
+        Reord::build().with_reordering(this->rcm_factory).on(this->exec);
+
+    ASSERT_THROW(factory->generate(rectangular_mtx), gko::DimensionMismatch);
+}
+
+
+TYPED_TEST(Reordered, AppliesIdentityWithoutInnerOperator)
+{
+    using Reord = typename TestFixture::Reord;
+    auto reordered = Reord::build()
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+
+    reordered->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->b, 0.0);
+}
+
+
+TYPED_TEST(Reordered, SolvesWithoutReordering)
+{
+    using Reord = typename TestFixture::Reord;
+    using value_type = typename TestFixture::value_type;
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+    this->x->fill(gko::zero<value_type>());
+
+    reordered->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->solve_without_reordering(this->b.get()),
+                        r<value_type>::value);
+}
+
+
+TYPED_TEST(Reordered, SolvesWithRcmReordering)
+{
+    using Reord = typename TestFixture::Reord;
+    using value_type = typename TestFixture::value_type;
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+    this->x->fill(gko::zero<value_type>());
+
+    reordered->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->solve_without_reordering(this->b.get()),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Reordered, SolvesWithGrayCodeReordering)
+{
+    using Reord = typename TestFixture::Reord;
+    using value_type = typename TestFixture::value_type;
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .with_reordering(this->gray_code_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+    this->x->fill(gko::zero<value_type>());
+
+    reordered->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, this->solve_without_reordering(this->b.get()),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Reordered, PermutesInitialGuess)
+{
+    using Reord = typename TestFixture::Reord;
+    using Cg = typename TestFixture::Cg;
+    // without iterations, the solver returns the initial guess
+    auto reordered =
+        Reord::build()
+            .with_inner_operator(
+                Cg::build()
+                    .with_criteria(
+                        gko::stop::Iteration::build().with_max_iters(0u))
+                    .on(this->exec))
+            .with_reordering(this->rcm_factory)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto expected = this->x->clone();
+
+    reordered->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, expected, 0.0);
+}
+
+
+TYPED_TEST(Reordered, AdvancedSolvesWithRcmReordering)
+{
+    using Reord = typename TestFixture::Reord;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto alpha = gko::initialize<Vec>({2.0}, this->exec);
+    auto beta = gko::initialize<Vec>({-1.0}, this->exec);
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+    auto expected = this->solve_without_reordering(this->b.get());
+    expected->scale(alpha);
+    expected->add_scaled(beta, this->x);
+
+    reordered->apply(alpha, this->b, beta, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, expected, r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Reordered, SolvesMultipleRhsWithRcmReordering)
+{
+    using Reord = typename TestFixture::Reord;
+    using Vec = typename TestFixture::Vec;
+    using value_type = typename TestFixture::value_type;
+    auto b = gko::initialize<Vec>(
+        {I<value_type>{1.0, -1.0}, I<value_type>{2.0, 0.5},
+         I<value_type>{3.0, 1.0}, I<value_type>{4.0, 2.0},
+         I<value_type>{5.0, -3.0}},
+        this->exec);
+    auto x = Vec::create(this->exec, b->get_size());
+    x->fill(gko::zero<value_type>());
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+
+    reordered->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, this->solve_without_reordering(b.get()),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(Reordered, CanBeCloned)
+{
+    using Reord = typename TestFixture::Reord;
+    using value_type = typename TestFixture::value_type;
+    auto reordered = Reord::build()
+                         .with_inner_operator(this->cg_factory)
+                         .with_reordering(this->rcm_factory)
+                         .on(this->exec)
+                         ->generate(this->mtx);
+    this->x->fill(gko::zero<value_type>());
+
+    auto clone = gko::clone(reordered);
+    clone->apply(this->b, this->x);
+
+    ASSERT_EQ(clone->get_permutation(), reordered->get_permutation());
+    GKO_ASSERT_MTX_NEAR(this->x, this->solve_without_reordering(this->b.get()),
+                        r<value_type>::value * 1e1);
+}
+
+
+}  // namespace
@@ -17,6 +17,8 @@
 #include <ginkgo/core/matrix/batch_csr.hpp>
 #include <ginkgo/core/matrix/batch_dense.hpp>
 #include <ginkgo/core/matrix/batch_ell.hpp>
+#include <ginkgo/core/matrix/batch_variable_csr.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 
 
 #include "core/base/batch_utilities.hpp"
@@ -201,3 +203,93 @@ TYPED_TEST(BatchCg, CanSolveHpdSystem)
 
     GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, tol * 1000);
 }
+
+
+TYPED_TEST(BatchCg, CanSolveVariableSizeSystem)
+{
+    using value_type = typename TestFixture::value_type;
+    using real_type = gko::remove_complex<value_type>;
+    using Solver = typename TestFixture::solver_type;
+    using MVec = typename TestFixture::MVec;
+    using VarCsrMtx = gko::batch::matrix::VariableCsr<value_type>;
+    using ItemMtx = gko::matrix::Csr<value_type>;
+    const real_type tol = 1e-6;
+    auto small_mtx = gko::initialize<ItemMtx>(
+        {{2.0, -1.0, 0.0}, {-1.0, 2.0, -1.0}, {0.0, -1.0, 2.0}}, this->exec);
+    auto large_mtx = gko::initialize<ItemMtx>({{2.0, -1.0, 0.0, 0.0, 0.0},
+                                               {-1.0, 2.0, -1.0, 0.0, 0.0},
+                                               {0.0, -1.0, 2.0, -1.0, 0.0},
+                                               {0.0, 0.0, -1.0, 2.0, -1.0},
+                                               {0.0, 0.0, 0.0, -1.0, 2.0}},
+                                              this->exec);
+    auto mtx = gko::share(VarCsrMtx::create_from_items(
+        this->exec, {small_mtx.get(), large_mtx.get()}));
+    auto b = gko::batch::initialize<MVec>(
+        {{1.0, 0.0, 1.0, 0.0, 0.0}, {1.0, 0.0, 0.0, 0.0, 1.0}}, this->exec);
+    auto x = MVec::create(this->exec, b->get_size());
+    x->fill(gko::zero<value_type>());
+    auto solver = Solver::build()
+                      .with_max_iterations(100)
+                      .with_tolerance(tol)
+                      .with_tolerance_type(
+                          gko::batch::stop::tolerance_type::absolute)
+                      .on(this->exec)
+                      ->generate(mtx);
+
+    solver->apply(b, x);
+
+    for (int row = 0; row < 3; row++) {
+        ASSERT_NEAR(x->at(0, row, 0), value_type{1.0}, tol * 100);
+    }
+    for (int row = 0; row < 5; row++) {
+        ASSERT_NEAR(x->at(1, row, 0), value_type{1.0}, tol * 100);
+    }
+}
+
+
+TYPED_TEST(BatchCg, SolvesStencilSystemWithMultipleRhs)
+{
+    const int num_rhs = 4;
+    auto linear_system =
+        gko::test::generate_batch_linear_system(this->mat, num_rhs);
+
+    auto res = gko::test::solve_linear_system(
+        this->exec, this->solve_lambda, this->solver_settings, linear_system);
+
+    for (size_t i = 0; i < this->num_batch_items; i++) {
+        for (int j = 0; j < num_rhs; j++) {
+            ASSERT_LE(res.host_res_norm->at(i, 0, j) /
+                          linear_system.host_rhs_norm->at(i, 0, j),
+                      this->solver_settings.residual_tol);
+        }
+    }
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, this->eps * 10);
+}
+
+
+TYPED_TEST(BatchCg, LogsIterationsPerRhs)
+{
+    using value_type = typename TestFixture::value_type;
+    const int num_rhs = 2;
+    auto linear_system =
+        gko::test::generate_batch_linear_system(this->mat, num_rhs);
+    // the second right hand side is zero and converges immediately
+    for (size_t i = 0; i < this->num_batch_items; i++) {
+        for (int row = 0; row < this->num_rows; row++) {
+            linear_system.rhs->at(i, row, 1) = gko::zero<value_type>();
+            linear_system.exact_sol->at(i, row, 1) = gko::zero<value_type>();
+        }
+        linear_system.host_rhs_norm->at(i, 0, 1) = 0;
+    }
+
+    auto res = gko::test::solve_linear_system(
+        this->exec, this->solve_lambda, this->solver_settings, linear_system);
+
+    auto iter_array = res.log_data->iter_counts.get_const_data();
+    auto res_array = res.log_data->res_norms.get_const_data();
+    for (size_t i = 0; i < this->num_batch_items; i++) {
+        ASSERT_GT(iter_array[i * num_rhs], iter_array[i * num_rhs + 1]);
+        ASSERT_EQ(res_array[i * num_rhs + 1], 0);
+    }
+    GKO_ASSERT_BATCH_MTX_NEAR(res.x, linear_system.exact_sol, this->eps * 10);
+}
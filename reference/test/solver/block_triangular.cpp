@@ -0,0 +1,287 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/solver/block_triangular.hpp>
+
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/solver/triangular.hpp>
+
+
+#include "core/test/utils.hpp"
+
+
+namespace {
+
+
+template <typename ValueIndexType>
+class BlockTriangular : public ::testing::Test {
+protected:
+    using value_type =
+        typename std::tuple_element<0, decltype(ValueIndexType())>::type;
+    using index_type =
+        typename std::tuple_element<1, decltype(ValueIndexType())>::type;
+    using Mtx = gko::matrix::Dense<value_type>;
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Fbcsr = gko::matrix::Fbcsr<value_type, index_type>;
+    using LowerSolver = gko::solver::BlockLowerTrs<value_type, index_type>;
+    using UpperSolver = gko::solver::BlockUpperTrs<value_type, index_type>;
+
+    BlockTriangular()
+        : exec(gko::ReferenceExecutor::create()),
+          // clang-format off
+          mtx(gko::initialize<Mtx>(
+              {{2., 1., 0., 1., 1., 0.},
+               {1., 3., 2., 0., 0., 1.},
+               {1., 0., 4., 1., 0., 2.},
+               {0., 2., 0., 2., 1., 0.},
+               {0., 0., 1., 1., 3., 0.},
+               {1., 0., 0., 1., 1., 2.}}, exec)),
+          lower(gko::initialize<Mtx>(
+              {{2., 1., 0., 0., 0., 0.},
+               {1., 3., 0., 0., 0., 0.},
+               {1., 0., 4., 1., 0., 0.},
+               {0., 2., 0., 2., 0., 0.},
+               {0., 0., 1., 1., 3., 0.},
+               {1., 0., 0., 1., 1., 2.}}, exec)),
+          upper(gko::initialize<Mtx>(
+              {{2., 1., 0., 1., 1., 0.},
+               {1., 3., 2., 0., 0., 1.},
+               {0., 0., 4., 1., 0., 2.},
+               {0., 0., 0., 2., 1., 0.},
+               {0., 0., 0., 0., 3., 0.},
+               {0., 0., 0., 0., 1., 2.}}, exec)),
+          b(gko::initialize<Mtx>(
+              {I<value_type>{1., 2.},
+               I<value_type>{-1., 0.},
+               I<value_type>{3., 1.},
+               I<value_type>{0., -2.},
+               I<value_type>{2., 1.},
+               I<value_type>{1., 4.}}, exec)),
+          // clang-format on
+          fbcsr_mtx(Fbcsr::create(exec, 2))
+    {
+        mtx->convert_to(fbcsr_mtx);
+    }
+
+    std::shared_ptr<const gko::Executor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<Mtx> lower;
+    std::shared_ptr<Mtx> upper;
+    std::shared_ptr<Mtx> b;
+    std::shared_ptr<Fbcsr> fbcsr_mtx;
+};
+
+TYPED_TEST_SUITE(BlockTriangular, gko::test::ValueIndexTypes,
+                 PairTypenameNameGenerator);
+
+
+TYPED_TEST(BlockTriangular, KeepsBlockSizeOfSystemMatrix)
+{
+    using LowerSolver = typename TestFixture::LowerSolver;
+
+    auto solver =
+        LowerSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+
+    ASSERT_EQ(solver->get_size(), gko::dim<2>(6, 6));
+    ASSERT_EQ(solver->get_system_matrix()->get_block_size(), 2);
+}
+
+
+TYPED_TEST(BlockTriangular, LowerSolvesUsingLowerBlocks)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    auto solver =
+        LowerSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto result = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    solver->apply(this->b, x);
+
+    this->lower->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, UpperSolvesUsingUpperBlocks)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using UpperSolver = typename TestFixture::UpperSolver;
+    auto solver =
+        UpperSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto result = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    solver->apply(this->b, x);
+
+    this->upper->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, LowerSolvesWithUnitDiagonal)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    auto solver = LowerSolver::build()
+                      .with_unit_diagonal(true)
+                      .on(this->exec)
+                      ->generate(this->fbcsr_mtx);
+    // clang-format off
+    auto unit_lower = gko::initialize<Mtx>(
+        {{1., 0., 0., 0., 0., 0.},
+         {0., 1., 0., 0., 0., 0.},
+         {1., 0., 1., 0., 0., 0.},
+         {0., 2., 0., 1., 0., 0.},
+         {0., 0., 1., 1., 1., 0.},
+         {1., 0., 0., 1., 0., 1.}}, this->exec);
+    // clang-format on
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto result = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    solver->apply(this->b, x);
+
+    unit_lower->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, UpperSolvesWithUnitDiagonal)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using UpperSolver = typename TestFixture::UpperSolver;
+    auto solver = UpperSolver::build()
+                      .with_unit_diagonal(true)
+                      .on(this->exec)
+                      ->generate(this->fbcsr_mtx);
+    // clang-format off
+    auto unit_upper = gko::initialize<Mtx>(
+        {{1., 0., 0., 1., 1., 0.},
+         {0., 1., 2., 0., 0., 1.},
+         {0., 0., 1., 0., 0., 2.},
+         {0., 0., 0., 1., 1., 0.},
+         {0., 0., 0., 0., 1., 0.},
+         {0., 0., 0., 0., 0., 1.}}, this->exec);
+    // clang-format on
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto result = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    solver->apply(this->b, x);
+
+    unit_upper->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, SolvesLikeScalarTrsForBlockSizeOne)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    using UpperSolver = typename TestFixture::UpperSolver;
+    auto csr = gko::share(TestFixture::Csr::create(this->exec));
+    this->mtx->convert_to(csr);
+    auto lower_solver = LowerSolver::build().on(this->exec)->generate(csr);
+    auto upper_solver = UpperSolver::build().on(this->exec)->generate(csr);
+    auto scalar_lower_solver =
+        gko::solver::LowerTrs<value_type, index_type>::build()
+            .on(this->exec)
+            ->generate(csr);
+    auto scalar_upper_solver =
+        gko::solver::UpperTrs<value_type, index_type>::build()
+            .on(this->exec)
+            ->generate(csr);
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto expected = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    lower_solver->apply(this->b, x);
+    scalar_lower_solver->apply(this->b, expected);
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value);
+    upper_solver->apply(this->b, x);
+    scalar_upper_solver->apply(this->b, expected);
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, SolvesAdvanced)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    auto solver =
+        LowerSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+    auto alpha = gko::initialize<Mtx>({2.0}, this->exec);
+    auto beta = gko::initialize<Mtx>({-1.0}, this->exec);
+    auto x = gko::clone(this->b);
+    auto expected = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    solver->apply(this->b, expected);
+    expected->scale(alpha);
+    expected->sub_scaled(gko::initialize<Mtx>({1.0}, this->exec), this->b);
+
+    solver->apply(alpha, this->b, beta, x);
+
+    GKO_ASSERT_MTX_NEAR(x, expected, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, TransposedLowerSolvesWithTransposedBlocks)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    using UpperSolver = typename TestFixture::UpperSolver;
+    auto solver =
+        LowerSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto result = Mtx::create(this->exec, gko::dim<2>{6, 2});
+
+    auto trans_solver = gko::as<UpperSolver>(solver->transpose());
+    trans_solver->apply(this->b, x);
+
+    gko::as<Mtx>(this->lower->transpose())->apply(x, result);
+    GKO_ASSERT_MTX_NEAR(result, this->b, r<value_type>::value);
+}
+
+
+TYPED_TEST(BlockTriangular, CanBeCopiedAndMoved)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    using LowerSolver = typename TestFixture::LowerSolver;
+    auto solver =
+        LowerSolver::build().on(this->exec)->generate(this->fbcsr_mtx);
+    auto copy = LowerSolver::build().on(this->exec)->generate(
+        TestFixture::Fbcsr::create(this->exec, 2));
+    auto moved = LowerSolver::build().on(this->exec)->generate(
+        TestFixture::Fbcsr::create(this->exec, 2));
+    auto x = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    auto expected = Mtx::create(this->exec, gko::dim<2>{6, 2});
+    solver->apply(this->b, expected);
+
+    copy->copy_from(solver);
+    moved->move_from(solver);
+
+    copy->apply(this->b, x);
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+    moved->apply(this->b, x);
+    GKO_ASSERT_MTX_NEAR(x, expected, 0.0);
+}
+
+
+}  // namespace
@@ -10,8 +10,13 @@
 
 #include <ginkgo/core/base/exception.hpp>
 #include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/factorization/lu.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
 #include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/identity.hpp>
+#include <ginkgo/core/solver/direct.hpp>
 #include <ginkgo/core/solver/gmres.hpp>
+#include <ginkgo/core/solver/workspace_pool.hpp>
 #include <ginkgo/core/stop/combined.hpp>
 #include <ginkgo/core/stop/iteration.hpp>
 #include <ginkgo/core/stop/residual_norm.hpp>
@@ -170,6 +175,47 @@ TYPED_TEST(Ir, SolvesTriangularSystemWithIterativeInnerSolver)
 }
 
 
+TYPED_TEST(Ir, SolvesTriangularSystemWithWorkspacePool)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using value_type = typename TestFixture::value_type;
+    const gko::remove_complex<value_type> inner_reduction_factor = 1e-2;
+    auto inner_solver_factory = gko::share(
+        gko::solver::Gmres<value_type>::build()
+            .with_criteria(gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(inner_reduction_factor)
+                               .on(this->exec))
+            .on(this->exec));
+    auto solver =
+        gko::solver::Ir<value_type>::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(30u),
+                           gko::stop::ResidualNorm<value_type>::build()
+                               .with_reduction_factor(r<value_type>::value))
+            .with_solver(inner_solver_factory)
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto inner_solver =
+        gko::as<gko::solver::Gmres<value_type>>(solver->get_solver());
+    auto pool = gko::solver::WorkspacePool::create(this->exec);
+    gko::solver::set_workspace_pool(solver.get(), pool);
+    auto b = gko::initialize<Mtx>({3.9, 9.0, 2.2}, this->exec);
+    auto x = gko::initialize<Mtx>({0.0, 0.0, 0.0}, this->exec);
+
+    solver->apply(b, x);
+    const auto num_buffers = pool->get_num_buffers();
+    x->fill(gko::zero<value_type>());
+    solver->apply(b, x);
+
+    GKO_ASSERT_MTX_NEAR(x, l({1.0, 3.0, 2.0}), r<value_type>::value * 1e1);
+    ASSERT_EQ(solver->get_workspace_pool(), pool);
+    ASSERT_EQ(inner_solver->get_workspace_pool(), pool);
+    // the buffers are returned after each apply and reused by the next one
+    ASSERT_GT(num_buffers, 0);
+    ASSERT_EQ(pool->get_num_buffers(), num_buffers);
+    ASSERT_EQ(pool->get_num_leased_buffers(), 0);
+}
+
+
 TYPED_TEST(Ir, SolvesMultipleTriangularSystems)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -448,4 +494,210 @@ TYPED_TEST(Ir, ApplyWithGivenInitialGuessModeIsEquivalentToRef)
 }
 
 
+template <typename T>
+class MixedPrecisionIr : public ::testing::Test {
+protected:
+    using value_type = T;
+    using lower_type = gko::next_precision<value_type>;
+    using Mtx = gko::matrix::Csr<value_type, gko::int32>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using LowerVec = gko::matrix::Dense<lower_type>;
+    using Solver = gko::solver::Ir<value_type>;
+    using LowerDirect =
+        gko::experimental::solver::Direct<lower_type, gko::int32>;
+    using Direct = gko::experimental::solver::Direct<value_type, gko::int32>;
+    MixedPrecisionIr()
+        : exec(gko::ReferenceExecutor::create()),
+          mtx(gko::initialize<Mtx>(
+              {{0.9, -1.0, 3.0}, {0.3, 1.0, 3.0}, {0.1, 0.0, 1.1}}, exec)),
+          b(gko::initialize<Vec>({3.9, 9.3, 2.3}, exec)),
+          x(gko::initialize<Vec>({0.0, 0.0, 0.0}, exec))
+    {}
+
+    std::unique_ptr<typename Solver::Factory> build_solver(
+        std::shared_ptr<const gko::LinOp> inner_solver, gko::size_type iters)
+    {
+        return Solver::build()
+            .with_generated_solver(inner_solver)
+            .with_mixed_precision(true)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(iters),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .on(exec);
+    }
+
+    std::shared_ptr<const gko::ReferenceExecutor> exec;
+    std::shared_ptr<Mtx> mtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+};
+
+using MixedPrecisionIrTypes = ::testing::Types<double, std::complex<double>>;
+
+TYPED_TEST_SUITE(MixedPrecisionIr, MixedPrecisionIrTypes,
+                 TypenameNameGenerator);
+
+
+TYPED_TEST(MixedPrecisionIr, KernelAddCorrection)
+{
+    using Vec = typename TestFixture::Vec;
+    using LowerVec = typename TestFixture::LowerVec;
+    auto alpha = gko::initialize<Vec>({0.5}, this->exec);
+    auto correction = gko::initialize<LowerVec>({2.0, -4.0, 1.0}, this->exec);
+    auto x = gko::initialize<Vec>({1.0, 1.0, 1.0}, this->exec);
+
+    gko::kernels::reference::ir::add_correction(this->exec, alpha.get(),
+                                                correction.get(), x.get());
+
+    GKO_ASSERT_MTX_NEAR(x, l({2.0, -1.0, 1.5}), 0.0);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, SolvesToFullPrecisionWithLowerPrecisionDirect)
+{
+    using value_type = typename TestFixture::value_type;
+    using lower_type = typename TestFixture::lower_type;
+    using LowerDirect = typename TestFixture::LowerDirect;
+    auto inner_solver =
+        LowerDirect::build()
+            .with_factorization(
+                gko::experimental::factorization::Lu<lower_type,
+                                                     gko::int32>::build())
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto solver = this->build_solver(std::move(inner_solver), 10u)
+                      ->generate(this->mtx);
+
+    solver->apply(this->b, this->x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, l({1.0, 3.0, 2.0}),
+                        r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, RoundsOnlyTheCorrection)
+{
+    using Solver = typename TestFixture::Solver;
+    using lower_type = typename TestFixture::lower_type;
+    auto solver =
+        this->build_solver(
+                gko::matrix::Identity<lower_type>::create(this->exec, 3), 3u)
+            ->generate(this->mtx);
+    auto ref_solver =
+        Solver::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto ref_x = this->x->clone();
+
+    solver->apply(this->b, this->x);
+    ref_solver->apply(this->b, ref_x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, ref_x, r<lower_type>::value);
+    ASSERT_NE(this->x->at(0), ref_x->at(0));
+}
+
+
+TYPED_TEST(MixedPrecisionIr, PromotesSolverOnStagnation)
+{
+    using value_type = typename TestFixture::value_type;
+    using lower_type = typename TestFixture::lower_type;
+    using Solver = typename TestFixture::Solver;
+    using Direct = typename TestFixture::Direct;
+    // the identity is a poor inner solver, so the correction stagnates
+    auto id = gko::share(
+        gko::matrix::Identity<lower_type>::create(this->exec, 3));
+    auto solver =
+        Solver::build()
+            .with_generated_solver(id)
+            .with_mixed_precision(true)
+            .with_stagnation_factor(0.1)
+            .with_promoted_solver(Direct::build().with_factorization(
+                gko::experimental::factorization::Lu<value_type,
+                                                     gko::int32>::build()))
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(5u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto unpromoted_x = this->x->clone();
+
+    solver->apply(this->b, this->x);
+    this->build_solver(id, 5u)->generate(this->mtx)->apply(this->b,
+                                                            unpromoted_x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, l({1.0, 3.0, 2.0}),
+                        r<value_type>::value * 1e1);
+    ASSERT_GT(gko::abs(unpromoted_x->at(1) - value_type{3.0}), 1e-3);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, TransposedSolverPromotesSolverOnStagnation)
+{
+    using value_type = typename TestFixture::value_type;
+    using lower_type = typename TestFixture::lower_type;
+    using Solver = typename TestFixture::Solver;
+    using Gmres = gko::solver::Gmres<value_type>;
+    auto id = gko::share(
+        gko::matrix::Identity<lower_type>::create(this->exec, 3));
+    // the promoted solver needs to be transposable, which Direct is not
+    auto gmres_factory = gko::share(
+        Gmres::build()
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(3u))
+            .on(this->exec));
+    auto solver =
+        Solver::build()
+            .with_generated_solver(id)
+            .with_mixed_precision(true)
+            .with_stagnation_factor(0.1)
+            .with_promoted_solver(gmres_factory)
+            .with_criteria(
+                gko::stop::Iteration::build().with_max_iters(5u),
+                gko::stop::ResidualNorm<value_type>::build()
+                    .with_reduction_factor(r<value_type>::value))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto ref_x = this->x->clone();
+
+    solver->transpose()->apply(this->b, this->x);
+    gmres_factory->generate(gko::share(this->mtx->transpose()))
+        ->apply(this->b, ref_x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, ref_x, r<value_type>::value * 1e1);
+}
+
+
+TYPED_TEST(MixedPrecisionIr, ChecksStagnationOnlyEveryInterval)
+{
+    using value_type = typename TestFixture::value_type;
+    using lower_type = typename TestFixture::lower_type;
+    using Solver = typename TestFixture::Solver;
+    using Direct = typename TestFixture::Direct;
+    auto id = gko::share(
+        gko::matrix::Identity<lower_type>::create(this->exec, 3));
+    // the first check after the initial one is beyond the iteration limit
+    auto solver =
+        Solver::build()
+            .with_generated_solver(id)
+            .with_mixed_precision(true)
+            .with_stagnation_factor(0.1)
+            .with_stagnation_check_interval(10u)
+            .with_promoted_solver(Direct::build().with_factorization(
+                gko::experimental::factorization::Lu<value_type,
+                                                     gko::int32>::build()))
+            .with_criteria(gko::stop::Iteration::build().with_max_iters(5u))
+            .on(this->exec)
+            ->generate(this->mtx);
+    auto unpromoted_x = this->x->clone();
+
+    solver->apply(this->b, this->x);
+    this->build_solver(id, 5u)->generate(this->mtx)->apply(this->b,
+                                                            unpromoted_x);
+
+    GKO_ASSERT_MTX_NEAR(this->x, unpromoted_x, 0.0);
+}
+
+
 }  // namespace
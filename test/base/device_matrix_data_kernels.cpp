@@ -9,6 +9,11 @@
 #include <random>
 
 
+#ifdef GKO_COMPILING_OMP
+#include <omp.h>
+#endif
+
+
 #include <gtest/gtest.h>
 
 
@@ -329,6 +334,35 @@ TYPED_TEST(DeviceMatrixData, SumsDuplicates)
 }
 
 
+TYPED_TEST(DeviceMatrixData, SumsDuplicatesAndRemovesZeros)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using device_matrix_data = gko::device_matrix_data<value_type, index_type>;
+    auto device_data =
+        device_matrix_data::create_from_host(this->exec, this->duplicate_data);
+    auto ref_data = this->deduplicated_data;
+    ref_data.remove_zeros();
+    auto ref_device_data = device_matrix_data::create_from_host(
+        this->exec->get_master(), ref_data);
+
+    device_data.sum_duplicates_and_remove_zeros();
+
+    auto ref_arrays = ref_device_data.empty_out();
+    auto arrays = device_data.empty_out();
+    GKO_ASSERT_ARRAY_EQ(arrays.row_idxs, ref_arrays.row_idxs);
+    GKO_ASSERT_ARRAY_EQ(arrays.col_idxs, ref_arrays.col_idxs);
+    double max_error{};
+    arrays.values.set_executor(this->exec->get_master());
+    for (int i = 0; i < arrays.values.get_size(); i++) {
+        max_error = std::max<double>(
+            max_error, std::abs(arrays.values.get_const_data()[i] -
+                                ref_arrays.values.get_const_data()[i]));
+    }
+    ASSERT_LT(max_error, 2 * r<value_type>::value);
+}
+
+
 #endif
 
 
@@ -353,3 +387,82 @@ TYPED_TEST(DeviceMatrixData, DoesntSumDuplicatesIfThereAreNone)
     ASSERT_EQ(device_data.copy_to_host().nonzeros,
               this->sorted_host_data.nonzeros);
 }
+
+
+TYPED_TEST(DeviceMatrixData, SumsDuplicatesAndRemovesZerosWithoutDuplicates)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using device_matrix_data = gko::device_matrix_data<value_type, index_type>;
+    auto device_data =
+        device_matrix_data::create_from_host(this->exec, this->host_data);
+    auto ref_data = this->sorted_host_data;
+    ref_data.remove_zeros();
+
+    device_data.sum_duplicates_and_remove_zeros();
+
+    ASSERT_EQ(device_data.copy_to_host().nonzeros, ref_data.nonzeros);
+}
+
+
+#ifdef GKO_COMPILING_OMP
+
+
+TYPED_TEST(DeviceMatrixData, SortsRowMajorInsideParallelRegion)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using device_matrix_data = gko::device_matrix_data<value_type, index_type>;
+    auto device_data =
+        device_matrix_data::create_from_host(this->exec, this->host_data);
+    const auto max_active_levels = omp_get_max_active_levels();
+    // the nested team consists of a single thread only
+    omp_set_max_active_levels(1);
+
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp single
+        device_data.sort_row_major();
+    }
+
+    omp_set_max_active_levels(max_active_levels);
+    ASSERT_EQ(device_data.copy_to_host().nonzeros,
+              this->sorted_host_data.nonzeros);
+}
+
+
+TYPED_TEST(DeviceMatrixData, SumsDuplicatesInsideParallelRegion)
+{
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    using device_matrix_data = gko::device_matrix_data<value_type, index_type>;
+    auto device_data =
+        device_matrix_data::create_from_host(this->exec, this->duplicate_data);
+    auto ref_device_data = device_matrix_data::create_from_host(
+        this->exec->get_master(), this->deduplicated_data);
+    const auto max_active_levels = omp_get_max_active_levels();
+    // the nested team consists of a single thread only
+    omp_set_max_active_levels(1);
+
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp single
+        device_data.sum_duplicates();
+    }
+
+    omp_set_max_active_levels(max_active_levels);
+    auto ref_arrays = ref_device_data.empty_out();
+    auto arrays = device_data.empty_out();
+    GKO_ASSERT_ARRAY_EQ(arrays.row_idxs, ref_arrays.row_idxs);
+    GKO_ASSERT_ARRAY_EQ(arrays.col_idxs, ref_arrays.col_idxs);
+    double max_error{};
+    for (int i = 0; i < arrays.values.get_size(); i++) {
+        max_error = std::max<double>(
+            max_error, std::abs(arrays.values.get_const_data()[i] -
+                                ref_arrays.values.get_const_data()[i]));
+    }
+    ASSERT_LT(max_error, 2 * r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <ginkgo/core/factorization/block_ilu.hpp>
+
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/fb_matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+class BlockIlu : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Fbcsr<value_type, index_type>;
+    using ilu_type = gko::factorization::BlockIlu<value_type, index_type>;
+
+    BlockIlu() : rand_engine(1337) {}
+
+    std::default_random_engine rand_engine;
+};
+
+
+TEST_F(BlockIlu, ComputeBlockIluIsEquivalentToRef)
+{
+    for (int block_size : {1, 2, 3, 4, 7}) {
+        SCOPED_TRACE(block_size);
+        std::shared_ptr<Mtx> mtx =
+            gko::test::generate_random_fbcsr<value_type, index_type>(
+                ref, 80, 80, block_size, true, false, rand_engine);
+        auto dmtx = gko::share(gko::clone(exec, mtx));
+
+        auto fact = ilu_type::build().on(ref)->generate(mtx);
+        auto dfact = ilu_type::build().on(exec)->generate(dmtx);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(dfact->get_l_factor(),
+                                   fact->get_l_factor());
+        GKO_ASSERT_MTX_EQ_SPARSITY(dfact->get_u_factor(),
+                                   fact->get_u_factor());
+        GKO_ASSERT_MTX_NEAR(dfact->get_l_factor(), fact->get_l_factor(),
+                            r<value_type>::value);
+        GKO_ASSERT_MTX_NEAR(dfact->get_u_factor(), fact->get_u_factor(),
+                            r<value_type>::value);
+    }
+}
+
+
+TEST_F(BlockIlu, ComputeBlockIluUnsortedIsEquivalentToRef)
+{
+    std::shared_ptr<Mtx> mtx =
+        gko::test::generate_random_fbcsr<value_type, index_type>(
+            ref, 60, 60, 3, true, true, rand_engine);
+    auto dmtx = gko::share(gko::clone(exec, mtx));
+
+    auto fact = ilu_type::build().on(ref)->generate(mtx);
+    auto dfact = ilu_type::build().on(exec)->generate(dmtx);
+
+    GKO_ASSERT_MTX_NEAR(dfact->get_l_factor(), fact->get_l_factor(),
+                        r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(dfact->get_u_factor(), fact->get_u_factor(),
+                        r<value_type>::value);
+}
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <random>
 
 
 #include <gtest/gtest.h>
@@ -93,6 +94,24 @@ protected:
         std::ifstream ani1_amd_stream{gko::matrices::location_ani1_amd_mtx};
         matrices.emplace_back("ani1_amd",
                               gko::read<matrix_type>(ani1_amd_stream, ref));
+        // large enough to be split between threads for the elimination forest
+        const index_type size = 4096;
+        gko::matrix_data<value_type, index_type> data{gko::dim<2>(size)};
+        std::default_random_engine engine{42};
+        std::uniform_int_distribution<index_type> offset_dist{1, 100};
+        for (index_type row = 0; row < size; row++) {
+            data.nonzeros.emplace_back(row, row, 1.0);
+            for (int i = 0; i < 3; i++) {
+                const auto col = row - offset_dist(engine);
+                if (col >= 0) {
+                    data.nonzeros.emplace_back(row, col, 1.0);
+                }
+            }
+        }
+        gko::utils::make_symmetric(data);
+        auto random_mtx = matrix_type::create(ref);
+        random_mtx->read(data);
+        matrices.emplace_back("random band", std::move(random_mtx));
     }
 
     void assert_equal_forests(elimination_forest& lhs, elimination_forest& rhs,
@@ -434,3 +434,53 @@ TYPED_TEST(ParIlut, KernelComputeLUIsEquivalentToRef)
     GKO_ASSERT_MTX_NEAR(this->mtx_u_ani, this->dmtx_u_ani, 1e-2);
     GKO_ASSERT_MTX_NEAR(this->dmtx_u_ani, dmtx_utt_ani, 0);
 }
+
+
+#ifdef GKO_COMPILING_OMP
+
+
+TYPED_TEST(ParIlut, KernelRowWiseFactorizeIsEquivalentToRef)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto res_l = Csr::create(this->ref, this->mtx_ani->get_size());
+    auto res_u = Csr::create(this->ref, this->mtx_ani->get_size());
+    auto dres_l = Csr::create(this->exec, this->mtx_ani->get_size());
+    auto dres_u = Csr::create(this->exec, this->mtx_ani->get_size());
+
+    gko::kernels::reference::par_ilut_factorization::row_wise_factorize(
+        this->ref, this->mtx_ani.get(), 1e-3, 2.0, res_l.get(), res_u.get());
+    gko::kernels::EXEC_NAMESPACE::par_ilut_factorization::row_wise_factorize(
+        this->exec, this->dmtx_ani.get(), 1e-3, 2.0, dres_l.get(),
+        dres_u.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres_l, res_l);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres_u, res_u);
+    GKO_ASSERT_MTX_NEAR(dres_l, res_l, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(dres_u, res_u, r<value_type>::value);
+}
+
+
+TYPED_TEST(ParIlut, KernelRowWiseFactorizeWithFillInIsEquivalentToRef)
+{
+    using Csr = typename TestFixture::Csr;
+    using value_type = typename TestFixture::value_type;
+    auto res_l = Csr::create(this->ref, this->mtx_square->get_size());
+    auto res_u = Csr::create(this->ref, this->mtx_square->get_size());
+    auto dres_l = Csr::create(this->exec, this->mtx_square->get_size());
+    auto dres_u = Csr::create(this->exec, this->mtx_square->get_size());
+
+    gko::kernels::reference::par_ilut_factorization::row_wise_factorize(
+        this->ref, this->mtx_square.get(), 0.0, 3.0, res_l.get(), res_u.get());
+    gko::kernels::EXEC_NAMESPACE::par_ilut_factorization::row_wise_factorize(
+        this->exec, this->dmtx_square.get(), 0.0, 3.0, dres_l.get(),
+        dres_u.get());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres_l, res_l);
+    GKO_ASSERT_MTX_EQ_SPARSITY(dres_u, res_u);
+    GKO_ASSERT_MTX_NEAR(dres_l, res_l, r<value_type>::value);
+    GKO_ASSERT_MTX_NEAR(dres_u, res_u, r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
@@ -0,0 +1,164 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "core/matrix/csr_assembly_kernels.hpp"
+
+
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/csr_assembler.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class CsrAssembler : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Assembler = gko::matrix::CsrAssembler<value_type, index_type>;
+
+    CsrAssembler()
+        : rand_engine(42),
+          num_dofs{1234},
+          dofs_per_element{8},
+          num_elements{2000},
+          element_dofs{ref, num_elements * dofs_per_element},
+          element_values{ref,
+                         num_elements * dofs_per_element * dofs_per_element}
+    {
+        // elements couple nearby degrees of freedom, some are eliminated
+        std::uniform_int_distribution<index_type> center_dist(0, num_dofs - 1);
+        std::uniform_int_distribution<index_type> offset_dist(-20, 20);
+        std::uniform_real_distribution<> eliminated_dist(0.0, 1.0);
+        for (gko::size_type element = 0; element < num_elements; element++) {
+            const auto center = center_dist(rand_engine);
+            for (gko::size_type i = 0; i < dofs_per_element; i++) {
+                const auto dof = std::min<index_type>(
+                    std::max<index_type>(center + offset_dist(rand_engine), 0),
+                    num_dofs - 1);
+                element_dofs.get_data()[element * dofs_per_element + i] =
+                    eliminated_dist(rand_engine) < 0.05 ? -1 : dof;
+            }
+        }
+        std::normal_distribution<gko::remove_complex<value_type>> value_dist(
+            0.0, 1.0);
+        for (gko::size_type i = 0; i < element_values.get_size(); i++) {
+            element_values.get_data()[i] =
+                gko::test::detail::get_rand_value<value_type>(value_dist,
+                                                              rand_engine);
+        }
+    }
+
+    std::default_random_engine rand_engine;
+    index_type num_dofs;
+    gko::size_type dofs_per_element;
+    gko::size_type num_elements;
+    gko::array<index_type> element_dofs;
+    gko::array<value_type> element_values;
+};
+
+
+TEST_F(CsrAssembler, BuildPatternIsEquivalentToRef)
+{
+    auto assembler = Assembler::create(ref, gko::dim<2>(num_dofs),
+                                       element_dofs, dofs_per_element);
+    auto dassembler = Assembler::create(exec, gko::dim<2>(num_dofs),
+                                        element_dofs, dofs_per_element);
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(dassembler->get_matrix(),
+                               assembler->get_matrix());
+    ASSERT_TRUE(dassembler->get_matrix()->is_sorted_by_column_index());
+}
+
+
+TEST_F(CsrAssembler, AddElementsIsEquivalentToRef)
+{
+    auto assembler = Assembler::create(ref, gko::dim<2>(num_dofs),
+                                       element_dofs, dofs_per_element);
+    auto dassembler = Assembler::create(exec, gko::dim<2>(num_dofs),
+                                        element_dofs, dofs_per_element);
+
+    assembler->add_elements(element_dofs, element_values, dofs_per_element);
+    dassembler->add_elements(element_dofs, element_values, dofs_per_element);
+
+    GKO_ASSERT_MTX_NEAR(dassembler->get_matrix(), assembler->get_matrix(),
+                        r<value_type>::value);
+}
+
+
+TEST_F(CsrAssembler, AddElementsIntoExistingMatrixIsEquivalentToRef)
+{
+    // the pattern only contains the couplings of the first half of elements
+    const auto half_size = num_elements / 2 * dofs_per_element;
+    gko::array<index_type> half_dofs{
+        ref, element_dofs.get_const_data(),
+        element_dofs.get_const_data() + half_size};
+    auto mtx = Assembler::create(ref, gko::dim<2>(num_dofs), half_dofs,
+                                 dofs_per_element)
+                   ->get_matrix();
+    auto assembler = Assembler::create(mtx);
+    auto dassembler = Assembler::create(gko::clone(exec, mtx));
+
+    assembler->add_elements(element_dofs, element_values, dofs_per_element);
+    dassembler->add_elements(element_dofs, element_values, dofs_per_element);
+
+    GKO_ASSERT_MTX_NEAR(dassembler->get_matrix(), assembler->get_matrix(),
+                        r<value_type>::value);
+}
+
+
+TEST_F(CsrAssembler, AddValuesIsEquivalentToRef)
+{
+    auto assembler = Assembler::create(ref, gko::dim<2>(num_dofs),
+                                       element_dofs, dofs_per_element);
+    auto dassembler = Assembler::create(exec, gko::dim<2>(num_dofs),
+                                        element_dofs, dofs_per_element);
+    const gko::size_type num_entries = 10000;
+    gko::array<index_type> rows{ref, num_entries};
+    gko::array<index_type> cols{ref, num_entries};
+    gko::array<value_type> values{ref, num_entries};
+    std::uniform_int_distribution<index_type> row_dist(0, num_dofs - 1);
+    std::uniform_int_distribution<index_type> offset_dist(-5, 5);
+    for (gko::size_type i = 0; i < num_entries; i++) {
+        const auto row = row_dist(rand_engine);
+        rows.get_data()[i] = row;
+        cols.get_data()[i] = std::min<index_type>(
+            std::max<index_type>(row + offset_dist(rand_engine), 0),
+            num_dofs - 1);
+        values.get_data()[i] = static_cast<value_type>(i % 7);
+    }
+
+    assembler->add_values(rows, cols, values);
+    dassembler->add_values(rows, cols, values);
+
+    GKO_ASSERT_MTX_NEAR(dassembler->get_matrix(), assembler->get_matrix(),
+                        r<value_type>::value);
+}
+
+
+TEST_F(CsrAssembler, AddElementsWithOutOfBoundsDofsIsEquivalentToRef)
+{
+    auto assembler = Assembler::create(ref, gko::dim<2>(num_dofs),
+                                       element_dofs, dofs_per_element);
+    auto dassembler = Assembler::create(exec, gko::dim<2>(num_dofs),
+                                        element_dofs, dofs_per_element);
+    for (gko::size_type element = 0; element < num_elements; element += 100) {
+        element_dofs.get_data()[element * dofs_per_element] = num_dofs;
+    }
+
+    ASSERT_THROW(assembler->add_elements(element_dofs, element_values,
+                                         dofs_per_element),
+                 gko::OutOfBoundsError);
+    ASSERT_THROW(dassembler->add_elements(element_dofs, element_values,
+                                          dofs_per_element),
+                 gko::OutOfBoundsError);
+    GKO_ASSERT_MTX_NEAR(dassembler->get_matrix(), assembler->get_matrix(),
+                        r<value_type>::value);
+}
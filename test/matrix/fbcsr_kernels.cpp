@@ -226,6 +226,48 @@ TYPED_TEST(Fbcsr, AdvancedSpmvMultiIsEquivalentToRefSorted)
 }
 
 
+TYPED_TEST(Fbcsr, SpmvIsEquivalentToRefForAllBlockSizes)
+{
+    using Mtx = typename TestFixture::Mtx;
+    using Dense = typename TestFixture::Dense;
+    using value_type = typename TestFixture::value_type;
+    using index_type = typename TestFixture::index_type;
+    // covers the specialized block sizes and the generic fallback
+    for (int block_size = 1; block_size <= 9; block_size++) {
+        SCOPED_TRACE(block_size);
+        auto mtx = gko::test::generate_random_fbcsr<value_type, index_type>(
+            this->ref, 30, 20, block_size, false, false,
+            std::default_random_engine(block_size));
+        auto dmtx = gko::clone(this->exec, mtx);
+        for (gko::size_type num_rhs : {1, 5}) {
+            auto x = Dense::create(this->ref,
+                                   gko::dim<2>(mtx->get_size()[1], num_rhs));
+            this->generate_sin(x);
+            auto dx = gko::clone(this->exec, x);
+            auto prod = Dense::create(
+                this->ref, gko::dim<2>(mtx->get_size()[0], num_rhs));
+            this->generate_sin(prod);
+            auto dprod = gko::clone(this->exec, prod);
+            auto adv_prod = gko::clone(prod);
+            auto dadv_prod = gko::clone(this->exec, prod);
+            auto alpha = gko::initialize<Dense>({2.5}, this->ref);
+            auto beta = gko::initialize<Dense>({-1.5}, this->ref);
+            auto dalpha = gko::clone(this->exec, alpha);
+            auto dbeta = gko::clone(this->exec, beta);
+
+            mtx->apply(x, prod);
+            dmtx->apply(dx, dprod);
+            mtx->apply(alpha, x, beta, adv_prod);
+            dmtx->apply(dalpha, dx, dbeta, dadv_prod);
+
+            const double tol = r<value_type>::value;
+            GKO_ASSERT_MTX_NEAR(prod, dprod, 5 * tol);
+            GKO_ASSERT_MTX_NEAR(adv_prod, dadv_prod, 5 * tol);
+        }
+    }
+}
+
+
 TYPED_TEST(Fbcsr, ConjTransposeIsEquivalentToRefSortedBS3)
 {
     using Mtx = typename TestFixture::Mtx;
@@ -0,0 +1,171 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/stencil.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class Stencil : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::Stencil<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using stencil_type = gko::matrix::stencil_type;
+
+    Stencil() : rand_engine(15) {}
+
+    std::unique_ptr<Vec> gen_vec(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void initialize_data(gko::dim<3> grid, stencil_type type, bool variable,
+                         int num_rhs)
+    {
+        mtx = Mtx::create_laplacian(ref, grid, type);
+        if (variable) {
+            const auto size = mtx->get_num_points() * mtx->get_size()[0];
+            mtx = Mtx::create(ref, grid, type,
+                              gko::test::generate_random_array<value_type>(
+                                  size, std::normal_distribution<>(-1.0, 1.0),
+                                  rand_engine, ref));
+        }
+        dmtx = gko::clone(exec, mtx);
+        const auto num_rows = mtx->get_size()[0];
+        b = gen_vec(num_rows, num_rhs);
+        x = gen_vec(num_rows, num_rhs);
+        alpha = gen_vec(1, 1);
+        beta = gen_vec(1, 1);
+        db = gko::clone(exec, b);
+        dx = gko::clone(exec, x);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    template <typename TestFunction>
+    void for_each_stencil(TestFunction fn)
+    {
+        for (int num_rhs : {1, 3}) {
+            SCOPED_TRACE(num_rhs);
+            for (bool variable : {false, true}) {
+                SCOPED_TRACE(variable);
+                {
+                    SCOPED_TRACE("empty");
+                    initialize_data({0, 0, 1}, stencil_type::five_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+                {
+                    SCOPED_TRACE("5pt single line");
+                    initialize_data({1500, 1, 1}, stencil_type::five_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+                {
+                    SCOPED_TRACE("5pt");
+                    initialize_data({1100, 37, 1}, stencil_type::five_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+                {
+                    SCOPED_TRACE("9pt");
+                    initialize_data({53, 41, 1}, stencil_type::nine_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+                {
+                    SCOPED_TRACE("7pt");
+                    initialize_data({23, 19, 17}, stencil_type::seven_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+                {
+                    SCOPED_TRACE("27pt");
+                    initialize_data({17, 23, 19},
+                                    stencil_type::twenty_seven_point,
+                                    variable, num_rhs);
+                    fn();
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+    std::default_random_engine rand_engine;
+};
+
+
+TEST_F(Stencil, SimpleApplyIsEquivalentToRef)
+{
+    for_each_stencil([this] {
+        mtx->apply(b, x);
+        dmtx->apply(db, dx);
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+    });
+}
+
+
+TEST_F(Stencil, AdvancedApplyIsEquivalentToRef)
+{
+    for_each_stencil([this] {
+        mtx->apply(alpha, b, beta, x);
+        dmtx->apply(dalpha, db, dbeta, dx);
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+    });
+}
+
+
+TEST_F(Stencil, ConvertToCsrIsEquivalentToRef)
+{
+    for_each_stencil([this] {
+        auto result = Csr::create(ref);
+        auto dresult = Csr::create(exec);
+
+        mtx->convert_to(result);
+        dmtx->convert_to(dresult);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+        GKO_ASSERT_MTX_NEAR(dresult, result, 0.0);
+    });
+}
+
+
+TEST_F(Stencil, ExtractDiagonalIsEquivalentToRef)
+{
+    for_each_stencil([this] {
+        auto diag = mtx->extract_diagonal();
+        auto ddiag = dmtx->extract_diagonal();
+
+        GKO_ASSERT_MTX_NEAR(ddiag, diag, 0.0);
+    });
+}
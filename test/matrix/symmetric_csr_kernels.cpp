@@ -0,0 +1,189 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#ifdef GKO_COMPILING_OMP
+#include <omp.h>
+#endif
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/diagonal.hpp>
+#include <ginkgo/core/matrix/symmetric_csr.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "test/utils/executor.hpp"
+
+
+class SymmetricCsr : public CommonTestFixture {
+protected:
+    using Csr = gko::matrix::Csr<value_type, index_type>;
+    using Mtx = gko::matrix::SymmetricCsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+
+    SymmetricCsr() : rand_engine(15) {}
+
+    std::unique_ptr<Vec> gen_vec(gko::size_type num_rows,
+                                 gko::size_type num_cols)
+    {
+        return gko::test::generate_random_matrix<Vec>(
+            num_rows, num_cols,
+            std::uniform_int_distribution<>(num_cols, num_cols),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+    }
+
+    void initialize_data(gko::size_type size, int min_nnz_row,
+                         int max_nnz_row, int num_rhs)
+    {
+        csr = gko::test::generate_random_matrix<Csr>(
+            size, size,
+            std::uniform_int_distribution<>(min_nnz_row, max_nnz_row),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        mtx = Mtx::create(ref, csr.get());
+        dmtx = Mtx::create(exec, gko::clone(exec, csr).get());
+        b = gen_vec(size, num_rhs);
+        x = gen_vec(size, num_rhs);
+        alpha = gen_vec(1, 1);
+        beta = gen_vec(1, 1);
+        db = gko::clone(exec, b);
+        dx = gko::clone(exec, x);
+        dalpha = gko::clone(exec, alpha);
+        dbeta = gko::clone(exec, beta);
+    }
+
+    template <typename TestFunction>
+    void for_each_matrix(TestFunction fn)
+    {
+        for (int num_rhs : {1, 4}) {
+            SCOPED_TRACE(num_rhs);
+            {
+                SCOPED_TRACE("empty");
+                initialize_data(0, 0, 0, num_rhs);
+                fn();
+            }
+            {
+                SCOPED_TRACE("sparse with empty rows");
+                initialize_data(531, 0, 10, num_rhs);
+                fn();
+            }
+            {
+                SCOPED_TRACE("irregular");
+                initialize_data(234, 1, 200, num_rhs);
+                fn();
+            }
+            {
+                SCOPED_TRACE("dense");
+                initialize_data(67, 67, 67, num_rhs);
+                fn();
+            }
+        }
+    }
+
+    std::unique_ptr<Csr> csr;
+    std::unique_ptr<Mtx> mtx;
+    std::unique_ptr<Mtx> dmtx;
+    std::unique_ptr<Vec> b;
+    std::unique_ptr<Vec> x;
+    std::unique_ptr<Vec> alpha;
+    std::unique_ptr<Vec> beta;
+    std::unique_ptr<Vec> db;
+    std::unique_ptr<Vec> dx;
+    std::unique_ptr<Vec> dalpha;
+    std::unique_ptr<Vec> dbeta;
+    std::default_random_engine rand_engine;
+};
+
+
+TEST_F(SymmetricCsr, CreateFromCsrIsEquivalentToRef)
+{
+    for_each_matrix([this] {
+        GKO_ASSERT_EQ(dmtx->get_num_stored_elements(),
+                      mtx->get_num_stored_elements());
+        GKO_ASSERT_MTX_NEAR(dmtx, mtx, 0.0);
+    });
+}
+
+
+TEST_F(SymmetricCsr, SimpleApplyIsEquivalentToRef)
+{
+    for_each_matrix([this] {
+        mtx->apply(b, x);
+        dmtx->apply(db, dx);
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+    });
+}
+
+
+TEST_F(SymmetricCsr, AdvancedApplyIsEquivalentToRef)
+{
+    for_each_matrix([this] {
+        mtx->apply(alpha, b, beta, x);
+        dmtx->apply(dalpha, db, dbeta, dx);
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+    });
+}
+
+
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(SymmetricCsr, ApplyInsideParallelRegionIsEquivalentToRef)
+{
+    const auto max_active_levels = omp_get_max_active_levels();
+    // the nested team consists of a single thread only
+    omp_set_max_active_levels(1);
+    for_each_matrix([this] {
+        mtx->apply(alpha, b, beta, x);
+
+#pragma omp parallel num_threads(2)
+        {
+#pragma omp master
+            dmtx->apply(dalpha, db, dbeta, dx);
+        }
+
+        GKO_ASSERT_MTX_NEAR(dx, x, r<value_type>::value);
+    });
+    omp_set_max_active_levels(max_active_levels);
+}
+
+
+#endif  // GKO_COMPILING_OMP
+
+
+TEST_F(SymmetricCsr, ConvertToCsrIsEquivalentToRef)
+{
+    for_each_matrix([this] {
+        auto result = Csr::create(ref);
+        auto dresult = Csr::create(exec);
+
+        mtx->convert_to(result);
+        dmtx->convert_to(dresult);
+
+        GKO_ASSERT_MTX_EQ_SPARSITY(dresult, result);
+        GKO_ASSERT_MTX_NEAR(dresult, result, 0.0);
+        ASSERT_TRUE(dresult->is_sorted_by_column_index());
+    });
+}
+
+
+TEST_F(SymmetricCsr, ExtractDiagonalIsEquivalentToRef)
+{
+    for_each_matrix([this] {
+        auto diag = mtx->extract_diagonal();
+        auto ddiag = dmtx->extract_diagonal();
+
+        GKO_ASSERT_MTX_NEAR(ddiag, diag, 0.0);
+    });
+}
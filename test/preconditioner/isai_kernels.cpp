@@ -667,3 +667,61 @@ TEST_F(Isai, IsaiGenerateGeneralSparsityPowerNIsEquivalentToRef)
                         d_isai->get_approximate_inverse(),
                         10 * r<value_type>::value);
 }
+
+
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(Isai, IsaiGenerateGeneralWithAdaptivePatternIsEquivalentToRef)
+{
+    using Isai =
+        gko::preconditioner::Isai<gko::preconditioner::isai_type::general,
+                                  value_type, index_type>;
+    initialize_data(matrix_type::general, 536, 15);
+
+    auto isai = Isai::build()
+                    .with_adaptive_steps(3)
+                    .with_adaptive_fill(3)
+                    .on(ref)
+                    ->generate(mtx->clone());
+    auto d_isai = Isai::build()
+                      .with_adaptive_steps(3)
+                      .with_adaptive_fill(3)
+                      .on(exec)
+                      ->generate(d_mtx->clone());
+
+    GKO_ASSERT_MTX_EQ_SPARSITY(isai->get_approximate_inverse(),
+                               d_isai->get_approximate_inverse());
+    GKO_ASSERT_MTX_NEAR(isai->get_approximate_inverse(),
+                        d_isai->get_approximate_inverse(),
+                        10 * r<value_type>::value);
+}
+
+
+TEST_F(Isai, IsaiGenerateSpdWithAdaptivePatternIsEquivalentToRef)
+{
+    using Isai = gko::preconditioner::Isai<gko::preconditioner::isai_type::spd,
+                                           value_type, index_type>;
+    initialize_data(matrix_type::spd, 536, 15);
+
+    auto isai = Isai::build()
+                    .with_adaptive_steps(3)
+                    .with_adaptive_fill(2)
+                    .on(ref)
+                    ->generate(mtx->clone());
+    auto d_isai = Isai::build()
+                      .with_adaptive_steps(3)
+                      .with_adaptive_fill(2)
+                      .on(exec)
+                      ->generate(d_mtx->clone());
+
+    const auto factor = gko::as<Csr>(
+        isai->get_approximate_inverse()->get_operators()[1]);
+    const auto d_factor = gko::as<Csr>(
+        d_isai->get_approximate_inverse()->get_operators()[1]);
+    GKO_ASSERT_MTX_EQ_SPARSITY(factor, d_factor);
+    GKO_ASSERT_MTX_NEAR(factor, d_factor, 10 * r<value_type>::value);
+}
+
+
+#endif  // GKO_COMPILING_OMP
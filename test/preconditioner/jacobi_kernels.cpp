@@ -5,6 +5,11 @@
 #include <random>
 
 
+#ifdef GKO_COMPILING_OMP
+#include <omp.h>
+#endif
+
+
 #include <gtest/gtest.h>
 
 
@@ -255,6 +260,115 @@ TEST_F(Jacobi,
 }
 
 
+TEST_F(Jacobi, FindsSameBlocksAsRefInLargeMatrix)
+{
+    // runs of rows with the same pattern with random lengths
+    std::default_random_engine engine(42);
+    std::uniform_int_distribution<> run_length_dist(1, 20);
+    gko::matrix_data<double, int> data{gko::dim<2>{10000}};
+    for (int run_start = 0; run_start < 10000;) {
+        const auto run_end =
+            std::min(10000, run_start + run_length_dist(engine));
+        for (int row = run_start; row < run_end; ++row) {
+            for (int col = run_start; col < run_end; ++col) {
+                data.nonzeros.emplace_back(row, col, row == col ? 30.0 : 1.0);
+            }
+        }
+        run_start = run_end;
+    }
+    auto mtx = share(Mtx::create(ref));
+    mtx->read(data);
+
+    auto bj = Bj::build().with_max_block_size(8u).on(ref)->generate(mtx);
+    auto d_bj = Bj::build().with_max_block_size(8u).on(exec)->generate(mtx);
+
+    const auto num_blocks = bj->get_num_blocks();
+    ASSERT_EQ(d_bj->get_num_blocks(), num_blocks);
+    // the block pointer arrays are allocated for the worst case
+    const auto ptrs = bj->get_parameters().block_pointers.get_const_data();
+    gko::array<gko::int32> d_ptrs{ref, d_bj->get_parameters().block_pointers};
+    for (gko::size_type i = 0; i <= num_blocks; ++i) {
+        ASSERT_EQ(d_ptrs.get_const_data()[i], ptrs[i]);
+    }
+    GKO_ASSERT_MTX_NEAR(d_bj, bj, 1e-13);
+}
+
+
+#ifdef GKO_COMPILING_OMP
+
+
+TEST_F(Jacobi, GenerateInsideParallelRegionEquivalentToRef)
+{
+    // 2x2 blocks, so the runs of rows with the same pattern cross the
+    // boundaries of the row chunks
+    gko::matrix_data<double, int> data{gko::dim<2>{4000}};
+    for (int block = 0; block < 4000; block += 2) {
+        for (int row = block; row < block + 2; ++row) {
+            for (int col = block; col < block + 2; ++col) {
+                data.nonzeros.emplace_back(row, col, row == col ? 4.0 : 1.0);
+            }
+        }
+    }
+    auto mtx = share(Mtx::create(ref));
+    mtx->read(data);
+    const auto max_active_levels = omp_get_max_active_levels();
+    // the nested team consists of a single thread only
+    omp_set_max_active_levels(1);
+
+    auto bj = Bj::build().with_max_block_size(8u).on(ref)->generate(mtx);
+    std::unique_ptr<Bj> d_bj;
+#pragma omp parallel num_threads(2)
+    {
+#pragma omp single
+        d_bj = Bj::build().with_max_block_size(8u).on(exec)->generate(mtx);
+    }
+
+    omp_set_max_active_levels(max_active_levels);
+    ASSERT_EQ(d_bj->get_num_blocks(), bj->get_num_blocks());
+    GKO_ASSERT_MTX_NEAR(d_bj, bj, 1e-13);
+}
+
+
+#endif  // GKO_COMPILING_OMP
+
+
+TEST_F(Jacobi, PreconditionerEquivalentToRefWithUniformBlockSize)
+{
+    std::vector<gko::int32> block_ptrs(251);
+    for (int i = 0; i < block_ptrs.size(); ++i) {
+        block_ptrs[i] = 4 * i;
+    }
+    const auto dim = block_ptrs.back();
+    std::default_random_engine engine(42);
+    mtx = gko::test::generate_random_matrix<Mtx>(
+        dim, dim, std::uniform_int_distribution<>(10, 20),
+        std::normal_distribution<>(0.0, 1.0), engine, ref);
+    gko::array<gko::int32> ptrs{ref, block_ptrs.begin(), block_ptrs.end()};
+    b = gko::test::generate_random_matrix<Vec>(
+        dim, 1, std::uniform_int_distribution<>(1, 1),
+        std::normal_distribution<>(0.0, 1.0), engine, ref);
+    d_b = gko::clone(exec, b);
+    x = Vec::create(ref, gko::dim<2>{static_cast<gko::size_type>(dim), 1});
+    d_x = Vec::create(exec, x->get_size());
+
+    auto bj = Bj::build()
+                  .with_max_block_size(4u)
+                  .with_block_pointers(ptrs)
+                  .on(ref)
+                  ->generate(mtx);
+    auto d_bj = Bj::build()
+                    .with_max_block_size(4u)
+                    .with_block_pointers(ptrs)
+                    .on(exec)
+                    ->generate(mtx);
+    bj->apply(b, x);
+    d_bj->apply(d_b, d_x);
+
+    GKO_ASSERT_MTX_NEAR(d_bj, bj, 1e-13);
+    GKO_ASSERT_MTX_NEAR(d_x, x, 1e-12);
+}
+
+
 TEST_F(Jacobi, PreconditionerEquivalentToRefWithBlockSize32Sorted)
 {
     initialize_data({0, 32, 64, 96, 128}, {}, {}, 32, 100, 110);
@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/matrix/csr.hpp>
+#include <ginkgo/core/reorder/gray_code.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "matrices/config.hpp"
+#include "test/utils/executor.hpp"
+
+
+template <typename IndexType>
+class GrayCode : public CommonTestFixture {
+protected:
+    using index_type = IndexType;
+    using matrix_type = gko::matrix::Csr<value_type, index_type>;
+    using reorder_type = gko::experimental::reorder::GrayCode<index_type>;
+
+    GrayCode()
+    {
+        std::ifstream stream{gko::matrices::location_ani4_mtx};
+        mtx = gko::read<matrix_type>(stream, ref);
+        dmtx = gko::clone(exec, mtx);
+    }
+
+    void assert_equivalent_to_ref(gko::size_type num_column_blocks)
+    {
+        auto factory = reorder_type::build()
+                           .with_num_column_blocks(num_column_blocks)
+                           .on(ref);
+        auto dfactory = reorder_type::build()
+                            .with_num_column_blocks(num_column_blocks)
+                            .on(exec);
+
+        auto perm = factory->generate(mtx);
+        auto dperm = dfactory->generate(dmtx);
+
+        auto perm_array = gko::make_array_view(ref, mtx->get_size()[0],
+                                               perm->get_permutation());
+        auto dperm_array = gko::make_array_view(exec, mtx->get_size()[0],
+                                                dperm->get_permutation());
+        GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+    }
+
+    std::shared_ptr<matrix_type> mtx;
+    std::shared_ptr<matrix_type> dmtx;
+};
+
+TYPED_TEST_SUITE(GrayCode, gko::test::IndexTypes, TypenameNameGenerator);
+
+
+TYPED_TEST(GrayCode, IsEquivalentToRef)
+{
+    this->assert_equivalent_to_ref(64);
+}
+
+
+TYPED_TEST(GrayCode, IsEquivalentToRefWithFewColumnBlocks)
+{
+    // few blocks lead to many rows with equal signatures
+    this->assert_equivalent_to_ref(3);
+}
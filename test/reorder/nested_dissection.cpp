@@ -57,3 +57,29 @@ TYPED_TEST(NestedDissection, ResultIsEquivalentToRef)
         this->exec, this->mtx->get_size()[0], dperm->get_permutation());
     GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
 }
+
+
+TYPED_TEST(NestedDissection, NativeResultIsEquivalentToRef)
+{
+    using matrix_type = typename TestFixture::matrix_type;
+    using reorder_type = typename TestFixture::reorder_type;
+    const auto algorithm = gko::experimental::reorder::nd_algorithm::native;
+    // use a larger matrix to exercise the recursive dissection
+    std::ifstream stream{gko::matrices::location_ani4_mtx};
+    this->mtx = gko::read<matrix_type>(stream, this->ref);
+    this->dmtx = gko::clone(this->exec, this->mtx);
+    auto perm = reorder_type::build()
+                    .with_algorithm(algorithm)
+                    .on(this->ref)
+                    ->generate(this->mtx);
+    auto dperm = reorder_type::build()
+                     .with_algorithm(algorithm)
+                     .on(this->exec)
+                     ->generate(this->dmtx);
+
+    auto perm_array = gko::make_array_view(this->ref, this->mtx->get_size()[0],
+                                           perm->get_permutation());
+    auto dperm_array = gko::make_array_view(
+        this->exec, this->mtx->get_size()[0], dperm->get_permutation());
+    GKO_ASSERT_ARRAY_EQ(perm_array, dperm_array);
+}
@@ -0,0 +1,112 @@
+// SPDX-FileCopyrightText: 2017 - 2024 The Ginkgo authors
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include <memory>
+#include <random>
+
+
+#include <gtest/gtest.h>
+
+
+#include <ginkgo/core/base/executor.hpp>
+#include <ginkgo/core/matrix/dense.hpp>
+#include <ginkgo/core/matrix/fbcsr.hpp>
+#include <ginkgo/core/solver/block_triangular.hpp>
+
+
+#include "core/test/utils.hpp"
+#include "core/test/utils/fb_matrix_generator.hpp"
+#include "test/utils/executor.hpp"
+
+
+class BlockTriangular : public CommonTestFixture {
+protected:
+    using Mtx = gko::matrix::Fbcsr<value_type, index_type>;
+    using Vec = gko::matrix::Dense<value_type>;
+    using LowerSolver = gko::solver::BlockLowerTrs<value_type, index_type>;
+    using UpperSolver = gko::solver::BlockUpperTrs<value_type, index_type>;
+
+    BlockTriangular() : rand_engine(30) {}
+
+    void initialize_data(int block_size, int num_rhs)
+    {
+        const index_type num_block_rows = 60;
+        mtx = gko::test::generate_random_fbcsr<value_type, index_type>(
+            ref, num_block_rows, num_block_rows, block_size, true, false,
+            rand_engine);
+        b = gko::test::generate_random_matrix<Vec>(
+            mtx->get_size()[0], num_rhs,
+            std::uniform_int_distribution<>(num_rhs, num_rhs),
+            std::normal_distribution<>(-1.0, 1.0), rand_engine, ref);
+        x = Vec::create(ref, b->get_size());
+        dmtx = gko::clone(exec, mtx);
+        db = gko::clone(exec, b);
+        dx = Vec::create(exec, b->get_size());
+    }
+
+    std::shared_ptr<Mtx> mtx;
+    std::shared_ptr<Vec> b;
+    std::shared_ptr<Vec> x;
+    std::shared_ptr<Mtx> dmtx;
+    std::shared_ptr<Vec> db;
+    std::shared_ptr<Vec> dx;
+    std::default_random_engine rand_engine;
+};
+
+
+TEST_F(BlockTriangular, LowerApplyIsEquivalentToRef)
+{
+    for (int block_size : {1, 2, 3, 4, 5, 6, 7, 8, 9}) {
+        SCOPED_TRACE(block_size);
+        for (int num_rhs : {1, 3}) {
+            initialize_data(block_size, num_rhs);
+            auto solver = LowerSolver::build().on(ref)->generate(mtx);
+            auto dsolver = LowerSolver::build().on(exec)->generate(dmtx);
+
+            solver->apply(b, x);
+            dsolver->apply(db, dx);
+
+            GKO_ASSERT_MTX_NEAR(dx, x, 10 * r<value_type>::value);
+        }
+    }
+}
+
+
+TEST_F(BlockTriangular, UpperApplyIsEquivalentToRef)
+{
+    for (int block_size : {1, 2, 3, 4, 5, 6, 7, 8, 9}) {
+        SCOPED_TRACE(block_size);
+        for (int num_rhs : {1, 3}) {
+            initialize_data(block_size, num_rhs);
+            auto solver = UpperSolver::build().on(ref)->generate(mtx);
+            auto dsolver = UpperSolver::build().on(exec)->generate(dmtx);
+
+            solver->apply(b, x);
+            dsolver->apply(db, dx);
+
+            GKO_ASSERT_MTX_NEAR(dx, x, 10 * r<value_type>::value);
+        }
+    }
+}
+
+
+TEST_F(BlockTriangular, UnitDiagonalApplyIsEquivalentToRef)
+{
+    initialize_data(4, 3);
+    auto lower_solver =
+        LowerSolver::build().with_unit_diagonal(true).on(ref)->generate(mtx);
+    auto dlower_solver =
+        LowerSolver::build().with_unit_diagonal(true).on(exec)->generate(dmtx);
+    auto upper_solver =
+        UpperSolver::build().with_unit_diagonal(true).on(ref)->generate(mtx);
+    auto dupper_solver =
+        UpperSolver::build().with_unit_diagonal(true).on(exec)->generate(dmtx);
+
+    lower_solver->apply(b, x);
+    dlower_solver->apply(db, dx);
+    GKO_ASSERT_MTX_NEAR(dx, x, 10 * r<value_type>::value);
+    upper_solver->apply(b, x);
+    dupper_solver->apply(db, dx);
+    GKO_ASSERT_MTX_NEAR(dx, x, 10 * r<value_type>::value);
+}